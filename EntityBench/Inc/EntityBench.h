@@ -0,0 +1,401 @@
+#pragma once
+
+#include <cstdint>
+#include <thread>
+
+#include "BenchModule.h"
+#include "Mat4x4.h"
+#include "Transform.h"
+
+#include "ArchetypeWorld.h"
+#include "IEntity.h"
+
+
+/**
+ * @brief ġũ ϰ ϴ  ƼƼԴϴ.
+ *
+ * @note ƼƼ Ŵ 븸 ϵ Tick, Render, Release ƹ͵  ʽϴ.
+ */
+class BenchEntity : public IEntity
+{
+public:
+	/**
+	 * @brief  ƼƼ Դϴ.
+	 *
+	 * @param value ƼƼ  Դϴ.
+	 */
+	explicit BenchEntity(float value) : value_(value) { bIsInitialized_ = true; }
+
+
+	/**
+	 * @brief  ƼƼ  ҸԴϴ.
+	 */
+	virtual ~BenchEntity() {}
+
+
+	/**
+	 * @brief  ƼƼ  ڿ  ڸ  մϴ.
+	 */
+	DISALLOW_COPY_AND_ASSIGN(BenchEntity);
+
+
+	/**
+	 * @brief  Ÿ ð մϴ.
+	 */
+	virtual void Tick(float deltaSeconds) override { value_ += deltaSeconds; }
+
+
+	/**
+	 * @brief ƹ͵  ʽϴ.
+	 */
+	virtual void Render(RenderQueue*) override {}
+
+
+	/**
+	 * @brief ʱȭ ¸ մϴ.
+	 */
+	virtual void Release() override { bIsInitialized_ = false; }
+
+
+	/**
+	 * @brief ƼƼ  ϴ.
+	 */
+	float GetValue() const { return value_; }
+
+
+private:
+	/**
+	 * @brief ƼƼ Դϴ.
+	 */
+	float value_ = 0.0f;
+};
+
+
+/**
+ * @brief ŰŸ    Ϳ  IEntity   ƼƼԴϴ.
+ *
+ * @note ŰŸ  ϱ , ƼƼ  Ҵǰ  Tick ŵ˴ϴ.
+ */
+class BenchSphere : public IEntity
+{
+public:
+	/**
+	 * @brief  ƼƼ Դϴ.
+	 *
+	 * @param transform  ƮԴϴ.
+	 * @param axis  ȸ Դϴ.
+	 * @param radiansPerSecond ʴ ȸ  Դϴ.
+	 */
+	BenchSphere(const Transform& transform, const Vec3f& axis, float radiansPerSecond);
+
+
+	/**
+	 * @brief  ƼƼ  ҸԴϴ.
+	 */
+	virtual ~BenchSphere() {}
+
+
+	/**
+	 * @brief  ƼƼ  ڿ  ڸ  մϴ.
+	 */
+	DISALLOW_COPY_AND_ASSIGN(BenchSphere);
+
+
+	/**
+	 * @brief ȸ,  ,   ʷ մϴ.
+	 */
+	virtual void Tick(float deltaSeconds) override;
+
+
+	/**
+	 * @brief ƹ͵  ʽϴ.
+	 */
+	virtual void Render(RenderQueue*) override {}
+
+
+	/**
+	 * @brief ʱȭ ¸ մϴ.
+	 */
+	virtual void Release() override { bIsInitialized_ = false; }
+
+
+	/**
+	 * @brief      ϴ.
+	 */
+	virtual bool GetBoundingSphere(Vec3f& outCenter, float& outRadius) const override;
+
+
+	/**
+	 * @brief    ϴ.
+	 */
+	const Mat4x4& GetWorld() const { return world_; }
+
+
+private:
+	/**
+	 * @brief  ƮԴϴ.
+	 */
+	Transform transform_;
+
+
+	/**
+	 * @brief  ȸ Դϴ.
+	 */
+	Vec3f axis_;
+
+
+	/**
+	 * @brief ʴ ȸ  Դϴ.
+	 */
+	float radiansPerSecond_ = 0.0f;
+
+
+	/**
+	 * @brief  ȸ  Դϴ.
+	 */
+	float radian_ = 0.0f;
+
+
+	/**
+	 * @brief Ʈ   Դϴ.
+	 */
+	Mat4x4 world_;
+
+
+	/**
+	 * @brief     ߽Դϴ.
+	 */
+	Vec3f boundCenter_;
+
+
+	/**
+	 * @brief     Դϴ.
+	 */
+	float boundRadius_ = 0.0f;
+};
+
+
+/**
+ * @brief ƽ ٷ ġũ ϴ, ڽ ŰŸ 忡   ƼƼԴϴ.
+ *
+ * @note  ͷ ī޶  ð  Ƿ, ð   ýۺ ߿ Ǿ մϴ.
+ */
+class BenchSphereGroup : public IEntity
+{
+public:
+	/**
+	 * @brief   ƼƼ Դϴ.
+	 *
+	 * @param seed    õԴϴ.
+	 * @param count   Դϴ.
+	 * @param timeScale Ÿ ð  ð Դϴ. ٸ Tick   մϴ.
+	 */
+	BenchSphereGroup(uint32_t seed, uint32_t count, const float* timeScale);
+
+
+	/**
+	 * @brief   ƼƼ  ҸԴϴ.
+	 */
+	virtual ~BenchSphereGroup() {}
+
+
+	/**
+	 * @brief   ƼƼ  ڿ  ڸ  մϴ.
+	 */
+	DISALLOW_COPY_AND_ASSIGN(BenchSphereGroup);
+
+
+	/**
+	 * @brief ð   Ÿ ð ŰŸ ý մϴ.
+	 */
+	virtual void Tick(float deltaSeconds) override;
+
+
+	/**
+	 * @brief ð  ī޶ ڸ ΰ нϴ.
+	 */
+	virtual void GetTickAccess(TickAccess& outAccess) const override { outAccess.Read(ETickResource::CAMERA); }
+
+
+	/**
+	 * @brief ƹ͵  ʽϴ.
+	 */
+	virtual void Render(RenderQueue*) override {}
+
+
+	/**
+	 * @brief ʱȭ ¸ մϴ.
+	 */
+	virtual void Release() override { bIsInitialized_ = false; }
+
+
+	/**
+	 * @brief   ŰŸ 带 ϴ.
+	 */
+	ArchetypeWorld& GetWorld() { return world_; }
+
+
+private:
+	/**
+	 * @brief   ŰŸ Դϴ.
+	 */
+	ArchetypeWorld world_;
+
+
+	/**
+	 * @brief Ÿ ð  ð Դϴ.
+	 */
+	const float* timeScale_ = nullptr;
+};
+
+
+/**
+ * @brief ƽ ٷ  ϴ,   ͸ а  ƼƼԴϴ.
+ *
+ * @note  ͸  ϳ ΰ, д  ڽ     ڽ  ϴ. 浹ϴ Tick   ٲ  ޶ϴ.
+ */
+class BenchTickNode : public IEntity
+{
+public:
+	/**
+	 * @brief   Դϴ.   Ʈ ũ Ʈ  ϴ.
+	 */
+	static const uint32_t RESOURCE_COUNT = 32;
+
+
+public:
+	/**
+	 * @brief ƽ  ƼƼ Դϴ.
+	 *
+	 * @param seed ƼƼ  ʱⰪԴϴ.
+	 * @param resourceValues  ͺ  迭Դϴ. RESOURCE_COUNT  ־ մϴ.
+	 */
+	BenchTickNode(uint64_t seed, uint64_t* resourceValues) : value_(seed), resourceValues_(resourceValues) { bIsInitialized_ = true; }
+
+
+	/**
+	 * @brief ƽ  ƼƼ  ҸԴϴ.
+	 */
+	virtual ~BenchTickNode() {}
+
+
+	/**
+	 * @brief ƽ  ƼƼ  ڿ  ڸ  մϴ.
+	 */
+	DISALLOW_COPY_AND_ASSIGN(BenchTickNode);
+
+
+	/**
+	 * @brief д    ,  纸    Ϳ  ϴ.
+	 */
+	virtual void Tick(float deltaSeconds) override;
+
+
+	/**
+	 * @brief   ͸ ϴ.
+	 */
+	virtual void GetTickAccess(TickAccess& outAccess) const override { outAccess = access_; }
+
+
+	/**
+	 * @brief ƹ͵  ʽϴ.
+	 */
+	virtual void Render(RenderQueue*) override {}
+
+
+	/**
+	 * @brief ʱȭ ¸ մϴ.
+	 */
+	virtual void Release() override { bIsInitialized_ = false; }
+
+
+	/**
+	 * @brief Tick а   ͸ մϴ. ƽ ٷ  Tick  ׷ ٽ ϴ.
+	 */
+	void SetTickAccess(const TickAccess& access) { access_ = access; }
+
+
+	/**
+	 * @brief ƼƼ  ϴ.
+	 */
+	uint64_t GetValue() const { return value_; }
+
+
+	/**
+	 * @brief  Tick   ID ϴ.
+	 */
+	std::thread::id GetTickThreadID() const { return tickThreadID_; }
+
+
+private:
+	/**
+	 * @brief Tick а   Դϴ.
+	 */
+	TickAccess access_;
+
+
+	/**
+	 * @brief ƼƼ Դϴ.
+	 */
+	uint64_t value_ = 0;
+
+
+	/**
+	 * @brief  ͺ  迭Դϴ.
+	 */
+	uint64_t* resourceValues_ = nullptr;
+
+
+	/**
+	 * @brief  Tick   IDԴϴ.
+	 */
+	std::thread::id tickThreadID_;
+};
+
+
+/**
+ * @brief ƼƼ Ŵ    ID   մϴ.
+ */
+void PrintEntityManagerCounters();
+
+
+/**
+ * @brief ƼƼ Ŵ / ݺ(churn) ȸ ġũ մϴ.
+ */
+void RegisterEntityManagerBenchmarks();
+
+
+/**
+ * @brief ŰŸ  ûũ  ø  մϴ.
+ */
+void PrintArchetypeCounters();
+
+
+/**
+ * @brief ŰŸ  IEntity (Tick),   ġũ մϴ.
+ */
+void RegisterArchetypeBenchmarks();
+
+
+/**
+ * @brief ƽ ٷ  ׷,    , ƼƼ Tick ð մϴ.
+ */
+void PrintTickSchedulerCounters();
+
+
+/**
+ * @brief  ƼƼ   ƽ ٷ ϴ ġũ մϴ.
+ */
+void RegisterTickSchedulerBenchmarks();
+
+
+/**
+ * @brief   ͸  ƼƼ ý ƽ ٷ ݺؼ ϰ,    մϴ.
+ *
+ * @return   ٸ 0, ׷  1 ȯմϴ.
+ *
+ * @note
+ * - --verify ڷ ϸ ġũ    մϴ.
+ * - Ӹ Ϻ ƼƼ  ͸ ٲ㼭  ׷ ٽ  ,   Tick ȣ 忡 Ǵ Ȯմϴ.
+ */
+int32_t RunVerify();
\ No newline at end of file
@@ -0,0 +1,186 @@
+#include <cstdio>
+#include <vector>
+
+#include "Frustum.h"
+#include "RandomStream.h"
+
+#include "ArchetypeSystems.h"
+#include "ArchetypeWorld.h"
+#include "EntityManager.h"
+
+#include "EntityBench.h"
+
+/**
+ * @brief Ű   ġũ ϴ  Դϴ.
+ */
+static const uint32_t BENCH_SPHERE_COUNT = 100000;
+
+/**
+ * @brief  ġũ Ÿ ðԴϴ.
+ */
+static const float BENCH_DELTA_SECONDS = 1.0f / 60.0f;
+
+/**
+ * @brief Ű   ġũ ϴ  üԴϴ.
+ *
+ * @note     õ   Ƿ,     ƾ մϴ.
+ */
+static ArchetypeWorld* world = nullptr;
+static std::vector<IEntity*> sphereEntities;
+static std::vector<RenderItem> renderItems;
+static std::vector<const Mat4x4*> entityRenderItems;
+static Frustum frustum;
+
+BenchSphere::BenchSphere(const Transform& transform, const Vec3f& axis, float radiansPerSecond)
+	: transform_(transform)
+	, axis_(axis)
+	, radiansPerSecond_(radiansPerSecond)
+{
+	bIsInitialized_ = true;
+}
+
+void BenchSphere::Tick(float deltaSeconds)
+{
+	radian_ = MathModule::Fmod(radian_ + radiansPerSecond_ * deltaSeconds, TwoPi);
+	transform_.rotate = Quat::AxisRadian(axis_, radian_);
+
+	world_ = Transform::ToMat(transform_);
+
+	const Vec3f& scale = transform_.scale;
+	boundCenter_ = transform_.position;
+	boundRadius_ = MathModule::Max<float>(MathModule::Abs(scale.x), MathModule::Max<float>(MathModule::Abs(scale.y), MathModule::Abs(scale.z)));
+}
+
+bool BenchSphere::GetBoundingSphere(Vec3f& outCenter, float& outRadius) const
+{
+	outCenter = boundCenter_;
+	outRadius = boundRadius_;
+	return true;
+}
+
+/**
+ * @brief ŰŸ  IEntity   մϴ.
+ */
+static void InitializeSpheres()
+{
+	if (world)
+	{
+		return;
+	}
+
+	world = new ArchetypeWorld();
+	sphereEntities.resize(BENCH_SPHERE_COUNT);
+
+	RandomStream stream(RandomStream::DEFAULT_SEED);
+	for (uint32_t index = 0; index < BENCH_SPHERE_COUNT; ++index)
+	{
+		float scale = stream.NextFloat(0.2f, 1.0f);
+
+		Transform transform;
+		transform.position = Vec3f(stream.NextFloat(-100.0f, 100.0f), stream.NextFloat(-100.0f, 100.0f), stream.NextFloat(-100.0f, 100.0f));
+		transform.scale = Vec3f(scale, scale, scale);
+
+		Vec3f axis = stream.NextUnitVec3();
+		float radiansPerSecond = stream.NextFloat(-Pi, Pi);
+
+		world->Create(transform, WorldMatrix{ Transform::ToMat(transform) }, MeshRef{}, BoundingSphere{ transform.position, scale, 1.0f }, Spin{ axis, radiansPerSecond, 0.0f });
+		sphereEntities[index] = EntityManager::Get().CreateEntity<BenchSphere>(transform, axis, radiansPerSecond);
+	}
+
+	frustum = Frustum(Mat4x4::LookAt(Vec3f(0.0f, 0.0f, 0.0f), Vec3f(0.0f, 0.0f, 1.0f), Vec3f(0.0f, 1.0f, 0.0f)) * Mat4x4::Perspective(PiDiv4, 1.25f, 0.1f, 200.0f));
+
+	renderItems.reserve(BENCH_SPHERE_COUNT);
+	entityRenderItems.reserve(BENCH_SPHERE_COUNT);
+
+	ArchetypeSystems::Tick(*world, BENCH_DELTA_SECONDS);
+	for (IEntity* entity : sphereEntities)
+	{
+		entity->Tick(BENCH_DELTA_SECONDS);
+	}
+}
+
+/**
+ * @brief IEntity   ü ø ϰ, ̴ ƼƼ   ϴ.
+ *
+ * @return ̴ ƼƼ  ȯմϴ.
+ */
+static uint32_t CollectVisibleEntities()
+{
+	entityRenderItems.clear();
+
+	Vec3f center;
+	float radius = 0.0f;
+	for (IEntity* entity : sphereEntities)
+	{
+		if (entity->GetBoundingSphere(center, radius) && frustum.IsIntersectSphere(center, radius))
+		{
+			entityRenderItems.push_back(&reinterpret_cast<BenchSphere*>(entity)->GetWorld());
+		}
+	}
+
+	return static_cast<uint32_t>(entityRenderItems.size());
+}
+
+void PrintArchetypeCounters()
+{
+	InitializeSpheres();
+
+	ComponentMask sphereMask = ArchetypeWorld::GetComponentMask<Transform, WorldMatrix, MeshRef, BoundingSphere, Spin>();
+	uint32_t chunkCapacity = world->GetChunkCapacity(sphereMask);
+
+	std::printf("Archetype world (%u spheres)\n", BENCH_SPHERE_COUNT);
+	std::printf("  %-24s %u\n", "entities", world->GetEntityCount());
+	std::printf("  %-24s %u\n", "archetypes", world->GetArchetypeCount());
+	std::printf("  %-24s %u\n", "chunks", world->GetChunkCount());
+	std::printf("  %-24s %u\n", "entities per chunk", chunkCapacity);
+	std::printf("  %-24s %u\n", "bytes per entity", ArchetypeWorld::CHUNK_BYTES / chunkCapacity);
+	std::printf("  %-24s %u\n", "archetype visible", ArchetypeSystems::CollectVisible(*world, frustum, renderItems));
+	std::printf("  %-24s %u\n", "IEntity visible", CollectVisibleEntities());
+	std::printf("\n");
+}
+
+void RegisterArchetypeBenchmarks()
+{
+	InitializeSpheres();
+
+	BenchModule::Register("Archetype/Tick100k", [](uint64_t iterations)
+		{
+			for (uint64_t iteration = 0; iteration < iterations; ++iteration)
+			{
+				ArchetypeSystems::Tick(*world, BENCH_DELTA_SECONDS);
+				BenchModule::ClobberMemory();
+			}
+		}, BENCH_SPHERE_COUNT
+	);
+
+	BenchModule::Register("Archetype/CollectVisible100k", [](uint64_t iterations)
+		{
+			for (uint64_t iteration = 0; iteration < iterations; ++iteration)
+			{
+				BenchModule::DoNotOptimize(ArchetypeSystems::CollectVisible(*world, frustum, renderItems));
+			}
+		}, BENCH_SPHERE_COUNT
+	);
+
+	BenchModule::Register("IEntity/Tick100k", [](uint64_t iterations)
+		{
+			for (uint64_t iteration = 0; iteration < iterations; ++iteration)
+			{
+				for (IEntity* entity : sphereEntities)
+				{
+					entity->Tick(BENCH_DELTA_SECONDS);
+				}
+				BenchModule::ClobberMemory();
+			}
+		}, BENCH_SPHERE_COUNT
+	);
+
+	BenchModule::Register("IEntity/CollectVisible100k", [](uint64_t iterations)
+		{
+			for (uint64_t iteration = 0; iteration < iterations; ++iteration)
+			{
+				BenchModule::DoNotOptimize(CollectVisibleEntities());
+			}
+		}, BENCH_SPHERE_COUNT
+	);
+}
\ No newline at end of file
@@ -0,0 +1,100 @@
+#include <cstdio>
+#include <vector>
+
+#include "EntityManager.h"
+
+#include "EntityBench.h"
+
+/**
+ * @brief / ݺ ġũ ׻ ִ ƼƼ Դϴ. 2 ŵ̾ մϴ.
+ */
+static const uint32_t BENCH_LIVE_ENTITY_COUNT = 65536;
+
+/**
+ * @brief   ϰ ϴ ƼƼ Դϴ.
+ */
+static const uint32_t BENCH_BATCH_ENTITY_COUNT = 1024;
+
+/**
+ * @brief / ݺ ġũ ִ ƼƼ IDԴϴ.
+ */
+static std::vector<EntityID> liveIDs;
+
+void PrintEntityManagerCounters()
+{
+	EntityManager& manager = EntityManager::Get();
+
+	EntityID staleID = manager.CreateID<BenchEntity>(1.0f);
+	manager.Destroy(staleID);
+
+	EntityID reusedID = manager.CreateID<BenchEntity>(2.0f);
+	bool bIsSlotReused = (reusedID & (EntityManager::MAX_ENTITY_COUNT - 1)) == (staleID & (EntityManager::MAX_ENTITY_COUNT - 1));
+	bool bIsStaleDetected = !manager.IsValid(staleID) && manager.GetEntity<BenchEntity>(staleID) == nullptr;
+
+	manager.Destroy(staleID);
+	bool bIsReusedAlive = manager.IsValid(reusedID);
+	manager.Destroy(reusedID);
+
+	std::printf("Entity manager slot map\n");
+	std::printf("  %-24s %s\n", "slot reused", bIsSlotReused ? "yes" : "no");
+	std::printf("  %-24s %s\n", "stale id detected", bIsStaleDetected ? "yes" : "no");
+	std::printf("  %-24s %s\n", "stale destroy ignored", bIsReusedAlive ? "yes" : "no");
+	std::printf("  %-24s %u\n", "live entities", manager.GetEntityCount());
+	std::printf("  %-24s %u\n", "slots", manager.GetSlotCount());
+	std::printf("\n");
+}
+
+void RegisterEntityManagerBenchmarks()
+{
+	EntityManager& manager = EntityManager::Get();
+
+	liveIDs.resize(BENCH_LIVE_ENTITY_COUNT);
+	for (uint32_t index = 0; index < BENCH_LIVE_ENTITY_COUNT; ++index)
+	{
+		liveIDs[index] = manager.CreateID<BenchEntity>(static_cast<float>(index));
+	}
+
+	BenchModule::Register("EntityManager/Churn", [](uint64_t iterations)
+		{
+			EntityManager& manager = EntityManager::Get();
+			for (uint64_t iteration = 0; iteration < iterations; ++iteration)
+			{
+				EntityID& entityID = liveIDs[(iteration * 7919) & (BENCH_LIVE_ENTITY_COUNT - 1)];
+				manager.Destroy(entityID);
+				entityID = manager.CreateID<BenchEntity>(static_cast<float>(iteration));
+			}
+		}
+	);
+
+	BenchModule::Register("EntityManager/CreateDestroyBatch", [](uint64_t iterations)
+		{
+			EntityManager& manager = EntityManager::Get();
+			EntityID batchIDs[BENCH_BATCH_ENTITY_COUNT];
+
+			for (uint64_t iteration = 0; iteration < iterations; ++iteration)
+			{
+				for (uint32_t index = 0; index < BENCH_BATCH_ENTITY_COUNT; ++index)
+				{
+					batchIDs[index] = manager.CreateID<BenchEntity>(static_cast<float>(index));
+				}
+
+				for (uint32_t index = 0; index < BENCH_BATCH_ENTITY_COUNT; ++index)
+				{
+					manager.Destroy(batchIDs[index]);
+				}
+			}
+		},
+		BENCH_BATCH_ENTITY_COUNT
+	);
+
+	BenchModule::Register("EntityManager/GetEntity", [](uint64_t iterations)
+		{
+			EntityManager& manager = EntityManager::Get();
+			for (uint64_t iteration = 0; iteration < iterations; ++iteration)
+			{
+				EntityID entityID = liveIDs[(iteration * 7919) & (BENCH_LIVE_ENTITY_COUNT - 1)];
+				BenchModule::DoNotOptimize(manager.GetEntity<BenchEntity>(entityID));
+			}
+		}
+	);
+}
\ No newline at end of file
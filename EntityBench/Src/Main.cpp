@@ -0,0 +1,35 @@
+#include <cstdint>
+#include <cstring>
+
+#include "EntityManager.h"
+#include "JobModule.h"
+
+#include "EntityBench.h"
+
+int32_t main(int32_t argc, char* argv[])
+{
+	for (int32_t index = 1; index < argc; ++index)
+	{
+		if (std::strcmp(argv[index], "--verify") == 0)
+		{
+			return RunVerify();
+		}
+	}
+
+	EntityManager::Get().Startup();
+	JobModule::Init();
+
+	PrintEntityManagerCounters();
+	PrintArchetypeCounters();
+	PrintTickSchedulerCounters();
+
+	RegisterEntityManagerBenchmarks();
+	RegisterArchetypeBenchmarks();
+	RegisterTickSchedulerBenchmarks();
+
+	int32_t result = BenchModule::Main(argc, argv);
+
+	JobModule::Uninit();
+	EntityManager::Get().Shutdown();
+	return result;
+}
\ No newline at end of file
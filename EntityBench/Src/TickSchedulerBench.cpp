@@ -0,0 +1,214 @@
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "RandomStream.h"
+
+#include "ArchetypeSystems.h"
+#include "EntityManager.h"
+#include "TickScheduler.h"
+
+#include "EntityBench.h"
+
+/**
+ * @brief ƽ ٷ ġũ ϴ   ƼƼ Դϴ.
+ */
+static const uint32_t BENCH_GROUP_COUNT = 8;
+
+/**
+ * @brief   ƼƼ ϳ   Դϴ.
+ */
+static const uint32_t BENCH_GROUP_SPHERE_COUNT = 12500;
+
+/**
+ * @brief      ϴ  Դϴ.
+ */
+static const uint32_t BENCH_VERIFY_FRAME_COUNT = 60;
+
+/**
+ * @brief ƽ ٷ ġũ Ÿ ðԴϴ.
+ */
+static const float BENCH_TICK_DELTA_SECONDS = 1.0f / 60.0f;
+
+/**
+ * @brief ƽ ٷ ϳ  ٷ  ƼƼԴϴ.
+ *
+ * @note ð   ý,   ƼƼ, ð  д   ý  մϴ.
+ */
+struct BenchTickScene
+{
+	TickScheduler scheduler;
+	std::vector<BenchSphereGroup*> groups;
+	float timeScale = 1.0f;
+	float elapsedSeconds = 0.0f;
+	float timeScaleSum = 0.0f;
+};
+
+/**
+ * @brief   ƽ ٷ  Դϴ.  õ   մϴ.
+ */
+static BenchTickScene* serialScene = nullptr;
+static BenchTickScene* parallelScene = nullptr;
+
+BenchSphereGroup::BenchSphereGroup(uint32_t seed, uint32_t count, const float* timeScale)
+	: timeScale_(timeScale)
+{
+	RandomStream stream(seed);
+	for (uint32_t index = 0; index < count; ++index)
+	{
+		float scale = stream.NextFloat(0.2f, 1.0f);
+
+		Transform transform;
+		transform.position = Vec3f(stream.NextFloat(-100.0f, 100.0f), stream.NextFloat(-100.0f, 100.0f), stream.NextFloat(-100.0f, 100.0f));
+		transform.scale = Vec3f(scale, scale, scale);
+
+		world_.Create(transform, WorldMatrix{ Transform::ToMat(transform) }, MeshRef{}, BoundingSphere{ transform.position, scale, 1.0f }, Spin{ stream.NextUnitVec3(), stream.NextFloat(-Pi, Pi), 0.0f });
+	}
+
+	bIsInitialized_ = true;
+}
+
+void BenchSphereGroup::Tick(float deltaSeconds)
+{
+	ArchetypeSystems::Tick(world_, deltaSeconds * (*timeScale_));
+}
+
+/**
+ * @brief   ƼƼ ý ϰ ƽ ٷ մϴ.
+ */
+static BenchTickScene* CreateScene()
+{
+	BenchTickScene* scene = new BenchTickScene();
+
+	scene->scheduler.AddSystem("TimeScale", TickAccess().Write(ETickResource::CAMERA), [scene](float deltaSeconds)
+		{
+			scene->elapsedSeconds += deltaSeconds;
+			scene->timeScale = 1.0f + 0.5f * MathModule::Sin(scene->elapsedSeconds);
+		}
+	);
+
+	for (uint32_t index = 0; index < BENCH_GROUP_COUNT; ++index)
+	{
+		BenchSphereGroup* group = EntityManager::Get().CreateEntity<BenchSphereGroup>(RandomStream::DEFAULT_SEED + index, BENCH_GROUP_SPHERE_COUNT, &scene->timeScale);
+		scene->groups.push_back(group);
+
+		char name[32];
+		std::snprintf(name, sizeof(name), "SphereGroup%u", index);
+		scene->scheduler.AddEntity(name, group);
+	}
+
+	TickAccess mainThreadAccess;
+	mainThreadAccess.Read(ETickResource::CAMERA);
+	mainThreadAccess.bIsMainThread = true;
+	scene->scheduler.AddSystem("TimeScaleSum", mainThreadAccess, [scene](float) { scene->timeScaleSum += scene->timeScale; });
+
+	return scene;
+}
+
+/**
+ * @brief     Ʈ   Ȯմϴ.
+ */
+static bool IsSameWorldMatrices(BenchTickScene* lhs, BenchTickScene* rhs)
+{
+	for (uint32_t index = 0; index < BENCH_GROUP_COUNT; ++index)
+	{
+		std::vector<Mat4x4> lhsMatrices;
+		std::vector<Mat4x4> rhsMatrices;
+
+		auto collect = [](BenchSphereGroup* group, std::vector<Mat4x4>& outMatrices)
+			{
+				group->GetWorld().ForEachChunk<WorldMatrix>(
+					[&](uint32_t count, WorldMatrix* worldMatrices)
+					{
+						for (uint32_t row = 0; row < count; ++row)
+						{
+							outMatrices.push_back(worldMatrices[row].world);
+						}
+					}
+				);
+			};
+
+		collect(lhs->groups[index], lhsMatrices);
+		collect(rhs->groups[index], rhsMatrices);
+
+		if (lhsMatrices.size() != rhsMatrices.size() || std::memcmp(lhsMatrices.data(), rhsMatrices.data(), lhsMatrices.size() * sizeof(Mat4x4)) != 0)
+		{
+			return false;
+		}
+	}
+
+	return lhs->timeScaleSum == rhs->timeScaleSum;
+}
+
+/**
+ * @brief   ƽ ٷ   մϴ.
+ */
+static void InitializeScenes()
+{
+	if (serialScene)
+	{
+		return;
+	}
+
+	serialScene = CreateScene();
+	parallelScene = CreateScene();
+}
+
+void PrintTickSchedulerCounters()
+{
+	InitializeScenes();
+
+	for (uint32_t frame = 0; frame < BENCH_VERIFY_FRAME_COUNT; ++frame)
+	{
+		serialScene->scheduler.TickSerial(BENCH_TICK_DELTA_SECONDS);
+		parallelScene->scheduler.Tick(BENCH_TICK_DELTA_SECONDS);
+	}
+
+	std::vector<TickScheduler::TickStats> tickStats;
+	parallelScene->scheduler.GetTickStats(tickStats);
+	std::stable_sort(tickStats.begin(), tickStats.end(), [](const TickScheduler::TickStats& lhs, const TickScheduler::TickStats& rhs) { return lhs.averageNanoseconds > rhs.averageNanoseconds; });
+
+	std::printf("Tick scheduler (%u threads, %u x %u spheres)\n", JobModule::GetThreadCount(), BENCH_GROUP_COUNT, BENCH_GROUP_SPHERE_COUNT);
+	std::printf("  %-24s %u\n", "nodes", parallelScene->scheduler.GetNodeCount());
+	std::printf("  %-24s %u\n", "edges", parallelScene->scheduler.GetEdgeCount());
+	std::printf("  %-24s %s\n", "matches serial", IsSameWorldMatrices(serialScene, parallelScene) ? "yes" : "no");
+	std::printf("  %-16s %12s %12s %6s %6s\n", "node (slowest)", "avg (us)", "max (us)", "deps", "main");
+	for (const TickScheduler::TickStats& stats : tickStats)
+	{
+		std::printf(
+			"  %-16s %12.1f %12.1f %6u %6s\n",
+			stats.name.c_str(),
+			static_cast<double>(stats.averageNanoseconds) / 1000.0,
+			static_cast<double>(stats.maxNanoseconds) / 1000.0,
+			stats.dependencyCount,
+			stats.bIsMainThread ? "yes" : "no"
+		);
+	}
+	std::printf("\n");
+}
+
+void RegisterTickSchedulerBenchmarks()
+{
+	InitializeScenes();
+
+	BenchModule::Register("TickScheduler/Serial8x12.5k", [](uint64_t iterations)
+		{
+			for (uint64_t iteration = 0; iteration < iterations; ++iteration)
+			{
+				serialScene->scheduler.TickSerial(BENCH_TICK_DELTA_SECONDS);
+				BenchModule::ClobberMemory();
+			}
+		}, BENCH_GROUP_COUNT * BENCH_GROUP_SPHERE_COUNT
+	);
+
+	BenchModule::Register("TickScheduler/Parallel8x12.5k", [](uint64_t iterations)
+		{
+			for (uint64_t iteration = 0; iteration < iterations; ++iteration)
+			{
+				parallelScene->scheduler.Tick(BENCH_TICK_DELTA_SECONDS);
+				BenchModule::ClobberMemory();
+			}
+		}, BENCH_GROUP_COUNT * BENCH_GROUP_SPHERE_COUNT
+	);
+}
\ No newline at end of file
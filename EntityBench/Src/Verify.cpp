@@ -0,0 +1,250 @@
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "JobModule.h"
+
+#include "EntityManager.h"
+#include "TickScheduler.h"
+
+#include "EntityBench.h"
+
+/**
+ * @brief  ϴ  Դϴ. ϵ     尡 Tick  ϵ մϴ.
+ */
+static const uint32_t VERIFY_THREAD_COUNT = 8;
+
+/**
+ * @brief   ׷   ϴ õԴϴ. и  Է   ֵ մϴ.
+ */
+static const uint32_t VERIFY_TICK_SEED = 0x71C45EED;
+
+/**
+ * @brief  ׷   ϴ ȽԴϴ.
+ */
+static const uint32_t VERIFY_TICK_ROUND_COUNT = 200;
+
+/**
+ * @brief ׷ ϳ ϴ  Դϴ.
+ */
+static const uint32_t VERIFY_TICK_FRAME_COUNT = 8;
+
+/**
+ * @brief ׷ ϳ ϴ ƼƼ ý  ִԴϴ.
+ */
+static const uint32_t VERIFY_TICK_MAX_NODE_COUNT = 48;
+
+/**
+ * @brief  ϴ   Դϴ. 浹  ⵵   Ʈ  Ϻθ մϴ.
+ */
+static const uint32_t VERIFY_TICK_RESOURCE_COUNT = 8;
+
+/**
+ * @brief  Ÿ ðԴϴ.
+ */
+static const float VERIFY_TICK_DELTA_SECONDS = 1.0f / 60.0f;
+
+/**
+ * @brief   ϴ.   ٲ  ޶ϴ.
+ */
+static inline uint64_t Mix(uint64_t lhs, uint64_t rhs)
+{
+	return (lhs ^ rhs) * 1099511628211ULL + 0x9E3779B97F4A7C15ULL;
+}
+
+void BenchTickNode::Tick(float)
+{
+	tickThreadID_ = std::this_thread::get_id();
+
+	uint32_t accessMask = access_.readMask | access_.writeMask;
+	for (uint32_t resource = 0; resource < RESOURCE_COUNT; ++resource)
+	{
+		if (accessMask & (1u << resource))
+		{
+			value_ = Mix(value_, resourceValues_[resource]);
+		}
+	}
+
+	// б  ̿  纸ؼ, ھ ϳ̾ 浹ϴ Tick ÿ Ǹ  ޶ մϴ.
+	std::this_thread::yield();
+
+	for (uint32_t resource = 0; resource < RESOURCE_COUNT; ++resource)
+	{
+		if (access_.writeMask & (1u << resource))
+		{
+			resourceValues_[resource] = Mix(resourceValues_[resource], value_);
+		}
+	}
+}
+
+/**
+ * @brief   ƽ ٷ    Դϴ.
+ */
+struct VerifyTickScene
+{
+	TickScheduler scheduler;
+	std::vector<BenchTickNode*> nodes;
+	uint64_t resourceValues[BenchTickNode::RESOURCE_COUNT] = {};
+};
+
+/**
+ * @brief   ͸ մϴ. б 1/4,  1/8,    1/5 ȮԴϴ.
+ */
+static TickAccess NextAccess(std::mt19937& random)
+{
+	TickAccess access;
+	for (uint32_t resource = 0; resource < VERIFY_TICK_RESOURCE_COUNT; ++resource)
+	{
+		uint32_t roll = std::uniform_int_distribution<uint32_t>(0, 7)(random);
+		if (roll < 2)
+		{
+			access.readMask |= (1u << resource);
+		}
+		else if (roll == 2)
+		{
+			access.writeMask |= (1u << resource);
+		}
+	}
+
+	access.bIsMainThread = std::uniform_int_distribution<uint32_t>(0, 4)(random) == 0;
+	return access;
+}
+
+/**
+ * @brief 帶 ƼƼ ϰ, ý  ƼƼ Tick ȣϴ ý,  ƼƼ մϴ.
+ */
+static void CreateScene(VerifyTickScene& scene, const std::vector<uint64_t>& seeds, const std::vector<TickAccess>& accesses, const std::vector<bool>& bIsSystems)
+{
+	for (uint32_t index = 0; index < seeds.size(); ++index)
+	{
+		BenchTickNode* node = EntityManager::Get().CreateEntity<BenchTickNode>(seeds[index], scene.resourceValues);
+		node->SetTickAccess(accesses[index]);
+		scene.nodes.push_back(node);
+
+		std::string name = "Node" + std::to_string(index);
+		if (bIsSystems[index])
+		{
+			scene.scheduler.AddSystem(name, accesses[index], [node](float deltaSeconds) { node->Tick(deltaSeconds); });
+		}
+		else
+		{
+			scene.scheduler.AddEntity(name, node);
+		}
+	}
+}
+
+/**
+ * @brief  ƼƼ  մϴ.
+ */
+static void DestroyScene(VerifyTickScene& scene)
+{
+	for (BenchTickNode* node : scene.nodes)
+	{
+		EntityManager::Get().Destroy(node);
+	}
+	scene.nodes.clear();
+}
+
+/**
+ * @brief  ׷   ƽ ٷ ϸ  Ϳ ƼƼ  մϴ.
+ *
+ * @note  ̿ ƼƼ  ͸ ٲ㼭  ׷ ٽ  ϰ,   Tick ȣ 忡 Ǿ Ȯմϴ.
+ */
+static bool VerifyTickScheduler()
+{
+	std::mt19937 random(VERIFY_TICK_SEED);
+	std::thread::id mainThreadID = std::this_thread::get_id();
+
+	uint32_t mismatchCount = 0;
+	uint32_t mainThreadViolationCount = 0;
+	for (uint32_t round = 0; round < VERIFY_TICK_ROUND_COUNT; ++round)
+	{
+		uint32_t nodeCount = std::uniform_int_distribution<uint32_t>(1, VERIFY_TICK_MAX_NODE_COUNT)(random);
+
+		std::vector<uint64_t> seeds(nodeCount);
+		std::vector<TickAccess> accesses(nodeCount);
+		std::vector<bool> bIsSystems(nodeCount);
+		for (uint32_t index = 0; index < nodeCount; ++index)
+		{
+			seeds[index] = random();
+			accesses[index] = NextAccess(random);
+			bIsSystems[index] = std::uniform_int_distribution<uint32_t>(0, 3)(random) == 0;
+		}
+
+		VerifyTickScene serialScene;
+		VerifyTickScene parallelScene;
+		CreateScene(serialScene, seeds, accesses, bIsSystems);
+		CreateScene(parallelScene, seeds, accesses, bIsSystems);
+
+		bool bIsMismatch = false;
+		bool bIsMainThreadViolated = false;
+		for (uint32_t frame = 0; frame < VERIFY_TICK_FRAME_COUNT; ++frame)
+		{
+			if (frame > 0)
+			{
+				uint32_t index = std::uniform_int_distribution<uint32_t>(0, nodeCount - 1)(random);
+				if (!bIsSystems[index])
+				{
+					accesses[index] = NextAccess(random);
+					serialScene.nodes[index]->SetTickAccess(accesses[index]);
+					parallelScene.nodes[index]->SetTickAccess(accesses[index]);
+				}
+			}
+
+			serialScene.scheduler.TickSerial(VERIFY_TICK_DELTA_SECONDS);
+			parallelScene.scheduler.Tick(VERIFY_TICK_DELTA_SECONDS);
+
+			if (std::memcmp(serialScene.resourceValues, parallelScene.resourceValues, sizeof(serialScene.resourceValues)) != 0)
+			{
+				bIsMismatch = true;
+			}
+
+			for (uint32_t index = 0; index < nodeCount; ++index)
+			{
+				if (serialScene.nodes[index]->GetValue() != parallelScene.nodes[index]->GetValue())
+				{
+					bIsMismatch = true;
+				}
+
+				if (accesses[index].bIsMainThread && parallelScene.nodes[index]->GetTickThreadID() != mainThreadID)
+				{
+					bIsMainThreadViolated = true;
+				}
+			}
+		}
+
+		DestroyScene(serialScene);
+		DestroyScene(parallelScene);
+
+		mismatchCount += bIsMismatch ? 1 : 0;
+		mainThreadViolationCount += bIsMainThreadViolated ? 1 : 0;
+	}
+
+	std::printf("  %-32s %8u rounds %8u failures\n", "TickScheduler/MatchesSerial", VERIFY_TICK_ROUND_COUNT, mismatchCount);
+	std::printf("  %-32s %8u rounds %8u failures\n", "TickScheduler/MainThread", VERIFY_TICK_ROUND_COUNT, mainThreadViolationCount);
+	return mismatchCount == 0 && mainThreadViolationCount == 0;
+}
+
+int32_t RunVerify()
+{
+	EntityManager::Get().Startup();
+	if (JobModule::Init(VERIFY_THREAD_COUNT) != JobModule::Errors::OK)
+	{
+		std::printf("failed to initialize job module: %s\n", JobModule::GetLastErrorMessage());
+		return -1;
+	}
+
+	std::printf("Verify tick scheduler with %u threads\n", JobModule::GetThreadCount());
+
+	uint32_t failureCount = 0;
+	failureCount += VerifyTickScheduler() ? 0 : 1;
+
+	JobModule::Uninit();
+	EntityManager::Get().Shutdown();
+
+	std::printf("%s (%u failures)\n", failureCount == 0 ? "PASSED" : "FAILED", failureCount);
+	return failureCount == 0 ? 0 : 1;
+}
\ No newline at end of file
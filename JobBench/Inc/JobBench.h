@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "BenchModule.h"
+#include "JobModule.h"
+
+
+/**
+ * @brief       ϴ.
+ *
+ * @note 1 2辿 ø,  ׻ ϵ  Դϴ.   ϵ 尡 6 1, 2, 4, 6Դϴ.
+ */
+const std::vector<uint32_t>& GetBenchThreadCounts();
+
+
+/**
+ * @brief ۾    ־  ٸٸ ٽ ʱȭմϴ.
+ *
+ * @param threadCount ۾   Դϴ.
+ */
+void UseThreads(uint32_t threadCount);
+
+
+/**
+ * @brief ParallelFor ļ ۾  ϰ, 庰 ۾ 踦 մϴ.
+ */
+void PrintJobCounters();
+
+
+/**
+ * @brief   ParallelFor, ۾ , ļ ۾ ġũ մϴ.
+ */
+void RegisterScalingBenchmarks();
+
+
+/**
+ * @brief ۾     ϸ ۾ Ǯ   մϴ.
+ *
+ * @return   ϸ 0, ׷  1 ȯմϴ.
+ *
+ * @note
+ * - --verify ڷ ϸ ġũ    մϴ.
+ * - ParallelFor, ļ ۾, ۾  , ܺ   ⸦  Է ݺؼ,  ۾     Ǵ Ȯմϴ.
+ */
+int32_t RunVerify();
\ No newline at end of file
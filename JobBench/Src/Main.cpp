@@ -0,0 +1,59 @@
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+
+#include "JobBench.h"
+
+const std::vector<uint32_t>& GetBenchThreadCounts()
+{
+	static std::vector<uint32_t> threadCounts;
+	if (threadCounts.empty())
+	{
+		uint32_t maxThreadCount = std::max<uint32_t>(std::thread::hardware_concurrency(), 1);
+		for (uint32_t threadCount = 1; threadCount < maxThreadCount; threadCount *= 2)
+		{
+			threadCounts.push_back(threadCount);
+		}
+		threadCounts.push_back(maxThreadCount);
+	}
+
+	return threadCounts;
+}
+
+void UseThreads(uint32_t threadCount)
+{
+	if (JobModule::GetThreadCount() == threadCount)
+	{
+		return;
+	}
+
+	JobModule::Uninit();
+	JobModule::Init(threadCount);
+}
+
+int32_t main(int32_t argc, char* argv[])
+{
+	for (int32_t index = 1; index < argc; ++index)
+	{
+		if (std::strcmp(argv[index], "--verify") == 0)
+		{
+			return RunVerify();
+		}
+	}
+
+	if (JobModule::Init() != JobModule::Errors::OK)
+	{
+		std::printf("failed to initialize job module: %s\n", JobModule::GetLastErrorMessage());
+		return -1;
+	}
+
+	PrintJobCounters();
+	RegisterScalingBenchmarks();
+
+	int32_t result = BenchModule::Main(argc, argv);
+
+	JobModule::Uninit();
+	return result;
+}
\ No newline at end of file
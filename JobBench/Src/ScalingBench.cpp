@@ -0,0 +1,258 @@
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <string>
+#include <thread>
+
+#include "JobBench.h"
+
+/**
+ * @brief ParallelFor ġũ óϴ  Դϴ.
+ */
+static const uint32_t BENCH_ELEMENT_COUNT = 1 << 20;
+
+/**
+ * @brief  ϳ ݺϴ  Դϴ. ۾ й 뺸   Ŀ    Ȯ强   ֽϴ.
+ */
+static const uint32_t BENCH_WORK_PER_ELEMENT = 32;
+
+/**
+ * @brief ۾  ġũ   ϴ ۾ Դϴ.
+ */
+static const uint32_t BENCH_JOB_COUNT = 4096;
+
+/**
+ * @brief ļ ۾ ġũ  ܰ迡 ϴ ۾ Դϴ.
+ */
+static const uint32_t BENCH_FAN_OUT_COUNT = 64;
+
+/**
+ * @brief ļ ۾ ġũ ̾ ̴ ܰ Դϴ.
+ */
+static const uint32_t BENCH_STAGE_COUNT = 16;
+
+/**
+ * @brief ۾ڰ ƴ  ⸦ Ȯ  ۾  ٽ ʱȭϴ ȽԴϴ.
+ */
+static const uint32_t BENCH_REINIT_COUNT = 8;
+
+/**
+ * @brief ParallelFor ġũ Է° Դϴ.
+ */
+static std::vector<float> inputs;
+static std::vector<float> outputs;
+
+/**
+ * @brief [begin, end)  Ҹ óմϴ.
+ */
+static void ProcessRange(uint32_t begin, uint32_t end)
+{
+	for (uint32_t index = begin; index < end; ++index)
+	{
+		float value = inputs[index];
+		for (uint32_t work = 0; work < BENCH_WORK_PER_ELEMENT; ++work)
+		{
+			value = value * 0.999f + 0.25f;
+		}
+		outputs[index] = value;
+	}
+}
+
+/**
+ * @brief ParallelFor ġũ Է մϴ.
+ */
+static void InitializeInputs()
+{
+	if (!inputs.empty())
+	{
+		return;
+	}
+
+	inputs.resize(BENCH_ELEMENT_COUNT);
+	outputs.resize(BENCH_ELEMENT_COUNT);
+
+	for (uint32_t index = 0; index < BENCH_ELEMENT_COUNT; ++index)
+	{
+		inputs[index] = static_cast<float>(index % 1024) / 1024.0f;
+	}
+}
+
+/**
+ * @brief ܰ踶 BENCH_FAN_OUT_COUNT ۾ ϰ,    ܰ踦 ļ ۾ մϴ.
+ *
+ * @param stage  ܰԴϴ.
+ * @param counters ܰ躰 īԴϴ. ܰ i ۾ counters[i] ɸϴ.
+ * @param executedJobCount  ۾ Դϴ.
+ */
+static void ScheduleStage(uint32_t stage, JobModule::Counter* counters, std::atomic<uint32_t>* executedJobCount)
+{
+	JobModule::Counter& counter = counters[stage];
+	for (uint32_t index = 0; index < BENCH_FAN_OUT_COUNT; ++index)
+	{
+		JobModule::Schedule([executedJobCount]() { executedJobCount->fetch_add(1, std::memory_order_relaxed); }, &counter);
+	}
+
+	if (stage + 1 < BENCH_STAGE_COUNT)
+	{
+		//  ܰ ī͸   ξ,  ܰ踦 ٸ 尡  ȯ ʽϴ.
+		JobModule::ScheduleAfter(counter, [stage, counters, executedJobCount]() { ScheduleStage(stage + 1, counters, executedJobCount); }, &counters[stage + 1]);
+	}
+}
+
+/**
+ * @brief BENCH_STAGE_COUNT ܰ踦 ļ ۾ ̾ ϰ,  ܰ谡   ٸϴ.
+ *
+ * @return  ۾  ȯմϴ.
+ */
+static uint32_t RunStages()
+{
+	JobModule::Counter counters[BENCH_STAGE_COUNT];
+	std::atomic<uint32_t> executedJobCount = 0;
+
+	ScheduleStage(0, counters, &executedJobCount);
+	for (JobModule::Counter& counter : counters)
+	{
+		JobModule::Wait(counter);
+	}
+
+	return executedJobCount.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief ۾ڰ ƴ 尡 ۾ ٸ  ۾  ٽ ʱȭϱ⸦ ݺϰ,     Ȯմϴ.
+ *
+ * @param serialOutputs ķ ó Դϴ.
+ *
+ * @note
+ * - 0 尡   ۾ ϸ, ۾ڰ ƴ 尡   ParallelFor ó    ٸ  մϴ.
+ * - ۾ڰ ƴ   ʱȭ  ۾ ۾ Ǯ ģ ۾ ȯ ڿ ۾ ҴϹǷ, ۾ Ǯ  Ȯ  ֽϴ.
+ * - ۾ ĥ ۾ 尡 ֵ ּ 2  ʱȭմϴ.
+ */
+static bool RunReinitWithExternalWait(const std::vector<float>& serialOutputs)
+{
+	uint32_t threadCount = std::max<uint32_t>(GetBenchThreadCounts().back(), 2);
+	uint32_t halfCount = BENCH_ELEMENT_COUNT / 2;
+	uint32_t rangeSize = halfCount / BENCH_JOB_COUNT;
+	bool bIsMatched = true;
+
+	for (uint32_t round = 0; round < BENCH_REINIT_COUNT; ++round)
+	{
+		JobModule::Uninit();
+		JobModule::Init(threadCount);
+		std::fill(outputs.begin(), outputs.end(), 0.0f);
+
+		JobModule::Counter counter;
+		for (uint32_t begin = 0; begin < halfCount; begin += rangeSize)
+		{
+			JobModule::Schedule([begin, rangeSize]() { ProcessRange(begin, begin + rangeSize); }, &counter);
+		}
+
+		std::thread externalThread([&counter, halfCount]()
+			{
+				JobModule::ParallelFor(halfCount, [halfCount](uint32_t begin, uint32_t end) { ProcessRange(halfCount + begin, halfCount + end); });
+				JobModule::Wait(counter);
+			}
+		);
+		externalThread.join();
+
+		bIsMatched = bIsMatched && (outputs == serialOutputs);
+	}
+
+	return bIsMatched;
+}
+
+void PrintJobCounters()
+{
+	InitializeInputs();
+
+	uint32_t maxThreadCount = GetBenchThreadCounts().back();
+	UseThreads(maxThreadCount);
+
+	ProcessRange(0, BENCH_ELEMENT_COUNT);
+	std::vector<float> serialOutputs = outputs;
+
+	std::fill(outputs.begin(), outputs.end(), 0.0f);
+	JobModule::ResetWorkerStats();
+	JobModule::ParallelFor(BENCH_ELEMENT_COUNT, ProcessRange);
+
+	std::vector<JobModule::WorkerStats> workerStats;
+	JobModule::GetWorkerStats(workerStats);
+
+	std::printf("Job module (%u threads)\n", JobModule::GetThreadCount());
+	std::printf("  %-24s %s\n", "parallel for matches", outputs == serialOutputs ? "yes" : "no");
+	std::printf("  %-24s %u / %u\n", "stage jobs executed", RunStages(), BENCH_FAN_OUT_COUNT * BENCH_STAGE_COUNT);
+	std::printf("  %-24s %s\n", "external wait matches", RunReinitWithExternalWait(serialOutputs) ? "yes" : "no");
+	std::printf("  %-8s %10s %10s %10s %10s %12s\n", "thread", "executed", "steals", "attempts", "max depth", "idle (us)");
+	for (std::size_t index = 0; index < workerStats.size(); ++index)
+	{
+		const JobModule::WorkerStats& stats = workerStats[index];
+		std::printf(
+			"  %-8zu %10llu %10llu %10llu %10u %12.1f\n",
+			index,
+			static_cast<unsigned long long>(stats.executedJobCount),
+			static_cast<unsigned long long>(stats.stealCount),
+			static_cast<unsigned long long>(stats.stealAttemptCount),
+			stats.maxQueueDepth,
+			static_cast<double>(stats.idleNanoseconds) / 1000.0
+		);
+	}
+	std::printf("\n");
+
+	UseThreads(maxThreadCount);
+}
+
+void RegisterScalingBenchmarks()
+{
+	InitializeInputs();
+
+	BenchModule::Register("Job/ParallelFor/Serial", [](uint64_t iterations)
+		{
+			for (uint64_t iteration = 0; iteration < iterations; ++iteration)
+			{
+				ProcessRange(0, BENCH_ELEMENT_COUNT);
+				BenchModule::ClobberMemory();
+			}
+		}, BENCH_ELEMENT_COUNT
+	);
+
+	for (uint32_t threadCount : GetBenchThreadCounts())
+	{
+		std::string suffix = "/Threads" + std::to_string(threadCount);
+
+		BenchModule::Register("Job/ParallelFor" + suffix, [threadCount](uint64_t iterations)
+			{
+				UseThreads(threadCount);
+				for (uint64_t iteration = 0; iteration < iterations; ++iteration)
+				{
+					JobModule::ParallelFor(BENCH_ELEMENT_COUNT, ProcessRange);
+					BenchModule::ClobberMemory();
+				}
+			}, BENCH_ELEMENT_COUNT
+		);
+
+		BenchModule::Register("Job/Schedule" + suffix, [threadCount](uint64_t iterations)
+			{
+				UseThreads(threadCount);
+				for (uint64_t iteration = 0; iteration < iterations; ++iteration)
+				{
+					JobModule::Counter counter;
+					for (uint32_t index = 0; index < BENCH_JOB_COUNT; ++index)
+					{
+						JobModule::Schedule([]() { BenchModule::ClobberMemory(); }, &counter);
+					}
+					JobModule::Wait(counter);
+				}
+			}, BENCH_JOB_COUNT
+		);
+
+		BenchModule::Register("Job/Continuation" + suffix, [threadCount](uint64_t iterations)
+			{
+				UseThreads(threadCount);
+				for (uint64_t iteration = 0; iteration < iterations; ++iteration)
+				{
+					BenchModule::DoNotOptimize(RunStages());
+				}
+			}, BENCH_FAN_OUT_COUNT * BENCH_STAGE_COUNT
+		);
+	}
+}
\ No newline at end of file
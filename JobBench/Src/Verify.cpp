@@ -0,0 +1,395 @@
+#include <atomic>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "JobBench.h"
+
+/**
+ * @brief  ϴ  Դϴ. ϵ     尡 ۾ ġ մϴ.
+ */
+static const uint32_t VERIFY_THREAD_COUNT = 8;
+
+/**
+ * @brief ۾ Ǯ    ϴ ۾ Դϴ.
+ */
+static const uint32_t VERIFY_POOL_JOB_COUNT = 64;
+
+/**
+ * @brief ۾ Ǯ  ۾ Ǯ ũ⸦ ϱ  ݺϴ ȽԴϴ.
+ */
+static const uint32_t VERIFY_POOL_WARMUP_COUNT = 1000;
+
+/**
+ * @brief ۾ Ǯ  ݺϴ ȽԴϴ.
+ */
+static const uint32_t VERIFY_POOL_ROUND_COUNT = 20000;
+
+/**
+ * @brief   ۾ Ǯ Ҵ ۾   ϴ.
+ */
+static uint64_t GetPooledJobCount()
+{
+	std::vector<JobModule::WorkerStats> workerStats;
+	JobModule::GetWorkerStats(workerStats);
+
+	uint64_t pooledJobCount = 0;
+	for (const JobModule::WorkerStats& stats : workerStats)
+	{
+		pooledJobCount += stats.pooledJobCount;
+	}
+
+	return pooledJobCount;
+}
+
+/**
+ * @brief 0 尡 ۾ ϰ ٸ⸦ ݺص ۾ Ǯ  Ŀ ʴ Ȯմϴ.
+ *
+ * @return ۾ Ǯ ũⰡ ״ζ true, ׷  false ȯմϴ.
+ *
+ * @note ٸ 尡   ۾ Ҵ Ǯ ƿ , 0  Ǯ ݺ    Ҵմϴ.
+ */
+static bool VerifyPoolBounded()
+{
+	uint64_t warmupPooledJobCount = 0;
+	for (uint32_t round = 0; round < VERIFY_POOL_ROUND_COUNT; ++round)
+	{
+		if (round == VERIFY_POOL_WARMUP_COUNT)
+		{
+			warmupPooledJobCount = GetPooledJobCount();
+		}
+
+		// ۾  纸ؼ, ھ ϳ̾ ٸ 尡 0  ۾ ġ մϴ.
+		JobModule::Counter counter;
+		for (uint32_t index = 0; index < VERIFY_POOL_JOB_COUNT; ++index)
+		{
+			JobModule::Schedule([]() { std::this_thread::yield(); }, &counter);
+		}
+		JobModule::Wait(counter);
+	}
+
+	uint64_t pooledJobCount = GetPooledJobCount();
+	bool bIsBounded = (pooledJobCount == warmupPooledJobCount);
+
+	std::printf(
+		"  %-32s %8llu -> %-8llu pooled jobs %s\n",
+		"JobPool/Bounded",
+		static_cast<unsigned long long>(warmupPooledJobCount),
+		static_cast<unsigned long long>(pooledJobCount),
+		bIsBounded ? "ok" : "FAILED"
+	);
+
+	return bIsBounded;
+}
+
+/**
+ * @brief Ʈ   Է   ϴ õԴϴ. и  Է   ֵ մϴ.
+ */
+static const uint32_t VERIFY_STRESS_SEED = 0x5EED1234;
+
+/**
+ * @brief Ʈ  ׸񺰷 ݺϴ ȽԴϴ.
+ */
+static const uint32_t VERIFY_STRESS_ROUND_COUNT = 200;
+
+/**
+ * @brief ParallelFor  ϴ   ִԴϴ.
+ */
+static const uint32_t VERIFY_PARALLEL_FOR_MAX_COUNT = 20000;
+
+/**
+ * @brief ļ ۾     ۾ Դϴ.
+ */
+static const uint32_t VERIFY_CONTINUATION_JOB_COUNT = 256;
+
+/**
+ * @brief ø   ۾ ϴ ڽ ۾ Դϴ.
+ */
+static const uint32_t VERIFY_NESTED_FAN_OUT = 4;
+
+/**
+ * @brief ø   ۾ Ʈ Դϴ.
+ */
+static const uint32_t VERIFY_NESTED_DEPTH = 4;
+
+/**
+ * @brief ܺ   ۾  ۿ ۾ ϰ ٸ  Դϴ.
+ */
+static const uint32_t VERIFY_EXTERNAL_THREAD_COUNT = 4;
+
+/**
+ * @brief Ʈ  ׸  մϴ.
+ *
+ * @return а ٸ true, ׷  false ȯմϴ.
+ */
+static bool ReportStress(const char* name, uint32_t roundCount, uint32_t failureCount)
+{
+	std::printf("  %-32s %8u rounds %8u failures\n", name, roundCount, failureCount);
+	return failureCount == 0;
+}
+
+/**
+ * @brief Ҹ ParallelFor ѱ  Ե Ƚ ,  Ұ Ȯ   ԵǾ Ȯմϴ.
+ */
+static bool IsVisitedOnce(const std::vector<std::atomic<uint32_t>>& visitCounts, uint32_t count)
+{
+	for (uint32_t index = 0; index < count; ++index)
+	{
+		if (visitCounts[index].load(std::memory_order_relaxed) != 1)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/**
+ * @brief      ParallelFor ؼ,  Ұ Ȯ   óǴ Ȯմϴ.
+ *
+ * @note   ParallelFor ٽ ȣؼ, ۾ ȿ ParallelFor ٸ 쵵 Ȯմϴ.
+ */
+static bool VerifyParallelFor()
+{
+	std::mt19937 random(VERIFY_STRESS_SEED);
+	std::vector<std::atomic<uint32_t>> visitCounts(VERIFY_PARALLEL_FOR_MAX_COUNT);
+
+	uint32_t failureCount = 0;
+	for (uint32_t round = 0; round < VERIFY_STRESS_ROUND_COUNT; ++round)
+	{
+		uint32_t count = std::uniform_int_distribution<uint32_t>(0, VERIFY_PARALLEL_FOR_MAX_COUNT)(random);
+		uint32_t grainSize = std::uniform_int_distribution<uint32_t>(0, 64)(random);
+		bool bIsNested = (round % 2) == 1;
+
+		for (uint32_t index = 0; index < count; ++index)
+		{
+			visitCounts[index].store(0, std::memory_order_relaxed);
+		}
+
+		std::atomic<uint32_t> invalidRangeCount = 0;
+		JobModule::ParallelFor(count, [&](uint32_t begin, uint32_t end)
+			{
+				if (begin >= end || end > count)
+				{
+					invalidRangeCount.fetch_add(1, std::memory_order_relaxed);
+					return;
+				}
+
+				if (!bIsNested)
+				{
+					for (uint32_t index = begin; index < end; ++index)
+					{
+						visitCounts[index].fetch_add(1, std::memory_order_relaxed);
+					}
+					return;
+				}
+
+				JobModule::ParallelFor(end - begin, [&, begin](uint32_t nestedBegin, uint32_t nestedEnd)
+					{
+						for (uint32_t index = begin + nestedBegin; index < begin + nestedEnd; ++index)
+						{
+							visitCounts[index].fetch_add(1, std::memory_order_relaxed);
+						}
+					},
+					1
+				);
+			},
+			grainSize
+		);
+
+		if (invalidRangeCount.load() != 0 || !IsVisitedOnce(visitCounts, count))
+		{
+			++failureCount;
+		}
+	}
+
+	return ReportStress("ParallelFor/Stress", VERIFY_STRESS_ROUND_COUNT, failureCount);
+}
+
+/**
+ * @brief    ļ ۾ ؼ,  ۾   ǰ ϴ ۾  ڿ Ǵ Ȯմϴ.
+ *
+ * @note ռ ۾  ϳ ϰ ϹǷ, ̹  ۾ ϰų  ۾  ļ ۾ ɸ 찡 Բ ϴ.
+ */
+static bool VerifyContinuations()
+{
+	std::mt19937 random(VERIFY_STRESS_SEED);
+
+	uint32_t failureCount = 0;
+	for (uint32_t round = 0; round < VERIFY_STRESS_ROUND_COUNT; ++round)
+	{
+		std::unique_ptr<JobModule::Counter[]> counters = std::make_unique<JobModule::Counter[]>(VERIFY_CONTINUATION_JOB_COUNT);
+		std::vector<uint32_t> dependencies(VERIFY_CONTINUATION_JOB_COUNT);
+		std::vector<std::atomic<uint32_t>> runCounts(VERIFY_CONTINUATION_JOB_COUNT);
+		std::vector<std::atomic<uint32_t>> finishOrders(VERIFY_CONTINUATION_JOB_COUNT);
+		std::atomic<uint32_t> finishCount = 0;
+		std::atomic<uint32_t> orderViolationCount = 0;
+
+		for (uint32_t job = 0; job < VERIFY_CONTINUATION_JOB_COUNT; ++job)
+		{
+			bool bIsRoot = (job == 0) || std::uniform_int_distribution<uint32_t>(0, 7)(random) == 0;
+			dependencies[job] = bIsRoot ? job : std::uniform_int_distribution<uint32_t>(0, job - 1)(random);
+
+			auto function = [&, job]()
+				{
+					if (job % 3 == 0)
+					{
+						std::this_thread::yield();
+					}
+
+					uint32_t dependency = dependencies[job];
+					if (dependency != job && runCounts[dependency].load(std::memory_order_acquire) == 0)
+					{
+						orderViolationCount.fetch_add(1, std::memory_order_relaxed);
+					}
+
+					finishOrders[job].store(finishCount.fetch_add(1, std::memory_order_relaxed), std::memory_order_relaxed);
+					runCounts[job].fetch_add(1, std::memory_order_release);
+				};
+
+			if (bIsRoot)
+			{
+				JobModule::Schedule(function, &counters[job]);
+			}
+			else
+			{
+				JobModule::ScheduleAfter(counters[dependencies[job]], function, &counters[job]);
+			}
+		}
+
+		for (uint32_t job = 0; job < VERIFY_CONTINUATION_JOB_COUNT; ++job)
+		{
+			JobModule::Wait(counters[job]);
+		}
+
+		bool bIsFailed = orderViolationCount.load() != 0;
+		for (uint32_t job = 0; job < VERIFY_CONTINUATION_JOB_COUNT; ++job)
+		{
+			uint32_t dependency = dependencies[job];
+			if (runCounts[job].load() != 1 || (dependency != job && finishOrders[dependency].load() > finishOrders[job].load()))
+			{
+				bIsFailed = true;
+			}
+		}
+
+		failureCount += bIsFailed ? 1 : 0;
+	}
+
+	return ReportStress("Continuation/Stress", VERIFY_STRESS_ROUND_COUNT, failureCount);
+}
+
+/**
+ * @brief ڽ ۾ ϰ ٸ ۾  ؼ, ۾ ȿ ٷ     ۾ Ǵ Ȯմϴ.
+ */
+static void ForkJoin(uint32_t depth, std::atomic<uint32_t>* leafCount)
+{
+	if (depth == 0)
+	{
+		leafCount->fetch_add(1, std::memory_order_relaxed);
+		return;
+	}
+
+	JobModule::Counter counter;
+	for (uint32_t child = 0; child < VERIFY_NESTED_FAN_OUT; ++child)
+	{
+		JobModule::Schedule([depth, leafCount]() { ForkJoin(depth - 1, leafCount); }, &counter);
+	}
+	JobModule::Wait(counter);
+}
+
+/**
+ * @brief ۾ ȿ ڽ ۾ ٸ ۾ Ʈ ݺؼ ϰ,  ۾  Ȯմϴ.
+ */
+static bool VerifyNestedWait()
+{
+	uint32_t expectedLeafCount = 1;
+	for (uint32_t depth = 0; depth < VERIFY_NESTED_DEPTH; ++depth)
+	{
+		expectedLeafCount *= VERIFY_NESTED_FAN_OUT;
+	}
+
+	uint32_t failureCount = 0;
+	for (uint32_t round = 0; round < VERIFY_STRESS_ROUND_COUNT; ++round)
+	{
+		std::atomic<uint32_t> leafCount = 0;
+		ForkJoin(VERIFY_NESTED_DEPTH, &leafCount);
+
+		failureCount += (leafCount.load() == expectedLeafCount) ? 0 : 1;
+	}
+
+	return ReportStress("NestedWait/Stress", VERIFY_STRESS_ROUND_COUNT, failureCount);
+}
+
+/**
+ * @brief ۾ ⿡      0  ÿ ۾ ϰ ٷ,  ۾   Ǵ Ȯմϴ.
+ */
+static bool VerifyExternalThreads()
+{
+	static const uint32_t JOB_COUNT = 64;
+
+	uint32_t roundCount = VERIFY_STRESS_ROUND_COUNT / 4;
+	std::atomic<uint32_t> failureCount = 0;
+
+	auto runRounds = [&](uint32_t seed)
+		{
+			std::mt19937 random(VERIFY_STRESS_SEED + seed);
+			for (uint32_t round = 0; round < roundCount; ++round)
+			{
+				std::atomic<uint32_t> runCount = 0;
+
+				JobModule::Counter counter;
+				for (uint32_t job = 0; job < JOB_COUNT; ++job)
+				{
+					JobModule::Schedule([&runCount]() { runCount.fetch_add(1, std::memory_order_relaxed); }, &counter);
+				}
+
+				uint32_t count = std::uniform_int_distribution<uint32_t>(1, 4096)(random);
+				JobModule::ParallelFor(count, [&runCount](uint32_t begin, uint32_t end) { runCount.fetch_add(end - begin, std::memory_order_relaxed); });
+				JobModule::Wait(counter);
+
+				if (runCount.load() != JOB_COUNT + count)
+				{
+					failureCount.fetch_add(1, std::memory_order_relaxed);
+				}
+			}
+		};
+
+	std::vector<std::thread> threads;
+	for (uint32_t thread = 1; thread <= VERIFY_EXTERNAL_THREAD_COUNT; ++thread)
+	{
+		threads.emplace_back(runRounds, thread);
+	}
+
+	runRounds(0);
+	for (std::thread& thread : threads)
+	{
+		thread.join();
+	}
+
+	return ReportStress("ExternalThread/Stress", roundCount * (VERIFY_EXTERNAL_THREAD_COUNT + 1), failureCount.load());
+}
+
+int32_t RunVerify()
+{
+	if (JobModule::Init(VERIFY_THREAD_COUNT) != JobModule::Errors::OK)
+	{
+		std::printf("failed to initialize job module: %s\n", JobModule::GetLastErrorMessage());
+		return -1;
+	}
+
+	std::printf("Verify job module with %u threads\n", JobModule::GetThreadCount());
+
+	uint32_t failureCount = 0;
+	failureCount += VerifyPoolBounded() ? 0 : 1;
+	failureCount += VerifyParallelFor() ? 0 : 1;
+	failureCount += VerifyContinuations() ? 0 : 1;
+	failureCount += VerifyNestedWait() ? 0 : 1;
+	failureCount += VerifyExternalThreads() ? 0 : 1;
+
+	JobModule::Uninit();
+
+	std::printf("%s (%u failures)\n", failureCount == 0 ? "PASSED" : "FAILED", failureCount);
+	return failureCount == 0 ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,203 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "BenchModule.h"
+#include "Mat2x2.h"
+#include "Mat3x3.h"
+#include "Mat4x3.h"
+#include "Mat4x4.h"
+#include "ParallelFor.h"
+#include "Quat.h"
+#include "Transform.h"
+#include "Vec2.h"
+#include "Vec3.h"
+#include "Vec4.h"
+
+
+/**
+ * @brief  ϳ   ȸϴ Է  Դϴ. 2 ŵ̾ մϴ.
+ *
+ * @note Է 迭 BENCH_INPUT_COUNT + 1 Ҹ Ƿ, ε i i + 1 ũ   ° ǿڷ   ֽϴ.
+ */
+static const uint32_t BENCH_INPUT_COUNT = 1024;
+
+
+/**
+ * @brief Է  ε ũԴϴ.
+ */
+static const uint32_t BENCH_INPUT_MASK = BENCH_INPUT_COUNT - 1;
+
+
+/**
+ * @brief ġũ ϴ  Է Դϴ.
+ *
+ * @note  Է ϸ Ϸ  ̸   Ƿ,  õ RandomStream   ȸϸ մϴ.
+ */
+struct BenchInputs
+{
+	/**
+	 * @brief Է ͸  õ մϴ.
+	 */
+	void Initialize();
+
+
+	/**
+	 * @brief [0, 1]   Դϴ.
+	 */
+	float ratios[BENCH_INPUT_COUNT + 1];
+
+
+	/**
+	 * @brief [-2, 2]   Դϴ.
+	 */
+	float radians[BENCH_INPUT_COUNT + 1];
+
+
+	/**
+	 * @brief [-1, 1]  Դϴ. ﰢ Լ Է մϴ.
+	 */
+	float units[BENCH_INPUT_COUNT + 1];
+
+
+	/**
+	 * @brief   ԷԴϴ.
+	 */
+	Vec2i vec2is[BENCH_INPUT_COUNT + 1];
+	Vec3i vec3is[BENCH_INPUT_COUNT + 1];
+	Vec4i vec4is[BENCH_INPUT_COUNT + 1];
+
+
+	/**
+	 * @brief Ǽ  ԷԴϴ.  Ұ 0 ƴմϴ.
+	 */
+	Vec2f vec2fs[BENCH_INPUT_COUNT + 1];
+	Vec3f vec3fs[BENCH_INPUT_COUNT + 1];
+	Vec4f vec4fs[BENCH_INPUT_COUNT + 1];
+
+
+	/**
+	 * @brief  ϴ  ԷԴϴ.
+	 */
+	Mat2x2 mat2x2s[BENCH_INPUT_COUNT + 1];
+	Mat3x3 mat3x3s[BENCH_INPUT_COUNT + 1];
+	Mat4x4 mat4x4s[BENCH_INPUT_COUNT + 1];
+	Mat4x3 mat4x3s[BENCH_INPUT_COUNT + 1];
+
+
+	/**
+	 * @brief  ʹϾ ԷԴϴ.
+	 */
+	Quat quats[BENCH_INPUT_COUNT + 1];
+
+
+	/**
+	 * @brief    Ʈ ԷԴϴ.
+	 */
+	Transform transforms[BENCH_INPUT_COUNT + 1];
+};
+
+
+/**
+ * @brief  ġũ ϴ Է Դϴ.
+ */
+extern BenchInputs benchInputs;
+
+
+/**
+ * @brief [0, count)  ε ϳ JobModule ۾  óϰ,    ٸϴ.
+ *
+ * @param count ó ε Դϴ.
+ * @param function   ó ԼԴϴ.
+ *
+ * @note MathModule  ó Լ(ParallelForFunction) ѱϴ.
+ */
+void ParallelForJobs(uint32_t count, const ParallelRangeFunction& function);
+
+
+/**
+ * @brief Է ε ޾  ϳ ȯϴ  ġũ մϴ.
+ *
+ * @param name ġũ ̸Դϴ. "Ÿ/"  մϴ.
+ * @param operation Է ε ޾  ȯϴ Դϴ.
+ * @param itemsPerOperation  1ȸ óϴ ׸ Դϴ. SIMD     Ѱ δ ð մϴ.
+ *
+ * @note  ݺ  DoNotOptimize ѱǷ  ü ŵ ʽϴ.
+ */
+template <typename Operation>
+inline void RegisterOperation(const std::string& name, Operation operation, uint64_t itemsPerOperation = 1)
+{
+	BenchModule::Register(name, [operation](uint64_t iterations)
+		{
+			for (uint64_t iteration = 0; iteration < iterations; ++iteration)
+			{
+				uint32_t index = static_cast<uint32_t>(iteration) & BENCH_INPUT_MASK;
+				BenchModule::DoNotOptimize(operation(index));
+			}
+		},
+		itemsPerOperation
+	);
+}
+
+
+/**
+ * @brief Vec2, Vec3, Vec4 SIMD   ġũ մϴ.
+ */
+void RegisterVecBenchmarks();
+
+
+/**
+ * @brief Mat2x2, Mat3x3, Mat4x4, Mat4x3 ġũ մϴ.
+ */
+void RegisterMatBenchmarks();
+
+
+/**
+ * @brief Quat SIMD  ʹϾ ġũ մϴ.
+ */
+void RegisterQuatBenchmarks();
+
+
+/**
+ * @brief Transform TransformStream ġũ մϴ.
+ */
+void RegisterTransformBenchmarks();
+
+
+/**
+ * @brief MathModule Į/迭 Լ Frustum, SceneHierarchy, BVH ġũ մϴ.
+ */
+void RegisterBatchBenchmarks();
+
+
+/**
+ * @brief  ڿ  ġ 鿡 OcclusionBuffer ü   մϴ.
+ */
+void PrintOcclusionCounters();
+
+
+/**
+ * @brief   OcclusionBuffer ȭ   ġũ մϴ.
+ */
+void RegisterOcclusionBenchmarks();
+
+
+/**
+ * @brief SIMD ο ġ Ŀ  Į ڵ Ʈ  ϰ, BVH   SceneHierarchy    Ƽ긦 ϳ ˻ϰų     մϴ.
+ *
+ * @return   ٸ 0, ׷  1 ȯմϴ.
+ *
+ * @note --verify ڷ ϸ ġũ    մϴ.
+ */
+int32_t RunVerify();
+
+
+/**
+ * @brief Į, SSE 4, AVX2 8  SinCos/ASin/ACos ٻ ǿ ü е ǥ Լ , ִ   ULP  ִ񰪰  մϴ.
+ *
+ * @return ׻ 0 ȯմϴ.
+ *
+ * @note --accuracy ڷ ϸ ġũ    մϴ. 忡 Ե  SIMD δ ǳʶݴϴ.
+ */
+int32_t RunAccuracy();
\ No newline at end of file
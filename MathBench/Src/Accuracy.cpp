@@ -0,0 +1,197 @@
+#include <cmath>
+#include <cstdio>
+#include <limits>
+#include <vector>
+
+#include "MathBench.h"
+#include "SIMD.h"
+
+/**
+ * @brief Լ ǿ   Ȯϴ Է Դϴ. 8  մϴ.
+ */
+static const uint32_t ACCURACY_SAMPLE_COUNT = 1 << 20;
+
+/**
+ * @brief ULP     ּ ũԴϴ.
+ *
+ * @note ٻ    ϹǷ,   0  ULP Ѿ Ŀϴ. ̷ Է ִ  θ Ȯմϴ.
+ */
+static const double ACCURACY_MIN_REFERENCE = 0.1;
+
+/**
+ * @brief  ο  , ڻ, ũ , ũ ڻ Դϴ.
+ */
+struct AccuracyOutputs
+{
+	std::vector<float> sins;
+	std::vector<float> coss;
+	std::vector<float> asins;
+	std::vector<float> acoss;
+};
+
+/**
+ * @brief Լ ϳ  Դϴ.
+ */
+struct AccuracyResult
+{
+	double maxAbsError = 0.0;
+	double maxUlpError = 0.0;
+	double ulpErrorSum = 0.0;
+	uint32_t ulpCount = 0;
+};
+
+/**
+ * @brief ٻ  е    մϴ.
+ */
+static void Accumulate(AccuracyResult& result, float actual, double expected)
+{
+	double absError = std::fabs(static_cast<double>(actual) - expected);
+	result.maxAbsError = std::fmax(result.maxAbsError, absError);
+
+	if (std::fabs(expected) < ACCURACY_MIN_REFERENCE)
+	{
+		return;
+	}
+
+	//   float ݿø   ULP   ϴ.
+	float magnitude = std::fabs(static_cast<float>(expected));
+	double ulp = static_cast<double>(std::nextafter(magnitude, std::numeric_limits<float>::infinity()) - magnitude);
+	double ulpError = absError / ulp;
+
+	result.maxUlpError = std::fmax(result.maxUlpError, ulpError);
+	result.ulpErrorSum += ulpError;
+	++result.ulpCount;
+}
+
+/**
+ * @brief Լ ϳ  踦 մϴ.
+ */
+static void Report(const char* function, const char* path, const AccuracyResult& result)
+{
+	double meanUlpError = result.ulpCount == 0 ? 0.0 : result.ulpErrorSum / static_cast<double>(result.ulpCount);
+	std::printf("  %-8s %-8s %14.3e %10.2f %10.3f\n", function, path, result.maxAbsError, result.maxUlpError, meanUlpError);
+}
+
+/**
+ * @brief Į Լ  մϴ.
+ */
+static void EvaluateScalar(const std::vector<float>& radians, const std::vector<float>& values, AccuracyOutputs& outputs)
+{
+	for (uint32_t index = 0; index < ACCURACY_SAMPLE_COUNT; ++index)
+	{
+		MathModule::SinCos(radians[index], outputs.sins[index], outputs.coss[index]);
+		outputs.asins[index] = MathModule::ASin(values[index]);
+		outputs.acoss[index] = MathModule::ACos(values[index]);
+	}
+}
+
+#if defined(MATH_SIMD_SSE)
+/**
+ * @brief SSE 4 Ŀη  մϴ.
+ */
+static void EvaluateWide4(const std::vector<float>& radians, const std::vector<float>& values, AccuracyOutputs& outputs)
+{
+	for (uint32_t index = 0; index < ACCURACY_SAMPLE_COUNT; index += 4)
+	{
+		__m128 s;
+		__m128 c;
+		SIMD::SinCos4(_mm_loadu_ps(radians.data() + index), s, c);
+		_mm_storeu_ps(outputs.sins.data() + index, s);
+		_mm_storeu_ps(outputs.coss.data() + index, c);
+
+		__m128 value = _mm_loadu_ps(values.data() + index);
+		_mm_storeu_ps(outputs.asins.data() + index, SIMD::ASin4(value));
+		_mm_storeu_ps(outputs.acoss.data() + index, SIMD::ACos4(value));
+	}
+}
+#endif
+
+#if defined(MATH_SIMD_AVX2)
+/**
+ * @brief AVX2 8 Ŀη  մϴ.
+ */
+static void EvaluateWide8(const std::vector<float>& radians, const std::vector<float>& values, AccuracyOutputs& outputs)
+{
+	for (uint32_t index = 0; index < ACCURACY_SAMPLE_COUNT; index += 8)
+	{
+		__m256 s;
+		__m256 c;
+		SIMD::SinCos8(_mm256_loadu_ps(radians.data() + index), s, c);
+		_mm256_storeu_ps(outputs.sins.data() + index, s);
+		_mm256_storeu_ps(outputs.coss.data() + index, c);
+
+		__m256 value = _mm256_loadu_ps(values.data() + index);
+		_mm256_storeu_ps(outputs.asins.data() + index, SIMD::ASin8(value));
+		_mm256_storeu_ps(outputs.acoss.data() + index, SIMD::ACos8(value));
+	}
+}
+#endif
+
+int32_t RunAccuracy()
+{
+	std::vector<float> radians(ACCURACY_SAMPLE_COUNT);
+	std::vector<float> values(ACCURACY_SAMPLE_COUNT);
+	for (uint32_t index = 0; index < ACCURACY_SAMPLE_COUNT; ++index)
+	{
+		float ratio = static_cast<float>(index) / static_cast<float>(ACCURACY_SAMPLE_COUNT - 1);
+		radians[index] = -2.0f * TwoPi + ratio * 4.0f * TwoPi;
+		values[index] = MathModule::Min(-1.0f + ratio * 2.0f, 1.0f);
+	}
+
+	std::vector<double> sins(ACCURACY_SAMPLE_COUNT);
+	std::vector<double> coss(ACCURACY_SAMPLE_COUNT);
+	std::vector<double> asins(ACCURACY_SAMPLE_COUNT);
+	std::vector<double> acoss(ACCURACY_SAMPLE_COUNT);
+	for (uint32_t index = 0; index < ACCURACY_SAMPLE_COUNT; ++index)
+	{
+		sins[index] = std::sin(static_cast<double>(radians[index]));
+		coss[index] = std::cos(static_cast<double>(radians[index]));
+		asins[index] = std::asin(static_cast<double>(values[index]));
+		acoss[index] = std::acos(static_cast<double>(values[index]));
+	}
+
+	std::printf("Accuracy against double-precision std functions (%u samples per function)\n", ACCURACY_SAMPLE_COUNT);
+	std::printf("  Sin/Cos over [-4pi, 4pi], ASin/ACos over [-1, 1]. ULP errors only count references with magnitude >= %.1f.\n", ACCURACY_MIN_REFERENCE);
+	std::printf("  %-8s %-8s %14s %10s %10s\n", "function", "path", "max abs err", "max ulp", "mean ulp");
+
+	auto reportPath = [&](const char* path, void (*evaluate)(const std::vector<float>&, const std::vector<float>&, AccuracyOutputs&))
+		{
+			AccuracyOutputs outputs;
+			outputs.sins.resize(ACCURACY_SAMPLE_COUNT);
+			outputs.coss.resize(ACCURACY_SAMPLE_COUNT);
+			outputs.asins.resize(ACCURACY_SAMPLE_COUNT);
+			outputs.acoss.resize(ACCURACY_SAMPLE_COUNT);
+			evaluate(radians, values, outputs);
+
+			AccuracyResult sin;
+			AccuracyResult cos;
+			AccuracyResult asin;
+			AccuracyResult acos;
+			for (uint32_t index = 0; index < ACCURACY_SAMPLE_COUNT; ++index)
+			{
+				Accumulate(sin, outputs.sins[index], sins[index]);
+				Accumulate(cos, outputs.coss[index], coss[index]);
+				Accumulate(asin, outputs.asins[index], asins[index]);
+				Accumulate(acos, outputs.acoss[index], acoss[index]);
+			}
+
+			Report("Sin", path, sin);
+			Report("Cos", path, cos);
+			Report("ASin", path, asin);
+			Report("ACos", path, acos);
+		};
+
+	reportPath("Scalar", EvaluateScalar);
+#if defined(MATH_SIMD_SSE)
+	reportPath("Wide4", EvaluateWide4);
+#else
+	std::printf("  %-8s %-8s not in this build\n", "*", "Wide4");
+#endif
+#if defined(MATH_SIMD_AVX2)
+	reportPath("Wide8", EvaluateWide8);
+#else
+	std::printf("  %-8s %-8s not in this build\n", "*", "Wide8");
+#endif
+
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,258 @@
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "JobModule.h"
+
+#include "BVH.h"
+#include "Frustum.h"
+#include "MathBench.h"
+#include "RandomStream.h"
+#include "SceneHierarchy.h"
+
+/**
+ * @brief 迭 Լ Է 迭 ü ϴ ġũ մϴ.    ϳ ðԴϴ.
+ */
+template <typename Function>
+static void RegisterArrayOperation(const std::string& name, Function function)
+{
+	BenchModule::Register(name, [function](uint64_t iterations)
+		{
+			for (uint64_t iteration = 0; iteration < iterations; ++iteration)
+			{
+				function();
+				BenchModule::ClobberMemory();
+			}
+		},
+		BENCH_INPUT_COUNT
+	);
+}
+
+/**
+ * @brief MathModule Į Լ 迭 Լ ġũ մϴ.
+ */
+static void RegisterMathModuleBenchmarks()
+{
+	const float* radians = benchInputs.radians;
+	const float* units = benchInputs.units;
+
+	RegisterOperation("MathModule/ToDegree",      [radians](uint32_t i) { return MathModule::ToDegree(radians[i]); });
+	RegisterOperation("MathModule/ToRadian",      [radians](uint32_t i) { return MathModule::ToRadian(radians[i]); });
+	RegisterOperation("MathModule/NearZero",      [units](uint32_t i) { return MathModule::NearZero(units[i]); });
+	RegisterOperation("MathModule/Max",           [units](uint32_t i) { return MathModule::Max(units[i], units[i + 1]); });
+	RegisterOperation("MathModule/Min",           [units](uint32_t i) { return MathModule::Min(units[i], units[i + 1]); });
+	RegisterOperation("MathModule/Clamp",         [units](uint32_t i) { return MathModule::Clamp(units[i], -0.5f, 0.5f); });
+	RegisterOperation("MathModule/Sin",           [radians](uint32_t i) { return MathModule::Sin(radians[i]); });
+	RegisterOperation("MathModule/Cos",           [radians](uint32_t i) { return MathModule::Cos(radians[i]); });
+	RegisterOperation("MathModule/SinCos",        [radians](uint32_t i) { float s, c; MathModule::SinCos(radians[i], s, c); return s + c; });
+	RegisterOperation("MathModule/ASin",          [units](uint32_t i) { return MathModule::ASin(units[i]); });
+	RegisterOperation("MathModule/ACos",          [units](uint32_t i) { return MathModule::ACos(units[i]); });
+	RegisterOperation("MathModule/Sqrt",          [](uint32_t i) { return MathModule::Sqrt(benchInputs.ratios[i]); });
+	RegisterOperation("MathModule/Abs",           [units](uint32_t i) { return MathModule::Abs(units[i]); });
+	RegisterOperation("MathModule/Fmod",          [radians](uint32_t i) { return MathModule::Fmod(radians[i], Pi); });
+	RegisterOperation("MathModule/RandomInt",     [](uint32_t) { return MathModule::GenerateRandomInt(0, 100); });
+	RegisterOperation("MathModule/RandomFloat",   [](uint32_t) { return MathModule::GenerateRandomFloat(0.0f, 1.0f); });
+
+	static std::vector<float> outSin(BENCH_INPUT_COUNT);
+	static std::vector<float> outCos(BENCH_INPUT_COUNT);
+
+	RegisterArrayOperation("MathModule/SinCosArray", [radians]() { MathModule::SinCos(radians, outSin.data(), outCos.data(), BENCH_INPUT_COUNT); });
+	RegisterArrayOperation("MathModule/ASinArray",   [units]() { MathModule::ASin(units, outSin.data(), BENCH_INPUT_COUNT); });
+	RegisterArrayOperation("MathModule/ACosArray",   [units]() { MathModule::ACos(units, outCos.data(), BENCH_INPUT_COUNT); });
+}
+
+/**
+ * @brief Frustum /ġ ø ġũ մϴ.
+ *
+ * @note Է  ڴ  ٶ󺸴 ī޶ ֺ  ־, 뷫  ø˴ϴ.
+ */
+static void RegisterFrustumBenchmarks()
+{
+	static Frustum frustum(Mat4x4::LookAt(Vec3f(0.0f, 0.0f, -10.0f), Vec3f(0.0f, 0.0f, 0.0f), Vec3f(0.0f, 1.0f, 0.0f)) * Mat4x4::Perspective(PiDiv4, 1.0f, 0.1f, 100.0f));
+	static std::vector<Vec3f> centers(BENCH_INPUT_COUNT + 1);
+	static std::vector<float> centerX(BENCH_INPUT_COUNT), centerY(BENCH_INPUT_COUNT), centerZ(BENCH_INPUT_COUNT);
+	static std::vector<float> radii(BENCH_INPUT_COUNT + 1);
+	static std::vector<Vec3f> minPositions(BENCH_INPUT_COUNT + 1);
+	static std::vector<Vec3f> maxPositions(BENCH_INPUT_COUNT + 1);
+	static std::vector<uint32_t> visibleIndices(BENCH_INPUT_COUNT);
+
+	RandomStream stream(RandomStream::DEFAULT_SEED);
+	for (uint32_t index = 0; index <= BENCH_INPUT_COUNT; ++index)
+	{
+		centers[index] = Vec3f(stream.NextFloat(-30.0f, 30.0f), stream.NextFloat(-30.0f, 30.0f), stream.NextFloat(-30.0f, 30.0f));
+		radii[index] = stream.NextFloat(0.1f, 2.0f);
+		minPositions[index] = centers[index] - radii[index];
+		maxPositions[index] = centers[index] + radii[index];
+	}
+
+	for (uint32_t index = 0; index < BENCH_INPUT_COUNT; ++index)
+	{
+		centerX[index] = centers[index].x;
+		centerY[index] = centers[index].y;
+		centerZ[index] = centers[index].z;
+	}
+
+	RegisterOperation("Frustum/IsIntersectSphere", [](uint32_t i) { return frustum.IsIntersectSphere(centers[i], radii[i]); });
+	RegisterOperation("Frustum/IsIntersectAABB",   [](uint32_t i) { return frustum.IsIntersectAABB(minPositions[i], maxPositions[i]); });
+
+	RegisterArrayOperation("Frustum/CullSpheres",    []() { BenchModule::DoNotOptimize(frustum.CullSpheres(centers.data(), radii.data(), BENCH_INPUT_COUNT, visibleIndices.data())); });
+	RegisterArrayOperation("Frustum/CullSpheresSoA", []() { BenchModule::DoNotOptimize(frustum.CullSpheres(centerX.data(), centerY.data(), centerZ.data(), radii.data(), BENCH_INPUT_COUNT, visibleIndices.data())); });
+	RegisterArrayOperation("Frustum/CullAABBs",      []() { BenchModule::DoNotOptimize(frustum.CullAABBs(minPositions.data(), maxPositions.data(), BENCH_INPUT_COUNT, visibleIndices.data())); });
+}
+
+/**
+ * @brief SceneHierarchy ġũ  Դϴ.
+ */
+static const uint32_t SCENE_HIERARCHY_NODE_COUNTS[] = { 10000, 100000, 1000000 };
+
+/**
+ * @brief   شϴ SceneHierarchy ġũ   ϴ.
+ *
+ * @note Ʈ 16 Ʒ 4 Ʈ մϴ. 1M    ޸𸮸  ϹǷ, ó   մϴ.
+ */
+static SceneHierarchy& GetBenchHierarchy(uint32_t nodeCount)
+{
+	static const uint32_t ROOT_COUNT = 16;
+	static std::map<uint32_t, std::unique_ptr<SceneHierarchy>> hierarchies;
+
+	std::unique_ptr<SceneHierarchy>& hierarchy = hierarchies[nodeCount];
+	if (!hierarchy)
+	{
+		hierarchy = std::make_unique<SceneHierarchy>();
+		for (uint32_t index = 0; index < nodeCount; ++index)
+		{
+			uint32_t parent = (index < ROOT_COUNT) ? SceneHierarchy::INVALID_NODE : (index - ROOT_COUNT) / 4;
+			hierarchy->AddNode(benchInputs.transforms[index & BENCH_INPUT_MASK], parent);
+		}
+		hierarchy->Update();
+	}
+
+	return *hierarchy;
+}
+
+/**
+ * @brief SceneHierarchy  ġũ մϴ.    ϳ ðԴϴ.
+ *
+ * @note
+ * -    尡 Ƽ  1% Ƽ 츦  մϴ.
+ * -  1 JobModule    մϴ. 尡 1 ȯ濡  Ʈ  ϵ ּ 2 ϴ.
+ */
+static void RegisterSceneHierarchyBenchmarks()
+{
+	uint32_t parallelThreadCount = MathModule::Max<uint32_t>(JobModule::GetThreadCount(), 2);
+
+	for (uint32_t nodeCount : SCENE_HIERARCHY_NODE_COUNTS)
+	{
+		for (uint32_t threadCount : { 1u, parallelThreadCount })
+		{
+			std::string size = (nodeCount % 1000000 == 0) ? std::to_string(nodeCount / 1000000) + "M" : std::to_string(nodeCount / 1000) + "k";
+			std::string suffix = "/" + size + "/Threads" + std::to_string(threadCount);
+
+			BenchModule::Register("SceneHierarchy/UpdateAllDirty" + suffix, [nodeCount, threadCount](uint64_t iterations)
+				{
+					SceneHierarchy& hierarchy = GetBenchHierarchy(nodeCount);
+					for (uint64_t iteration = 0; iteration < iterations; ++iteration)
+					{
+						for (uint32_t node = 0; node < nodeCount; ++node)
+						{
+							hierarchy.SetLocalTransform(node, benchInputs.transforms[(node + iteration) & BENCH_INPUT_MASK]);
+						}
+
+						hierarchy.Update(threadCount, ParallelForJobs);
+						BenchModule::ClobberMemory();
+					}
+				},
+				nodeCount
+			);
+
+			BenchModule::Register("SceneHierarchy/UpdateOnePercentDirty" + suffix, [nodeCount, threadCount](uint64_t iterations)
+				{
+					SceneHierarchy& hierarchy = GetBenchHierarchy(nodeCount);
+					for (uint64_t iteration = 0; iteration < iterations; ++iteration)
+					{
+						for (uint32_t node = static_cast<uint32_t>(iteration % 100); node < nodeCount; node += 100)
+						{
+							hierarchy.SetLocalTransform(node, benchInputs.transforms[(node + iteration) & BENCH_INPUT_MASK]);
+						}
+
+						hierarchy.Update(threadCount, ParallelForJobs);
+						BenchModule::ClobberMemory();
+					}
+				},
+				nodeCount
+			);
+		}
+	}
+}
+
+/**
+ * @brief BVH   ġũ մϴ.
+ *
+ * @note ̰ 鸮  ޽ø մϴ.    Ʒ  ϴ.
+ */
+static void RegisterBVHBenchmarks()
+{
+	static const uint32_t GRID_SIZE = 64;
+	static std::vector<Vec3f> positions;
+	static std::vector<uint32_t> indices;
+	static BVH bvh;
+
+	RandomStream stream(RandomStream::DEFAULT_SEED);
+	for (uint32_t z = 0; z <= GRID_SIZE; ++z)
+	{
+		for (uint32_t x = 0; x <= GRID_SIZE; ++x)
+		{
+			positions.push_back(Vec3f(static_cast<float>(x), stream.NextFloat(-1.0f, 1.0f), static_cast<float>(z)));
+		}
+	}
+
+	for (uint32_t z = 0; z < GRID_SIZE; ++z)
+	{
+		for (uint32_t x = 0; x < GRID_SIZE; ++x)
+		{
+			uint32_t v0 = z * (GRID_SIZE + 1) + x;
+			uint32_t v1 = v0 + 1;
+			uint32_t v2 = v0 + GRID_SIZE + 1;
+			uint32_t v3 = v2 + 1;
+
+			indices.insert(indices.end(), { v0, v2, v1, v1, v2, v3 });
+		}
+	}
+
+	uint32_t triangleCount = static_cast<uint32_t>(indices.size() / 3);
+	bvh.BuildTriangles(positions.data(), indices.data(), triangleCount);
+
+	BenchModule::Register("BVH/BuildTriangles", [triangleCount](uint64_t iterations)
+		{
+			BVH buildBVH;
+			for (uint64_t iteration = 0; iteration < iterations; ++iteration)
+			{
+				buildBVH.BuildTriangles(positions.data(), indices.data(), triangleCount, false);
+				BenchModule::ClobberMemory();
+			}
+		},
+		triangleCount
+	);
+
+	static std::vector<BVH::Ray> rays;
+	for (uint32_t index = 0; index <= BENCH_INPUT_COUNT + BVH::PACKET_SIZE; ++index)
+	{
+		Vec3f origin(stream.NextFloat(0.0f, static_cast<float>(GRID_SIZE)), 10.0f, stream.NextFloat(0.0f, static_cast<float>(GRID_SIZE)));
+		Vec3f direction = Vec3f::Normalize(Vec3f(stream.NextFloat(-0.2f, 0.2f), -1.0f, stream.NextFloat(-0.2f, 0.2f)));
+		rays.push_back(BVH::Ray(origin, direction));
+	}
+
+	RegisterOperation("BVH/IntersectRay",       [](uint32_t i) { BVH::Hit hit; bvh.IntersectRay(rays[i], hit); return hit.t; });
+	RegisterOperation("BVH/IsIntersectRay",     [](uint32_t i) { return bvh.IsIntersectRay(rays[i]); });
+	RegisterOperation("BVH/IntersectRay4",      [](uint32_t i) { BVH::Hit hits[BVH::PACKET_SIZE]; return bvh.IntersectRay4(&rays[i], hits); }, BVH::PACKET_SIZE);
+	RegisterOperation("BVH/IntersectSphere",    [](uint32_t i) { BVH::Hit hit; bvh.IntersectSphere(rays[i].origin - Vec3f(0.0f, 10.0f, 0.0f), 0.5f, hit); return hit.t; });
+	RegisterOperation("BVH/IsIntersectSphere",  [](uint32_t i) { return bvh.IsIntersectSphere(rays[i].origin - Vec3f(0.0f, 10.0f, 0.0f), 0.5f); });
+}
+
+void RegisterBatchBenchmarks()
+{
+	RegisterMathModuleBenchmarks();
+	RegisterFrustumBenchmarks();
+	RegisterSceneHierarchyBenchmarks();
+	RegisterBVHBenchmarks();
+}
\ No newline at end of file
@@ -0,0 +1,85 @@
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+#include "JobModule.h"
+
+#include "MathBench.h"
+#include "RandomStream.h"
+
+BenchInputs benchInputs;
+
+void BenchInputs::Initialize()
+{
+	RandomStream stream(RandomStream::DEFAULT_SEED);
+
+	for (uint32_t index = 0; index <= BENCH_INPUT_COUNT; ++index)
+	{
+		ratios[index] = stream.NextFloat();
+		radians[index] = stream.NextFloat(-TwoPi, TwoPi);
+		units[index] = stream.NextFloat(-1.0f, 1.0f);
+
+		vec2is[index] = Vec2i(stream.NextInt(1, 100), stream.NextInt(1, 100));
+		vec3is[index] = Vec3i(stream.NextInt(1, 100), stream.NextInt(1, 100), stream.NextInt(1, 100));
+		vec4is[index] = Vec4i(stream.NextInt(1, 100), stream.NextInt(1, 100), stream.NextInt(1, 100), stream.NextInt(1, 100));
+
+		vec2fs[index] = Vec2f(stream.NextFloat(0.1f, 10.0f), stream.NextFloat(0.1f, 10.0f));
+		vec3fs[index] = Vec3f(stream.NextFloat(0.1f, 10.0f), stream.NextFloat(0.1f, 10.0f), stream.NextFloat(0.1f, 10.0f));
+		vec4fs[index] = Vec4f(stream.NextFloat(0.1f, 10.0f), stream.NextFloat(0.1f, 10.0f), stream.NextFloat(0.1f, 10.0f), stream.NextFloat(0.1f, 10.0f));
+
+		quats[index] = stream.NextUnitQuat();
+
+		Vec3f position(stream.NextFloat(-100.0f, 100.0f), stream.NextFloat(-100.0f, 100.0f), stream.NextFloat(-100.0f, 100.0f));
+		Vec3f scale(stream.NextFloat(0.5f, 2.0f), stream.NextFloat(0.5f, 2.0f), stream.NextFloat(0.5f, 2.0f));
+		transforms[index] = Transform(position, quats[index], scale);
+
+		mat4x4s[index] = Transform::ToMat(transforms[index]);
+		mat4x3s[index] = Transform::ToMat4x3(transforms[index]);
+
+		const Mat4x4& m = mat4x4s[index];
+		mat3x3s[index] = Mat3x3(m.e00, m.e01, m.e02, m.e10, m.e11, m.e12, m.e20, m.e21, m.e22);
+		mat2x2s[index] = Mat2x2(m.e00, m.e01, m.e10, m.e11) + Mat2x2::Identity() * 2.0f;
+	}
+}
+
+void ParallelForJobs(uint32_t count, const ParallelRangeFunction& function)
+{
+	JobModule::ParallelFor(count, function, 1);
+}
+
+int32_t main(int32_t argc, char* argv[])
+{
+	for (int32_t index = 1; index < argc; ++index)
+	{
+		if (std::strcmp(argv[index], "--verify") == 0)
+		{
+			return RunVerify();
+		}
+
+		if (std::strcmp(argv[index], "--accuracy") == 0)
+		{
+			return RunAccuracy();
+		}
+	}
+
+	if (JobModule::Init() != JobModule::Errors::OK)
+	{
+		std::printf("failed to initialize job module: %s\n", JobModule::GetLastErrorMessage());
+		return -1;
+	}
+
+	benchInputs.Initialize();
+	PrintOcclusionCounters();
+
+	RegisterVecBenchmarks();
+	RegisterMatBenchmarks();
+	RegisterQuatBenchmarks();
+	RegisterTransformBenchmarks();
+	RegisterBatchBenchmarks();
+	RegisterOcclusionBenchmarks();
+
+	int32_t result = BenchModule::Main(argc, argv);
+
+	JobModule::Uninit();
+	return result;
+}
\ No newline at end of file
@@ -0,0 +1,56 @@
+#include "MathBench.h"
+
+/**
+ * @brief Mat2x2, Mat3x3, Mat4x4  ϴ  ġũ մϴ.
+ */
+template <typename T>
+static void RegisterCommonMatBenchmarks(const std::string& type, const T* inputs)
+{
+	RegisterOperation(type + "/Negate",       [inputs](uint32_t i) { return -inputs[i]; });
+	RegisterOperation(type + "/Add",          [inputs](uint32_t i) { return inputs[i] + inputs[i + 1]; });
+	RegisterOperation(type + "/Sub",          [inputs](uint32_t i) { return inputs[i] - inputs[i + 1]; });
+	RegisterOperation(type + "/MulScalar",    [inputs](uint32_t i) { return inputs[i] * benchInputs.ratios[i]; });
+	RegisterOperation(type + "/Mul",          [inputs](uint32_t i) { return inputs[i] * inputs[i + 1]; });
+	RegisterOperation(type + "/AddAssign",    [inputs](uint32_t i) { T m = inputs[i]; m += inputs[i + 1]; return m; });
+	RegisterOperation(type + "/SubAssign",    [inputs](uint32_t i) { T m = inputs[i]; m -= inputs[i + 1]; return m; });
+	RegisterOperation(type + "/Equal",        [inputs](uint32_t i) { return inputs[i] == inputs[i + 1]; });
+	RegisterOperation(type + "/NotEqual",     [inputs](uint32_t i) { return inputs[i] != inputs[i + 1]; });
+	RegisterOperation(type + "/Zero",         [](uint32_t) { return T::Zero(); });
+	RegisterOperation(type + "/Identity",     [](uint32_t) { return T::Identity(); });
+	RegisterOperation(type + "/Transpose",    [inputs](uint32_t i) { return T::Transpose(inputs[i]); });
+	RegisterOperation(type + "/Inverse",      [inputs](uint32_t i) { return T::Inverse(inputs[i]); });
+}
+
+void RegisterMatBenchmarks()
+{
+	RegisterCommonMatBenchmarks("Mat2x2", benchInputs.mat2x2s);
+	RegisterOperation("Mat2x2/Determinant", [](uint32_t i) { return Mat2x2::Determinant(benchInputs.mat2x2s[i]); });
+
+	RegisterCommonMatBenchmarks("Mat3x3", benchInputs.mat3x3s);
+	RegisterOperation("Mat3x3/Determinant", [](uint32_t i) { return Mat3x3::Determinant(benchInputs.mat3x3s[i]); });
+
+	RegisterCommonMatBenchmarks("Mat4x4", benchInputs.mat4x4s);
+	RegisterOperation("Mat4x4/Translation",   [](uint32_t i) { return Mat4x4::Translation(benchInputs.vec3fs[i].x, benchInputs.vec3fs[i].y, benchInputs.vec3fs[i].z); });
+	RegisterOperation("Mat4x4/TranslationV",  [](uint32_t i) { return Mat4x4::Translation(benchInputs.vec3fs[i]); });
+	RegisterOperation("Mat4x4/Scale",         [](uint32_t i) { return Mat4x4::Scale(benchInputs.vec3fs[i].x, benchInputs.vec3fs[i].y, benchInputs.vec3fs[i].z); });
+	RegisterOperation("Mat4x4/ScaleV",        [](uint32_t i) { return Mat4x4::Scale(benchInputs.vec3fs[i]); });
+	RegisterOperation("Mat4x4/RotateX",       [](uint32_t i) { return Mat4x4::RotateX(benchInputs.radians[i]); });
+	RegisterOperation("Mat4x4/RotateY",       [](uint32_t i) { return Mat4x4::RotateY(benchInputs.radians[i]); });
+	RegisterOperation("Mat4x4/RotateZ",       [](uint32_t i) { return Mat4x4::RotateZ(benchInputs.radians[i]); });
+	RegisterOperation("Mat4x4/Rotate",        [](uint32_t i) { return Mat4x4::Rotate(benchInputs.radians[i], Vec3f::Normalize(benchInputs.vec3fs[i])); });
+	RegisterOperation("Mat4x4/Ortho",         [](uint32_t i) { return Mat4x4::Ortho(-benchInputs.vec3fs[i].x, benchInputs.vec3fs[i].x, -benchInputs.vec3fs[i].y, benchInputs.vec3fs[i].y, 0.1f, 100.0f + benchInputs.vec3fs[i].z); });
+	RegisterOperation("Mat4x4/Perspective",   [](uint32_t i) { return Mat4x4::Perspective(0.5f + benchInputs.ratios[i], 1.777f, 0.1f, 100.0f); });
+	RegisterOperation("Mat4x4/LookAt",        [](uint32_t i) { return Mat4x4::LookAt(benchInputs.vec3fs[i], -benchInputs.vec3fs[i + 1], Vec3f(0.0f, 1.0f, 0.0f)); });
+
+	RegisterOperation("Mat4x3/Mul",             [](uint32_t i) { return benchInputs.mat4x3s[i] * benchInputs.mat4x3s[i + 1]; });
+	RegisterOperation("Mat4x3/Equal",           [](uint32_t i) { return benchInputs.mat4x3s[i] == benchInputs.mat4x3s[i + 1]; });
+	RegisterOperation("Mat4x3/NotEqual",        [](uint32_t i) { return benchInputs.mat4x3s[i] != benchInputs.mat4x3s[i + 1]; });
+	RegisterOperation("Mat4x3/Identity",        [](uint32_t) { return Mat4x3::Identity(); });
+	RegisterOperation("Mat4x3/Determinant",     [](uint32_t i) { return Mat4x3::Determinant(benchInputs.mat4x3s[i]); });
+	RegisterOperation("Mat4x3/InverseAffine",   [](uint32_t i) { return Mat4x3::InverseAffine(benchInputs.mat4x3s[i]); });
+	RegisterOperation("Mat4x3/InverseRigid",    [](uint32_t i) { return Mat4x3::InverseRigid(benchInputs.mat4x3s[i]); });
+	RegisterOperation("Mat4x3/TransformPoint",  [](uint32_t i) { return Mat4x3::TransformPoint(benchInputs.vec3fs[i], benchInputs.mat4x3s[i]); });
+	RegisterOperation("Mat4x3/TransformVector", [](uint32_t i) { return Mat4x3::TransformVector(benchInputs.vec3fs[i], benchInputs.mat4x3s[i]); });
+	RegisterOperation("Mat4x3/ToMat",           [](uint32_t i) { return Mat4x3::ToMat(benchInputs.mat4x3s[i]); });
+	RegisterOperation("Mat4x3/ToMat4x3",        [](uint32_t i) { return Mat4x3::ToMat4x3(benchInputs.mat4x4s[i]); });
+}
\ No newline at end of file
@@ -0,0 +1,166 @@
+#include <cstdio>
+#include <vector>
+
+#include "Frustum.h"
+#include "OcclusionBuffer.h"
+#include "RandomStream.h"
+
+#include "MathBench.h"
+
+/**
+ * @brief  ڿ ġϴ  Դϴ.
+ */
+static const uint32_t BENCH_OCCLUDEE_COUNT = 4096;
+
+/**
+ * @brief ü    ϳ   Դϴ.
+ */
+static const uint32_t BENCH_WALL_COUNT = 4;
+static const uint32_t BENCH_WALL_GRID_X = 24;
+static const uint32_t BENCH_WALL_GRID_Y = 16;
+
+/**
+ * @brief  ø ġũ ϴ Դϴ.
+ *
+ * @note z = 0 ƴ ִ    ,  (z > 0)  Ѹ  z = -20  ٶ󺾴ϴ.
+ */
+static Mat4x4 viewProjection;
+static std::vector<Vec3f> wallPositions;
+static std::vector<uint32_t> wallIndices;
+static std::vector<Vec3f> centers;
+static std::vector<float> radii;
+static std::vector<uint32_t> frustumIndices;
+static std::vector<uint32_t> visibleIndices;
+static uint32_t frustumVisibleCount = 0;
+
+/**
+ * @brief  ø ġũ  մϴ.
+ */
+static void InitializeOcclusionScene()
+{
+	if (!wallPositions.empty())
+	{
+		return;
+	}
+
+	float aspect = static_cast<float>(OcclusionBuffer::DEFAULT_WIDTH) / static_cast<float>(OcclusionBuffer::DEFAULT_HEIGHT);
+	viewProjection = Mat4x4::LookAt(Vec3f(0.0f, 3.0f, -20.0f), Vec3f(0.0f, 3.0f, 0.0f), Vec3f(0.0f, 1.0f, 0.0f)) * Mat4x4::Perspective(PiDiv4, aspect, 0.1f, 200.0f);
+
+	for (uint32_t wall = 0; wall < BENCH_WALL_COUNT; ++wall)
+	{
+		float minX = -24.0f + 12.0f * static_cast<float>(wall);
+		uint32_t baseVertex = static_cast<uint32_t>(wallPositions.size());
+
+		for (uint32_t y = 0; y <= BENCH_WALL_GRID_Y; ++y)
+		{
+			for (uint32_t x = 0; x <= BENCH_WALL_GRID_X; ++x)
+			{
+				float u = static_cast<float>(x) / static_cast<float>(BENCH_WALL_GRID_X);
+				float v = static_cast<float>(y) / static_cast<float>(BENCH_WALL_GRID_Y);
+				wallPositions.push_back(Vec3f(minX + 11.0f * u, 8.0f * v, 0.0f));
+			}
+		}
+
+		for (uint32_t y = 0; y < BENCH_WALL_GRID_Y; ++y)
+		{
+			for (uint32_t x = 0; x < BENCH_WALL_GRID_X; ++x)
+			{
+				uint32_t v0 = baseVertex + y * (BENCH_WALL_GRID_X + 1) + x;
+				uint32_t v1 = v0 + 1;
+				uint32_t v2 = v0 + BENCH_WALL_GRID_X + 1;
+				uint32_t v3 = v2 + 1;
+
+				wallIndices.insert(wallIndices.end(), { v0, v2, v1, v1, v2, v3 });
+			}
+		}
+	}
+
+	RandomStream stream(RandomStream::DEFAULT_SEED);
+	centers.resize(BENCH_OCCLUDEE_COUNT);
+	radii.resize(BENCH_OCCLUDEE_COUNT);
+	for (uint32_t index = 0; index < BENCH_OCCLUDEE_COUNT; ++index)
+	{
+		centers[index] = Vec3f(stream.NextFloat(-30.0f, 30.0f), stream.NextFloat(0.5f, 12.0f), stream.NextFloat(2.0f, 60.0f));
+		radii[index] = stream.NextFloat(0.3f, 1.0f);
+	}
+
+	frustumIndices.resize(BENCH_OCCLUDEE_COUNT);
+	visibleIndices.resize(BENCH_OCCLUDEE_COUNT);
+
+	Frustum frustum(viewProjection);
+	frustumVisibleCount = frustum.CullSpheres(centers.data(), radii.data(), BENCH_OCCLUDEE_COUNT, frustumIndices.data());
+}
+
+/**
+ * @brief  ü  ۿ ׸ϴ.
+ */
+static void RasterizeWalls(OcclusionBuffer& buffer, bool bIsParallel)
+{
+	buffer.Clear(viewProjection);
+	buffer.AddOccluder(wallPositions.data(), static_cast<uint32_t>(wallPositions.size()), wallIndices.data(), static_cast<uint32_t>(wallIndices.size()), Mat4x4::Identity());
+	buffer.Rasterize(bIsParallel ? ParallelForJobs : nullptr);
+}
+
+void PrintOcclusionCounters()
+{
+	InitializeOcclusionScene();
+
+	OcclusionBuffer buffer;
+	RasterizeWalls(buffer, true);
+
+	uint32_t visibleCount = buffer.CullSpheres(centers.data(), radii.data(), frustumIndices.data(), frustumVisibleCount, visibleIndices.data());
+	const OcclusionBuffer::Stats& stats = buffer.GetStats();
+
+	std::printf("Occlusion culling (%ux%u depth buffer)\n", buffer.GetWidth(), buffer.GetHeight());
+	std::printf("  %-24s %u\n", "occluder triangles", stats.occluderTriangleCount);
+	std::printf("  %-24s %u\n", "binned triangles", stats.binnedTriangleCount);
+	std::printf("  %-24s %u\n", "spheres", BENCH_OCCLUDEE_COUNT);
+	std::printf("  %-24s %u\n", "frustum visible", frustumVisibleCount);
+	std::printf("  %-24s %u\n", "occlusion visible", visibleCount);
+	std::printf("  %-24s %u\n", "occlusion culled", frustumVisibleCount - visibleCount);
+	std::printf("\n");
+}
+
+void RegisterOcclusionBenchmarks()
+{
+	InitializeOcclusionScene();
+
+	uint32_t triangleCount = static_cast<uint32_t>(wallIndices.size() / 3);
+
+	BenchModule::Register("OcclusionBuffer/Rasterize", [](uint64_t iterations)
+		{
+			OcclusionBuffer buffer;
+			for (uint64_t iteration = 0; iteration < iterations; ++iteration)
+			{
+				RasterizeWalls(buffer, false);
+				BenchModule::ClobberMemory();
+			}
+		},
+		triangleCount
+	);
+
+	BenchModule::Register("OcclusionBuffer/RasterizeParallel", [](uint64_t iterations)
+		{
+			OcclusionBuffer buffer;
+			for (uint64_t iteration = 0; iteration < iterations; ++iteration)
+			{
+				RasterizeWalls(buffer, true);
+				BenchModule::ClobberMemory();
+			}
+		},
+		triangleCount
+	);
+
+	BenchModule::Register("OcclusionBuffer/CullSpheres", [](uint64_t iterations)
+		{
+			OcclusionBuffer buffer;
+			RasterizeWalls(buffer, true);
+
+			for (uint64_t iteration = 0; iteration < iterations; ++iteration)
+			{
+				BenchModule::DoNotOptimize(buffer.CullSpheres(centers.data(), radii.data(), frustumIndices.data(), frustumVisibleCount, visibleIndices.data()));
+			}
+		},
+		frustumVisibleCount
+	);
+}
\ No newline at end of file
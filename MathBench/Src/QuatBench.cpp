@@ -0,0 +1,70 @@
+#include "MathBench.h"
+#include "QuatWide.h"
+
+/**
+ * @brief SIMD  ʹϾ  ġũ մϴ.    ϳ ðԴϴ.
+ */
+template <typename T>
+static void RegisterWideQuatBenchmarks(const std::string& type)
+{
+	using Quatx = QuatWide<T>;
+	using Vec3x = Vec3Wide<T>;
+	const uint32_t laneMask = ~(T::LANE_COUNT - 1);
+	const uint64_t laneCount = T::LANE_COUNT;
+
+	RegisterOperation(type + "/Load",         [laneMask](uint32_t i) { return Quatx::Load(&benchInputs.quats[i & laneMask]); }, laneCount);
+	RegisterOperation(type + "/Mul",          [laneMask](uint32_t i) { return Quatx::Load(&benchInputs.quats[i & laneMask]) * Quatx::Load(&benchInputs.quats[(i & laneMask) + 1]); }, laneCount);
+	RegisterOperation(type + "/MulVec3",      [laneMask](uint32_t i) { return Quatx::Load(&benchInputs.quats[i & laneMask]) * Vec3x::Load(&benchInputs.vec3fs[i & laneMask]); }, laneCount);
+	RegisterOperation(type + "/Dot",          [laneMask](uint32_t i) { return Quatx::Dot(Quatx::Load(&benchInputs.quats[i & laneMask]), Quatx::Load(&benchInputs.quats[(i & laneMask) + 1])); }, laneCount);
+	RegisterOperation(type + "/Normalize",    [laneMask](uint32_t i) { return Quatx::Normalize(Quatx::Load(&benchInputs.quats[i & laneMask])); }, laneCount);
+	RegisterOperation(type + "/Conjugate",    [laneMask](uint32_t i) { return Quatx::Conjugate(Quatx::Load(&benchInputs.quats[i & laneMask])); }, laneCount);
+	RegisterOperation(type + "/Inverse",      [laneMask](uint32_t i) { return Quatx::Inverse(Quatx::Load(&benchInputs.quats[i & laneMask])); }, laneCount);
+	RegisterOperation(type + "/Lerp",         [laneMask](uint32_t i) { return Quatx::Lerp(Quatx::Load(&benchInputs.quats[i & laneMask]), Quatx::Load(&benchInputs.quats[(i & laneMask) + 1]), T::Load(&benchInputs.ratios[i & laneMask])); }, laneCount);
+	RegisterOperation(type + "/Nlerp",        [laneMask](uint32_t i) { return Quatx::Nlerp(Quatx::Load(&benchInputs.quats[i & laneMask]), Quatx::Load(&benchInputs.quats[(i & laneMask) + 1]), T::Load(&benchInputs.ratios[i & laneMask])); }, laneCount);
+	RegisterOperation(type + "/Slerp",        [laneMask](uint32_t i) { return Quatx::Slerp(Quatx::Load(&benchInputs.quats[i & laneMask]), Quatx::Load(&benchInputs.quats[(i & laneMask) + 1]), T::Load(&benchInputs.ratios[i & laneMask])); }, laneCount);
+}
+
+void RegisterQuatBenchmarks()
+{
+	const Quat* quats = benchInputs.quats;
+	const Vec3f* vectors = benchInputs.vec3fs;
+	const float* ratios = benchInputs.ratios;
+
+	RegisterOperation("Quat/Negate",            [quats](uint32_t i) { return -quats[i]; });
+	RegisterOperation("Quat/Add",               [quats](uint32_t i) { return quats[i] + quats[i + 1]; });
+	RegisterOperation("Quat/Sub",               [quats](uint32_t i) { return quats[i] - quats[i + 1]; });
+	RegisterOperation("Quat/MulScalar",         [quats, ratios](uint32_t i) { return quats[i] * ratios[i]; });
+	RegisterOperation("Quat/Mul",               [quats](uint32_t i) { return quats[i] * quats[i + 1]; });
+	RegisterOperation("Quat/MulVec3",           [quats, vectors](uint32_t i) { return quats[i] * vectors[i]; });
+	RegisterOperation("Quat/AddAssign",         [quats](uint32_t i) { Quat q = quats[i]; q += quats[i + 1]; return q; });
+	RegisterOperation("Quat/SubAssign",         [quats](uint32_t i) { Quat q = quats[i]; q -= quats[i + 1]; return q; });
+	RegisterOperation("Quat/MulAssign",         [quats, ratios](uint32_t i) { Quat q = quats[i]; q *= ratios[i]; return q; });
+	RegisterOperation("Quat/Equal",             [quats](uint32_t i) { return quats[i] == quats[i + 1]; });
+	RegisterOperation("Quat/NotEqual",          [quats](uint32_t i) { return quats[i] != quats[i + 1]; });
+	RegisterOperation("Quat/AxisRadian",        [vectors](uint32_t i) { return Quat::AxisRadian(Vec3f::Normalize(vectors[i]), benchInputs.radians[i]); });
+	RegisterOperation("Quat/AxisAngle",         [vectors](uint32_t i) { return Quat::AxisAngle(Vec3f::Normalize(vectors[i]), benchInputs.radians[i]); });
+	RegisterOperation("Quat/Axis",              [quats](uint32_t i) { return Quat::Axis(quats[i]); });
+	RegisterOperation("Quat/Radian",            [quats](uint32_t i) { return Quat::Radian(quats[i]); });
+	RegisterOperation("Quat/Angle",             [quats](uint32_t i) { return Quat::Angle(quats[i]); });
+	RegisterOperation("Quat/Dot",               [quats](uint32_t i) { return Quat::Dot(quats[i], quats[i + 1]); });
+	RegisterOperation("Quat/LengthSq",          [quats](uint32_t i) { return Quat::LengthSq(quats[i]); });
+	RegisterOperation("Quat/Length",            [quats](uint32_t i) { return Quat::Length(quats[i]); });
+	RegisterOperation("Quat/Normalize",         [quats](uint32_t i) { return Quat::Normalize(quats[i]); });
+	RegisterOperation("Quat/Conjugate",         [quats](uint32_t i) { return Quat::Conjugate(quats[i]); });
+	RegisterOperation("Quat/Inverse",           [quats](uint32_t i) { return Quat::Inverse(quats[i]); });
+	RegisterOperation("Quat/Zero",              [](uint32_t) { return Quat::Zero(); });
+	RegisterOperation("Quat/Identity",          [](uint32_t) { return Quat::Identity(); });
+	RegisterOperation("Quat/Rotate",            [vectors](uint32_t i) { return Quat::Rotate(vectors[i], vectors[i + 1]); });
+	RegisterOperation("Quat/Lerp",              [quats, ratios](uint32_t i) { return Quat::Lerp(quats[i], quats[i + 1], ratios[i]); });
+	RegisterOperation("Quat/Nlerp",             [quats, ratios](uint32_t i) { return Quat::Nlerp(quats[i], quats[i + 1], ratios[i]); });
+	RegisterOperation("Quat/Slerp",             [quats, ratios](uint32_t i) { return Quat::Slerp(quats[i], quats[i + 1], ratios[i]); });
+	RegisterOperation("Quat/Nslerp",            [quats, ratios](uint32_t i) { return Quat::Nslerp(quats[i], quats[i + 1], ratios[i]); });
+	RegisterOperation("Quat/Pow",               [quats, ratios](uint32_t i) { return Quat::Pow(quats[i], ratios[i]); });
+	RegisterOperation("Quat/LookRotate",        [vectors](uint32_t i) { return Quat::LookRotate(vectors[i], Vec3f(0.0f, 1.0f, 0.0f)); });
+	RegisterOperation("Quat/ToMat",             [quats](uint32_t i) { return Quat::ToMat(quats[i]); });
+	RegisterOperation("Quat/ToQuat",            [](uint32_t i) { return Quat::ToQuat(benchInputs.mat4x4s[i]); });
+	RegisterOperation("Quat/IsSameOrientation", [quats](uint32_t i) { Quat q = quats[i]; return q.IsSameOrientation(quats[i], quats[i + 1]); });
+
+	RegisterWideQuatBenchmarks<Floatx4>("Quatx4");
+	RegisterWideQuatBenchmarks<Floatx8>("Quatx8");
+}
\ No newline at end of file
@@ -0,0 +1,97 @@
+#include <vector>
+
+#include "MathBench.h"
+#include "TransformStream.h"
+
+void RegisterTransformBenchmarks()
+{
+	const Transform* transforms = benchInputs.transforms;
+
+	RegisterOperation("Transform/Equal",          [transforms](uint32_t i) { Transform t = transforms[i]; return t == transforms[i + 1]; });
+	RegisterOperation("Transform/NotEqual",       [transforms](uint32_t i) { Transform t = transforms[i]; return t != transforms[i + 1]; });
+	RegisterOperation("Transform/ToMat",          [transforms](uint32_t i) { return Transform::ToMat(transforms[i]); });
+	RegisterOperation("Transform/ToMat4x3",       [transforms](uint32_t i) { return Transform::ToMat4x3(transforms[i]); });
+	RegisterOperation("Transform/ToTransform",    [](uint32_t i) { return Transform::ToTransform(benchInputs.mat4x4s[i]); });
+	RegisterOperation("Transform/ToTransform4x3", [](uint32_t i) { return Transform::ToTransform(benchInputs.mat4x3s[i]); });
+	RegisterOperation("Transform/Combine",        [transforms](uint32_t i) { return Transform::Combine(transforms[i], transforms[i + 1]); });
+	RegisterOperation("Transform/Inverse",        [transforms](uint32_t i) { return Transform::Inverse(transforms[i]); });
+	RegisterOperation("Transform/Mix",            [transforms](uint32_t i) { return Transform::Mix(transforms[i], transforms[i + 1], benchInputs.ratios[i]); });
+
+	static TransformStream stream(BENCH_INPUT_COUNT);
+	static TransformStream otherStream(BENCH_INPUT_COUNT);
+	static TransformStream outStream(BENCH_INPUT_COUNT);
+	static std::vector<Transform> outTransforms(BENCH_INPUT_COUNT);
+	static std::vector<Mat4x4> outMatrices(BENCH_INPUT_COUNT);
+
+	for (uint32_t index = 0; index < BENCH_INPUT_COUNT; ++index)
+	{
+		stream.Set(index, transforms[index]);
+		otherStream.Set(index, transforms[index + 1]);
+	}
+
+	BenchModule::Register("TransformStream/ToMatrices", [transforms](uint64_t iterations)
+		{
+			for (uint64_t iteration = 0; iteration < iterations; ++iteration)
+			{
+				TransformStream::ToMatrices(transforms, outMatrices.data(), BENCH_INPUT_COUNT);
+				BenchModule::DoNotOptimize(outMatrices.data());
+			}
+		},
+		BENCH_INPUT_COUNT
+	);
+
+	BenchModule::Register("TransformStream/ToMatricesSoA", [](uint64_t iterations)
+		{
+			for (uint64_t iteration = 0; iteration < iterations; ++iteration)
+			{
+				TransformStream::ToMatrices(stream, outMatrices.data());
+				BenchModule::DoNotOptimize(outMatrices.data());
+			}
+		},
+		BENCH_INPUT_COUNT
+	);
+
+	BenchModule::Register("TransformStream/Combine", [transforms](uint64_t iterations)
+		{
+			for (uint64_t iteration = 0; iteration < iterations; ++iteration)
+			{
+				TransformStream::Combine(transforms, transforms + 1, outTransforms.data(), BENCH_INPUT_COUNT);
+				BenchModule::DoNotOptimize(outTransforms.data());
+			}
+		},
+		BENCH_INPUT_COUNT
+	);
+
+	BenchModule::Register("TransformStream/CombineSoA", [](uint64_t iterations)
+		{
+			for (uint64_t iteration = 0; iteration < iterations; ++iteration)
+			{
+				TransformStream::Combine(stream, otherStream, outStream);
+				BenchModule::ClobberMemory();
+			}
+		},
+		BENCH_INPUT_COUNT
+	);
+
+	BenchModule::Register("TransformStream/Inverse", [transforms](uint64_t iterations)
+		{
+			for (uint64_t iteration = 0; iteration < iterations; ++iteration)
+			{
+				TransformStream::Inverse(transforms, outTransforms.data(), BENCH_INPUT_COUNT);
+				BenchModule::DoNotOptimize(outTransforms.data());
+			}
+		},
+		BENCH_INPUT_COUNT
+	);
+
+	BenchModule::Register("TransformStream/InverseSoA", [](uint64_t iterations)
+		{
+			for (uint64_t iteration = 0; iteration < iterations; ++iteration)
+			{
+				TransformStream::Inverse(stream, outStream);
+				BenchModule::ClobberMemory();
+			}
+		},
+		BENCH_INPUT_COUNT
+	);
+}
\ No newline at end of file
@@ -0,0 +1,81 @@
+#include "MathBench.h"
+#include "Vec3Wide.h"
+
+/**
+ * @brief /Ǽ Ͱ  ϴ  ġũ մϴ.
+ */
+template <typename T>
+static void RegisterCommonVecBenchmarks(const std::string& type, const T* inputs)
+{
+	RegisterOperation(type + "/Negate",       [inputs](uint32_t i) { return -inputs[i]; });
+	RegisterOperation(type + "/Add",          [inputs](uint32_t i) { return inputs[i] + inputs[i + 1]; });
+	RegisterOperation(type + "/Sub",          [inputs](uint32_t i) { return inputs[i] - inputs[i + 1]; });
+	RegisterOperation(type + "/Mul",          [inputs](uint32_t i) { return inputs[i] * inputs[i + 1]; });
+	RegisterOperation(type + "/AddAssign",    [inputs](uint32_t i) { T v = inputs[i]; v += inputs[i + 1]; return v; });
+	RegisterOperation(type + "/SubAssign",    [inputs](uint32_t i) { T v = inputs[i]; v -= inputs[i + 1]; return v; });
+	RegisterOperation(type + "/Equal",        [inputs](uint32_t i) { T v = inputs[i]; return v == inputs[i + 1]; });
+	RegisterOperation(type + "/NotEqual",     [inputs](uint32_t i) { T v = inputs[i]; return v != inputs[i + 1]; });
+	RegisterOperation(type + "/Dot",          [inputs](uint32_t i) { return T::Dot(inputs[i], inputs[i + 1]); });
+	RegisterOperation(type + "/LengthSq",     [inputs](uint32_t i) { return T::LengthSq(inputs[i]); });
+	RegisterOperation(type + "/Length",       [inputs](uint32_t i) { return T::Length(inputs[i]); });
+	RegisterOperation(type + "/Radian",       [inputs](uint32_t i) { return T::Radian(inputs[i], inputs[i + 1]); });
+	RegisterOperation(type + "/Degree",       [inputs](uint32_t i) { return T::Degree(inputs[i], inputs[i + 1]); });
+}
+
+/**
+ * @brief Ǽ ͸ ϴ  ġũ մϴ.
+ */
+template <typename T>
+static void RegisterFloatVecBenchmarks(const std::string& type, const T* inputs)
+{
+	RegisterCommonVecBenchmarks(type, inputs);
+
+	RegisterOperation(type + "/Normalize",    [inputs](uint32_t i) { return T::Normalize(inputs[i]); });
+	RegisterOperation(type + "/Project",      [inputs](uint32_t i) { return T::Project(inputs[i], inputs[i + 1]); });
+	RegisterOperation(type + "/Reject",       [inputs](uint32_t i) { return T::Reject(inputs[i], inputs[i + 1]); });
+	RegisterOperation(type + "/Lerp",         [inputs](uint32_t i) { return T::Lerp(inputs[i], inputs[i + 1], benchInputs.ratios[i]); });
+	RegisterOperation(type + "/Slerp",        [inputs](uint32_t i) { return T::Slerp(inputs[i], inputs[i + 1], benchInputs.ratios[i]); });
+}
+
+/**
+ * @brief SIMD    ġũ մϴ.    ϳ ðԴϴ.
+ */
+template <typename T>
+static void RegisterWideVecBenchmarks(const std::string& type)
+{
+	using Vec3x = Vec3Wide<T>;
+	const uint32_t laneMask = ~(T::LANE_COUNT - 1);
+	const uint64_t laneCount = T::LANE_COUNT;
+
+	RegisterOperation(type + "/Load",         [laneMask](uint32_t i) { return Vec3x::Load(&benchInputs.vec3fs[i & laneMask]); }, laneCount);
+	RegisterOperation(type + "/Add",          [laneMask](uint32_t i) { return Vec3x::Load(&benchInputs.vec3fs[i & laneMask]) + Vec3x::Load(&benchInputs.vec3fs[(i & laneMask) + 1]); }, laneCount);
+	RegisterOperation(type + "/Dot",          [laneMask](uint32_t i) { return Vec3x::Dot(Vec3x::Load(&benchInputs.vec3fs[i & laneMask]), Vec3x::Load(&benchInputs.vec3fs[(i & laneMask) + 1])); }, laneCount);
+	RegisterOperation(type + "/Cross",        [laneMask](uint32_t i) { return Vec3x::Cross(Vec3x::Load(&benchInputs.vec3fs[i & laneMask]), Vec3x::Load(&benchInputs.vec3fs[(i & laneMask) + 1])); }, laneCount);
+	RegisterOperation(type + "/Length",       [laneMask](uint32_t i) { return Vec3x::Length(Vec3x::Load(&benchInputs.vec3fs[i & laneMask])); }, laneCount);
+	RegisterOperation(type + "/Normalize",    [laneMask](uint32_t i) { return Vec3x::Normalize(Vec3x::Load(&benchInputs.vec3fs[i & laneMask])); }, laneCount);
+	RegisterOperation(type + "/Lerp",         [laneMask](uint32_t i) { return Vec3x::Lerp(Vec3x::Load(&benchInputs.vec3fs[i & laneMask]), Vec3x::Load(&benchInputs.vec3fs[(i & laneMask) + 1]), T::Load(&benchInputs.ratios[i & laneMask])); }, laneCount);
+	RegisterOperation(type + "/Slerp",        [laneMask](uint32_t i) { return Vec3x::Slerp(Vec3x::Load(&benchInputs.vec3fs[i & laneMask]), Vec3x::Load(&benchInputs.vec3fs[(i & laneMask) + 1]), T::Load(&benchInputs.ratios[i & laneMask])); }, laneCount);
+	RegisterOperation(type + "/Min",          [laneMask](uint32_t i) { return Vec3x::Min(Vec3x::Load(&benchInputs.vec3fs[i & laneMask]), Vec3x::Load(&benchInputs.vec3fs[(i & laneMask) + 1])); }, laneCount);
+	RegisterOperation(type + "/Max",          [laneMask](uint32_t i) { return Vec3x::Max(Vec3x::Load(&benchInputs.vec3fs[i & laneMask]), Vec3x::Load(&benchInputs.vec3fs[(i & laneMask) + 1])); }, laneCount);
+}
+
+void RegisterVecBenchmarks()
+{
+	RegisterCommonVecBenchmarks("Vec2i", benchInputs.vec2is);
+	RegisterOperation("Vec2i/Cross", [](uint32_t i) { return Vec2i::Cross(benchInputs.vec2is[i], benchInputs.vec2is[i + 1]); });
+
+	RegisterFloatVecBenchmarks("Vec2f", benchInputs.vec2fs);
+	RegisterOperation("Vec2f/Cross", [](uint32_t i) { return Vec2f::Cross(benchInputs.vec2fs[i], benchInputs.vec2fs[i + 1]); });
+
+	RegisterCommonVecBenchmarks("Vec3i", benchInputs.vec3is);
+	RegisterOperation("Vec3i/Cross", [](uint32_t i) { return Vec3i::Cross(benchInputs.vec3is[i], benchInputs.vec3is[i + 1]); });
+
+	RegisterFloatVecBenchmarks("Vec3f", benchInputs.vec3fs);
+	RegisterOperation("Vec3f/Cross", [](uint32_t i) { return Vec3f::Cross(benchInputs.vec3fs[i], benchInputs.vec3fs[i + 1]); });
+
+	RegisterCommonVecBenchmarks("Vec4i", benchInputs.vec4is);
+	RegisterFloatVecBenchmarks("Vec4f", benchInputs.vec4fs);
+
+	RegisterWideVecBenchmarks<Floatx4>("Vec3fx4");
+	RegisterWideVecBenchmarks<Floatx8>("Vec3fx8");
+}
\ No newline at end of file
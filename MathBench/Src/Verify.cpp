@@ -0,0 +1,820 @@
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "JobModule.h"
+
+#include "BVH.h"
+#include "MathBench.h"
+#include "RandomStream.h"
+#include "SceneHierarchy.h"
+#include "TransformStream.h"
+
+/**
+ * @brief  ϴ  Է Դϴ.
+ */
+static const uint32_t VERIFY_INPUT_COUNT = 4096;
+
+/**
+ * @brief  ׸񺰷 ϴ ġ  ִ Դϴ.
+ */
+static const uint32_t VERIFY_MAX_REPORT_COUNT = 4;
+
+/**
+ * @brief  ׸ ϳ Դϴ.
+ */
+struct VerifyResult
+{
+	const char* name = nullptr;
+	uint32_t checkCount = 0;
+	uint32_t mismatchCount = 0;
+};
+
+/**
+ * @brief   Ʈ  ϰ, ٸٸ ġ  ŵϴ.
+ */
+static void CheckBits(VerifyResult& result, uint32_t index, const void* actual, const void* expected, std::size_t size)
+{
+	++result.checkCount;
+	if (std::memcmp(actual, expected, size) == 0)
+	{
+		return;
+	}
+
+	if (result.mismatchCount < VERIFY_MAX_REPORT_COUNT)
+	{
+		std::printf("  mismatch %s [%u]\n", result.name, index);
+	}
+	++result.mismatchCount;
+}
+
+/**
+ * @brief  ׸  ϰ ġ  ȯմϴ.
+ */
+static uint32_t Report(const VerifyResult& result)
+{
+	std::printf("  %-32s %8u checks %8u mismatches\n", result.name, result.checkCount, result.mismatchCount);
+	return result.mismatchCount;
+}
+
+/**
+ * @brief Ұ [-10, 10]   4x4  մϴ.
+ */
+static Mat4x4 NextMat4x4(RandomStream& stream)
+{
+	Mat4x4 m;
+	for (uint32_t index = 0; index < 16; ++index)
+	{
+		m.data[index] = stream.NextFloat(-10.0f, 10.0f);
+	}
+
+	return m;
+}
+
+/**
+ * @brief SIMD θ ߰ϱ  Mat4x4 Į ڵԴϴ. SIMD    ڵ Ʈ  ƾ մϴ.
+ */
+struct ScalarMat4x4
+{
+	static Mat4x4 Mul(const Mat4x4& l, const Mat4x4& m)
+	{
+		return Mat4x4(
+			l.e00 * m.e00 + l.e01 * m.e10 + l.e02 * m.e20 + l.e03 * m.e30,
+			l.e00 * m.e01 + l.e01 * m.e11 + l.e02 * m.e21 + l.e03 * m.e31,
+			l.e00 * m.e02 + l.e01 * m.e12 + l.e02 * m.e22 + l.e03 * m.e32,
+			l.e00 * m.e03 + l.e01 * m.e13 + l.e02 * m.e23 + l.e03 * m.e33,
+			l.e10 * m.e00 + l.e11 * m.e10 + l.e12 * m.e20 + l.e13 * m.e30,
+			l.e10 * m.e01 + l.e11 * m.e11 + l.e12 * m.e21 + l.e13 * m.e31,
+			l.e10 * m.e02 + l.e11 * m.e12 + l.e12 * m.e22 + l.e13 * m.e32,
+			l.e10 * m.e03 + l.e11 * m.e13 + l.e12 * m.e23 + l.e13 * m.e33,
+			l.e20 * m.e00 + l.e21 * m.e10 + l.e22 * m.e20 + l.e23 * m.e30,
+			l.e20 * m.e01 + l.e21 * m.e11 + l.e22 * m.e21 + l.e23 * m.e31,
+			l.e20 * m.e02 + l.e21 * m.e12 + l.e22 * m.e22 + l.e23 * m.e32,
+			l.e20 * m.e03 + l.e21 * m.e13 + l.e22 * m.e23 + l.e23 * m.e33,
+			l.e30 * m.e00 + l.e31 * m.e10 + l.e32 * m.e20 + l.e33 * m.e30,
+			l.e30 * m.e01 + l.e31 * m.e11 + l.e32 * m.e21 + l.e33 * m.e31,
+			l.e30 * m.e02 + l.e31 * m.e12 + l.e32 * m.e22 + l.e33 * m.e32,
+			l.e30 * m.e03 + l.e31 * m.e13 + l.e32 * m.e23 + l.e33 * m.e33
+		);
+	}
+
+	static bool Equal(const Mat4x4& l, const Mat4x4& m)
+	{
+		for (uint32_t index = 0; index < 16; ++index)
+		{
+			if (!(MathModule::Abs(l.data[index] - m.data[index]) <= Epsilon))
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	static Mat4x4 Transpose(const Mat4x4& m)
+	{
+		return Mat4x4(
+			m.e00, m.e10, m.e20, m.e30,
+			m.e01, m.e11, m.e21, m.e31,
+			m.e02, m.e12, m.e22, m.e32,
+			m.e03, m.e13, m.e23, m.e33
+		);
+	}
+
+	static float Determinant(const Mat4x4& m)
+	{
+		float subFactor00 = m.e22 * m.e33 - m.e32 * m.e23;
+		float subFactor01 = m.e21 * m.e33 - m.e31 * m.e23;
+		float subFactor02 = m.e21 * m.e32 - m.e31 * m.e22;
+		float subFactor03 = m.e20 * m.e33 - m.e30 * m.e23;
+		float subFactor04 = m.e20 * m.e32 - m.e30 * m.e22;
+		float subFactor05 = m.e20 * m.e31 - m.e30 * m.e21;
+
+		float cof0 = +(m.e11 * subFactor00 - m.e12 * subFactor01 + m.e13 * subFactor02);
+		float cof1 = -(m.e10 * subFactor00 - m.e12 * subFactor03 + m.e13 * subFactor04);
+		float cof2 = +(m.e10 * subFactor01 - m.e11 * subFactor03 + m.e13 * subFactor05);
+		float cof3 = -(m.e10 * subFactor02 - m.e11 * subFactor04 + m.e12 * subFactor05);
+
+		return m.e00 * cof0 + m.e01 * cof1 + m.e02 * cof2 + m.e03 * cof3;
+	}
+
+	static Mat4x4 Inverse(const Mat4x4& m)
+	{
+		float oneOverDeterminant = 1.0f / Determinant(m);
+
+		float coef00 = m.e22 * m.e33 - m.e32 * m.e23;
+		float coef02 = m.e12 * m.e33 - m.e32 * m.e13;
+		float coef03 = m.e12 * m.e23 - m.e22 * m.e13;
+
+		float coef04 = m.e21 * m.e33 - m.e31 * m.e23;
+		float coef06 = m.e11 * m.e33 - m.e31 * m.e13;
+		float coef07 = m.e11 * m.e23 - m.e21 * m.e13;
+
+		float coef08 = m.e21 * m.e32 - m.e31 * m.e22;
+		float coef10 = m.e11 * m.e32 - m.e31 * m.e12;
+		float coef11 = m.e11 * m.e22 - m.e21 * m.e12;
+
+		float coef12 = m.e20 * m.e33 - m.e30 * m.e23;
+		float coef14 = m.e10 * m.e33 - m.e30 * m.e13;
+		float coef15 = m.e10 * m.e23 - m.e20 * m.e13;
+
+		float coef16 = m.e20 * m.e32 - m.e30 * m.e22;
+		float coef18 = m.e10 * m.e32 - m.e30 * m.e12;
+		float coef19 = m.e10 * m.e22 - m.e20 * m.e12;
+
+		float coef20 = m.e20 * m.e31 - m.e30 * m.e21;
+		float coef22 = m.e10 * m.e31 - m.e30 * m.e11;
+		float coef23 = m.e10 * m.e21 - m.e20 * m.e11;
+
+		Vec4f fac0(coef00, coef00, coef02, coef03);
+		Vec4f fac1(coef04, coef04, coef06, coef07);
+		Vec4f fac2(coef08, coef08, coef10, coef11);
+		Vec4f fac3(coef12, coef12, coef14, coef15);
+		Vec4f fac4(coef16, coef16, coef18, coef19);
+		Vec4f fac5(coef20, coef20, coef22, coef23);
+
+		Vec4f vec0(m.e10, m.e00, m.e00, m.e00);
+		Vec4f vec1(m.e11, m.e01, m.e01, m.e01);
+		Vec4f vec2(m.e12, m.e02, m.e02, m.e02);
+		Vec4f vec3(m.e13, m.e03, m.e03, m.e03);
+
+		Vec4f inv0(vec1 * fac0 - vec2 * fac1 + vec3 * fac2);
+		Vec4f inv1(vec0 * fac0 - vec2 * fac3 + vec3 * fac4);
+		Vec4f inv2(vec0 * fac1 - vec1 * fac3 + vec3 * fac5);
+		Vec4f inv3(vec0 * fac2 - vec1 * fac4 + vec2 * fac5);
+
+		Vec4f signA(+1.0f, -1.0f, +1.0f, -1.0f);
+		Vec4f signB(-1.0f, +1.0f, -1.0f, +1.0f);
+
+		Vec4f col0 = (inv0 * signA) * oneOverDeterminant;
+		Vec4f col1 = (inv1 * signB) * oneOverDeterminant;
+		Vec4f col2 = (inv2 * signA) * oneOverDeterminant;
+		Vec4f col3 = (inv3 * signB) * oneOverDeterminant;
+
+		return Mat4x4(
+			col0.x, col0.y, col0.z, col0.w,
+			col1.x, col1.y, col1.z, col1.w,
+			col2.x, col2.y, col2.z, col2.w,
+			col3.x, col3.y, col3.z, col3.w
+		);
+	}
+};
+
+/**
+ * @brief Mat4x4 , , ġ, Ľ, 񱳸 Į ڵ մϴ.
+ */
+static uint32_t VerifyMat4x4()
+{
+	RandomStream stream(RandomStream::DEFAULT_SEED);
+
+	VerifyResult mul{ "Mat4x4/Mul" };
+	VerifyResult inverse{ "Mat4x4/Inverse" };
+	VerifyResult transpose{ "Mat4x4/Transpose" };
+	VerifyResult determinant{ "Mat4x4/Determinant" };
+	VerifyResult equal{ "Mat4x4/Equal" };
+
+	for (uint32_t index = 0; index < VERIFY_INPUT_COUNT; ++index)
+	{
+		Mat4x4 lhs = NextMat4x4(stream);
+		Mat4x4 rhs = NextMat4x4(stream);
+		Mat4x4 transform = Transform::ToMat(Transform(stream.NextUnitVec3() * 10.0f, stream.NextUnitQuat(), Vec3f(stream.NextFloat(0.5f, 2.0f), stream.NextFloat(0.5f, 2.0f), stream.NextFloat(0.5f, 2.0f))));
+
+		Mat4x4 product = lhs * rhs;
+		Mat4x4 expectedProduct = ScalarMat4x4::Mul(lhs, rhs);
+		CheckBits(mul, index, &product, &expectedProduct, sizeof(Mat4x4));
+
+		Mat4x4 transformProduct = transform * lhs;
+		Mat4x4 expectedTransformProduct = ScalarMat4x4::Mul(transform, lhs);
+		CheckBits(mul, index, &transformProduct, &expectedTransformProduct, sizeof(Mat4x4));
+
+		for (const Mat4x4& m : { lhs, transform })
+		{
+			Mat4x4 inv = Mat4x4::Inverse(m);
+			Mat4x4 expectedInv = ScalarMat4x4::Inverse(m);
+			CheckBits(inverse, index, &inv, &expectedInv, sizeof(Mat4x4));
+
+			Mat4x4 t = Mat4x4::Transpose(m);
+			Mat4x4 expectedT = ScalarMat4x4::Transpose(m);
+			CheckBits(transpose, index, &t, &expectedT, sizeof(Mat4x4));
+
+			float det = Mat4x4::Determinant(m);
+			float expectedDet = ScalarMat4x4::Determinant(m);
+			CheckBits(determinant, index, &det, &expectedDet, sizeof(float));
+		}
+
+		//  ϳ Epsilon  ó ٲ㼭, ٰ ϴ 谡 Į ڵ  Ȯմϴ.
+		Mat4x4 nearby = lhs;
+		nearby.data[index % 16] += stream.NextFloat(-2.0f * Epsilon, 2.0f * Epsilon);
+
+		for (const Mat4x4& m : { lhs, nearby, rhs })
+		{
+			bool bIsEqual = (lhs == m);
+			bool bIsExpectedEqual = ScalarMat4x4::Equal(lhs, m);
+			CheckBits(equal, index, &bIsEqual, &bIsExpectedEqual, sizeof(bool));
+
+			bool bIsNotEqual = (lhs != m);
+			bool bIsExpectedNotEqual = !bIsExpectedEqual;
+			CheckBits(equal, index, &bIsNotEqual, &bIsExpectedNotEqual, sizeof(bool));
+		}
+	}
+
+	return Report(mul) + Report(inverse) + Report(transpose) + Report(determinant) + Report(equal);
+}
+
+/**
+ * @brief TransformStream ϰ ȯ, , ȯ Transform Į ڵ մϴ.
+ *
+ * @note Է  4  ƴ  ξ, SIMD  ä ϴ  ҵ Ȯմϴ.
+ */
+static uint32_t VerifyTransformStream()
+{
+	RandomStream stream(RandomStream::DEFAULT_SEED);
+
+	uint32_t count = VERIFY_INPUT_COUNT - 1;
+	std::vector<Transform> lhs(count);
+	std::vector<Transform> rhs(count);
+	for (uint32_t index = 0; index < count; ++index)
+	{
+		lhs[index] = Transform(stream.NextUnitVec3() * stream.NextFloat(0.0f, 100.0f), stream.NextUnitQuat(), Vec3f(stream.NextFloat(0.5f, 2.0f), stream.NextFloat(0.5f, 2.0f), stream.NextFloat(0.5f, 2.0f)));
+		rhs[index] = Transform(stream.NextUnitVec3() * stream.NextFloat(0.0f, 100.0f), stream.NextUnitQuat(), Vec3f(stream.NextFloat(0.5f, 2.0f), stream.NextFloat(0.5f, 2.0f), stream.NextFloat(0.5f, 2.0f)));
+	}
+
+	VerifyResult toMatrices{ "TransformStream/ToMatrices" };
+	VerifyResult combine{ "TransformStream/Combine" };
+	VerifyResult inverse{ "TransformStream/Inverse" };
+
+	std::vector<Mat4x4> matrices(count);
+	std::vector<Transform> combined(count);
+	std::vector<Transform> inversed(count);
+	TransformStream::ToMatrices(lhs.data(), matrices.data(), count);
+	TransformStream::Combine(lhs.data(), rhs.data(), combined.data(), count);
+	TransformStream::Inverse(lhs.data(), inversed.data(), count);
+
+	TransformStream lhsStream(count);
+	TransformStream rhsStream(count);
+	for (uint32_t index = 0; index < count; ++index)
+	{
+		lhsStream.Set(index, lhs[index]);
+		rhsStream.Set(index, rhs[index]);
+	}
+
+	std::vector<Mat4x4> streamMatrices(count);
+	TransformStream combinedStream(count);
+	TransformStream inversedStream(count);
+	TransformStream::ToMatrices(lhsStream, streamMatrices.data());
+	TransformStream::Combine(lhsStream, rhsStream, combinedStream);
+	TransformStream::Inverse(lhsStream, inversedStream);
+
+	for (uint32_t index = 0; index < count; ++index)
+	{
+		Mat4x4 expectedMatrix = Transform::ToMat(lhs[index]);
+		CheckBits(toMatrices, index, &matrices[index], &expectedMatrix, sizeof(Mat4x4));
+		CheckBits(toMatrices, index, &streamMatrices[index], &expectedMatrix, sizeof(Mat4x4));
+
+		Transform expectedCombined = Transform::Combine(lhs[index], rhs[index]);
+		Transform streamCombined = combinedStream.Get(index);
+		CheckBits(combine, index, &combined[index], &expectedCombined, sizeof(Transform));
+		CheckBits(combine, index, &streamCombined, &expectedCombined, sizeof(Transform));
+
+		Transform expectedInversed = Transform::Inverse(lhs[index]);
+		Transform streamInversed = inversedStream.Get(index);
+		CheckBits(inverse, index, &inversed[index], &expectedInversed, sizeof(Transform));
+		CheckBits(inverse, index, &streamInversed, &expectedInversed, sizeof(Transform));
+	}
+
+	return Report(toMatrices) + Report(combine) + Report(inverse);
+}
+
+/**
+ * @brief MathModule 迭 ﰢ Լ Į Լ մϴ.
+ *
+ * @note Է  SIMD   ƴ  ΰ,   [-1, 1]    Բ Ȯմϴ.
+ */
+static uint32_t VerifyArrayFunctions()
+{
+	RandomStream stream(RandomStream::DEFAULT_SEED);
+
+	uint32_t count = VERIFY_INPUT_COUNT - 3;
+	std::vector<float> radians(count);
+	std::vector<float> values(count);
+	for (uint32_t index = 0; index < count; ++index)
+	{
+		radians[index] = stream.NextFloat(-2.0f * TwoPi, 2.0f * TwoPi);
+		values[index] = stream.NextFloat(-1.0f, 1.0f);
+	}
+
+	const float edgeRadians[] = { 0.0f, -0.0f, PiDiv2, -PiDiv2, Pi, -Pi, TwoPi, -TwoPi };
+	const float edgeValues[] = { 0.0f, -0.0f, 1.0f, -1.0f, 0.5f, -0.5f, 0.99999994f, -0.99999994f };
+	for (uint32_t index = 0; index < sizeof(edgeRadians) / sizeof(float); ++index)
+	{
+		radians[index] = edgeRadians[index];
+		values[index] = edgeValues[index];
+	}
+
+	VerifyResult sinCos{ "MathModule/SinCos" };
+	VerifyResult asin{ "MathModule/ASin" };
+	VerifyResult acos{ "MathModule/ACos" };
+
+	std::vector<float> sins(count);
+	std::vector<float> coss(count);
+	std::vector<float> asins(count);
+	std::vector<float> acoss(values);
+	MathModule::SinCos(radians.data(), sins.data(), coss.data(), count);
+	MathModule::ASin(values.data(), asins.data(), count);
+	MathModule::ACos(acoss.data(), acoss.data(), count);
+
+	for (uint32_t index = 0; index < count; ++index)
+	{
+		float expectedSin = 0.0f;
+		float expectedCos = 0.0f;
+		MathModule::SinCos(radians[index], expectedSin, expectedCos);
+		CheckBits(sinCos, index, &sins[index], &expectedSin, sizeof(float));
+		CheckBits(sinCos, index, &coss[index], &expectedCos, sizeof(float));
+
+		float sin = MathModule::Sin(radians[index]);
+		float cos = MathModule::Cos(radians[index]);
+		CheckBits(sinCos, index, &sin, &expectedSin, sizeof(float));
+		CheckBits(sinCos, index, &cos, &expectedCos, sizeof(float));
+
+		float expectedASin = MathModule::ASin(values[index]);
+		float expectedACos = MathModule::ACos(values[index]);
+		CheckBits(asin, index, &asins[index], &expectedASin, sizeof(float));
+		CheckBits(acos, index, &acoss[index], &expectedACos, sizeof(float));
+	}
+
+	return Report(sinCos) + Report(asin) + Report(acos);
+}
+
+/**
+ * @brief BVH  ϴ Ƽ Դϴ.  ϳ  ʵ  ܰ 尡  ŭ Ӵϴ.
+ */
+static const uint32_t VERIFY_BVH_PRIMITIVE_COUNT = 1024;
+
+/**
+ * @brief BVH  Ƽ긦 ġϴ ü    Դϴ.
+ */
+static const float VERIFY_BVH_EXTENT = 32.0f;
+
+/**
+ * @brief BVH  ϴ   մϴ.
+ *
+ * @note Ϻ  ࿡  ̳ ̰ ѵ  ,   Ѵ  tMax ߸ 츦 Բ Ȯմϴ.
+ */
+static BVH::Ray NextRay(RandomStream& stream, uint32_t index)
+{
+	Vec3f origin(stream.NextFloat(-4.0f, VERIFY_BVH_EXTENT + 4.0f), stream.NextFloat(-4.0f, VERIFY_BVH_EXTENT + 4.0f), stream.NextFloat(-4.0f, VERIFY_BVH_EXTENT + 4.0f));
+	Vec3f direction = stream.NextUnitVec3();
+
+	switch (index % 4)
+	{
+	case 1:
+		direction = Vec3f(0.0f, 0.0f, 0.0f);
+		direction.data[index % 3] = (index & 4) ? 1.0f : -1.0f;
+		break;
+
+	case 2:
+		return BVH::Ray::Segment(origin, origin + direction * stream.NextFloat(1.0f, VERIFY_BVH_EXTENT));
+
+	default:
+		break;
+	}
+
+	return BVH::Ray(origin, direction);
+}
+
+/**
+ * @brief     Ʈ  մϴ.
+ */
+static void CheckHit(VerifyResult& result, uint32_t index, bool bIsHit, const BVH::Hit& hit, bool bIsExpectedHit, const BVH::Hit& expectedHit)
+{
+	CheckBits(result, index, &bIsHit, &bIsExpectedHit, sizeof(bool));
+	if (bIsHit && bIsExpectedHit)
+	{
+		CheckBits(result, index, &hit.t, &expectedHit.t, sizeof(float));
+	}
+}
+
+/**
+ * @brief Ƽ긦 ϳ  BVH  ˻ؼ     ãϴ.
+ *
+ * @note Ƽ ϳ¥ BVH Ʈ  ̹Ƿ,  ˻   Ʈ  ġ⸸    ˴ϴ.
+ */
+static bool BruteIntersectRay(const std::vector<BVH>& primitives, const BVH::Ray& ray, BVH::Hit& outHit)
+{
+	bool bIsHit = false;
+	for (uint32_t primitive = 0; primitive < primitives.size(); ++primitive)
+	{
+		BVH::Hit hit;
+		if (primitives[primitive].IntersectRay(ray, hit) && (!bIsHit || hit.t < outHit.t))
+		{
+			outHit = hit;
+			outHit.primitive = primitive;
+			bIsHit = true;
+		}
+	}
+
+	return bIsHit;
+}
+
+/**
+ * @brief Ƽ긦 ϳ  BVH  ˻ؼ  ߽ɰ    ãϴ.
+ */
+static bool BruteIntersectSphere(const std::vector<BVH>& primitives, const Vec3f& center, float radius, BVH::Hit& outHit)
+{
+	bool bIsHit = false;
+	for (uint32_t primitive = 0; primitive < primitives.size(); ++primitive)
+	{
+		BVH::Hit hit;
+		if (primitives[primitive].IntersectSphere(center, radius, hit) && (!bIsHit || hit.t < outHit.t))
+		{
+			outHit = hit;
+			outHit.primitive = primitive;
+			bIsHit = true;
+		}
+	}
+
+	return bIsHit;
+}
+
+/**
+ * @brief BVH ,  Ŷ,     Ƽ긦 ˻  մϴ.
+ *
+ * @param name  ׸ ̸ λԴϴ.
+ * @param bvh  BVHԴϴ.
+ * @param primitives Ƽ긦 ϳ  BVH Դϴ. ε bvh Ƽ ε ϴ.
+ *
+ * @note Ÿ  Ƽ갡 ̸   ȯص ǹǷ, ȯ Ƽ  Ÿ ϴ Ȯմϴ.
+ */
+static uint32_t VerifyBVHQueries(const char* name, const BVH& bvh, const std::vector<BVH>& primitives)
+{
+	RandomStream stream(RandomStream::DEFAULT_SEED);
+
+	std::string prefix(name);
+	std::string intersectRayName = prefix + "/IntersectRay";
+	std::string isIntersectRayName = prefix + "/IsIntersectRay";
+	std::string intersectRay4Name = prefix + "/IntersectRay4";
+	std::string intersectSphereName = prefix + "/IntersectSphere";
+	std::string isIntersectSphereName = prefix + "/IsIntersectSphere";
+
+	VerifyResult intersectRay{ intersectRayName.c_str() };
+	VerifyResult isIntersectRay{ isIntersectRayName.c_str() };
+	VerifyResult intersectRay4{ intersectRay4Name.c_str() };
+	VerifyResult intersectSphere{ intersectSphereName.c_str() };
+	VerifyResult isIntersectSphere{ isIntersectSphereName.c_str() };
+
+	uint32_t rayCount = VERIFY_INPUT_COUNT / 4;
+	std::vector<BVH::Ray> rays;
+	std::vector<BVH::Hit> hits(rayCount);
+	std::vector<bool> bIsHits(rayCount);
+	for (uint32_t index = 0; index < rayCount; ++index)
+	{
+		rays.push_back(NextRay(stream, index));
+	}
+
+	for (uint32_t index = 0; index < rayCount; ++index)
+	{
+		const BVH::Ray& ray = rays[index];
+
+		BVH::Hit expectedHit;
+		bool bIsExpectedHit = BruteIntersectRay(primitives, ray, expectedHit);
+
+		BVH::Hit hit;
+		bool bIsHit = bvh.IntersectRay(ray, hit);
+		CheckHit(intersectRay, index, bIsHit, hit, bIsExpectedHit, expectedHit);
+
+		if (bIsHit)
+		{
+			BVH::Hit primitiveHit;
+			bool bIsPrimitiveHit = hit.primitive < primitives.size() && primitives[hit.primitive].IntersectRay(ray, primitiveHit);
+			CheckBits(intersectRay, index, &bIsPrimitiveHit, &bIsHit, sizeof(bool));
+			if (bIsPrimitiveHit)
+			{
+				primitiveHit.primitive = hit.primitive;
+				CheckBits(intersectRay, index, &hit, &primitiveHit, sizeof(BVH::Hit));
+			}
+		}
+
+		bool bIsAnyHit = bvh.IsIntersectRay(ray);
+		CheckBits(isIntersectRay, index, &bIsAnyHit, &bIsExpectedHit, sizeof(bool));
+
+		hits[index] = hit;
+		bIsHits[index] = bIsHit;
+	}
+
+	for (uint32_t index = 0; index + BVH::PACKET_SIZE <= rayCount; index += BVH::PACKET_SIZE)
+	{
+		BVH::Hit packetHits[BVH::PACKET_SIZE];
+		int32_t mask = bvh.IntersectRay4(&rays[index], packetHits);
+
+		int32_t expectedMask = 0;
+		for (uint32_t lane = 0; lane < BVH::PACKET_SIZE; ++lane)
+		{
+			if (bIsHits[index + lane])
+			{
+				expectedMask |= (1 << lane);
+				CheckBits(intersectRay4, index + lane, &packetHits[lane], &hits[index + lane], sizeof(BVH::Hit));
+			}
+		}
+		CheckBits(intersectRay4, index, &mask, &expectedMask, sizeof(int32_t));
+	}
+
+	for (uint32_t index = 0; index < rayCount; ++index)
+	{
+		const Vec3f& center = rays[index].origin;
+		float radius = stream.NextFloat(0.1f, 4.0f);
+
+		BVH::Hit expectedHit;
+		bool bIsExpectedHit = BruteIntersectSphere(primitives, center, radius, expectedHit);
+
+		BVH::Hit hit;
+		bool bIsHit = bvh.IntersectSphere(center, radius, hit);
+		CheckHit(intersectSphere, index, bIsHit, hit, bIsExpectedHit, expectedHit);
+
+		if (bIsHit)
+		{
+			BVH::Hit primitiveHit;
+			bool bIsPrimitiveHit = hit.primitive < primitives.size() && primitives[hit.primitive].IntersectSphere(center, radius, primitiveHit);
+			CheckBits(intersectSphere, index, &bIsPrimitiveHit, &bIsHit, sizeof(bool));
+			if (bIsPrimitiveHit)
+			{
+				primitiveHit.primitive = hit.primitive;
+				CheckBits(intersectSphere, index, &hit, &primitiveHit, sizeof(BVH::Hit));
+			}
+		}
+
+		bool bIsAnyHit = bvh.IsIntersectSphere(center, radius);
+		CheckBits(isIntersectSphere, index, &bIsAnyHit, &bIsExpectedHit, sizeof(bool));
+	}
+
+	return Report(intersectRay) + Report(isIntersectRay) + Report(intersectRay4) + Report(intersectSphere) + Report(isIntersectSphere);
+}
+
+/**
+ * @brief  ﰢ AABB BVH ,    Ƽ긦 ˻  մϴ.
+ */
+static uint32_t VerifyBVH()
+{
+	RandomStream stream(RandomStream::DEFAULT_SEED);
+
+	uint32_t count = VERIFY_BVH_PRIMITIVE_COUNT;
+	std::vector<Vec3f> positions;
+	std::vector<uint32_t> indices;
+	std::vector<Vec3f> minPositions;
+	std::vector<Vec3f> maxPositions;
+	for (uint32_t index = 0; index < count; ++index)
+	{
+		Vec3f center(stream.NextFloat(0.0f, VERIFY_BVH_EXTENT), stream.NextFloat(0.0f, VERIFY_BVH_EXTENT), stream.NextFloat(0.0f, VERIFY_BVH_EXTENT));
+		for (uint32_t vertex = 0; vertex < 3; ++vertex)
+		{
+			indices.push_back(static_cast<uint32_t>(positions.size()));
+			positions.push_back(center + stream.NextUnitVec3() * stream.NextFloat(0.2f, 2.0f));
+		}
+
+		Vec3f extent(stream.NextFloat(0.1f, 1.0f), stream.NextFloat(0.1f, 1.0f), stream.NextFloat(0.1f, 1.0f));
+		minPositions.push_back(center - extent);
+		maxPositions.push_back(center + extent);
+	}
+
+	BVH triangles;
+	BVH aabbs;
+	triangles.BuildTriangles(positions.data(), indices.data(), count, false);
+	aabbs.BuildAABBs(minPositions.data(), maxPositions.data(), count, false);
+
+	std::vector<BVH> primitiveTriangles(count);
+	std::vector<BVH> primitiveAABBs(count);
+	for (uint32_t index = 0; index < count; ++index)
+	{
+		primitiveTriangles[index].BuildTriangles(positions.data(), &indices[index * 3], 1, false);
+		primitiveAABBs[index].BuildAABBs(&minPositions[index], &maxPositions[index], 1, false);
+	}
+
+	return VerifyBVHQueries("BVH/Triangle", triangles, primitiveTriangles) + VerifyBVHQueries("BVH/AABB", aabbs, primitiveAABBs);
+}
+
+/**
+ * @brief SceneHierarchy   Դϴ.    ϴ غ  Ӵϴ.
+ */
+static const uint32_t VERIFY_HIERARCHY_NODE_COUNT = 20000;
+
+/**
+ * @brief SceneHierarchy   Ʈ θ ٲٰ ϴ ȽԴϴ.
+ */
+static const uint32_t VERIFY_HIERARCHY_ROUND_COUNT = 16;
+
+/**
+ * @brief SceneHierarchy     Դϴ. ϵ     Ʈ  մϴ.
+ */
+static const uint32_t VERIFY_HIERARCHY_THREAD_COUNT = 4;
+
+/**
+ * @brief 帶 θ     SceneHierarchy    մϴ.
+ *
+ * @note θ ٲٸ θ ID ڽĺ Ŭ  Ƿ,    ÿ ׾  մϴ.
+ */
+static void ComputeReferenceWorldMatrices(const std::vector<Transform>& localTransforms, const std::vector<uint32_t>& parents, std::vector<Mat4x4>& outWorldMatrices)
+{
+	uint32_t count = static_cast<uint32_t>(localTransforms.size());
+	std::vector<uint8_t> computedFlags(count, 0);
+	std::vector<uint32_t> stack;
+
+	outWorldMatrices.resize(count);
+	for (uint32_t node = 0; node < count; ++node)
+	{
+		for (uint32_t current = node; current != SceneHierarchy::INVALID_NODE && !computedFlags[current]; current = parents[current])
+		{
+			stack.push_back(current);
+		}
+
+		while (!stack.empty())
+		{
+			uint32_t current = stack.back();
+			stack.pop_back();
+
+			outWorldMatrices[current] = Transform::ToMat(localTransforms[current]);
+			if (parents[current] != SceneHierarchy::INVALID_NODE)
+			{
+				outWorldMatrices[current] = outWorldMatrices[current] * outWorldMatrices[parents[current]];
+			}
+			computedFlags[current] = 1;
+		}
+	}
+}
+
+/**
+ * @brief     Ʈ θ ٲ㰡 SceneHierarchy       մϴ.
+ *
+ * @note
+ * -  忡  ,  Ʈ  ʷ  , JobModule     Ȯմϴ.
+ * -  θ𺸴 ռ 忡 ڽ ߰ϰų θ ٲ㼭,  ٽ ϴ ο ȯ źϴ θ Բ Ȯմϴ.
+ */
+static uint32_t VerifySceneHierarchy()
+{
+	RandomStream stream(RandomStream::DEFAULT_SEED);
+
+	VerifyResult update{ "SceneHierarchy/Update" };
+	VerifyResult updateSplit{ "SceneHierarchy/UpdateSplit" };
+	VerifyResult updateJobs{ "SceneHierarchy/UpdateJobs" };
+	VerifyResult setParent{ "SceneHierarchy/SetParent" };
+
+	std::vector<Transform> localTransforms;
+	std::vector<uint32_t> parents;
+	SceneHierarchy hierarchies[3];
+	VerifyResult* results[3] = { &update, &updateSplit, &updateJobs };
+
+	auto nextTransform = [&stream]()
+		{
+			return Transform(stream.NextUnitVec3() * stream.NextFloat(0.0f, 10.0f), stream.NextUnitQuat(), Vec3f(stream.NextFloat(0.8f, 1.25f), stream.NextFloat(0.8f, 1.25f), stream.NextFloat(0.8f, 1.25f)));
+		};
+
+	auto addNode = [&](uint32_t parent)
+		{
+			localTransforms.push_back(nextTransform());
+			parents.push_back(parent);
+			for (SceneHierarchy& hierarchy : hierarchies)
+			{
+				hierarchy.AddNode(localTransforms.back(), parent);
+			}
+		};
+
+	auto updateAndCheck = [&](uint32_t round)
+		{
+			hierarchies[0].Update();
+			hierarchies[1].Update(VERIFY_HIERARCHY_THREAD_COUNT);
+			hierarchies[2].Update(VERIFY_HIERARCHY_THREAD_COUNT, ParallelForJobs);
+
+			std::vector<Mat4x4> expectedWorldMatrices;
+			ComputeReferenceWorldMatrices(localTransforms, parents, expectedWorldMatrices);
+
+			for (uint32_t hierarchy = 0; hierarchy < 3; ++hierarchy)
+			{
+				for (uint32_t node = 0; node < hierarchies[hierarchy].GetNodeCount(); ++node)
+				{
+					CheckBits(*results[hierarchy], round, &hierarchies[hierarchy].GetWorldMatrix(node), &expectedWorldMatrices[node], sizeof(Mat4x4));
+				}
+			}
+		};
+
+	// Ʈ   Ʒ ռ   ϳ θ    ϴ. Ʈ  Ʈ Ŀ Update  Ʈ  ǰ, κ 尡  θ  Ʈ  ƴ  ߰Ǿ  ٽ ϰ ˴ϴ.
+	for (uint32_t node = 0; node < VERIFY_HIERARCHY_NODE_COUNT; ++node)
+	{
+		uint32_t parent = (node < VERIFY_HIERARCHY_THREAD_COUNT) ? SceneHierarchy::INVALID_NODE : static_cast<uint32_t>(stream.NextInt(0, static_cast<int32_t>(node) - 1));
+		addNode(parent);
+	}
+	updateAndCheck(0);
+
+	for (uint32_t round = 1; round <= VERIFY_HIERARCHY_ROUND_COUNT; ++round)
+	{
+		uint32_t count = static_cast<uint32_t>(localTransforms.size());
+
+		for (uint32_t change = 0; change < count / 100; ++change)
+		{
+			uint32_t node = static_cast<uint32_t>(stream.NextInt(0, static_cast<int32_t>(count) - 1));
+			localTransforms[node] = nextTransform();
+			for (SceneHierarchy& hierarchy : hierarchies)
+			{
+				hierarchy.SetLocalTransform(node, localTransforms[node]);
+			}
+		}
+
+		for (uint32_t change = 0; change < 16; ++change)
+		{
+			uint32_t node = static_cast<uint32_t>(stream.NextInt(0, static_cast<int32_t>(count) - 1));
+			uint32_t parent = (change % 4 == 0) ? SceneHierarchy::INVALID_NODE : static_cast<uint32_t>(stream.NextInt(0, static_cast<int32_t>(count) - 1));
+
+			bool bIsExpectedAcyclic = true;
+			for (uint32_t ancestor = parent; ancestor != SceneHierarchy::INVALID_NODE; ancestor = parents[ancestor])
+			{
+				if (ancestor == node)
+				{
+					bIsExpectedAcyclic = false;
+					break;
+				}
+			}
+
+			if (bIsExpectedAcyclic)
+			{
+				parents[node] = parent;
+			}
+
+			for (SceneHierarchy& hierarchy : hierarchies)
+			{
+				bool bIsAcyclic = hierarchy.SetParent(node, parent);
+				CheckBits(setParent, round, &bIsAcyclic, &bIsExpectedAcyclic, sizeof(bool));
+
+				uint32_t actualParent = hierarchy.GetParent(node);
+				CheckBits(setParent, round, &actualParent, &parents[node], sizeof(uint32_t));
+			}
+		}
+
+		// ڽ  Ʈ  ƴ  带 ߰ؼ,  Update 带 ٽ ϰ մϴ.
+		addNode(static_cast<uint32_t>(stream.NextInt(0, static_cast<int32_t>(count) - 1)));
+
+		updateAndCheck(round);
+	}
+
+	return Report(update) + Report(updateSplit) + Report(updateJobs) + Report(setParent);
+}
+
+int32_t RunVerify()
+{
+	std::printf("Verify optimized code path against reference code\n");
+
+	uint32_t mismatchCount = 0;
+	mismatchCount += VerifyMat4x4();
+	mismatchCount += VerifyTransformStream();
+	mismatchCount += VerifyArrayFunctions();
+	mismatchCount += VerifyBVH();
+
+	if (JobModule::Init(VERIFY_HIERARCHY_THREAD_COUNT) != JobModule::Errors::OK)
+	{
+		std::printf("failed to initialize job module: %s\n", JobModule::GetLastErrorMessage());
+		return -1;
+	}
+
+	mismatchCount += VerifySceneHierarchy();
+	JobModule::Uninit();
+
+	std::printf("%s (%u mismatches)\n", mismatchCount == 0 ? "PASSED" : "FAILED", mismatchCount);
+	return mismatchCount == 0 ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,207 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+
+/**
+ * @brief ũ ġũ  մϴ.
+ *
+ * @note
+ * -  ġũ (warmup) ,    ּ  ð ̻ ǵ ݺ Ƚ ϰ   մϴ.
+ * -       ּڰ,  (50, 90, 99), ִ, Դϴ.
+ * -  JSON Ϸ ϰ,  JSON    ֽϴ.
+ * - â̳ ׷Ƚ ؽƮ  ϹǷ Windows Linux ο   ֽϴ.
+ */
+class BenchModule
+{
+public:
+	/**
+	 * @brief ġũ   Դϴ.
+	 */
+	enum class Errors
+	{
+		OK        = 0x00, //  
+		FAILED    = 0x01, // Ϲ 
+		ERR_OPEN  = 0x02, //   
+		ERR_WRITE = 0x03, //   
+		ERR_PARSE = 0x04, //  ؼ 
+	};
+
+
+	/**
+	 * @brief ġũ  ɼԴϴ.
+	 */
+	struct Options
+	{
+		/**
+		 * @brief   ġũ  ð(и)Դϴ.
+		 */
+		double warmupMilliseconds = 20.0;
+
+
+		/**
+		 * @brief    ɷ ϴ ּ ð(и)Դϴ.
+		 */
+		double minSampleMilliseconds = 2.0;
+
+
+		/**
+		 * @brief  ȽԴϴ.
+		 */
+		uint32_t sampleCount = 30;
+
+
+		/**
+		 * @brief ̸  ڿ Ե ġũ մϴ.    մϴ.
+		 */
+		std::string filter;
+	};
+
+
+	/**
+	 * @brief ġũ  Դϴ. ð     Դϴ.
+	 */
+	struct Result
+	{
+		std::string name;
+		uint64_t iterations = 0;
+		uint32_t sampleCount = 0;
+		double minNanoseconds = 0.0;
+		double medianNanoseconds = 0.0;
+		double p90Nanoseconds = 0.0;
+		double p99Nanoseconds = 0.0;
+		double maxNanoseconds = 0.0;
+		double meanNanoseconds = 0.0;
+	};
+
+
+	/**
+	 * @brief ġũ Դϴ. ڷ  Ƚŭ   ݺؾ մϴ.
+	 */
+	using Body = std::function<void(uint64_t)>;
+
+
+public:
+	/**
+	 * @brief ġũ   ֱ  ޽ ϴ.
+	 *
+	 * @return ġũ    ߻  ޽ ȯմϴ.
+	 */
+	static const char* GetLastErrorMessage();
+
+
+	/**
+	 * @brief ġũ մϴ.
+	 *
+	 * @param name ġũ ̸Դϴ.    ̸  մϴ.
+	 * @param body ġũ Դϴ.
+	 * @param itemsPerIteration  ݺ   óϴ  Դϴ.  ð  ϳ ð ȯ˴ϴ.
+	 */
+	static void Register(const std::string& name, const Body& body, uint64_t itemsPerIteration = 1);
+
+
+	/**
+	 * @brief  ġũ  ɼ ͸  ġũ մϴ.
+	 *
+	 * @param options  ɼԴϴ.
+	 * @param outResults   Դϴ.   ϴ.
+	 *
+	 * @note ġũ  ǥ ¿  پ մϴ.
+	 */
+	static void Run(const Options& options, std::vector<Result>& outResults);
+
+
+	/**
+	 * @brief   JSON Ϸ մϴ.
+	 *
+	 * @param path   Դϴ.
+	 * @param results    Դϴ.
+	 *
+	 * @return 忡 ϸ OK, ׷     ȯմϴ.
+	 */
+	static Errors WriteJson(const std::string& path, const std::vector<Result>& results);
+
+
+	/**
+	 * @brief WriteJson  JSON Ͽ   нϴ.
+	 *
+	 * @param path   Դϴ.
+	 * @param outResults    Դϴ.
+	 *
+	 * @return б⿡ ϸ OK, ׷     ȯմϴ.
+	 */
+	static Errors ReadJson(const std::string& path, std::vector<Result>& outResults);
+
+
+	/**
+	 * @brief    ߾Ӱ ̸  ǥ ¿ մϴ.
+	 *
+	 * @param baseResults    Դϴ.
+	 * @param targetResults    Դϴ.
+	 * @param thresholdPercent  (%)  ġũ  Ϸ ǥմϴ.
+	 *
+	 * @return  Ϸ ǥõ ġũ  ȯմϴ.
+	 */
+	static uint32_t Compare(const std::vector<Result>& baseResults, const std::vector<Result>& targetResults, double thresholdPercent);
+
+
+	/**
+	 * @brief  ڿ   ġũ ϰų  JSON  մϴ.
+	 *
+	 * @param argc   Դϴ.
+	 * @param argv   Դϴ.
+	 *
+	 * @return μ  ڵ带 ȯմϴ.    ϰ  1Դϴ.
+	 *
+	 * @note
+	 * - --filter <ڿ>, --samples <Ƚ>, --min-time <и>, --warmup <и>, --json <>
+	 * - --compare < JSON> < JSON> [--threshold <ۼƮ>]
+	 */
+	static int32_t Main(int32_t argc, char* argv[]);
+
+
+	/**
+	 * @brief Ϸ  ϴ ڵ带  ϵ մϴ.
+	 *
+	 * @param value   Ǿ ϴ Դϴ.
+	 */
+	template <typename T>
+	static inline void DoNotOptimize(const T& value)
+	{
+#if defined(_MSC_VER)
+		UseCharPointer(&reinterpret_cast<const volatile char&>(value));
+		_ReadWriteBarrier();
+#else
+		asm volatile("" : : "r,m"(value) : "memory");
+#endif
+	}
+
+
+	/**
+	 * @brief Ϸ ޸ ⸦ ϰų  ٲ ϵ մϴ.
+	 */
+	static inline void ClobberMemory()
+	{
+#if defined(_MSC_VER)
+		_ReadWriteBarrier();
+#else
+		asm volatile("" : : : "memory");
+#endif
+	}
+
+
+private:
+	/**
+	 * @brief ͸ ܺη  ȭ ϴ. MSVC DoNotOptimize  մϴ.
+	 *
+	 * @param ptr  Դϴ.
+	 */
+	static void UseCharPointer(const volatile char* ptr);
+};
\ No newline at end of file
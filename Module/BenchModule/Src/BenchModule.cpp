@@ -0,0 +1,361 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <memory>
+
+#include <json/json.h>
+
+#include "BenchModule.h"
+
+/**
+ * @brief ϵ ġũԴϴ.
+ */
+struct Benchmark
+{
+	std::string name;
+	BenchModule::Body body;
+	uint64_t itemsPerIteration;
+};
+
+/**
+ * @brief ϵ ġũ Դϴ.
+ *
+ * @note  ʱȭ   ϱ  Լ    Ӵϴ.
+ */
+static std::vector<Benchmark>& GetBenchmarks()
+{
+	static std::vector<Benchmark> benchmarks;
+	return benchmarks;
+}
+
+/**
+ * @brief  ֱٿ ߻  ޽Դϴ.
+ */
+static std::string lastErrorMessage;
+
+/**
+ * @brief ġũ  ־ Ƚŭ ϰ ɸ ð() մϴ.
+ */
+static double Measure(const BenchModule::Body& body, uint64_t iterations)
+{
+	auto start = std::chrono::steady_clock::now();
+	body(iterations);
+	BenchModule::ClobberMemory();
+	auto end = std::chrono::steady_clock::now();
+
+	return std::chrono::duration<double, std::nano>(end - start).count();
+}
+
+/**
+ * @brief ĵ  Ͽ   ϴ. nearest-rank Դϴ.
+ */
+static double Percentile(const std::vector<double>& sortedValues, double percent)
+{
+	std::size_t rank = static_cast<std::size_t>(percent / 100.0 * static_cast<double>(sortedValues.size()) + 0.5);
+	rank = std::min<std::size_t>(std::max<std::size_t>(rank, 1), sortedValues.size());
+
+	return sortedValues[rank - 1];
+}
+
+const char* BenchModule::GetLastErrorMessage()
+{
+	return lastErrorMessage.c_str();
+}
+
+void BenchModule::Register(const std::string& name, const Body& body, uint64_t itemsPerIteration)
+{
+	GetBenchmarks().push_back(Benchmark{ name, body, std::max<uint64_t>(itemsPerIteration, 1) });
+}
+
+void BenchModule::Run(const Options& options, std::vector<Result>& outResults)
+{
+	double minSampleNanoseconds = options.minSampleMilliseconds * 1.0e6;
+	double warmupNanoseconds = options.warmupMilliseconds * 1.0e6;
+	uint32_t sampleCount = std::max<uint32_t>(options.sampleCount, 1);
+
+	outResults.clear();
+	std::printf("%-56s %12s %12s %12s %12s\n", "benchmark", "min(ns)", "median(ns)", "p90(ns)", "p99(ns)");
+
+	for (const Benchmark& benchmark : GetBenchmarks())
+	{
+		if (!options.filter.empty() && benchmark.name.find(options.filter) == std::string::npos)
+		{
+			continue;
+		}
+
+		uint64_t iterations = 1;
+		double elapsed = Measure(benchmark.body, iterations);
+		double warmupElapsed = elapsed;
+
+		while (elapsed < minSampleNanoseconds)
+		{
+			double scale = (elapsed > 0.0) ? (minSampleNanoseconds * 1.2 / elapsed) : 10.0;
+			iterations = static_cast<uint64_t>(static_cast<double>(iterations) * std::min(std::max(scale, 1.5), 10.0)) + 1;
+
+			elapsed = Measure(benchmark.body, iterations);
+			warmupElapsed += elapsed;
+		}
+
+		while (warmupElapsed < warmupNanoseconds)
+		{
+			warmupElapsed += Measure(benchmark.body, iterations);
+		}
+
+		double items = static_cast<double>(iterations * benchmark.itemsPerIteration);
+		std::vector<double> samples(sampleCount);
+		for (uint32_t sample = 0; sample < sampleCount; ++sample)
+		{
+			samples[sample] = Measure(benchmark.body, iterations) / items;
+		}
+
+		std::sort(samples.begin(), samples.end());
+
+		Result result;
+		result.name = benchmark.name;
+		result.iterations = iterations;
+		result.sampleCount = sampleCount;
+		result.minNanoseconds = samples.front();
+		result.medianNanoseconds = Percentile(samples, 50.0);
+		result.p90Nanoseconds = Percentile(samples, 90.0);
+		result.p99Nanoseconds = Percentile(samples, 99.0);
+		result.maxNanoseconds = samples.back();
+
+		for (double sample : samples)
+		{
+			result.meanNanoseconds += sample;
+		}
+		result.meanNanoseconds /= static_cast<double>(sampleCount);
+
+		std::printf("%-56s %12.3f %12.3f %12.3f %12.3f\n", result.name.c_str(), result.minNanoseconds, result.medianNanoseconds, result.p90Nanoseconds, result.p99Nanoseconds);
+		std::fflush(stdout);
+
+		outResults.push_back(result);
+	}
+}
+
+BenchModule::Errors BenchModule::WriteJson(const std::string& path, const std::vector<Result>& results)
+{
+	char timestamp[32] = "";
+	std::time_t now = std::time(nullptr);
+	std::strftime(timestamp, sizeof(timestamp), "%Y-%m-%dT%H:%M:%S", std::localtime(&now));
+
+#if defined(_MSC_VER)
+	std::string compiler = "MSVC " + std::to_string(_MSC_VER);
+#elif defined(__clang__)
+	std::string compiler = "Clang " __clang_version__;
+#elif defined(__GNUC__)
+	std::string compiler = "GCC " __VERSION__;
+#else
+	std::string compiler = "unknown";
+#endif
+
+	Json::Value root;
+	root["context"]["date"] = timestamp;
+	root["context"]["compiler"] = compiler;
+	root["benchmarks"] = Json::Value(Json::arrayValue);
+
+	for (const Result& result : results)
+	{
+		Json::Value benchmark;
+		benchmark["name"] = result.name;
+		benchmark["iterations"] = static_cast<Json::UInt64>(result.iterations);
+		benchmark["samples"] = result.sampleCount;
+		benchmark["min_ns"] = result.minNanoseconds;
+		benchmark["median_ns"] = result.medianNanoseconds;
+		benchmark["p90_ns"] = result.p90Nanoseconds;
+		benchmark["p99_ns"] = result.p99Nanoseconds;
+		benchmark["max_ns"] = result.maxNanoseconds;
+		benchmark["mean_ns"] = result.meanNanoseconds;
+
+		root["benchmarks"].append(benchmark);
+	}
+
+	std::ofstream file(path, std::ios::out | std::ios::trunc);
+	if (!file.is_open())
+	{
+		lastErrorMessage = "failed to open " + path;
+		return Errors::ERR_OPEN;
+	}
+
+	Json::StreamWriterBuilder builder;
+	builder["indentation"] = "  ";
+
+	std::unique_ptr<Json::StreamWriter> writer(builder.newStreamWriter());
+	writer->write(root, &file);
+	file << "\n";
+
+	if (!file.good())
+	{
+		lastErrorMessage = "failed to write " + path;
+		return Errors::ERR_WRITE;
+	}
+
+	return Errors::OK;
+}
+
+BenchModule::Errors BenchModule::ReadJson(const std::string& path, std::vector<Result>& outResults)
+{
+	std::ifstream file(path);
+	if (!file.is_open())
+	{
+		lastErrorMessage = "failed to open " + path;
+		return Errors::ERR_OPEN;
+	}
+
+	Json::Value root;
+	Json::CharReaderBuilder builder;
+	std::string errors;
+
+	if (!Json::parseFromStream(builder, file, &root, &errors) || !root["benchmarks"].isArray())
+	{
+		lastErrorMessage = "failed to parse " + path + " " + errors;
+		return Errors::ERR_PARSE;
+	}
+
+	outResults.clear();
+	for (const Json::Value& benchmark : root["benchmarks"])
+	{
+		Result result;
+		result.name = benchmark["name"].asString();
+		result.iterations = benchmark["iterations"].asUInt64();
+		result.sampleCount = benchmark["samples"].asUInt();
+		result.minNanoseconds = benchmark["min_ns"].asDouble();
+		result.medianNanoseconds = benchmark["median_ns"].asDouble();
+		result.p90Nanoseconds = benchmark["p90_ns"].asDouble();
+		result.p99Nanoseconds = benchmark["p99_ns"].asDouble();
+		result.maxNanoseconds = benchmark["max_ns"].asDouble();
+		result.meanNanoseconds = benchmark["mean_ns"].asDouble();
+
+		outResults.push_back(result);
+	}
+
+	return Errors::OK;
+}
+
+uint32_t BenchModule::Compare(const std::vector<Result>& baseResults, const std::vector<Result>& targetResults, double thresholdPercent)
+{
+	uint32_t regressionCount = 0;
+
+	std::printf("%-56s %12s %12s %9s\n", "benchmark", "base(ns)", "target(ns)", "change");
+
+	for (const Result& target : targetResults)
+	{
+		auto base = std::find_if(baseResults.begin(), baseResults.end(), [&](const Result& result) { return result.name == target.name; });
+		if (base == baseResults.end())
+		{
+			std::printf("%-56s %12s %12.3f %9s\n", target.name.c_str(), "-", target.medianNanoseconds, "new");
+			continue;
+		}
+
+		double change = (base->medianNanoseconds > 0.0) ? (target.medianNanoseconds - base->medianNanoseconds) / base->medianNanoseconds * 100.0 : 0.0;
+
+		const char* mark = "";
+		if (change > thresholdPercent)
+		{
+			mark = "  REGRESSION";
+			++regressionCount;
+		}
+		else if (change < -thresholdPercent)
+		{
+			mark = "  improved";
+		}
+
+		std::printf("%-56s %12.3f %12.3f %+8.1f%%%s\n", target.name.c_str(), base->medianNanoseconds, target.medianNanoseconds, change, mark);
+	}
+
+	for (const Result& base : baseResults)
+	{
+		auto target = std::find_if(targetResults.begin(), targetResults.end(), [&](const Result& result) { return result.name == base.name; });
+		if (target == targetResults.end())
+		{
+			std::printf("%-56s %12.3f %12s %9s\n", base.name.c_str(), base.medianNanoseconds, "-", "removed");
+		}
+	}
+
+	std::printf("%u regression(s) over %.1f%%\n", regressionCount, thresholdPercent);
+	return regressionCount;
+}
+
+int32_t BenchModule::Main(int32_t argc, char* argv[])
+{
+	Options options;
+	std::string jsonPath;
+	std::string basePath;
+	std::string targetPath;
+	double thresholdPercent = 5.0;
+
+	for (int32_t index = 1; index < argc; ++index)
+	{
+		std::string argument = argv[index];
+		bool bHasValue = (index + 1 < argc);
+
+		if (argument == "--filter" && bHasValue)
+		{
+			options.filter = argv[++index];
+		}
+		else if (argument == "--samples" && bHasValue)
+		{
+			options.sampleCount = static_cast<uint32_t>(std::atoi(argv[++index]));
+		}
+		else if (argument == "--min-time" && bHasValue)
+		{
+			options.minSampleMilliseconds = std::atof(argv[++index]);
+		}
+		else if (argument == "--warmup" && bHasValue)
+		{
+			options.warmupMilliseconds = std::atof(argv[++index]);
+		}
+		else if (argument == "--json" && bHasValue)
+		{
+			jsonPath = argv[++index];
+		}
+		else if (argument == "--threshold" && bHasValue)
+		{
+			thresholdPercent = std::atof(argv[++index]);
+		}
+		else if (argument == "--compare" && index + 2 < argc)
+		{
+			basePath = argv[++index];
+			targetPath = argv[++index];
+		}
+		else
+		{
+			std::printf("usage: %s [--filter <text>] [--samples <count>] [--min-time <ms>] [--warmup <ms>] [--json <path>]\n", argv[0]);
+			std::printf("       %s --compare <base.json> <target.json> [--threshold <percent>]\n", argv[0]);
+			return (argument == "--help" || argument == "-h") ? 0 : 1;
+		}
+	}
+
+	if (!basePath.empty())
+	{
+		std::vector<Result> baseResults;
+		std::vector<Result> targetResults;
+
+		if (ReadJson(basePath, baseResults) != Errors::OK || ReadJson(targetPath, targetResults) != Errors::OK)
+		{
+			std::printf("%s\n", GetLastErrorMessage());
+			return 1;
+		}
+
+		return (Compare(baseResults, targetResults, thresholdPercent) > 0) ? 1 : 0;
+	}
+
+	std::vector<Result> results;
+	Run(options, results);
+
+	if (!jsonPath.empty() && WriteJson(jsonPath, results) != Errors::OK)
+	{
+		std::printf("%s\n", GetLastErrorMessage());
+		return 1;
+	}
+
+	return 0;
+}
+
+void BenchModule::UseCharPointer(const volatile char* ptr)
+{
+	(void)ptr;
+}
\ No newline at end of file
@@ -1,6 +1,13 @@
 #include "FileModule.h"
 
+#if defined(_WIN32) || defined(_WIN64)
 #include <shlwapi.h>
+#else
+#include <cerrno>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#endif
 
 char FileModule::lastErrorMessage[MAX_BUFFER_SIZE];
 
@@ -9,6 +16,8 @@ const char* FileModule::GetLastErrorMessage()
 	return lastErrorMessage;
 }
 
+#if defined(_WIN32) || defined(_WIN64)
+
 FileModule::Errors FileModule::ReadFile(const std::string& path, std::vector<uint8_t>& outBuffer)
 {
 	HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, 0, nullptr);
@@ -147,6 +156,126 @@ bool FileModule::IsValidPath(const std::wstring& path)
 	return PathFileExistsW(path.c_str());
 }
 
+#else
+template <typename TPath>
+static FileModule::Errors ReadFileFromStream(const TPath& path, std::vector<uint8_t>& outBuffer)
+{
+	std::ifstream file(std::filesystem::path(path), std::ios::binary | std::ios::ate);
+	if (!file.is_open())
+	{
+		return FileModule::Errors::ERR_OPEN;
+	}
+
+	std::streamsize fileSize = file.tellg();
+	file.seekg(0, std::ios::beg);
+	outBuffer.resize(static_cast<std::size_t>(fileSize));
+
+	if (!file.read(reinterpret_cast<char*>(outBuffer.data()), fileSize))
+	{
+		return FileModule::Errors::ERR_READ;
+	}
+
+	return FileModule::Errors::OK;
+}
+
+template <typename TPath>
+static FileModule::Errors WriteFileToStream(const TPath& path, const std::vector<uint8_t>& buffer)
+{
+	std::ofstream file(std::filesystem::path(path), std::ios::binary | std::ios::trunc);
+	if (!file.is_open())
+	{
+		return FileModule::Errors::ERR_CREATE;
+	}
+
+	if (!file.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size())))
+	{
+		return FileModule::Errors::ERR_WRITE;
+	}
+
+	return FileModule::Errors::OK;
+}
+
+FileModule::Errors FileModule::ReadFile(const std::string& path, std::vector<uint8_t>& outBuffer)
+{
+	Errors result = ReadFileFromStream(path, outBuffer);
+	if (result != Errors::OK)
+	{
+		SetLastErrorMessage();
+	}
+
+	return result;
+}
+
+FileModule::Errors FileModule::ReadFile(const std::wstring& path, std::vector<uint8_t>& outBuffer)
+{
+	Errors result = ReadFileFromStream(path, outBuffer);
+	if (result != Errors::OK)
+	{
+		SetLastErrorMessage();
+	}
+
+	return result;
+}
+
+FileModule::Errors FileModule::WriteFile(const std::string& path, const std::vector<uint8_t>& buffer)
+{
+	Errors result = WriteFileToStream(path, buffer);
+	if (result != Errors::OK)
+	{
+		SetLastErrorMessage();
+	}
+
+	return result;
+}
+
+FileModule::Errors FileModule::WriteFile(const std::wstring& path, const std::vector<uint8_t>& buffer)
+{
+	Errors result = WriteFileToStream(path, buffer);
+	if (result != Errors::OK)
+	{
+		SetLastErrorMessage();
+	}
+
+	return result;
+}
+
+FileModule::Errors FileModule::MakeDirectory(const std::string& path)
+{
+	std::error_code errorCode;
+	if (!std::filesystem::create_directory(std::filesystem::path(path), errorCode))
+	{
+		SetLastErrorMessage();
+		return Errors::ERR_API;
+	}
+
+	return Errors::OK;
+}
+
+FileModule::Errors FileModule::MakeDirectory(const std::wstring& path)
+{
+	std::error_code errorCode;
+	if (!std::filesystem::create_directory(std::filesystem::path(path), errorCode))
+	{
+		SetLastErrorMessage();
+		return Errors::ERR_API;
+	}
+
+	return Errors::OK;
+}
+
+bool FileModule::IsValidPath(const std::string& path)
+{
+	std::error_code errorCode;
+	return std::filesystem::exists(std::filesystem::path(path), errorCode);
+}
+
+bool FileModule::IsValidPath(const std::wstring& path)
+{
+	std::error_code errorCode;
+	return std::filesystem::exists(std::filesystem::path(path), errorCode);
+}
+#endif
+
 std::string FileModule::GetBasePath(const std::string& path)
 {
 	std::size_t lastSlash;
@@ -235,10 +364,18 @@ std::wstring FileModule::GetFileExtension(const std::wstring& path)
 	return (offset == std::wstring::npos) ? L"" : filename.substr(offset + 1);
 }
 
+#if defined(_WIN32) || defined(_WIN64)
 void FileModule::SetLastErrorMessage()
 {
 	DWORD errorCode = static_cast<DWORD>(GetLastError());
 
 	// https://learn.microsoft.com/ko-kr/windows/win32/api/winbase/nf-winbase-formatmessagea
 	FormatMessageA(FORMAT_MESSAGE_FROM_SYSTEM, nullptr, errorCode, MAKELANGID(LANG_NEUTRAL, SUBLANG_DEFAULT), lastErrorMessage, MAX_BUFFER_SIZE, nullptr);
-}
\ No newline at end of file
+}
+#else
+void FileModule::SetLastErrorMessage()
+{
+	std::strncpy(lastErrorMessage, std::strerror(errno), MAX_BUFFER_SIZE - 1);
+	lastErrorMessage[MAX_BUFFER_SIZE - 1] = '\0';
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,441 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <new>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+/**
+ * @brief ۾(job)  忡  ϴ ۾ ý  մϴ.
+ *
+ * @note
+ * -  Ŭ   ޼  static Դϴ.
+ * - Init ȣ 尡 0 尡 ǰ,   ŭ ۾ 带 մϴ.
+ * - 帶 Chase-Lev ۾ ġ(work stealing)  , ڽ  ۾    ٸ   Ĩϴ.
+ * - Wait ȣ  ٸ   ʰ ٸ ۾ մϴ.
+ * - ۾ 尡 ƴ 忡  ۾  ť , ۾ 尡  մϴ.
+ * - Init ̶ ۾ Schedule ȣ 忡 ٷ ˴ϴ.
+ * - https://www.di.ens.fr/~zappa/readings/ppopp13.pdf
+ */
+class JobModule
+{
+private:
+	/**
+	 * @brief ۾Դϴ. Ǵ Ʒ ֽϴ.
+	 */
+	struct Job;
+
+
+public:
+	/**
+	 * @brief ۾   Դϴ.
+	 */
+	enum class Errors
+	{
+		OK          = 0x00, //  
+		FAILED      = 0x01, // Ϲ 
+		ERR_INIT    = 0x02, // ̹ ʱȭ
+		ERR_THREAD  = 0x03, //   
+	};
+
+
+	/**
+	 * @brief    ۾   īԴϴ.
+	 *
+	 * @note
+	 * - Schedule ī͸ ѱ ۾   1 ϰ, ۾   1 մϴ.
+	 * - īͰ 0 Ǹ ScheduleAfter  ļ ۾(continuation) ˴ϴ.
+	 * - ī͸ ٸ 尡 ִ ȿ ī͸ ҸŰ  ˴ϴ.
+	 */
+	class Counter
+	{
+	public:
+		/**
+		 * @brief ī Ʈ Դϴ.
+		 */
+		Counter() = default;
+
+
+		/**
+		 * @brief ī  ڿ  ڸ  մϴ.
+		 */
+		Counter(Counter&&) = delete;
+		Counter(const Counter&) = delete;
+		Counter& operator=(Counter&&) = delete;
+		Counter& operator=(const Counter&) = delete;
+
+
+		/**
+		 * @brief īͿ ɸ ۾   Ȯմϴ.
+		 *
+		 * @return īͰ 0̶ true, ׷  false ȯմϴ.
+		 */
+		bool IsDone() const { return value_.load(std::memory_order_acquire) == 0; }
+
+
+	private:
+		/**
+		 * @brief ۾  ī  ļ ۾   ֵ մϴ.
+		 */
+		friend class JobModule;
+
+
+		/**
+		 * @brief    ۾ Դϴ.
+		 */
+		std::atomic<uint32_t> value_ = 0;
+
+
+		/**
+		 * @brief  ҿ ļ ۾  ȣϴ ؽԴϴ.
+		 */
+		std::mutex mutex_;
+
+
+		/**
+		 * @brief īͰ 0 Ǹ  ļ ۾ Դϴ.
+		 */
+		std::vector<Job*> continuations_;
+	};
+
+
+	/**
+	 * @brief  ϳ ۾ Դϴ.
+	 */
+	struct WorkerStats
+	{
+		uint64_t executedJobCount = 0; //  ۾ Դϴ.
+		uint64_t stealCount = 0; // ٸ   ģ ۾ Դϴ.
+		uint64_t stealAttemptCount = 0; // ٸ   ۾ ġ  ȽԴϴ.
+		uint64_t idleNanoseconds = 0; //  ۾ ã ϰ  ð()Դϴ.
+		uint32_t queueDepth = 0; //    ִ ۾ Դϴ.
+		uint32_t maxQueueDepth = 0; //  ׿ ۾  ִԴϴ.
+		uint32_t pooledJobCount = 0; // ۾ Ǯ ݱ Ҵ ۾ Դϴ. ʱȭ ʽϴ.
+	};
+
+
+	/**
+	 * @brief ParallelFor ѱ  ԼԴϴ. [begin, end)  ε óؾ մϴ.
+	 */
+	using RangeFunction = std::function<void(uint32_t begin, uint32_t end)>;
+
+
+	/**
+	 * @brief  ϳ ۾    ִ ִ ۾ Դϴ. 2 ŵ̾ մϴ.
+	 *
+	 * @note    ۾  ʰ Schedule ȣ 忡 ٷ մϴ.
+	 */
+	static const uint32_t MAX_QUEUE_DEPTH = 4096;
+
+
+	/**
+	 * @brief ۾ Լ ü   ִ ִ Ʈ Դϴ.
+	 *
+	 * @note ۾ Լ ü ۾ ȿ ٷ ǹǷ, ̺ ū  ĸóؾ Ѵٸ ͷ ĸóؾ մϴ.
+	 */
+	static const uint32_t MAX_JOB_FUNCTION_SIZE = 104;
+
+
+public:
+	/**
+	 * @brief ۾  ʱȭϰ ۾ 带 մϴ.
+	 *
+	 * @param threadCount ۾   Դϴ. Init ȣ 带 մϴ. 0̸ ϵ   մϴ.
+	 *
+	 * @return ʱȭ ϸ OK, ׷     ȯմϴ.
+	 */
+	static Errors Init(uint32_t threadCount = 0);
+
+
+	/**
+	 * @brief ۾ 带 ϰ ۾  ʱȭ մϴ.
+	 *
+	 * @return ʱȭ  ϸ OK, ׷     ȯմϴ.
+	 *
+	 * @note  ۾   ڿ ȣؾ մϴ.
+	 */
+	static Errors Uninit();
+
+
+	/**
+	 * @brief ۾   ֱ  ޽ ϴ.
+	 *
+	 * @return ۾    ߻  ޽ ȯմϴ.
+	 */
+	static const char* GetLastErrorMessage();
+
+
+	/**
+	 * @brief ۾ ϴ   ϴ.
+	 *
+	 * @return Init ȣ 带    ȯմϴ. ʱȭ ̶ 1 ȯմϴ.
+	 */
+	static uint32_t GetThreadCount();
+
+
+	/**
+	 * @brief ۾ մϴ.
+	 *
+	 * @param function  Լ üԴϴ. ڰ  ϰ, ũⰡ MAX_JOB_FUNCTION_SIZE Ͽ մϴ.
+	 * @param counter ۾   ҽų īԴϴ. nullptr̸ ī͸  ʽϴ.
+	 */
+	template <typename TFunction>
+	static void Schedule(TFunction&& function, Counter* counter = nullptr)
+	{
+		Submit(CreateJob(std::forward<TFunction>(function), counter));
+	}
+
+
+	/**
+	 * @brief ϴ īͰ 0  ڿ  ļ ۾ մϴ.
+	 *
+	 * @param dependency ļ ۾ ٸ īԴϴ. ̹ 0̶ ٷ մϴ.
+	 * @param function  Լ üԴϴ.
+	 * @param counter ļ ۾   ҽų īԴϴ. ļ ۾   ƴ϶  մϴ.
+	 */
+	template <typename TFunction>
+	static void ScheduleAfter(Counter& dependency, TFunction&& function, Counter* counter = nullptr)
+	{
+		SubmitAfter(dependency, CreateJob(std::forward<TFunction>(function), counter));
+	}
+
+
+	/**
+	 * @brief īͰ 0   ٸϴ.
+	 *
+	 * @param counter ٸ īԴϴ.
+	 *
+	 * @note ۾ 忡 ȣϸ ٸ  ٸ ۾ ϹǷ, ۾ ȿ ٸ ۾ ٷ  ¿  ʽϴ.
+	 */
+	static void Wait(Counter& counter);
+
+
+	/**
+	 * @brief [0, count)   忡  óϰ,    ٸϴ.
+	 *
+	 * @param count ó ε Դϴ.
+	 * @param function   ó ԼԴϴ.  忡 ÿ ȣ˴ϴ.
+	 * @param grainSize  ̻    ũԴϴ. 0̸ 帶 8   ư մϴ.
+	 *
+	 * @note       ְ ٸ   Ƿ,   尡  ū   ϰ  ϴ.
+	 */
+	static void ParallelFor(uint32_t count, const RangeFunction& function, uint32_t grainSize = 0);
+
+
+	/**
+	 * @brief 庰 ۾ 踦 ϴ.
+	 *
+	 * @param outStats 庰 ۾ Դϴ. ε  ȣ̸, 0 Init ȣ Դϴ.
+	 */
+	static void GetWorkerStats(std::vector<WorkerStats>& outStats);
+
+
+	/**
+	 * @brief 庰 ۾ 踦 ʱȭմϴ.   ۾  ʱȭ ʽϴ.
+	 */
+	static void ResetWorkerStats();
+
+
+private:
+	/**
+	 * @brief ۾ ǮԴϴ. Ǵ JobModule.cpp ֽϴ.
+	 */
+	struct JobPool;
+
+
+	/**
+	 * @brief ۾Դϴ.
+	 *
+	 * @note
+	 * - Լ ü ۾ ȿ ٷ ϹǷ, ۾    Ҵ Ͼ ʽϴ.
+	 * - īʹ   ۾ Ǯ ȯϱ  Ƿ, ȯ ۾  ڸ  ۾ Ű ͸ Ӵϴ.
+	 */
+	struct alignas(64) Job
+	{
+		alignas(16) unsigned char function[MAX_JOB_FUNCTION_SIZE]; //  Լ üԴϴ.
+		void (*invoke)(Job* job) = nullptr; // Լ ü ȣϰ ҸŰ ԼԴϴ.
+		union
+		{
+			Counter* counter = nullptr; // ۾   ҽų īԴϴ.
+			Job* nextReturned; // ۾ Ǯ ȯ  ۾Դϴ.
+		};
+		JobPool* pool = nullptr; // ۾ Ҵ ۾ ǮԴϴ.
+	};
+
+
+	/**
+	 * @brief Լ ü ȣϰ Ҹŵϴ.
+	 */
+	template <typename TFunction>
+	static void InvokeJob(Job* job)
+	{
+		TFunction* function = std::launder(reinterpret_cast<TFunction*>(job->function));
+		(*function)();
+		function->~TFunction();
+	}
+
+
+	/**
+	 * @brief Լ ü  ۾ ϰ, ī͸ ŵϴ.
+	 */
+	template <typename TFunction>
+	static Job* CreateJob(TFunction&& function, Counter* counter)
+	{
+		using FunctionType = std::decay_t<TFunction>;
+		static_assert(sizeof(FunctionType) <= MAX_JOB_FUNCTION_SIZE, "job function is too large. capture by pointer instead.");
+		static_assert(alignof(FunctionType) <= 16, "job function is over-aligned.");
+
+		Job* job = AllocateJob(counter);
+		new (job->function) FunctionType(std::forward<TFunction>(function));
+		job->invoke = &InvokeJob<FunctionType>;
+
+		return job;
+	}
+
+
+	/**
+	 * @brief   ۾ Ǯ ۾ , ī͸ ŵϴ.
+	 */
+	static Job* AllocateJob(Counter* counter);
+
+
+	/**
+	 * @brief ۾    ֽϴ. ۾ 尡 ƴ϶  ť ֽϴ.
+	 */
+	static void Submit(Job* job);
+
+
+	/**
+	 * @brief īͰ 0  ڿ  ۾ մϴ.
+	 */
+	static void SubmitAfter(Counter& dependency, Job* job);
+
+
+	/**
+	 * @brief ۾ ϰ, ۾ Ҵ ۾ Ǯ ȯ  ī͸ ҽŵϴ.
+	 */
+	static void Execute(Job* job);
+
+
+	/**
+	 * @brief ī͸ ҽŰ, 0 Ǹ ļ ۾ մϴ.
+	 */
+	static void FinishCounter(Counter* counter);
+
+
+	/**
+	 * @brief  ۾ ãϴ. ڽ ,  ť, ٸ    ãϴ.
+	 *
+	 * @param index ۾ ã  ȣԴϴ. ۾ 尡 ƴ϶ -1Դϴ.
+	 *
+	 * @return ã ۾ ȯմϴ. ã ϸ nullptr ȯմϴ.
+	 */
+	static Job* FindJob(int32_t index);
+
+
+	/**
+	 * @brief  ۾ 尡 ִٸ ϳ ϴ.
+	 */
+	static void WakeWorker();
+
+
+	/**
+	 * @brief ۾  Դϴ.
+	 */
+	static void RunWorker(uint32_t index);
+
+
+private:
+	/**
+	 * @brief ۾  ϳ , ۾ Ǯ, Դϴ. Ǵ JobModule.cpp ֽϴ.
+	 */
+	struct Worker;
+
+
+	/**
+	 * @brief ۾  ʱȭǾ Ȯմϴ.
+	 */
+	static bool bIsInitialized;
+
+
+	/**
+	 * @brief ۾ 尡 ؾ ϴ Ȯմϴ.
+	 */
+	static std::atomic<bool> bIsQuit;
+
+
+	/**
+	 * @brief 庰 ۾ Դϴ. ε  ȣԴϴ.
+	 */
+	static std::vector<Worker*> workers;
+
+
+	/**
+	 * @brief ۾  Դϴ. 0  Init ȣ ̹Ƿ  ʽϴ.
+	 */
+	static std::vector<std::thread> threads;
+
+
+	/**
+	 * @brief ۾ 尡 ƴ 忡  ۾  ťԴϴ.
+	 */
+	static std::deque<Job*> injectionJobs;
+
+
+	/**
+	 * @brief  ť ȣϴ ؽԴϴ.
+	 */
+	static std::mutex injectionMutex;
+
+
+	/**
+	 * @brief  ť ۾ Դϴ.  ť  ؽ  Ȯ  մϴ.
+	 */
+	static std::atomic<uint32_t> injectionJobCount;
+
+
+	/**
+	 * @brief ۾ 尡 ƴ 尡 ϴ ۾ ǮԴϴ.
+	 */
+	static JobPool externalPool;
+
+
+	/**
+	 * @brief ۾ 尡 ƴ  ۾ Ǯ ȣϴ ؽԴϴ.
+	 */
+	static std::mutex externalPoolMutex;
+
+
+	/**
+	 * @brief  ۾ 带   ϴ ؽ  Դϴ.
+	 */
+	static std::mutex sleepMutex;
+	static std::condition_variable sleepCondition;
+
+
+	/**
+	 * @brief  ۾  Դϴ.
+	 */
+	static std::atomic<uint32_t> sleepingThreadCount;
+
+
+	/**
+	 * @brief ۾   ϴ Դϴ.     ٸٸ  ۾ ִ Դϴ.
+	 */
+	static std::atomic<uint64_t> workEpoch;
+
+
+	/**
+	 * @brief  ֱٿ ߻  ޽Դϴ.
+	 */
+	static std::string lastErrorMessage;
+};
\ No newline at end of file
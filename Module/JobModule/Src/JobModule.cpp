@@ -0,0 +1,566 @@
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <system_error>
+
+#include "JobModule.h"
+#include "WorkStealingDeque.h"
+
+/**
+ * @brief ۾ Ǯ   Ҵϴ ۾ Դϴ.
+ */
+static const uint32_t JOB_BLOCK_SIZE = 256;
+
+/**
+ * @brief ۾ 尡   ۾ ٽ ãƺ ȽԴϴ.
+ */
+static const uint32_t MAX_SPIN_COUNT = 64;
+
+/**
+ * @brief ParallelFor ڵ   ,  ϳ ư  Դϴ.
+ */
+static const uint32_t RANGES_PER_THREAD = 8;
+
+/**
+ * @brief   ȣԴϴ. ۾ 尡 ƴ϶ -1Դϴ.
+ */
+static thread_local int32_t threadIndex = -1;
+
+/**
+ * @brief   ۾  ξٰ ٽ ϴ ۾ ǮԴϴ.
+ *
+ * @note
+ * - ۾    ׻ Ҵ Ǯ ȯǹǷ, Ǯ  ۾  ÿ ̴ ۾   ʽϴ.
+ * - Ǯ    Free ȯϰ, ٸ  Return ȯ Ͽ ֽϴ. Allocate   Ҵϱ  ȯ  ȸմϴ.
+ */
+struct JobModule::JobPool
+{
+	Job* Allocate()
+	{
+		if (freeJobs.empty())
+		{
+			for (Job* job = returnedJobs.exchange(nullptr, std::memory_order_acquire); job; job = job->nextReturned)
+			{
+				freeJobs.push_back(job);
+			}
+		}
+
+		if (freeJobs.empty())
+		{
+			blocks.push_back(std::make_unique<Job[]>(JOB_BLOCK_SIZE));
+			pooledJobCount.fetch_add(JOB_BLOCK_SIZE, std::memory_order_relaxed);
+
+			Job* block = blocks.back().get();
+			for (uint32_t index = 0; index < JOB_BLOCK_SIZE; ++index)
+			{
+				block[index].pool = this;
+				freeJobs.push_back(&block[index]);
+			}
+		}
+
+		Job* job = freeJobs.back();
+		freeJobs.pop_back();
+
+		return job;
+	}
+
+	void Free(Job* job)
+	{
+		freeJobs.push_back(job);
+	}
+
+	void Return(Job* job)
+	{
+		Job* head = returnedJobs.load(std::memory_order_relaxed);
+		do
+		{
+			job->nextReturned = head;
+		} while (!returnedJobs.compare_exchange_weak(head, job, std::memory_order_release, std::memory_order_relaxed));
+	}
+
+	std::vector<Job*> freeJobs;
+	std::vector<std::unique_ptr<Job[]>> blocks;
+	std::atomic<Job*> returnedJobs = nullptr;
+	std::atomic<uint32_t> pooledJobCount = 0;
+};
+
+/**
+ * @brief ۾  ϳ , ۾ Ǯ, Դϴ.
+ *
+ * @note ٸ 尡 踦 а   Ƿ, 帶 ĳ  ϴ.
+ */
+struct alignas(64) JobModule::Worker
+{
+	WorkStealingDeque<Job*, MAX_QUEUE_DEPTH> deque;
+	JobPool pool;
+	uint32_t randomState = 0;
+
+	std::atomic<uint64_t> executedJobCount = 0;
+	std::atomic<uint64_t> stealCount = 0;
+	std::atomic<uint64_t> stealAttemptCount = 0;
+	std::atomic<uint64_t> idleNanoseconds = 0;
+	std::atomic<uint32_t> maxQueueDepth = 0;
+};
+
+bool JobModule::bIsInitialized = false;
+std::atomic<bool> JobModule::bIsQuit = false;
+std::vector<JobModule::Worker*> JobModule::workers;
+std::vector<std::thread> JobModule::threads;
+std::deque<JobModule::Job*> JobModule::injectionJobs;
+std::mutex JobModule::injectionMutex;
+std::atomic<uint32_t> JobModule::injectionJobCount = 0;
+JobModule::JobPool JobModule::externalPool;
+std::mutex JobModule::externalPoolMutex;
+std::mutex JobModule::sleepMutex;
+std::condition_variable JobModule::sleepCondition;
+std::atomic<uint32_t> JobModule::sleepingThreadCount = 0;
+std::atomic<uint64_t> JobModule::workEpoch = 0;
+std::string JobModule::lastErrorMessage;
+
+/**
+ * @brief  ð   ϴ.
+ */
+static uint64_t GetNanoseconds()
+{
+	return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+/**
+ * @brief xorshift32   ϴ. ĥ 带   մϴ.
+ */
+static uint32_t NextRandom(uint32_t& state)
+{
+	state ^= state << 13;
+	state ^= state >> 17;
+	state ^= state << 5;
+
+	return state;
+}
+
+/**
+ * @brief [begin, end)  grainSize ϰ    ,   ۾ մϴ.
+ */
+static void SplitRange(uint32_t begin, uint32_t end, uint32_t grainSize, const JobModule::RangeFunction* function, JobModule::Counter* counter)
+{
+	while (end - begin > grainSize)
+	{
+		uint32_t middle = begin + (end - begin) / 2;
+		JobModule::Schedule([=]() { SplitRange(middle, end, grainSize, function, counter); }, counter);
+		end = middle;
+	}
+
+	(*function)(begin, end);
+}
+
+JobModule::Errors JobModule::Init(uint32_t threadCount)
+{
+	if (bIsInitialized)
+	{
+		lastErrorMessage = "job module is already initialized.";
+		return Errors::ERR_INIT;
+	}
+
+	if (threadCount == 0)
+	{
+		threadCount = std::max<uint32_t>(std::thread::hardware_concurrency(), 1);
+	}
+
+	workers.resize(threadCount);
+	for (uint32_t index = 0; index < threadCount; ++index)
+	{
+		workers[index] = new Worker();
+		workers[index]->randomState = 0x9E3779B9u ^ (index + 1);
+	}
+
+	bIsQuit.store(false, std::memory_order_release);
+	threadIndex = 0;
+	bIsInitialized = true;
+
+	try
+	{
+		for (uint32_t index = 1; index < threadCount; ++index)
+		{
+			threads.emplace_back(&JobModule::RunWorker, index);
+		}
+	}
+	catch (const std::system_error& error)
+	{
+		lastErrorMessage = error.what();
+		Uninit();
+		return Errors::ERR_THREAD;
+	}
+
+	return Errors::OK;
+}
+
+JobModule::Errors JobModule::Uninit()
+{
+	if (!bIsInitialized)
+	{
+		lastErrorMessage = "job module is not initialized.";
+		return Errors::FAILED;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(sleepMutex);
+		bIsQuit.store(true, std::memory_order_release);
+	}
+	sleepCondition.notify_all();
+
+	for (std::thread& thread : threads)
+	{
+		thread.join();
+	}
+	threads.clear();
+
+	for (Worker* worker : workers)
+	{
+		delete worker;
+	}
+	workers.clear();
+
+	threadIndex = -1;
+	bIsInitialized = false;
+
+	return Errors::OK;
+}
+
+const char* JobModule::GetLastErrorMessage()
+{
+	return lastErrorMessage.c_str();
+}
+
+uint32_t JobModule::GetThreadCount()
+{
+	return bIsInitialized ? static_cast<uint32_t>(workers.size()) : 1;
+}
+
+void JobModule::Wait(Counter& counter)
+{
+	int32_t index = threadIndex;
+	uint64_t idleStart = 0;
+
+	while (counter.value_.load(std::memory_order_acquire) != 0)
+	{
+		Job* job = bIsInitialized ? FindJob(index) : nullptr;
+		if (job)
+		{
+			if (idleStart != 0 && index >= 0)
+			{
+				workers[index]->idleNanoseconds.fetch_add(GetNanoseconds() - idleStart, std::memory_order_relaxed);
+				idleStart = 0;
+			}
+
+			Execute(job);
+			continue;
+		}
+
+		if (idleStart == 0)
+		{
+			idleStart = GetNanoseconds();
+		}
+
+		std::this_thread::yield();
+	}
+
+	if (idleStart != 0 && index >= 0)
+	{
+		workers[index]->idleNanoseconds.fetch_add(GetNanoseconds() - idleStart, std::memory_order_relaxed);
+	}
+
+	//  ۾  尡 ī ؽ   ٷ, ȯ  ī͸ Ҹѵ մϴ.
+	std::lock_guard<std::mutex> lock(counter.mutex_);
+}
+
+void JobModule::ParallelFor(uint32_t count, const RangeFunction& function, uint32_t grainSize)
+{
+	if (count == 0)
+	{
+		return;
+	}
+
+	if (grainSize == 0)
+	{
+		grainSize = std::max<uint32_t>(count / (GetThreadCount() * RANGES_PER_THREAD), 1);
+	}
+
+	if (!bIsInitialized || count <= grainSize)
+	{
+		function(0, count);
+		return;
+	}
+
+	Counter counter;
+	SplitRange(0, count, grainSize, &function, &counter);
+	Wait(counter);
+}
+
+void JobModule::GetWorkerStats(std::vector<WorkerStats>& outStats)
+{
+	outStats.resize(workers.size());
+
+	for (std::size_t index = 0; index < workers.size(); ++index)
+	{
+		const Worker* worker = workers[index];
+		WorkerStats& stats = outStats[index];
+
+		stats.executedJobCount = worker->executedJobCount.load(std::memory_order_relaxed);
+		stats.stealCount = worker->stealCount.load(std::memory_order_relaxed);
+		stats.stealAttemptCount = worker->stealAttemptCount.load(std::memory_order_relaxed);
+		stats.idleNanoseconds = worker->idleNanoseconds.load(std::memory_order_relaxed);
+		stats.queueDepth = worker->deque.GetSize();
+		stats.maxQueueDepth = worker->maxQueueDepth.load(std::memory_order_relaxed);
+		stats.pooledJobCount = worker->pool.pooledJobCount.load(std::memory_order_relaxed);
+	}
+}
+
+void JobModule::ResetWorkerStats()
+{
+	for (Worker* worker : workers)
+	{
+		worker->executedJobCount.store(0, std::memory_order_relaxed);
+		worker->stealCount.store(0, std::memory_order_relaxed);
+		worker->stealAttemptCount.store(0, std::memory_order_relaxed);
+		worker->idleNanoseconds.store(0, std::memory_order_relaxed);
+		worker->maxQueueDepth.store(0, std::memory_order_relaxed);
+	}
+}
+
+JobModule::Job* JobModule::AllocateJob(Counter* counter)
+{
+	Job* job = nullptr;
+
+	int32_t index = threadIndex;
+	if (bIsInitialized && index >= 0)
+	{
+		job = workers[index]->pool.Allocate();
+	}
+	else
+	{
+		std::lock_guard<std::mutex> lock(externalPoolMutex);
+		job = externalPool.Allocate();
+	}
+
+	job->counter = counter;
+	if (counter)
+	{
+		counter->value_.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	return job;
+}
+
+void JobModule::Submit(Job* job)
+{
+	if (!bIsInitialized)
+	{
+		Execute(job);
+		return;
+	}
+
+	int32_t index = threadIndex;
+	if (index >= 0)
+	{
+		Worker* worker = workers[index];
+		if (!worker->deque.Push(job))
+		{
+			//   áٸ ̹ ٸ 尡   ϹǷ,  ʰ ٷ մϴ.
+			Execute(job);
+			return;
+		}
+
+		uint32_t queueDepth = worker->deque.GetSize();
+		if (queueDepth > worker->maxQueueDepth.load(std::memory_order_relaxed))
+		{
+			worker->maxQueueDepth.store(queueDepth, std::memory_order_relaxed);
+		}
+	}
+	else
+	{
+		std::lock_guard<std::mutex> lock(injectionMutex);
+		injectionJobs.push_back(job);
+		injectionJobCount.fetch_add(1, std::memory_order_release);
+	}
+
+	WakeWorker();
+}
+
+void JobModule::SubmitAfter(Counter& dependency, Job* job)
+{
+	{
+		std::lock_guard<std::mutex> lock(dependency.mutex_);
+		if (dependency.value_.load(std::memory_order_acquire) != 0)
+		{
+			dependency.continuations_.push_back(job);
+			return;
+		}
+	}
+
+	Submit(job);
+}
+
+void JobModule::Execute(Job* job)
+{
+	job->invoke(job);
+
+	Counter* counter = job->counter;
+	int32_t index = threadIndex;
+	Worker* worker = (bIsInitialized && index >= 0) ? workers[index] : nullptr;
+	if (worker)
+	{
+		worker->executedJobCount.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	//   Ǯ ȯϸ   ۾ŭ Ҵ Ǯ    ҴϹǷ, Ҵ Ǯ ȯմϴ.
+	if (worker && job->pool == &worker->pool)
+	{
+		worker->pool.Free(job);
+	}
+	else
+	{
+		job->pool->Return(job);
+	}
+
+	if (counter)
+	{
+		FinishCounter(counter);
+	}
+}
+
+void JobModule::FinishCounter(Counter* counter)
+{
+	std::vector<Job*> continuations;
+	{
+		std::lock_guard<std::mutex> lock(counter->mutex_);
+		if (counter->value_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+		{
+			continuations.swap(counter->continuations_);
+		}
+	}
+
+	// ؽ  ڿ ٸ 尡 ī͸ Ҹų  Ƿ,  ̻ īͿ  ʽϴ.
+	for (Job* continuation : continuations)
+	{
+		Submit(continuation);
+	}
+}
+
+JobModule::Job* JobModule::FindJob(int32_t index)
+{
+	Worker* self = index >= 0 ? workers[index] : nullptr;
+	if (self)
+	{
+		if (Job* job = self->deque.Pop())
+		{
+			return job;
+		}
+	}
+
+	if (injectionJobCount.load(std::memory_order_acquire) != 0)
+	{
+		std::lock_guard<std::mutex> lock(injectionMutex);
+		if (!injectionJobs.empty())
+		{
+			Job* job = injectionJobs.front();
+			injectionJobs.pop_front();
+			injectionJobCount.fetch_sub(1, std::memory_order_relaxed);
+			return job;
+		}
+	}
+
+	uint32_t threadCount = static_cast<uint32_t>(workers.size());
+	if (threadCount <= 1)
+	{
+		return nullptr;
+	}
+
+	// ۾ 尡 ƴ϶ ĥ 带   ° Ƿ, 0  ʷ Ĩϴ.
+	uint32_t start = self ? NextRandom(self->randomState) % threadCount : 0;
+	for (uint32_t offset = 0; offset < threadCount; ++offset)
+	{
+		uint32_t victim = (start + offset) % threadCount;
+		if (static_cast<int32_t>(victim) == index)
+		{
+			continue;
+		}
+
+		Job* job = workers[victim]->deque.Steal();
+		if (self)
+		{
+			self->stealAttemptCount.fetch_add(1, std::memory_order_relaxed);
+			if (job)
+			{
+				self->stealCount.fetch_add(1, std::memory_order_relaxed);
+			}
+		}
+
+		if (job)
+		{
+			return job;
+		}
+	}
+
+	return nullptr;
+}
+
+void JobModule::WakeWorker()
+{
+	workEpoch.fetch_add(1, std::memory_order_seq_cst);
+
+	if (sleepingThreadCount.load(std::memory_order_seq_cst) != 0)
+	{
+		std::lock_guard<std::mutex> lock(sleepMutex);
+		sleepCondition.notify_one();
+	}
+}
+
+void JobModule::RunWorker(uint32_t index)
+{
+	threadIndex = static_cast<int32_t>(index);
+	Worker* self = workers[index];
+
+	while (!bIsQuit.load(std::memory_order_acquire))
+	{
+		Job* job = FindJob(threadIndex);
+		if (job)
+		{
+			Execute(job);
+			continue;
+		}
+
+		uint64_t idleStart = GetNanoseconds();
+		uint32_t spinCount = 0;
+		while (!bIsQuit.load(std::memory_order_acquire))
+		{
+			// ۾ ã  о ξ, ã     ۾ ġ ʽϴ.
+			uint64_t epoch = workEpoch.load(std::memory_order_seq_cst);
+
+			job = FindJob(threadIndex);
+			if (job)
+			{
+				break;
+			}
+
+			if (++spinCount < MAX_SPIN_COUNT)
+			{
+				std::this_thread::yield();
+				continue;
+			}
+
+			std::unique_lock<std::mutex> lock(sleepMutex);
+			sleepingThreadCount.fetch_add(1, std::memory_order_seq_cst);
+			sleepCondition.wait(lock, [epoch]() { return workEpoch.load(std::memory_order_seq_cst) != epoch || bIsQuit.load(std::memory_order_acquire); });
+			sleepingThreadCount.fetch_sub(1, std::memory_order_relaxed);
+			spinCount = 0;
+		}
+
+		self->idleNanoseconds.fetch_add(GetNanoseconds() - idleStart, std::memory_order_relaxed);
+
+		if (job)
+		{
+			Execute(job);
+		}
+	}
+
+	threadIndex = -1;
+}
\ No newline at end of file
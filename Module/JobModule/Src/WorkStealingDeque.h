@@ -0,0 +1,147 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+
+/**
+ * @brief ũⰡ  Chase-Lev ۾ ġ(work stealing) Դϴ.
+ *
+ * @note
+ * - Push Pop   常 ȣؾ ϰ, Steal  忡 ȣ  ֽϴ.
+ * -   bottom ְ (LIFO), ٸ  top Ĩϴ(FIFO).
+ * - ޸  Ʒ  C11  ϴ.
+ * - https://www.di.ens.fr/~zappa/readings/ppopp13.pdf
+ *
+ * @param TItem    ŸԴϴ. Ϳ մϴ.
+ * @param CAPACITY  ִ ũԴϴ. 2 ŵ̾ մϴ.
+ */
+template <typename TItem, uint32_t CAPACITY>
+class WorkStealingDeque
+{
+public:
+	static_assert((CAPACITY & (CAPACITY - 1)) == 0, "capacity must be a power of two.");
+
+
+	/**
+	 * @brief  bottom  ֽϴ.
+	 *
+	 * @param item  Դϴ.
+	 *
+	 * @return   áٸ false, ׷  true ȯմϴ.
+	 */
+	bool Push(TItem item)
+	{
+		int64_t bottom = bottom_.load(std::memory_order_relaxed);
+		int64_t top = top_.load(std::memory_order_acquire);
+		if (bottom - top >= static_cast<int64_t>(CAPACITY))
+		{
+			return false;
+		}
+
+		//  release 潺 ڿ relaxed ,  ǹ release    ˻  ۾  Խø   ְ մϴ.
+		buffer_[bottom & MASK].store(item, std::memory_order_relaxed);
+		bottom_.store(bottom + 1, std::memory_order_release);
+
+		return true;
+	}
+
+
+	/**
+	 * @brief  bottom  ϴ.
+	 *
+	 * @return   ȯմϴ.  ų   ٸ 尡 ƴٸ nullptr ȯմϴ.
+	 */
+	TItem Pop()
+	{
+		int64_t bottom = bottom_.load(std::memory_order_relaxed) - 1;
+		bottom_.store(bottom, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		int64_t top = top_.load(std::memory_order_relaxed);
+
+		if (top > bottom)
+		{
+			bottom_.store(bottom + 1, std::memory_order_relaxed);
+			return nullptr;
+		}
+
+		TItem item = buffer_[bottom & MASK].load(std::memory_order_relaxed);
+		if (top == bottom)
+		{
+			//   ġ  ϹǷ, top  ű  ϴ.
+			if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+			{
+				item = nullptr;
+			}
+
+			bottom_.store(bottom + 1, std::memory_order_relaxed);
+		}
+
+		return item;
+	}
+
+
+	/**
+	 * @brief  top  Ĩϴ.
+	 *
+	 * @return ģ  ȯմϴ.  ų ٸ  ￡ ٸ nullptr ȯմϴ.
+	 */
+	TItem Steal()
+	{
+		int64_t top = top_.load(std::memory_order_acquire);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		int64_t bottom = bottom_.load(std::memory_order_acquire);
+
+		if (top >= bottom)
+		{
+			return nullptr;
+		}
+
+		TItem item = buffer_[top & MASK].load(std::memory_order_relaxed);
+		if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+		{
+			return nullptr;
+		}
+
+		return item;
+	}
+
+
+	/**
+	 * @brief   ִ   ϴ.
+	 *
+	 * @note ٸ 尡 ÿ ְ  ̶ ٻԴϴ.
+	 */
+	uint32_t GetSize() const
+	{
+		int64_t bottom = bottom_.load(std::memory_order_relaxed);
+		int64_t top = top_.load(std::memory_order_relaxed);
+
+		return bottom > top ? static_cast<uint32_t>(bottom - top) : 0;
+	}
+
+
+private:
+	/**
+	 * @brief ε  ũ   ϴ ũԴϴ.
+	 */
+	static const int64_t MASK = static_cast<int64_t>(CAPACITY) - 1;
+
+
+	/**
+	 * @brief ٸ 尡   ġԴϴ.  尡  bottom ĳ  ϴ.
+	 */
+	alignas(64) std::atomic<int64_t> top_ = 0;
+
+
+	/**
+	 * @brief  尡 ְ  ġԴϴ.
+	 */
+	alignas(64) std::atomic<int64_t> bottom_ = 0;
+
+
+	/**
+	 * @brief  ϴ  Դϴ.
+	 */
+	alignas(64) std::atomic<TItem> buffer_[CAPACITY];
+};
\ No newline at end of file
@@ -0,0 +1,342 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "MathModule.h"
+#include "Vec3.h"
+
+
+/**
+ * @brief ﰢ Ȥ    (AABB) տ    (Bounding Volume Hierarchy)Դϴ.
+ *
+ * @note
+ * - 16 (bin)  SAH(Surface Area Heuristic)  Ʈ մϴ.
+ * -   켱  ϳ 迭 Ǹ,  ڽ ׻ θ ٷ  ġմϴ.
+ * - Ƽ갡    Ʈ  忡  մϴ.
+ * -   BVH б ̹Ƿ  忡 ÿ   ֽϴ.
+ * - https://jacco.ompf2.com/2022/04/21/how-to-build-a-bvh-part-3-quick-builds/
+ */
+class BVH
+{
+public:
+	/**
+	 * @brief  ʾ  Ÿ Դϴ.
+	 */
+	static constexpr float MAX_DISTANCE = 3.402823466e+38F;
+
+
+	/**
+	 * @brief ȿ  Ƽ εԴϴ.
+	 */
+	static const uint32_t INVALID_PRIMITIVE = 0xFFFFFFFF;
+
+
+	/**
+	 * @brief  Ŷ  Դϴ.
+	 */
+	static const uint32_t PACKET_SIZE = 4;
+
+
+	/**
+	 * @brief BVH  ִ Ƽ Դϴ.
+	 */
+	enum class EPrimitive : int32_t
+	{
+		None     = 0x00,
+		Triangle = 0x01,
+		AABB     = 0x02,
+	};
+
+
+	/**
+	 * @brief ǿ  Դϴ.
+	 *
+	 * @note    origin + direction * t (0 <= t < tMax)Դϴ.  ʹ ȭ ʾƵ ˴ϴ.
+	 */
+	struct Ray
+	{
+		/**
+		 * @brief  Դϴ.
+		 *
+		 * @param o  Դϴ.
+		 * @param d  Դϴ.
+		 * @param maxT  ִ t Դϴ.
+		 */
+		Ray(const Vec3f& o, const Vec3f& d, float maxT = MAX_DISTANCE) noexcept : origin(o), direction(d), tMax(maxT) {}
+
+
+		/**
+		 * @brief   մ   ϴ.
+		 *
+		 * @param start  Դϴ.
+		 * @param end  Դϴ.
+		 *
+		 * @return   ̰ tMax 1  ȯմϴ.
+		 */
+		static inline Ray Segment(const Vec3f& start, const Vec3f& end)
+		{
+			return Ray(start, end - start, 1.0f);
+		}
+
+
+		/**
+		 * @brief  Դϴ.
+		 */
+		Vec3f origin;
+
+
+		/**
+		 * @brief  Դϴ.
+		 */
+		Vec3f direction;
+
+
+		/**
+		 * @brief  ִ t Դϴ.
+		 */
+		float tMax;
+	};
+
+
+	/**
+	 * @brief  Դϴ.
+	 */
+	struct Hit
+	{
+		/**
+		 * @brief  ǿ   t ,  ǿ  ߽ɰ     ŸԴϴ.
+		 */
+		float t = MAX_DISTANCE;
+
+
+		/**
+		 * @brief  Ƽ εԴϴ. Build    ϴ.
+		 */
+		uint32_t primitive = INVALID_PRIMITIVE;
+
+
+		/**
+		 * @brief    ߽ ǥ uԴϴ.   (1 - u - v) * v0 + u * v1 + v * v2Դϴ.
+		 *
+		 * @note AABB Ƽ꿡 ׻ 0Դϴ.
+		 */
+		float u = 0.0f;
+
+
+		/**
+		 * @brief    ߽ ǥ vԴϴ.
+		 *
+		 * @note AABB Ƽ꿡 ׻ 0Դϴ.
+		 */
+		float v = 0.0f;
+	};
+
+
+	/**
+	 * @brief BVH Դϴ. 32Ʈ ũ ĳ  ϳ   尡 ϴ.
+	 */
+	struct Node
+	{
+		/**
+		 * @brief    ּ ǥԴϴ.
+		 */
+		Vec3f minPosition;
+
+
+		/**
+		 * @brief    ڽ  ε,   ù ° Ƽ ġԴϴ.
+		 */
+		uint32_t leftFirst;
+
+
+		/**
+		 * @brief    ִ ǥԴϴ.
+		 */
+		Vec3f maxPosition;
+
+
+		/**
+		 * @brief   Ƽ Դϴ.   0Դϴ.
+		 */
+		uint32_t count;
+	};
+
+
+public:
+	/**
+	 * @brief BVH ⺻ Դϴ.
+	 */
+	BVH() = default;
+
+
+	/**
+	 * @brief BVH  ҸԴϴ.
+	 */
+	virtual ~BVH() {}
+
+
+	/**
+	 * @brief ﰢ  BVH մϴ.
+	 *
+	 * @param positions  ġ 迭Դϴ.
+	 * @param indices ﰢ  ε 迭Դϴ.   ε ϳ ﰢ ̷ϴ.
+	 * @param triangleCount ﰢ Դϴ.
+	 * @param bIsParallel Ƽ갡      Դϴ.
+	 */
+	void BuildTriangles(const Vec3f* positions, const uint32_t* indices, uint32_t triangleCount, bool bIsParallel = true);
+
+
+	/**
+	 * @brief  ϰ ε  BVH մϴ.
+	 *
+	 * @param vertices position    Դϴ. StaticMesh::GetVertices  ״   ֽϴ.
+	 * @param indices ﰢ  ε Դϴ.
+	 * @param bIsParallel Ƽ갡      Դϴ.
+	 */
+	template <typename VertexType>
+	void BuildTriangles(const std::vector<VertexType>& vertices, const std::vector<uint32_t>& indices, bool bIsParallel = true)
+	{
+		std::vector<Vec3f> positions(vertices.size());
+		for (std::size_t index = 0; index < vertices.size(); ++index)
+		{
+			positions[index] = vertices[index].position;
+		}
+
+		BuildTriangles(positions.data(), indices.data(), static_cast<uint32_t>(indices.size() / 3), bIsParallel);
+	}
+
+
+	/**
+	 * @brief    (AABB)  BVH մϴ.
+	 *
+	 * @param minPositions   ּ ǥ 迭Դϴ.
+	 * @param maxPositions   ִ ǥ 迭Դϴ.
+	 * @param count   Դϴ.
+	 * @param bIsParallel Ƽ갡      Դϴ.
+	 */
+	void BuildAABBs(const Vec3f* minPositions, const Vec3f* maxPositions, uint32_t count, bool bIsParallel = true);
+
+
+	/**
+	 * @brief      ãϴ.
+	 *
+	 * @param ray  Դϴ.
+	 * @param outHit    Դϴ.    ʽϴ.
+	 *
+	 * @return  Ƽ Ѵٸ true, ׷  false ȯմϴ.
+	 */
+	bool IntersectRay(const Ray& ray, Hit& outHit) const;
+
+
+	/**
+	 * @brief  Ƽ ϳ ϴ Ȯմϴ.
+	 *
+	 * @param ray  Դϴ.
+	 *
+	 * @return  Ƽ Ѵٸ true, ׷  false ȯմϴ.
+	 *
+	 * @note ó  Ƽ꿡 Ž ߹Ƿ IntersectRay ϴ. ü  մϴ.
+	 */
+	bool IsIntersectRay(const Ray& ray) const;
+
+
+	/**
+	 * @brief  Ŷ(PACKET_SIZE )       ãϴ.
+	 *
+	 * @param rays   迭Դϴ. PACKET_SIZE  ־ մϴ.
+	 * @param outHits      迭Դϴ.      ʽϴ.
+	 *
+	 * @return i°  ߴٸ i° Ʈ 1 ũ ȯմϴ.
+	 *
+	 * @note   IntersectRay ȣ  ϴ.     ϴ.
+	 */
+	int32_t IntersectRay4(const Ray* rays, Hit* outHits) const;
+
+
+	/**
+	 * @brief  ߽ɰ   Ƽ    ȿ ãϴ.
+	 *
+	 * @param center  ߽Դϴ.
+	 * @param radius  Դϴ.
+	 * @param outHit   Դϴ. t  ߽ɰ ŸԴϴ. ã ϸ  ʽϴ.
+	 *
+	 * @return  ġ Ƽ갡 ִٸ true, ׷  false ȯմϴ.
+	 */
+	bool IntersectSphere(const Vec3f& center, float radius, Hit& outHit) const;
+
+
+	/**
+	 * @brief  ġ Ƽ갡 ϳ ִ Ȯմϴ.
+	 *
+	 * @param center  ߽Դϴ.
+	 * @param radius  Դϴ.
+	 *
+	 * @return  ġ Ƽ갡 ִٸ true, ׷  false ȯմϴ.
+	 */
+	bool IsIntersectSphere(const Vec3f& center, float radius) const;
+
+
+	/**
+	 * @brief BVH  ִ Ƽ  ϴ.
+	 *
+	 * @return BVH  ִ Ƽ  ȯմϴ.  ʾҴٸ EPrimitive::NoneԴϴ.
+	 */
+	EPrimitive GetPrimitiveType() const { return primitiveType_; }
+
+
+	/**
+	 * @brief BVH  ִ Ƽ  ϴ.
+	 *
+	 * @return BVH  ִ Ƽ  ȯմϴ.
+	 */
+	uint32_t GetPrimitiveCount() const { return static_cast<uint32_t>(primitiveIndices_.size()); }
+
+
+	/**
+	 * @brief BVH   ϴ.
+	 *
+	 * @return  켱     ȯմϴ. 0 尡 ƮԴϴ.
+	 */
+	const std::vector<Node>& GetNodes() const { return nodes_; }
+
+
+private:
+	/**
+	 * @brief Ƽ  ڷ 带 մϴ.
+	 *
+	 * @param primitiveMinPositions Ƽ   ּ ǥ Դϴ.
+	 * @param primitiveMaxPositions Ƽ   ִ ǥ Դϴ.
+	 * @param bIsParallel    Դϴ.
+	 *
+	 * @note   primitiveIndices_    ĵ˴ϴ.
+	 */
+	void BuildNodes(const std::vector<Vec3f>& primitiveMinPositions, const std::vector<Vec3f>& primitiveMaxPositions, bool bIsParallel);
+
+
+private:
+	/**
+	 * @brief BVH  ִ Ƽ Դϴ.
+	 */
+	EPrimitive primitiveType_ = EPrimitive::None;
+
+
+	/**
+	 * @brief  켱    Դϴ.
+	 */
+	std::vector<Node> nodes_;
+
+
+	/**
+	 * @brief    ĵ Ƽ  εԴϴ.
+	 */
+	std::vector<uint32_t> primitiveIndices_;
+
+
+	/**
+	 * @brief    ĵ Ƽ ǥԴϴ.
+	 *
+	 * @note ﰢ (v0, v1 - v0, v2 - v0), AABB (ּ ǥ, ִ ǥ)  մϴ.
+	 */
+	std::vector<Vec3f> primitivePositions_;
+};
\ No newline at end of file
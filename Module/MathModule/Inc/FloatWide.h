@@ -0,0 +1,676 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+#include "MathModule.h"
+#include "SIMD.h"
+
+
+/**
+ * @brief 4 ε Ҽ  SIMD  ϳ ٷ ̵ ŸԴϴ.
+ *
+ * @note
+ * -   θ  Ʈ 1() Ȥ 0() ũ ȯϸ, Select    ֽϴ.
+ * - MATH_SIMD_SSE ǵ   Į ڵ մϴ.
+ */
+struct Floatx4
+{
+	/**
+	 * @brief ̵ Ÿ  Դϴ.
+	 */
+	static const uint32_t LANE_COUNT = 4;
+
+
+	/**
+	 * @brief ̵ Ÿ ⺻ Դϴ.   0 ʱȭմϴ.
+	 */
+	Floatx4() noexcept
+	{
+#if defined(MATH_SIMD_SSE)
+		v = _mm_setzero_ps();
+#else
+		for (uint32_t lane = 0; lane < LANE_COUNT; ++lane) data[lane] = 0.0f;
+#endif
+	}
+
+
+	/**
+	 * @brief ̵ Ÿ Դϴ.     ʱȭմϴ.
+	 *
+	 * @param s  ο  Դϴ.
+	 */
+	explicit Floatx4(float s) noexcept
+	{
+#if defined(MATH_SIMD_SSE)
+		v = _mm_set1_ps(s);
+#else
+		for (uint32_t lane = 0; lane < LANE_COUNT; ++lane) data[lane] = s;
+#endif
+	}
+
+
+	/**
+	 * @brief ̵ Ÿ Դϴ.
+	 *
+	 * @param s0 ù °  Դϴ.
+	 * @param s1  °  Դϴ.
+	 * @param s2  °  Դϴ.
+	 * @param s3  °  Դϴ.
+	 */
+	Floatx4(float s0, float s1, float s2, float s3) noexcept
+	{
+#if defined(MATH_SIMD_SSE)
+		v = _mm_setr_ps(s0, s1, s2, s3);
+#else
+		data[0] = s0;
+		data[1] = s1;
+		data[2] = s2;
+		data[3] = s3;
+#endif
+	}
+
+
+#if defined(MATH_SIMD_SSE)
+	/**
+	 * @brief ̵ Ÿ Դϴ.
+	 *
+	 * @param value ̵ Ÿ SIMD  Դϴ.
+	 */
+	explicit Floatx4(__m128 value) noexcept : v(value) {}
+#endif
+
+
+	/**
+	 * @brief 迭 4  нϴ.
+	 *
+	 * @param ptr   迭Դϴ. ޸  䱸 ʽϴ.
+	 *
+	 * @return   ȯմϴ.
+	 */
+	static __forceinline Floatx4 Load(const float* ptr)
+	{
+#if defined(MATH_SIMD_SSE)
+		return Floatx4(_mm_loadu_ps(ptr));
+#else
+		return Floatx4(ptr[0], ptr[1], ptr[2], ptr[3]);
+#endif
+	}
+
+
+	/**
+	 * @brief 迭 4  ϴ.
+	 *
+	 * @param ptr   迭Դϴ. ޸  䱸 ʽϴ.
+	 */
+	__forceinline void Store(float* ptr) const
+	{
+#if defined(MATH_SIMD_SSE)
+		_mm_storeu_ps(ptr, v);
+#else
+		for (uint32_t lane = 0; lane < LANE_COUNT; ++lane) ptr[lane] = data[lane];
+#endif
+	}
+
+
+	/**
+	 * @brief Ư   ϴ.
+	 *
+	 * @param lane   Դϴ.
+	 *
+	 * @return   ȯմϴ.
+	 */
+	__forceinline float Get(uint32_t lane) const
+	{
+		float elements[LANE_COUNT];
+		Store(elements);
+		return elements[lane];
+	}
+
+
+	/**
+	 * @brief  Ʈ 1  ũ ϴ.
+	 *
+	 * @param bIsTrue ũ Դϴ.
+	 *
+	 * @return   bIsTrue ũ ȯմϴ.
+	 */
+	static __forceinline Floatx4 Mask(bool bIsTrue)
+	{
+		uint32_t bits = bIsTrue ? 0xFFFFFFFF : 0x00000000;
+		float value;
+		std::memcpy(&value, &bits, sizeof(float));
+		return Floatx4(value);
+	}
+
+
+	Floatx4 operator-() const { return Apply(*this, Floatx4(-0.0f), EOperator::Xor); }
+	Floatx4 operator+(const Floatx4& rhs) const { return Apply(*this, rhs, EOperator::Add); }
+	Floatx4 operator-(const Floatx4& rhs) const { return Apply(*this, rhs, EOperator::Sub); }
+	Floatx4 operator*(const Floatx4& rhs) const { return Apply(*this, rhs, EOperator::Mul); }
+	Floatx4 operator/(const Floatx4& rhs) const { return Apply(*this, rhs, EOperator::Div); }
+	Floatx4 operator&(const Floatx4& rhs) const { return Apply(*this, rhs, EOperator::And); }
+	Floatx4 operator|(const Floatx4& rhs) const { return Apply(*this, rhs, EOperator::Or); }
+	Floatx4 operator^(const Floatx4& rhs) const { return Apply(*this, rhs, EOperator::Xor); }
+	Floatx4 operator<(const Floatx4& rhs) const { return Apply(*this, rhs, EOperator::Less); }
+	Floatx4 operator<=(const Floatx4& rhs) const { return Apply(*this, rhs, EOperator::LessEqual); }
+	Floatx4 operator>(const Floatx4& rhs) const { return Apply(rhs, *this, EOperator::Less); }
+	Floatx4 operator>=(const Floatx4& rhs) const { return Apply(rhs, *this, EOperator::LessEqual); }
+	Floatx4 operator==(const Floatx4& rhs) const { return Apply(*this, rhs, EOperator::Equal); }
+	Floatx4 operator!=(const Floatx4& rhs) const { return Apply(*this, rhs, EOperator::NotEqual); }
+	Floatx4& operator+=(const Floatx4& rhs) { *this = *this + rhs; return *this; }
+	Floatx4& operator-=(const Floatx4& rhs) { *this = *this - rhs; return *this; }
+	Floatx4& operator*=(const Floatx4& rhs) { *this = *this * rhs; return *this; }
+	Floatx4& operator/=(const Floatx4& rhs) { *this = *this / rhs; return *this; }
+
+
+	/**
+	 * @brief κ   մϴ.
+	 */
+	static __forceinline Floatx4 Min(const Floatx4& lhs, const Floatx4& rhs) { return Apply(lhs, rhs, EOperator::Min); }
+
+
+	/**
+	 * @brief κ ū  մϴ.
+	 */
+	static __forceinline Floatx4 Max(const Floatx4& lhs, const Floatx4& rhs) { return Apply(lhs, rhs, EOperator::Max); }
+
+
+	/**
+	 * @brief κ  մϴ.
+	 */
+	static __forceinline Floatx4 Abs(const Floatx4& x) { return AndNot(Floatx4(-0.0f), x); }
+
+
+	/**
+	 * @brief κ (~mask & x) մϴ.
+	 */
+	static __forceinline Floatx4 AndNot(const Floatx4& mask, const Floatx4& x) { return Apply(mask, x, EOperator::AndNot); }
+
+
+	/**
+	 * @brief κ  մϴ.
+	 */
+	static __forceinline Floatx4 Sqrt(const Floatx4& x)
+	{
+#if defined(MATH_SIMD_SSE)
+		return Floatx4(_mm_sqrt_ps(x.v));
+#else
+		Floatx4 result;
+		for (uint32_t lane = 0; lane < LANE_COUNT; ++lane) result.data[lane] = MathModule::Sqrt(x.data[lane]);
+		return result;
+#endif
+	}
+
+
+	/**
+	 * @brief ũ  κ  մϴ.
+	 *
+	 * @param mask  ũԴϴ.
+	 * @param a ũ  ο  Դϴ.
+	 * @param b ũ  ο  Դϴ.
+	 *
+	 * @return õ  ȯմϴ.
+	 */
+	static __forceinline Floatx4 Select(const Floatx4& mask, const Floatx4& a, const Floatx4& b)
+	{
+		return (mask & a) | AndNot(mask, b);
+	}
+
+
+	/**
+	 * @brief ũ   ȣ Ʈ  Ʈ ϴ.
+	 *
+	 * @param mask Ʈ  ũԴϴ.
+	 *
+	 * @return i° Ʈ i°  ȣ Ʈ  ȯմϴ.
+	 */
+	static __forceinline int32_t MoveMask(const Floatx4& mask)
+	{
+#if defined(MATH_SIMD_SSE)
+		return _mm_movemask_ps(mask.v);
+#else
+		int32_t result = 0;
+		for (uint32_t lane = 0; lane < LANE_COUNT; ++lane) result |= static_cast<int32_t>(mask.bits[lane] >> 31) << lane;
+		return result;
+#endif
+	}
+
+
+	/**
+	 * @brief ũ   ϳ ִ Ȯմϴ.
+	 */
+	static __forceinline bool Any(const Floatx4& mask) { return MoveMask(mask) != 0; }
+
+
+	/**
+	 * @brief ũ    Ȯմϴ.
+	 */
+	static __forceinline bool All(const Floatx4& mask) { return MoveMask(mask) == 0xF; }
+
+
+	/**
+	 * @brief κ   ڻ  մϴ.  MathModule::SinCos ϴ.
+	 */
+	static __forceinline void SinCos(const Floatx4& radian, Floatx4& outSin, Floatx4& outCos)
+	{
+#if defined(MATH_SIMD_SSE)
+		SIMD::SinCos4(radian.v, outSin.v, outCos.v);
+#else
+		for (uint32_t lane = 0; lane < LANE_COUNT; ++lane) MathModule::SinCos(radian.data[lane], outSin.data[lane], outCos.data[lane]);
+#endif
+	}
+
+
+	/**
+	 * @brief κ ũ ڻ մϴ.  MathModule::ACos ϴ.
+	 */
+	static __forceinline Floatx4 ACos(const Floatx4& x)
+	{
+#if defined(MATH_SIMD_SSE)
+		return Floatx4(SIMD::ACos4(x.v));
+#else
+		Floatx4 result;
+		for (uint32_t lane = 0; lane < LANE_COUNT; ++lane) result.data[lane] = MathModule::ACos(x.data[lane]);
+		return result;
+#endif
+	}
+
+
+private:
+	/**
+	 * @brief κ  Դϴ.
+	 */
+	enum class EOperator
+	{
+		Add,
+		Sub,
+		Mul,
+		Div,
+		And,
+		Or,
+		Xor,
+		AndNot,
+		Less,
+		LessEqual,
+		Equal,
+		NotEqual,
+		Min,
+		Max,
+	};
+
+
+	/**
+	 * @brief κ  մϴ.
+	 *
+	 * @note    Ÿ  ޵ǹǷ ζ  б ŵ˴ϴ.
+	 */
+	static __forceinline Floatx4 Apply(const Floatx4& lhs, const Floatx4& rhs, const EOperator& op)
+	{
+#if defined(MATH_SIMD_SSE)
+		switch (op)
+		{
+		case EOperator::Add:       return Floatx4(_mm_add_ps(lhs.v, rhs.v));
+		case EOperator::Sub:       return Floatx4(_mm_sub_ps(lhs.v, rhs.v));
+		case EOperator::Mul:       return Floatx4(_mm_mul_ps(lhs.v, rhs.v));
+		case EOperator::Div:       return Floatx4(_mm_div_ps(lhs.v, rhs.v));
+		case EOperator::And:       return Floatx4(_mm_and_ps(lhs.v, rhs.v));
+		case EOperator::Or:        return Floatx4(_mm_or_ps(lhs.v, rhs.v));
+		case EOperator::Xor:       return Floatx4(_mm_xor_ps(lhs.v, rhs.v));
+		case EOperator::AndNot:    return Floatx4(_mm_andnot_ps(lhs.v, rhs.v));
+		case EOperator::Less:      return Floatx4(_mm_cmplt_ps(lhs.v, rhs.v));
+		case EOperator::LessEqual: return Floatx4(_mm_cmple_ps(lhs.v, rhs.v));
+		case EOperator::Equal:     return Floatx4(_mm_cmpeq_ps(lhs.v, rhs.v));
+		case EOperator::NotEqual:  return Floatx4(_mm_cmpneq_ps(lhs.v, rhs.v));
+		case EOperator::Min:       return Floatx4(_mm_min_ps(lhs.v, rhs.v));
+		default:                   return Floatx4(_mm_max_ps(lhs.v, rhs.v));
+		}
+#else
+		Floatx4 result;
+
+		for (uint32_t lane = 0; lane < LANE_COUNT; ++lane)
+		{
+			float a = lhs.data[lane];
+			float b = rhs.data[lane];
+			uint32_t ia = lhs.bits[lane];
+			uint32_t ib = rhs.bits[lane];
+
+			switch (op)
+			{
+			case EOperator::Add:       result.data[lane] = a + b; break;
+			case EOperator::Sub:       result.data[lane] = a - b; break;
+			case EOperator::Mul:       result.data[lane] = a * b; break;
+			case EOperator::Div:       result.data[lane] = a / b; break;
+			case EOperator::And:       result.bits[lane] = ia & ib; break;
+			case EOperator::Or:        result.bits[lane] = ia | ib; break;
+			case EOperator::Xor:       result.bits[lane] = ia ^ ib; break;
+			case EOperator::AndNot:    result.bits[lane] = ~ia & ib; break;
+			case EOperator::Less:      result.bits[lane] = (a < b) ? 0xFFFFFFFF : 0; break;
+			case EOperator::LessEqual: result.bits[lane] = (a <= b) ? 0xFFFFFFFF : 0; break;
+			case EOperator::Equal:     result.bits[lane] = (a == b) ? 0xFFFFFFFF : 0; break;
+			case EOperator::NotEqual:  result.bits[lane] = (a != b) ? 0xFFFFFFFF : 0; break;
+			case EOperator::Min:       result.data[lane] = (a < b) ? a : b; break;
+			default:                   result.data[lane] = (a > b) ? a : b; break;
+			}
+		}
+
+		return result;
+#endif
+	}
+
+
+public:
+	/**
+	 * @brief ̵ Ÿ Դϴ.
+	 */
+#if defined(MATH_SIMD_SSE)
+	__m128 v;
+#else
+	union
+	{
+		float data[4];
+		uint32_t bits[4];
+	};
+#endif
+};
+
+
+/**
+ * @brief 8 ε Ҽ  ٷ ̵ ŸԴϴ.
+ *
+ * @note
+ * - MATH_SIMD_AVX2 ǵ  AVX  ϳ, ׷  Floatx4   մϴ.
+ * - ̽ Floatx4 ϴ.
+ */
+struct Floatx8
+{
+	/**
+	 * @brief ̵ Ÿ  Դϴ.
+	 */
+	static const uint32_t LANE_COUNT = 8;
+
+
+	/**
+	 * @brief ̵ Ÿ ⺻ Դϴ.   0 ʱȭմϴ.
+	 */
+#if defined(MATH_SIMD_AVX2)
+	Floatx8() noexcept : v(_mm256_setzero_ps()) {}
+#else
+	Floatx8() noexcept {}
+#endif
+
+
+	/**
+	 * @brief ̵ Ÿ Դϴ.     ʱȭմϴ.
+	 *
+	 * @param s  ο  Դϴ.
+	 */
+#if defined(MATH_SIMD_AVX2)
+	explicit Floatx8(float s) noexcept : v(_mm256_set1_ps(s)) {}
+#else
+	explicit Floatx8(float s) noexcept : lo(s), hi(s) {}
+#endif
+
+
+#if defined(MATH_SIMD_AVX2)
+	/**
+	 * @brief ̵ Ÿ Դϴ.
+	 *
+	 * @param value ̵ Ÿ SIMD  Դϴ.
+	 */
+	explicit Floatx8(__m256 value) noexcept : v(value) {}
+#else
+	/**
+	 * @brief ̵ Ÿ Դϴ.
+	 *
+	 * @param l  4  Դϴ.
+	 * @param h  4  Դϴ.
+	 */
+	Floatx8(const Floatx4& l, const Floatx4& h) noexcept : lo(l), hi(h) {}
+#endif
+
+
+	/**
+	 * @brief 迭 8  нϴ.
+	 *
+	 * @param ptr   迭Դϴ. ޸  䱸 ʽϴ.
+	 *
+	 * @return   ȯմϴ.
+	 */
+	static __forceinline Floatx8 Load(const float* ptr)
+	{
+#if defined(MATH_SIMD_AVX2)
+		return Floatx8(_mm256_loadu_ps(ptr));
+#else
+		return Floatx8(Floatx4::Load(ptr), Floatx4::Load(ptr + 4));
+#endif
+	}
+
+
+	/**
+	 * @brief 迭 8  ϴ.
+	 *
+	 * @param ptr   迭Դϴ. ޸  䱸 ʽϴ.
+	 */
+	__forceinline void Store(float* ptr) const
+	{
+#if defined(MATH_SIMD_AVX2)
+		_mm256_storeu_ps(ptr, v);
+#else
+		lo.Store(ptr);
+		hi.Store(ptr + 4);
+#endif
+	}
+
+
+	/**
+	 * @brief Ư   ϴ.
+	 *
+	 * @param lane   Դϴ.
+	 *
+	 * @return   ȯմϴ.
+	 */
+	__forceinline float Get(uint32_t lane) const
+	{
+		float elements[LANE_COUNT];
+		Store(elements);
+		return elements[lane];
+	}
+
+
+	/**
+	 * @brief  Ʈ 1  ũ ϴ.
+	 *
+	 * @param bIsTrue ũ Դϴ.
+	 *
+	 * @return   bIsTrue ũ ȯմϴ.
+	 */
+	static __forceinline Floatx8 Mask(bool bIsTrue)
+	{
+		uint32_t bits = bIsTrue ? 0xFFFFFFFF : 0x00000000;
+		float value;
+		std::memcpy(&value, &bits, sizeof(float));
+		return Floatx8(value);
+	}
+
+
+#if defined(MATH_SIMD_AVX2)
+	Floatx8 operator-() const { return Floatx8(_mm256_xor_ps(v, _mm256_set1_ps(-0.0f))); }
+	Floatx8 operator+(const Floatx8& rhs) const { return Floatx8(_mm256_add_ps(v, rhs.v)); }
+	Floatx8 operator-(const Floatx8& rhs) const { return Floatx8(_mm256_sub_ps(v, rhs.v)); }
+	Floatx8 operator*(const Floatx8& rhs) const { return Floatx8(_mm256_mul_ps(v, rhs.v)); }
+	Floatx8 operator/(const Floatx8& rhs) const { return Floatx8(_mm256_div_ps(v, rhs.v)); }
+	Floatx8 operator&(const Floatx8& rhs) const { return Floatx8(_mm256_and_ps(v, rhs.v)); }
+	Floatx8 operator|(const Floatx8& rhs) const { return Floatx8(_mm256_or_ps(v, rhs.v)); }
+	Floatx8 operator^(const Floatx8& rhs) const { return Floatx8(_mm256_xor_ps(v, rhs.v)); }
+	Floatx8 operator<(const Floatx8& rhs) const { return Floatx8(_mm256_cmp_ps(v, rhs.v, _CMP_LT_OQ)); }
+	Floatx8 operator<=(const Floatx8& rhs) const { return Floatx8(_mm256_cmp_ps(v, rhs.v, _CMP_LE_OQ)); }
+	Floatx8 operator>(const Floatx8& rhs) const { return Floatx8(_mm256_cmp_ps(v, rhs.v, _CMP_GT_OQ)); }
+	Floatx8 operator>=(const Floatx8& rhs) const { return Floatx8(_mm256_cmp_ps(v, rhs.v, _CMP_GE_OQ)); }
+	Floatx8 operator==(const Floatx8& rhs) const { return Floatx8(_mm256_cmp_ps(v, rhs.v, _CMP_EQ_OQ)); }
+	Floatx8 operator!=(const Floatx8& rhs) const { return Floatx8(_mm256_cmp_ps(v, rhs.v, _CMP_NEQ_UQ)); }
+#else
+	Floatx8 operator-() const { return Floatx8(-lo, -hi); }
+	Floatx8 operator+(const Floatx8& rhs) const { return Floatx8(lo + rhs.lo, hi + rhs.hi); }
+	Floatx8 operator-(const Floatx8& rhs) const { return Floatx8(lo - rhs.lo, hi - rhs.hi); }
+	Floatx8 operator*(const Floatx8& rhs) const { return Floatx8(lo * rhs.lo, hi * rhs.hi); }
+	Floatx8 operator/(const Floatx8& rhs) const { return Floatx8(lo / rhs.lo, hi / rhs.hi); }
+	Floatx8 operator&(const Floatx8& rhs) const { return Floatx8(lo & rhs.lo, hi & rhs.hi); }
+	Floatx8 operator|(const Floatx8& rhs) const { return Floatx8(lo | rhs.lo, hi | rhs.hi); }
+	Floatx8 operator^(const Floatx8& rhs) const { return Floatx8(lo ^ rhs.lo, hi ^ rhs.hi); }
+	Floatx8 operator<(const Floatx8& rhs) const { return Floatx8(lo < rhs.lo, hi < rhs.hi); }
+	Floatx8 operator<=(const Floatx8& rhs) const { return Floatx8(lo <= rhs.lo, hi <= rhs.hi); }
+	Floatx8 operator>(const Floatx8& rhs) const { return Floatx8(lo > rhs.lo, hi > rhs.hi); }
+	Floatx8 operator>=(const Floatx8& rhs) const { return Floatx8(lo >= rhs.lo, hi >= rhs.hi); }
+	Floatx8 operator==(const Floatx8& rhs) const { return Floatx8(lo == rhs.lo, hi == rhs.hi); }
+	Floatx8 operator!=(const Floatx8& rhs) const { return Floatx8(lo != rhs.lo, hi != rhs.hi); }
+#endif
+	Floatx8& operator+=(const Floatx8& rhs) { *this = *this + rhs; return *this; }
+	Floatx8& operator-=(const Floatx8& rhs) { *this = *this - rhs; return *this; }
+	Floatx8& operator*=(const Floatx8& rhs) { *this = *this * rhs; return *this; }
+	Floatx8& operator/=(const Floatx8& rhs) { *this = *this / rhs; return *this; }
+
+
+	/**
+	 * @brief κ   մϴ.
+	 */
+	static __forceinline Floatx8 Min(const Floatx8& lhs, const Floatx8& rhs)
+	{
+#if defined(MATH_SIMD_AVX2)
+		return Floatx8(_mm256_min_ps(lhs.v, rhs.v));
+#else
+		return Floatx8(Floatx4::Min(lhs.lo, rhs.lo), Floatx4::Min(lhs.hi, rhs.hi));
+#endif
+	}
+
+
+	/**
+	 * @brief κ ū  մϴ.
+	 */
+	static __forceinline Floatx8 Max(const Floatx8& lhs, const Floatx8& rhs)
+	{
+#if defined(MATH_SIMD_AVX2)
+		return Floatx8(_mm256_max_ps(lhs.v, rhs.v));
+#else
+		return Floatx8(Floatx4::Max(lhs.lo, rhs.lo), Floatx4::Max(lhs.hi, rhs.hi));
+#endif
+	}
+
+
+	/**
+	 * @brief κ  մϴ.
+	 */
+	static __forceinline Floatx8 Abs(const Floatx8& x) { return AndNot(Floatx8(-0.0f), x); }
+
+
+	/**
+	 * @brief κ (~mask & x) մϴ.
+	 */
+	static __forceinline Floatx8 AndNot(const Floatx8& mask, const Floatx8& x)
+	{
+#if defined(MATH_SIMD_AVX2)
+		return Floatx8(_mm256_andnot_ps(mask.v, x.v));
+#else
+		return Floatx8(Floatx4::AndNot(mask.lo, x.lo), Floatx4::AndNot(mask.hi, x.hi));
+#endif
+	}
+
+
+	/**
+	 * @brief κ  մϴ.
+	 */
+	static __forceinline Floatx8 Sqrt(const Floatx8& x)
+	{
+#if defined(MATH_SIMD_AVX2)
+		return Floatx8(_mm256_sqrt_ps(x.v));
+#else
+		return Floatx8(Floatx4::Sqrt(x.lo), Floatx4::Sqrt(x.hi));
+#endif
+	}
+
+
+	/**
+	 * @brief ũ  κ  մϴ.
+	 *
+	 * @param mask  ũԴϴ.
+	 * @param a ũ  ο  Դϴ.
+	 * @param b ũ  ο  Դϴ.
+	 *
+	 * @return õ  ȯմϴ.
+	 */
+	static __forceinline Floatx8 Select(const Floatx8& mask, const Floatx8& a, const Floatx8& b)
+	{
+#if defined(MATH_SIMD_AVX2)
+		return Floatx8(_mm256_blendv_ps(b.v, a.v, mask.v));
+#else
+		return Floatx8(Floatx4::Select(mask.lo, a.lo, b.lo), Floatx4::Select(mask.hi, a.hi, b.hi));
+#endif
+	}
+
+
+	/**
+	 * @brief ũ   ȣ Ʈ  Ʈ ϴ.
+	 *
+	 * @param mask Ʈ  ũԴϴ.
+	 *
+	 * @return i° Ʈ i°  ȣ Ʈ  ȯմϴ.
+	 */
+	static __forceinline int32_t MoveMask(const Floatx8& mask)
+	{
+#if defined(MATH_SIMD_AVX2)
+		return _mm256_movemask_ps(mask.v);
+#else
+		return Floatx4::MoveMask(mask.lo) | (Floatx4::MoveMask(mask.hi) << 4);
+#endif
+	}
+
+
+	/**
+	 * @brief ũ   ϳ ִ Ȯմϴ.
+	 */
+	static __forceinline bool Any(const Floatx8& mask) { return MoveMask(mask) != 0; }
+
+
+	/**
+	 * @brief ũ    Ȯմϴ.
+	 */
+	static __forceinline bool All(const Floatx8& mask) { return MoveMask(mask) == 0xFF; }
+
+
+	/**
+	 * @brief κ   ڻ  մϴ.  MathModule::SinCos ϴ.
+	 */
+	static __forceinline void SinCos(const Floatx8& radian, Floatx8& outSin, Floatx8& outCos)
+	{
+#if defined(MATH_SIMD_AVX2)
+		SIMD::SinCos8(radian.v, outSin.v, outCos.v);
+#else
+		Floatx4::SinCos(radian.lo, outSin.lo, outCos.lo);
+		Floatx4::SinCos(radian.hi, outSin.hi, outCos.hi);
+#endif
+	}
+
+
+	/**
+	 * @brief κ ũ ڻ մϴ.  MathModule::ACos ϴ.
+	 */
+	static __forceinline Floatx8 ACos(const Floatx8& x)
+	{
+#if defined(MATH_SIMD_AVX2)
+		return Floatx8(SIMD::ACos8(x.v));
+#else
+		return Floatx8(Floatx4::ACos(x.lo), Floatx4::ACos(x.hi));
+#endif
+	}
+
+
+	/**
+	 * @brief ̵ Ÿ Դϴ.
+	 */
+#if defined(MATH_SIMD_AVX2)
+	__m256 v;
+#else
+	Floatx4 lo;
+	Floatx4 hi;
+#endif
+};
\ No newline at end of file
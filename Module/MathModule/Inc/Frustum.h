@@ -0,0 +1,187 @@
+#pragma once
+
+#include <cstdint>
+
+#include "MathModule.h"
+#include "Mat4x4.h"
+#include "Vec3.h"
+#include "Vec4.h"
+
+
+/**
+ * @brief þ ü(View Frustum)Դϴ.
+ *
+ * @note
+ * - þ İ    Ŀ Gribb-Hartmann  6  մϴ.
+ * -   (nx, ny, nz, d) ̸,  ü  ϰ ȭǾ ֽϴ.  p dot(n, p) + d >= 0̸  Դϴ.
+ * - 4x4 İ    Ծ Ƿ, ü   view * projection    ؾ մϴ.
+ * - https://www.gamedevs.org/uploads/fast-extraction-viewing-frustum-planes-from-world-view-projection-matrix.pdf
+ */
+struct Frustum
+{
+	/**
+	 * @brief ü  Դϴ.
+	 */
+	enum class EPlane : int32_t
+	{
+		Left   = 0x00,
+		Right  = 0x01,
+		Bottom = 0x02,
+		Top    = 0x03,
+		Near   = 0x04,
+		Far    = 0x05,
+		Count  = 0x06,
+	};
+
+
+	/**
+	 * @brief ü ⺻ Դϴ.
+	 *
+	 * @note   0 ʱȭϹǷ  ü ü ϴ  ˴ϴ.
+	 */
+	Frustum() noexcept {}
+
+
+	/**
+	 * @brief ü Դϴ.
+	 *
+	 * @param viewProjection þ İ    Դϴ.
+	 */
+	explicit Frustum(const Mat4x4& viewProjection) noexcept
+	{
+		const Mat4x4& m = viewProjection;
+
+		planes[static_cast<int32_t>(EPlane::Left)]   = Vec4f(m.e03 + m.e00, m.e13 + m.e10, m.e23 + m.e20, m.e33 + m.e30);
+		planes[static_cast<int32_t>(EPlane::Right)]  = Vec4f(m.e03 - m.e00, m.e13 - m.e10, m.e23 - m.e20, m.e33 - m.e30);
+		planes[static_cast<int32_t>(EPlane::Bottom)] = Vec4f(m.e03 + m.e01, m.e13 + m.e11, m.e23 + m.e21, m.e33 + m.e31);
+		planes[static_cast<int32_t>(EPlane::Top)]    = Vec4f(m.e03 - m.e01, m.e13 - m.e11, m.e23 - m.e21, m.e33 - m.e31);
+		planes[static_cast<int32_t>(EPlane::Near)]   = Vec4f(m.e03 + m.e02, m.e13 + m.e12, m.e23 + m.e22, m.e33 + m.e32);
+		planes[static_cast<int32_t>(EPlane::Far)]    = Vec4f(m.e03 - m.e02, m.e13 - m.e12, m.e23 - m.e22, m.e33 - m.e32);
+
+		for (uint32_t index = 0; index < PLANE_COUNT; ++index)
+		{
+			Vec4f& plane = planes[index];
+			float length = MathModule::Sqrt(plane.x * plane.x + plane.y * plane.y + plane.z * plane.z);
+
+			if (length > Epsilon)
+			{
+				float invLength = 1.0f / length;
+				plane = Vec4f(plane.x * invLength, plane.y * invLength, plane.z * invLength, plane.w * invLength);
+			}
+		}
+	}
+
+
+	/**
+	 * @brief  ü ϰų ü ȿ ִ Ȯմϴ.
+	 *
+	 * @param center  ߽Դϴ.
+	 * @param radius  Դϴ.
+	 *
+	 * @return  ü ϰų ü ȿ ִٸ true, ׷  false ȯմϴ.
+	 */
+	bool IsIntersectSphere(const Vec3f& center, float radius) const
+	{
+		for (uint32_t index = 0; index < PLANE_COUNT; ++index)
+		{
+			const Vec4f& plane = planes[index];
+			float distance = plane.x * center.x + plane.y * center.y + plane.z * center.z + plane.w;
+
+			if (distance < -radius)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+
+	/**
+	 * @brief    (AABB) ü ϰų ü ȿ ִ Ȯմϴ.
+	 *
+	 * @param minPosition   ּ ǥԴϴ.
+	 * @param maxPosition   ִ ǥԴϴ.
+	 *
+	 * @return  ڰ ü ϰų ü ȿ ִٸ true, ׷  false ȯմϴ.
+	 *
+	 * @note 鸶     (p-vertex) ϳ ˻ϹǷ, ü 𼭸 ó ڴ  Ѵٰ   ֽϴ.
+	 */
+	bool IsIntersectAABB(const Vec3f& minPosition, const Vec3f& maxPosition) const
+	{
+		for (uint32_t index = 0; index < PLANE_COUNT; ++index)
+		{
+			const Vec4f& plane = planes[index];
+
+			float x = plane.x >= 0.0f ? maxPosition.x : minPosition.x;
+			float y = plane.y >= 0.0f ? maxPosition.y : minPosition.y;
+			float z = plane.z >= 0.0f ? maxPosition.z : minPosition.z;
+
+			if (plane.x * x + plane.y * y + plane.z * z + plane.w < 0.0f)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+
+	/**
+	 * @brief      ü øϰ, ̴  ε  ϴ.
+	 *
+	 * @param centers  ߽ 迭Դϴ.
+	 * @param radii   迭Դϴ.
+	 * @param count  Դϴ.
+	 * @param outVisibleIndices ̴  ε   迭Դϴ. ּ count Ҹ   ־ մϴ.
+	 *
+	 * @return ̴   ȯմϴ.
+	 *
+	 * @note   IsIntersectSphere ϴ. SIMD  ŭ  ˻մϴ.
+	 */
+	uint32_t CullSpheres(const Vec3f* centers, const float* radii, uint32_t count, uint32_t* outVisibleIndices) const;
+
+
+	/**
+	 * @brief SoA        ü øϰ, ̴  ε  ϴ.
+	 *
+	 * @param centerX  ߽ x ǥ 迭Դϴ.
+	 * @param centerY  ߽ y ǥ 迭Դϴ.
+	 * @param centerZ  ߽ z ǥ 迭Դϴ.
+	 * @param radii   迭Դϴ.
+	 * @param count  Դϴ.
+	 * @param outVisibleIndices ̴  ε   迭Դϴ. ּ count Ҹ   ־ մϴ.
+	 *
+	 * @return ̴   ȯմϴ.
+	 *
+	 * @note   ٷ   Ƿ Vec3f 迭 ޴  ϴ. ü  ٸ   մϴ.
+	 */
+	uint32_t CullSpheres(const float* centerX, const float* centerY, const float* centerZ, const float* radii, uint32_t count, uint32_t* outVisibleIndices) const;
+
+
+	/**
+	 * @brief      (AABB)   ü øϰ, ̴  ε  ϴ.
+	 *
+	 * @param minPositions   ּ ǥ 迭Դϴ.
+	 * @param maxPositions   ִ ǥ 迭Դϴ.
+	 * @param count   Դϴ.
+	 * @param outVisibleIndices ̴  ε   迭Դϴ. ּ count Ҹ   ־ մϴ.
+	 *
+	 * @return ̴   ȯմϴ.
+	 *
+	 * @note   IsIntersectAABB ϴ. SIMD  ŭ  ˻մϴ.
+	 */
+	uint32_t CullAABBs(const Vec3f* minPositions, const Vec3f* maxPositions, uint32_t count, uint32_t* outVisibleIndices) const;
+
+
+	/**
+	 * @brief ü  Դϴ.
+	 */
+	static const uint32_t PLANE_COUNT = static_cast<uint32_t>(EPlane::Count);
+
+
+	/**
+	 * @brief ü Դϴ. EPlane  ˴ϴ.
+	 */
+	Vec4f planes[PLANE_COUNT];
+};
\ No newline at end of file
@@ -0,0 +1,396 @@
+#pragma once
+
+#include <cstdint>
+
+#include "MathModule.h"
+#include "Mat4x4.h"
+#include "SIMD.h"
+#include "Vec3.h"
+
+
+/**
+ * @brief  ȯ ǥϴ 4x3 Դϴ.
+ *
+ * @note
+ * - 4x4 Ŀ ׻ (0, 0, 0, 1)   ϰ 48Ʈ մϴ.
+ * - 4x4 İ    Ծ , 0~2 ȸ/ũ/ , 3 ̵ Դϴ.
+ * -  ĳ  Mat4x4   28ȸ,  21ȸ ϴ.
+ */
+struct Mat4x3
+{
+	/**
+	 * @brief 4x3  ⺻ Դϴ.
+	 *
+	 * @note    0 ʱȭմϴ.
+	 */
+	Mat4x3() noexcept
+	{
+		e00 = 0.0f; e01 = 0.0f; e02 = 0.0f;
+		e10 = 0.0f; e11 = 0.0f; e12 = 0.0f;
+		e20 = 0.0f; e21 = 0.0f; e22 = 0.0f;
+		e30 = 0.0f; e31 = 0.0f; e32 = 0.0f;
+	}
+
+
+	/**
+	 * @brief 4x3  Դϴ.
+	 *
+	 * @param ee00  (0, 0) Դϴ.
+	 * @param ee01  (0, 1) Դϴ.
+	 * @param ee02  (0, 2) Դϴ.
+	 * @param ee10  (1, 0) Դϴ.
+	 * @param ee11  (1, 1) Դϴ.
+	 * @param ee12  (1, 2) Դϴ.
+	 * @param ee20  (2, 0) Դϴ.
+	 * @param ee21  (2, 1) Դϴ.
+	 * @param ee22  (2, 2) Դϴ.
+	 * @param ee30  (3, 0) Դϴ.
+	 * @param ee31  (3, 1) Դϴ.
+	 * @param ee32  (3, 2) Դϴ.
+	 */
+	Mat4x3(
+		const float& ee00, const float& ee01, const float& ee02,
+		const float& ee10, const float& ee11, const float& ee12,
+		const float& ee20, const float& ee21, const float& ee22,
+		const float& ee30, const float& ee31, const float& ee32
+	) noexcept
+	{
+		e00 = ee00; e01 = ee01; e02 = ee02;
+		e10 = ee10; e11 = ee11; e12 = ee12;
+		e20 = ee20; e21 = ee21; e22 = ee22;
+		e30 = ee30; e31 = ee31; e32 = ee32;
+	}
+
+
+	/**
+	 * @brief 4x3   Դϴ.
+	 *
+	 * @param m Ҹ   νϽԴϴ.
+	 */
+	Mat4x3(Mat4x3&& m) noexcept
+	{
+		e00 = m.e00; e01 = m.e01; e02 = m.e02;
+		e10 = m.e10; e11 = m.e11; e12 = m.e12;
+		e20 = m.e20; e21 = m.e21; e22 = m.e22;
+		e30 = m.e30; e31 = m.e31; e32 = m.e32;
+	}
+
+
+	/**
+	 * @brief 4x3   Դϴ.
+	 *
+	 * @param m Ҹ   νϽԴϴ.
+	 */
+	Mat4x3(const Mat4x3& m) noexcept
+	{
+		e00 = m.e00; e01 = m.e01; e02 = m.e02;
+		e10 = m.e10; e11 = m.e11; e12 = m.e12;
+		e20 = m.e20; e21 = m.e21; e22 = m.e22;
+		e30 = m.e30; e31 = m.e31; e32 = m.e32;
+	}
+
+
+	/**
+	 * @brief 4x3   Դϴ.
+	 *
+	 * @param m Ҹ   νϽԴϴ.
+	 *
+	 * @return   ڸ ȯմϴ.
+	 */
+	Mat4x3& operator=(Mat4x3&& m) noexcept
+	{
+		if (this == &m) return *this;
+
+		e00 = m.e00; e01 = m.e01; e02 = m.e02;
+		e10 = m.e10; e11 = m.e11; e12 = m.e12;
+		e20 = m.e20; e21 = m.e21; e22 = m.e22;
+		e30 = m.e30; e31 = m.e31; e32 = m.e32;
+
+		return *this;
+	}
+
+
+	/**
+	 * @brief 4x3   Դϴ.
+	 *
+	 * @param m Ҹ   νϽԴϴ.
+	 *
+	 * @return   ڸ ȯմϴ.
+	 */
+	Mat4x3& operator=(const Mat4x3& m) noexcept
+	{
+		if (this == &m) return *this;
+
+		e00 = m.e00; e01 = m.e01; e02 = m.e02;
+		e10 = m.e10; e11 = m.e11; e12 = m.e12;
+		e20 = m.e20; e21 = m.e21; e22 = m.e22;
+		e30 = m.e30; e31 = m.e31; e32 = m.e32;
+
+		return *this;
+	}
+
+
+	/**
+	 * @brief    մϴ.
+	 *
+	 * @param m   Դϴ.
+	 *
+	 * @return      ȯմϴ.
+	 *
+	 * @note    Mat4x4 ȯ   ϴ.
+	 */
+	Mat4x3 operator*(const Mat4x3& m) const
+	{
+#if defined(MATH_SIMD_SSE)
+		Mat4x3 result;
+		SIMD::MulMat4x3(data, m.data, result.data);
+		return result;
+#else
+		return Mat4x3(
+			e00 * m.e00 + e01 * m.e10 + e02 * m.e20,
+			e00 * m.e01 + e01 * m.e11 + e02 * m.e21,
+			e00 * m.e02 + e01 * m.e12 + e02 * m.e22,
+			e10 * m.e00 + e11 * m.e10 + e12 * m.e20,
+			e10 * m.e01 + e11 * m.e11 + e12 * m.e21,
+			e10 * m.e02 + e11 * m.e12 + e12 * m.e22,
+			e20 * m.e00 + e21 * m.e10 + e22 * m.e20,
+			e20 * m.e01 + e21 * m.e11 + e22 * m.e21,
+			e20 * m.e02 + e21 * m.e12 + e22 * m.e22,
+			e30 * m.e00 + e31 * m.e10 + e32 * m.e20 + m.e30,
+			e30 * m.e01 + e31 * m.e11 + e32 * m.e21 + m.e31,
+			e30 * m.e02 + e31 * m.e12 + e32 * m.e22 + m.e32
+		);
+#endif
+	}
+
+
+	/**
+	 * @brief   Ұ ġϴ Ȯմϴ.
+	 *
+	 * @param m Ұ ġϴ Ȯ Դϴ.
+	 *
+	 * @return   Ұ ġѴٸ true, ׷  false ȯմϴ.
+	 */
+	bool operator==(const Mat4x3& m) const
+	{
+		for (uint32_t index = 0; index < 12; ++index)
+		{
+			if (data[index] != m.data[index])
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+
+	/**
+	 * @brief   Ұ ġ ʴ Ȯմϴ.
+	 *
+	 * @param m Ұ ġ ʴ Ȯ Դϴ.
+	 *
+	 * @return   Ұ ġ ʴ´ٸ true, ׷  false ȯմϴ.
+	 */
+	bool operator!=(const Mat4x3& m) const
+	{
+		return !(*this == m);
+	}
+
+
+	/**
+	 * @brief 4x3   迭 ͸ ϴ.
+	 *
+	 * @return 4x3   迭 ͸ ȯմϴ.
+	 */
+	const float* GetPtr() const { return &e00; }
+
+
+	/**
+	 * @brief 4x3   迭 ͸ ϴ.
+	 *
+	 * @return 4x3   迭 ͸ ȯմϴ.
+	 */
+	float* GetPtr() { return &e00; }
+
+
+	/**
+	 * @brief 4x3    ϴ.
+	 *
+	 * @return 4x3    ȯմϴ.
+	 */
+	static inline Mat4x3 Identity()
+	{
+		return Mat4x3(
+			1.0f, 0.0f, 0.0f,
+			0.0f, 1.0f, 0.0f,
+			0.0f, 0.0f, 1.0f,
+			0.0f, 0.0f, 0.0f
+		);
+	}
+
+
+	/**
+	 * @brief   Ľ  ϴ.
+	 *
+	 * @param m Ľ    Դϴ.
+	 *
+	 * @return   Ľ  ȯմϴ. ̵  ĽĿ   ʽϴ.
+	 */
+	static inline float Determinant(const Mat4x3& m)
+	{
+		return m.e00 * (m.e11 * m.e22 - m.e12 * m.e21)
+			 + m.e01 * (m.e12 * m.e20 - m.e10 * m.e22)
+			 + m.e02 * (m.e10 * m.e21 - m.e11 * m.e20);
+	}
+
+
+	/**
+	 * @brief    ϴ.
+	 *
+	 * @param m    Դϴ.
+	 *
+	 * @return    ȯմϴ.
+	 *
+	 * @note 3x3 κ İ ̵ и ϹǷ Mat4x4::Inverse 귮 ξ ϴ.
+	 */
+	static inline Mat4x3 InverseAffine(const Mat4x3& m)
+	{
+		float cof00 = m.e11 * m.e22 - m.e12 * m.e21;
+		float cof01 = m.e12 * m.e20 - m.e10 * m.e22;
+		float cof02 = m.e10 * m.e21 - m.e11 * m.e20;
+
+		float oneOverDeterminant = 1.0f / (m.e00 * cof00 + m.e01 * cof01 + m.e02 * cof02);
+
+		float i00 = cof00 * oneOverDeterminant;
+		float i01 = (m.e02 * m.e21 - m.e01 * m.e22) * oneOverDeterminant;
+		float i02 = (m.e01 * m.e12 - m.e02 * m.e11) * oneOverDeterminant;
+		float i10 = cof01 * oneOverDeterminant;
+		float i11 = (m.e00 * m.e22 - m.e02 * m.e20) * oneOverDeterminant;
+		float i12 = (m.e02 * m.e10 - m.e00 * m.e12) * oneOverDeterminant;
+		float i20 = cof02 * oneOverDeterminant;
+		float i21 = (m.e01 * m.e20 - m.e00 * m.e21) * oneOverDeterminant;
+		float i22 = (m.e00 * m.e11 - m.e01 * m.e10) * oneOverDeterminant;
+
+		return Mat4x3(
+			i00, i01, i02,
+			i10, i11, i12,
+			i20, i21, i22,
+			-(m.e30 * i00 + m.e31 * i10 + m.e32 * i20),
+			-(m.e30 * i01 + m.e31 * i11 + m.e32 * i21),
+			-(m.e30 * i02 + m.e31 * i12 + m.e32 * i22)
+		);
+	}
+
+
+	/**
+	 * @brief ü ȯ(ȸ + ̵)   ϴ.
+	 *
+	 * @param m   ü ȯ Դϴ.
+	 *
+	 * @return ü ȯ   ȯմϴ.
+	 *
+	 * @note 3x3 κ   ̶ ϰ ġ  մϴ. ũ⳪   ִٸ InverseAffine ؾ մϴ.
+	 */
+	static inline Mat4x3 InverseRigid(const Mat4x3& m)
+	{
+		return Mat4x3(
+			m.e00, m.e10, m.e20,
+			m.e01, m.e11, m.e21,
+			m.e02, m.e12, m.e22,
+			-(m.e30 * m.e00 + m.e31 * m.e01 + m.e32 * m.e02),
+			-(m.e30 * m.e10 + m.e31 * m.e11 + m.e32 * m.e12),
+			-(m.e30 * m.e20 + m.e31 * m.e21 + m.e32 * m.e22)
+		);
+	}
+
+
+	/**
+	 * @brief  ķ ġ ȯմϴ.
+	 *
+	 * @param p ȯ ġԴϴ.
+	 * @param m ȯ   Դϴ.
+	 *
+	 * @return ȯ ġ ȯմϴ.
+	 */
+	static inline Vec3f TransformPoint(const Vec3f& p, const Mat4x3& m)
+	{
+		return Vec3f(
+			p.x * m.e00 + p.y * m.e10 + p.z * m.e20 + m.e30,
+			p.x * m.e01 + p.y * m.e11 + p.z * m.e21 + m.e31,
+			p.x * m.e02 + p.y * m.e12 + p.z * m.e22 + m.e32
+		);
+	}
+
+
+	/**
+	 * @brief  ķ  ͸ ȯմϴ.
+	 *
+	 * @param v ȯ  Դϴ.
+	 * @param m ȯ   Դϴ.
+	 *
+	 * @return ȯ  ͸ ȯմϴ. ̵   ʽϴ.
+	 */
+	static inline Vec3f TransformVector(const Vec3f& v, const Mat4x3& m)
+	{
+		return Vec3f(
+			v.x * m.e00 + v.y * m.e10 + v.z * m.e20,
+			v.x * m.e01 + v.y * m.e11 + v.z * m.e21,
+			v.x * m.e02 + v.y * m.e12 + v.z * m.e22
+		);
+	}
+
+
+	/**
+	 * @brief   4x4 ķ ȯմϴ.
+	 *
+	 * @param m 4x4 ķ ȯ  Դϴ.
+	 *
+	 * @return   (0, 0, 0, 1) 4x4  ȯմϴ.
+	 */
+	static inline Mat4x4 ToMat(const Mat4x3& m)
+	{
+		return Mat4x4(
+			m.e00, m.e01, m.e02, 0.0f,
+			m.e10, m.e11, m.e12, 0.0f,
+			m.e20, m.e21, m.e22, 0.0f,
+			m.e30, m.e31, m.e32, 1.0f
+		);
+	}
+
+
+	/**
+	 * @brief 4x4   ķ ȯմϴ.
+	 *
+	 * @param m  ķ ȯ 4x4 Դϴ.
+	 *
+	 * @return ȯ   ȯմϴ.
+	 *
+	 * @note   ϴ.   (0, 0, 0, 1)  ̶ ToMat ǵ   İ ϴ.
+	 */
+	static inline Mat4x3 ToMat4x3(const Mat4x4& m)
+	{
+		return Mat4x3(
+			m.e00, m.e01, m.e02,
+			m.e10, m.e11, m.e12,
+			m.e20, m.e21, m.e22,
+			m.e30, m.e31, m.e32
+		);
+	}
+
+
+	/**
+	 * @brief 4x3  Դϴ.
+	 */
+	union
+	{
+		struct
+		{
+			float e00; float e01; float e02;
+			float e10; float e11; float e12;
+			float e20; float e21; float e22;
+			float e30; float e31; float e32;
+		};
+		float data[12];
+	};
+};
\ No newline at end of file
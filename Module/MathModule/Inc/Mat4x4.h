@@ -3,6 +3,7 @@
 #include <cstdint>
 
 #include "MathModule.h"
+#include "SIMD.h"
 #include "Vec3.h"
 #include "Vec4.h"
 
@@ -323,6 +324,11 @@ struct Mat4x4
 	 */
 	Mat4x4 operator*(Mat4x4&& m) const
 	{
+#if defined(MATH_SIMD_SSE)
+		Mat4x4 result;
+		SIMD::MulMat4x4(data, m.data, result.data);
+		return result;
+#else
 		return Mat4x4(
 			e00 * m.e00 + e01 * m.e10 + e02 * m.e20 + e03 * m.e30,
 			e00 * m.e01 + e01 * m.e11 + e02 * m.e21 + e03 * m.e31,
@@ -341,6 +347,7 @@ struct Mat4x4
 			e30 * m.e02 + e31 * m.e12 + e32 * m.e22 + e33 * m.e32,
 			e30 * m.e03 + e31 * m.e13 + e32 * m.e23 + e33 * m.e33
 		);
+#endif
 	}
 
 
@@ -353,6 +360,11 @@ struct Mat4x4
 	 */
 	Mat4x4 operator*(const Mat4x4& m) const
 	{
+#if defined(MATH_SIMD_SSE)
+		Mat4x4 result;
+		SIMD::MulMat4x4(data, m.data, result.data);
+		return result;
+#else
 		return Mat4x4(
 			e00 * m.e00 + e01 * m.e10 + e02 * m.e20 + e03 * m.e30,
 			e00 * m.e01 + e01 * m.e11 + e02 * m.e21 + e03 * m.e31,
@@ -371,6 +383,7 @@ struct Mat4x4
 			e30 * m.e02 + e31 * m.e12 + e32 * m.e22 + e33 * m.e32,
 			e30 * m.e03 + e31 * m.e13 + e32 * m.e23 + e33 * m.e33
 		);
+#endif
 	}
 
 
@@ -455,6 +468,9 @@ struct Mat4x4
 	 */
 	bool operator==(Mat4x4&& m) const
 	{
+#if defined(MATH_SIMD_SSE)
+		return SIMD::EqualMat4x4(data, m.data);
+#else
 		return MathModule::Abs(e00 - m.e00) <= Epsilon
 			&& MathModule::Abs(e01 - m.e01) <= Epsilon
 			&& MathModule::Abs(e02 - m.e02) <= Epsilon
@@ -471,6 +487,7 @@ struct Mat4x4
 			&& MathModule::Abs(e31 - m.e31) <= Epsilon
 			&& MathModule::Abs(e32 - m.e32) <= Epsilon
 			&& MathModule::Abs(e33 - m.e33) <= Epsilon;
+#endif
 	}
 
 
@@ -483,6 +500,9 @@ struct Mat4x4
 	 */
 	bool operator==(const Mat4x4& m) const
 	{
+#if defined(MATH_SIMD_SSE)
+		return SIMD::EqualMat4x4(data, m.data);
+#else
 		return MathModule::Abs(e00 - m.e00) <= Epsilon
 			&& MathModule::Abs(e01 - m.e01) <= Epsilon
 			&& MathModule::Abs(e02 - m.e02) <= Epsilon
@@ -499,6 +519,7 @@ struct Mat4x4
 			&& MathModule::Abs(e31 - m.e31) <= Epsilon
 			&& MathModule::Abs(e32 - m.e32) <= Epsilon
 			&& MathModule::Abs(e33 - m.e33) <= Epsilon;
+#endif
 	}
 
 
@@ -511,6 +532,9 @@ struct Mat4x4
 	 */
 	bool operator!=(Mat4x4&& m) const
 	{
+#if defined(MATH_SIMD_SSE)
+		return SIMD::NotEqualMat4x4(data, m.data);
+#else
 		return MathModule::Abs(e00 - m.e00) > Epsilon
 			|| MathModule::Abs(e01 - m.e01) > Epsilon
 			|| MathModule::Abs(e02 - m.e02) > Epsilon
@@ -527,6 +551,7 @@ struct Mat4x4
 			|| MathModule::Abs(e31 - m.e31) > Epsilon
 			|| MathModule::Abs(e32 - m.e32) > Epsilon
 			|| MathModule::Abs(e33 - m.e33) > Epsilon;
+#endif
 	}
 
 
@@ -539,6 +564,9 @@ struct Mat4x4
 	 */
 	bool operator!=(const Mat4x4& m) const
 	{
+#if defined(MATH_SIMD_SSE)
+		return SIMD::NotEqualMat4x4(data, m.data);
+#else
 		return MathModule::Abs(e00 - m.e00) > Epsilon
 			|| MathModule::Abs(e01 - m.e01) > Epsilon
 			|| MathModule::Abs(e02 - m.e02) > Epsilon
@@ -555,6 +583,7 @@ struct Mat4x4
 			|| MathModule::Abs(e31 - m.e31) > Epsilon
 			|| MathModule::Abs(e32 - m.e32) > Epsilon
 			|| MathModule::Abs(e33 - m.e33) > Epsilon;
+#endif
 	}
 
 
@@ -615,12 +644,18 @@ struct Mat4x4
 	 */
 	static inline Mat4x4 Transpose(const Mat4x4& m)
 	{
+#if defined(MATH_SIMD_SSE)
+		Mat4x4 result;
+		SIMD::TransposeMat4x4(m.data, result.data);
+		return result;
+#else
 		return Mat4x4(
 			m.e00, m.e10, m.e20, m.e30,
 			m.e01, m.e11, m.e21, m.e31,
 			m.e02, m.e12, m.e22, m.e32,
 			m.e03, m.e13, m.e23, m.e33
 		);
+#endif
 	}
 
 
@@ -633,6 +668,9 @@ struct Mat4x4
 	 */
 	static float inline Determinant(const Mat4x4& m)
 	{
+#if defined(MATH_SIMD_SSE)
+		return SIMD::DeterminantMat4x4(m.data);
+#else
 		float subFactor00 = m.e22 * m.e33 - m.e32 * m.e23;
 		float subFactor01 = m.e21 * m.e33 - m.e31 * m.e23;
 		float subFactor02 = m.e21 * m.e32 - m.e31 * m.e22;
@@ -646,6 +684,7 @@ struct Mat4x4
 		float cof3 = -(m.e10 * subFactor02 - m.e11 * subFactor04 + m.e12 * subFactor05);
 
 		return m.e00 * cof0 + m.e01 * cof1 + m.e02 * cof2 + m.e03 * cof3;
+#endif
 	}
 
 
@@ -658,6 +697,11 @@ struct Mat4x4
 	 */
 	static inline Mat4x4 Inverse(const Mat4x4& m)
 	{
+#if defined(MATH_SIMD_SSE)
+		Mat4x4 result;
+		SIMD::InverseMat4x4(m.data, result.data);
+		return result;
+#else
 		float oneOverDeterminant = 1.0f / Determinant(m);
 
 		float coef00 = m.e22 * m.e33 - m.e32 * m.e23;
@@ -715,6 +759,7 @@ struct Mat4x4
 			col2.x, col2.y, col2.z, col2.w,
 			col3.x, col3.y, col3.z, col3.w
 		);
+#endif
 	}
 
 
@@ -3,6 +3,14 @@
 #include <cstdint>
 
 
+/**
+ * @brief MSVC ̿ Ϸ __forceinline   ֵ մϴ.
+ */
+#if !defined(_MSC_VER) && !defined(__forceinline)
+#define __forceinline inline __attribute__((always_inline))
+#endif
+
+
 /**
  * @brief () Դϴ.
  */
@@ -203,6 +211,64 @@ public:
 	}
 
 
+	/**
+	 * @brief   ϴ   ڻ    ϴ.
+	 *
+	 * @param radian   ڻ    Դϴ.
+	 * @param outSin   ϴ  Դϴ.
+	 * @param outCos   ϴ ڻ Դϴ.
+	 *
+	 * @note
+	 * -  Ҹ   ϸ,  Sin, Cos  ȣ  մϴ.
+	 * -      ڻ   ʿϴٸ Sin, Cos   ޼带 մϴ.
+	 */
+	static __forceinline void SinCos(float radian, float& outSin, float& outCos)
+	{
+		float quotient = OneDivTwoPi * radian;
+		if (radian >= 0.0f)
+		{
+			quotient = static_cast<float>(static_cast<int>(quotient + 0.5f));
+		}
+		else
+		{
+			quotient = static_cast<float>(static_cast<int>(quotient - 0.5f));
+		}
+
+		float y = radian - TwoPi * quotient;
+		float sign = 1.0f;
+
+		if (y > PiDiv2)
+		{
+			y = Pi - y;
+			sign = -1.0f;
+		}
+		else if (y < -PiDiv2)
+		{
+			y = -Pi - y;
+			sign = -1.0f;
+		}
+
+		float y2 = y * y;
+		outSin = (((((-2.3889859e-08f * y2 + 2.7525562e-06f) * y2 - 0.00019840874f) * y2 + 0.0083333310f) * y2 - 0.16666667f) * y2 + 1.0f) * y;
+
+		float p = ((((-2.6051615e-07f * y2 + 2.4760495e-05f) * y2 - 0.0013888378f) * y2 + 0.041666638f) * y2 - 0.5f) * y2 + 1.0f;
+		outCos = sign * p;
+	}
+
+
+	/**
+	 * @brief   迭 ϴ   ڻ  ϰ մϴ.
+	 *
+	 * @param radians   ڻ     迭Դϴ.
+	 * @param outSin    迭Դϴ.
+	 * @param outCos ڻ   迭Դϴ.
+	 * @param count   Դϴ.
+	 *
+	 * @note SIMD   ִٸ 4(AVX2 8)  ϸ,  Į SinCos մϴ.
+	 */
+	static void SinCos(const float* radians, float* outSin, float* outCos, uint32_t count);
+
+
 	/**
 	 * @brief ε Ҽ  ũ  մϴ.
 	 * 
@@ -233,6 +299,30 @@ public:
 	static float ACos(float value);
 
 
+	/**
+	 * @brief ε Ҽ  迭 ũ  ϰ մϴ.
+	 *
+	 * @param values -1.0  1.0   迭Դϴ.
+	 * @param outValues ũ    迭Դϴ. values Ƶ ˴ϴ.
+	 * @param count   Դϴ.
+	 *
+	 * @note SIMD   ִٸ 4(AVX2 8)  ϸ,  Į ASin մϴ.
+	 */
+	static void ASin(const float* values, float* outValues, uint32_t count);
+
+
+	/**
+	 * @brief ε Ҽ  迭 ũ ڻ ϰ մϴ.
+	 *
+	 * @param values -1.0  1.0   迭Դϴ.
+	 * @param outValues ũ ڻ   迭Դϴ. values Ƶ ˴ϴ.
+	 * @param count   Դϴ.
+	 *
+	 * @note SIMD   ִٸ 4(AVX2 8)  ϸ,  Į ACos մϴ.
+	 */
+	static void ACos(const float* values, float* outValues, uint32_t count);
+
+
 	/**
 	 * @brief  մϴ.
 	 *
@@ -287,6 +377,8 @@ public:
 	 * @param maxValue    ִԴϴ.
 	 *
 	 * @return    ȯմϴ.
+	 *
+	 * @note   ⺻  Ʈ(RandomStream::GetThreadLocal) մϴ.
 	 */
 	static int32_t GenerateRandomInt(int32_t minValue, int32_t maxValue);
 
@@ -298,6 +390,8 @@ public:
 	 * @param maxValue    ִԴϴ.
 	 *
 	 * @return   Ǽ ȯմϴ.
+	 *
+	 * @note   ⺻  Ʈ(RandomStream::GetThreadLocal) մϴ.
 	 */
 	static float GenerateRandomFloat(float minValue, float maxValue);
 };
\ No newline at end of file
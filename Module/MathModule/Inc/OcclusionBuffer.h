@@ -0,0 +1,292 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "MathModule.h"
+#include "Mat4x4.h"
+#include "ParallelFor.h"
+#include "Vec3.h"
+
+
+/**
+ * @brief Ʈ Ͷ ü(occluder) ̸ ϰ,  ü(occludee) ü ϴ ػ  Դϴ.
+ *
+ * @note
+ * -   NDC z [0, 1] ű ̸, 1   Դϴ.
+ * - ü ﰢ       ϳ ϹǷ, ϵ ̴  ǥ麸 ׻ ų ٴϴ.
+ * -  ϰų ڿ ִ ü ﰢ  ʽϴ.  ü ߸  ־, ̴ ü ٰ  ʽϴ.
+ * - ۴ TILE_WIDTH x TILE_HEIGHT ũ ŸϷ , Rasterize Ÿ   ó Լ  8ȼ ȭմϴ.
+ * - 4x4 İ    Ծ Ƿ, þ   view * projection    ؾ մϴ.
+ * - https://www.intel.com/content/www/us/en/developer/articles/technical/software-occlusion-culling.html
+ */
+class OcclusionBuffer
+{
+public:
+	/**
+	 * @brief Ÿ  ȼ Դϴ. 8  մϴ.
+	 */
+	static const uint32_t TILE_WIDTH = 32;
+
+
+	/**
+	 * @brief Ÿ  ȼ Դϴ.
+	 */
+	static const uint32_t TILE_HEIGHT = 16;
+
+
+	/**
+	 * @brief ⺻  ػԴϴ.
+	 */
+	static const uint32_t DEFAULT_WIDTH = 320;
+
+
+	/**
+	 * @brief ⺻  ػԴϴ.
+	 */
+	static const uint32_t DEFAULT_HEIGHT = 176;
+
+
+	/**
+	 * @brief ȭ Դϴ.
+	 */
+	struct Stats
+	{
+		/**
+		 * @brief AddOccluder ޵ ﰢ Դϴ.
+		 */
+		uint32_t occluderTriangleCount = 0;
+
+
+		/**
+		 * @brief , ȭ ﰢ, ȭ  ˻縦  ŸϿ й ﰢ Դϴ.
+		 */
+		uint32_t binnedTriangleCount = 0;
+
+
+		/**
+		 * @brief Ÿ   ȭ ۾ Դϴ.  ŸϿ ģ ﰢ Ÿϸ   ϴ.
+		 */
+		uint32_t tileTriangleCount = 0;
+	};
+
+
+public:
+	/**
+	 * @brief   Դϴ.
+	 *
+	 * @param width  ػԴϴ. TILE_WIDTH  øմϴ.
+	 * @param height  ػԴϴ. TILE_HEIGHT  øմϴ.
+	 */
+	explicit OcclusionBuffer(uint32_t width = DEFAULT_WIDTH, uint32_t height = DEFAULT_HEIGHT);
+
+
+	/**
+	 * @brief  ۸    , ̹  þ   մϴ.
+	 *
+	 * @param viewProjection view * projection   Դϴ.
+	 *
+	 * @note  ߰ ü  ϴ.
+	 */
+	void Clear(const Mat4x4& viewProjection);
+
+
+	/**
+	 * @brief ü ޽ø ߰մϴ.
+	 *
+	 * @param positions    ġ Դϴ.
+	 * @param vertexCount  Դϴ.
+	 * @param indices ﰢ  ε Դϴ.
+	 * @param indexCount ε Դϴ. 3  մϴ.
+	 * @param world ü  Դϴ.
+	 *
+	 * @note   ȭ  ȯ ŸϿ йϹǷ, ȣ   迭 ص ˴ϴ.
+	 */
+	void AddOccluder(const Vec3f* positions, uint32_t vertexCount, const uint32_t* indices, uint32_t indexCount, const Mat4x4& world);
+
+
+	/**
+	 * @brief  ϰ ε  ü ޽ø ߰մϴ.
+	 *
+	 * @param vertices position    Դϴ. StaticMesh::GetVertices  ״   ֽϴ.
+	 * @param indices ﰢ  ε Դϴ.
+	 * @param world ü  Դϴ.
+	 */
+	template <typename VertexType>
+	void AddOccluder(const std::vector<VertexType>& vertices, const std::vector<uint32_t>& indices, const Mat4x4& world)
+	{
+		positions_.resize(vertices.size());
+		for (std::size_t index = 0; index < vertices.size(); ++index)
+		{
+			positions_[index] = vertices[index].position;
+		}
+
+		AddOccluder(positions_.data(), static_cast<uint32_t>(positions_.size()), indices.data(), static_cast<uint32_t>(indices.size()), world);
+	}
+
+
+	/**
+	 * @brief ߰ ü  ۿ ȭմϴ.
+	 *
+	 * @param parallelFor Ÿ  ȭ  ó ԼԴϴ. nullptr̸  忡 ȭմϴ.
+	 *
+	 * @note Ÿϸ ﰢ  ũ ٸǷ,  ó Լ Ÿ ϳ  ۾ ġ  ϸ   ϴ.
+	 */
+	void Rasterize(const ParallelForFunction& parallelFor = nullptr);
+
+
+	/**
+	 * @brief    (AABB)  ۿ  ʾҴ Ȯմϴ.
+	 *
+	 * @param minPosition   ּ ǥԴϴ.
+	 * @param maxPosition   ִ ǥԴϴ.
+	 *
+	 * @return   Ϻζ   ִٸ true,  ų ȭ ۿ ִٸ false ȯմϴ.
+	 *
+	 * @note  ϴ  ڴ ׻ ̴  մϴ.
+	 */
+	bool IsVisibleAABB(const Vec3f& minPosition, const Vec3f& maxPosition) const;
+
+
+	/**
+	 * @brief    ۿ  ʾҴ Ȯմϴ.
+	 *
+	 * @param center   ߽Դϴ.
+	 * @param radius   Դϴ. Ѵ ׻ ̴  մϴ.
+	 *
+	 * @return   δ   Ϻζ   ִٸ true ȯմϴ.
+	 */
+	bool IsVisibleSphere(const Vec3f& center, float radius) const;
+
+
+	/**
+	 * @brief ε  Ű       ε ϴ.
+	 *
+	 * @param centers   ߽ Դϴ.
+	 * @param radii    Դϴ.
+	 * @param indices ˻   ε Դϴ. Frustum::CullSpheres  ״   ֽϴ.
+	 * @param indexCount ˻ ε Դϴ.
+	 * @param outVisibleIndices ̴   ε  迭Դϴ. indices  迭̾ ˴ϴ.
+	 *
+	 * @return ̴    ȯմϴ.
+	 */
+	uint32_t CullSpheres(const Vec3f* centers, const float* radii, const uint32_t* indices, uint32_t indexCount, uint32_t* outVisibleIndices) const;
+
+
+	/**
+	 * @brief    ػ󵵸 ϴ.
+	 */
+	uint32_t GetWidth() const { return width_; }
+
+
+	/**
+	 * @brief    ػ󵵸 ϴ.
+	 */
+	uint32_t GetHeight() const { return height_; }
+
+
+	/**
+	 * @brief  켱    ۸ ϴ. ù °  ȭ Դϴ.
+	 */
+	const std::vector<float>& GetDepths() const { return depths_; }
+
+
+	/**
+	 * @brief  Clear  ȭ 踦 ϴ.
+	 */
+	const Stats& GetStats() const { return stats_; }
+
+
+private:
+	/**
+	 * @brief ȭ  ȯ ŸϿ й ﰢԴϴ.
+	 *
+	 * @note ȼ (x, y) ߽ɿ a[i] * x + b[i] * y + c[i]    0 ̸̻ ﰢ Դϴ.
+	 */
+	struct ScreenTriangle
+	{
+		float a[3];
+		float b[3];
+		float c[3];
+		float depth;
+		int32_t minX;
+		int32_t minY;
+		int32_t maxX;
+		int32_t maxY;
+	};
+
+
+	/**
+	 * @brief Ÿ ϳ й ﰢ  ȭմϴ.
+	 *
+	 * @param tile ȭ Ÿ εԴϴ.
+	 */
+	void RasterizeTile(uint32_t tile);
+
+
+private:
+	/**
+	 * @brief  ػԴϴ.
+	 */
+	uint32_t width_ = 0;
+
+
+	/**
+	 * @brief  ػԴϴ.
+	 */
+	uint32_t height_ = 0;
+
+
+	/**
+	 * @brief   Ÿ Դϴ.
+	 */
+	uint32_t tileCountX_ = 0;
+
+
+	/**
+	 * @brief   Ÿ Դϴ.
+	 */
+	uint32_t tileCountY_ = 0;
+
+
+	/**
+	 * @brief ̹  þ  Դϴ.
+	 */
+	Mat4x4 viewProjection_;
+
+
+	/**
+	 * @brief  Դϴ.
+	 */
+	std::vector<float> depths_;
+
+
+	/**
+	 * @brief ŸϿ й ﰢ Դϴ.
+	 */
+	std::vector<ScreenTriangle> triangles_;
+
+
+	/**
+	 * @brief Ÿϸ й ﰢ ε Դϴ.
+	 */
+	std::vector<std::vector<uint32_t>> tileBins_;
+
+
+	/**
+	 * @brief ü  ȯ  ϴ ӽ 迭Դϴ.
+	 */
+	std::vector<Vec3f> positions_;
+
+
+	/**
+	 * @brief ü  ȭ  ǥ(x, y, )  ӽ 迭Դϴ.    ̰ Դϴ.
+	 */
+	std::vector<Vec3f> screenPositions_;
+
+
+	/**
+	 * @brief ȭ Դϴ.
+	 */
+	Stats stats_;
+};
\ No newline at end of file
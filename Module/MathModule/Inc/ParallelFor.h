@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+
+
+/**
+ * @brief [begin, end)  ε óϴ  ԼԴϴ.
+ */
+using ParallelRangeFunction = std::function<void(uint32_t begin, uint32_t end)>;
+
+
+/**
+ * @brief [0, count)    Լ ѱ  ó ԼԴϴ.
+ *
+ * @note
+ * - MathModule 带  ٷ Ƿ,    ϴ   Լ ڷ ް ȣ ۾ ýۿ  ó ñϴ.
+ * -  Լ  忡 ÿ ȣ  ,  ó Լ   ó ڿ ȯؾ մϴ.
+ * - ε ϳ ̹ ū ۾ ̹Ƿ,  ε ϳ  ѱ  ϴ.
+ */
+using ParallelForFunction = std::function<void(uint32_t count, const ParallelRangeFunction& function)>;
\ No newline at end of file
@@ -221,6 +221,7 @@ struct Quat
 	 */
 	Vec3f operator*(Vec3f&& vec) const
 	{
+		Vec3f v(x, y, z);
 		return v * 2.0f * Vec3f::Dot(v, vec) + vec * (w * w - Vec3f::Dot(v, v)) + Vec3f::Cross(v, vec) * 2.0f * w;
 	}
 
@@ -234,6 +235,7 @@ struct Quat
 	 */
 	Vec3f operator*(const Vec3f& vec) const
 	{
+		Vec3f v(x, y, z);
 		return v * 2.0f * Vec3f::Dot(v, vec) + vec * (w * w - Vec3f::Dot(v, v)) + Vec3f::Cross(v, vec) * 2.0f * w;
 	}
 	
@@ -779,11 +781,6 @@ struct Quat
 			float z;
 			float w;
 		};
-		struct 
-		{
-			Vec3f v;
-			float w;
-		};
 		float data[4];
 	};
 };
\ No newline at end of file
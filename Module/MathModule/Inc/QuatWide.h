@@ -0,0 +1,322 @@
+#pragma once
+
+#include <vector>
+
+#include "FloatWide.h"
+#include "Quat.h"
+#include "Vec3Wide.h"
+
+
+/**
+ * @brief   ʹϾ SoA  SIMD ο  ̵ ʹϾԴϴ.
+ *
+ * @note
+ * - T Floatx4 Ȥ Floatx8Դϴ.   ٸ   ڵ մϴ.
+ * -   κ Quat  ̸    մϴ.
+ */
+template <typename T>
+struct QuatWide
+{
+	/**
+	 * @brief ̵ ʹϾ  Դϴ.
+	 */
+	static const uint32_t LANE_COUNT = T::LANE_COUNT;
+
+
+	/**
+	 * @brief ̵ ʹϾ ⺻ Դϴ.   ׵ ʹϾ ʱȭմϴ.
+	 */
+	QuatWide() noexcept : x(0.0f), y(0.0f), z(0.0f), w(1.0f) {}
+
+
+	/**
+	 * @brief ̵ ʹϾ Դϴ.
+	 *
+	 * @param xx ̵ ʹϾ x Դϴ.
+	 * @param yy ̵ ʹϾ y Դϴ.
+	 * @param zz ̵ ʹϾ z Դϴ.
+	 * @param ww ̵ ʹϾ w Դϴ.
+	 */
+	QuatWide(const T& xx, const T& yy, const T& zz, const T& ww) noexcept : x(xx), y(yy), z(zz), w(ww) {}
+
+
+	/**
+	 * @brief ̵ ʹϾ Դϴ.    ʹϾ ʱȭմϴ.
+	 *
+	 * @param q  ο  ʹϾԴϴ.
+	 */
+	explicit QuatWide(const Quat& q) noexcept : x(q.x), y(q.y), z(q.z), w(q.w) {}
+
+
+	/**
+	 * @brief ʹϾ 迭 ̵ ʹϾ нϴ.
+	 *
+	 * @param quats  ʹϾ 迭Դϴ.
+	 * @param count  ʹϾ Դϴ.      ׵ ʹϾ äϴ.
+	 *
+	 * @return  ̵ ʹϾ ȯմϴ.
+	 */
+	static __forceinline QuatWide Load(const Quat* quats, uint32_t count = LANE_COUNT)
+	{
+		float elements[4][LANE_COUNT] = {};
+
+		for (uint32_t lane = 0; lane < LANE_COUNT; ++lane)
+		{
+			elements[3][lane] = 1.0f;
+		}
+
+		for (uint32_t lane = 0; lane < count && lane < LANE_COUNT; ++lane)
+		{
+			elements[0][lane] = quats[lane].x;
+			elements[1][lane] = quats[lane].y;
+			elements[2][lane] = quats[lane].z;
+			elements[3][lane] = quats[lane].w;
+		}
+
+		return QuatWide(T::Load(elements[0]), T::Load(elements[1]), T::Load(elements[2]), T::Load(elements[3]));
+	}
+
+
+	/**
+	 * @brief ʹϾ 迭 Ư ġ ̵ ʹϾ нϴ.
+	 *
+	 * @param quats  ʹϾ 迭Դϴ.
+	 * @param offset б  ġԴϴ. 迭  Ѵ  ׵ ʹϾ äϴ.
+	 *
+	 * @return  ̵ ʹϾ ȯմϴ.
+	 */
+	static __forceinline QuatWide Load(const std::vector<Quat>& quats, uint32_t offset)
+	{
+		uint32_t size = static_cast<uint32_t>(quats.size());
+		return Load(quats.data() + offset, offset < size ? size - offset : 0);
+	}
+
+
+	/**
+	 * @brief ̵ ʹϾ ʹϾ 迭 ϴ.
+	 *
+	 * @param outQuats  ʹϾ 迭Դϴ.
+	 * @param count  ʹϾ Դϴ.     θ ϴ.
+	 */
+	__forceinline void Store(Quat* outQuats, uint32_t count = LANE_COUNT) const
+	{
+		float elements[4][LANE_COUNT];
+		x.Store(elements[0]);
+		y.Store(elements[1]);
+		z.Store(elements[2]);
+		w.Store(elements[3]);
+
+		for (uint32_t lane = 0; lane < count && lane < LANE_COUNT; ++lane)
+		{
+			outQuats[lane] = Quat(elements[0][lane], elements[1][lane], elements[2][lane], elements[3][lane]);
+		}
+	}
+
+
+	/**
+	 * @brief ̵ ʹϾ ʹϾ 迭 Ư ġ ϴ.
+	 *
+	 * @param outQuats  ʹϾ 迭Դϴ.
+	 * @param offset   ġԴϴ. 迭  Ѵ   ʽϴ.
+	 */
+	__forceinline void Store(std::vector<Quat>& outQuats, uint32_t offset) const
+	{
+		uint32_t size = static_cast<uint32_t>(outQuats.size());
+		Store(outQuats.data() + offset, offset < size ? size - offset : 0);
+	}
+
+
+	/**
+	 * @brief Ư  ʹϾ ϴ.
+	 *
+	 * @param lane ʹϾ  Դϴ.
+	 *
+	 * @return  ʹϾ ȯմϴ.
+	 */
+	__forceinline Quat Get(uint32_t lane) const
+	{
+		return Quat(x.Get(lane), y.Get(lane), z.Get(lane), w.Get(lane));
+	}
+
+
+	QuatWide operator-() const { return QuatWide(-x, -y, -z, -w); }
+	QuatWide operator+(const QuatWide& q) const { return QuatWide(x + q.x, y + q.y, z + q.z, w + q.w); }
+	QuatWide operator-(const QuatWide& q) const { return QuatWide(x - q.x, y - q.y, z - q.z, w - q.w); }
+	QuatWide operator*(const T& s) const { return QuatWide(x * s, y * s, z * s, w * s); }
+
+
+	/**
+	 * @brief ̵ ʹϾ   մϴ.
+	 */
+	QuatWide operator*(const QuatWide& q) const
+	{
+		return QuatWide(
+			x * q.w + y * q.z - z * q.y + w * q.x,
+			y * q.w - x * q.z + z * q.x + w * q.y,
+			x * q.y - y * q.x + z * q.w + w * q.z,
+			w * q.w - (x * q.x + y * q.y + z * q.z)
+		);
+	}
+
+
+	/**
+	 * @brief ̵ ʹϾ ̵ ͸ ȸմϴ.
+	 */
+	Vec3Wide<T> operator*(const Vec3Wide<T>& vec) const
+	{
+		Vec3Wide<T> v(x, y, z);
+		return v * T(2.0f) * Vec3Wide<T>::Dot(v, vec) + vec * (w * w - Vec3Wide<T>::Dot(v, v)) + Vec3Wide<T>::Cross(v, vec) * T(2.0f) * w;
+	}
+
+
+	/**
+	 * @brief ̵ ʹϾ   մϴ.
+	 */
+	static __forceinline T Dot(const QuatWide& lhs, const QuatWide& rhs)
+	{
+		return lhs.x * rhs.x + lhs.y * rhs.y + lhs.z * rhs.z + lhs.w * rhs.w;
+	}
+
+
+	/**
+	 * @brief ̵ ʹϾ ũ   մϴ.
+	 */
+	static __forceinline T LengthSq(const QuatWide& q)
+	{
+		return Dot(q, q);
+	}
+
+
+	/**
+	 * @brief ̵ ʹϾ ũ⸦ մϴ.
+	 */
+	static __forceinline T Length(const QuatWide& q)
+	{
+		return T::Sqrt(LengthSq(q));
+	}
+
+
+	/**
+	 * @brief ̵ ʹϾ ȭմϴ.
+	 *
+	 * @note Quat::Normalize  ũⰡ 0   ׵ ʹϾ ȯմϴ.
+	 */
+	static __forceinline QuatWide Normalize(const QuatWide& q)
+	{
+		T length = Length(q);
+		T nearZero = T::Abs(length) <= T(Epsilon);
+		T invLength = T(1.0f) / length;
+
+		return Select(nearZero, QuatWide(), q * invLength);
+	}
+
+
+	/**
+	 * @brief ӷ ̵ ʹϾ ϴ.
+	 */
+	static __forceinline QuatWide Conjugate(const QuatWide& q)
+	{
+		return QuatWide(-q.x, -q.y, -q.z, q.w);
+	}
+
+
+	/**
+	 * @brief ̵ ʹϾ   ϴ.
+	 */
+	static __forceinline QuatWide Inverse(const QuatWide& q)
+	{
+		T invLengthSq = T(1.0f) / LengthSq(q);
+		return QuatWide(-q.x * invLengthSq, -q.y * invLengthSq, -q.z * invLengthSq, q.w * invLengthSq);
+	}
+
+
+	/**
+	 * @brief  ̵ ʹϾ  մϴ.
+	 */
+	static __forceinline QuatWide Lerp(const QuatWide& s, const QuatWide& e, const T& t)
+	{
+		return s * (T(1.0f) - t) + e * t;
+	}
+
+
+	/**
+	 * @brief  ̵ ʹϾ ȭ   մϴ.
+	 */
+	static __forceinline QuatWide Nlerp(const QuatWide& s, const QuatWide& e, const T& t)
+	{
+		return Normalize(Lerp(s, e, t));
+	}
+
+
+	/**
+	 * @brief   ̵ ʹϾ   մϴ.
+	 *
+	 * @note
+	 * - sin() ̿   ϸ,  s * Quat::Pow(Quat::Inverse(s) * e, t) ݿø   ϴ. t 1̸ e ȯմϴ.
+	 * -  ʹϾ   sin() 0   ȭ    ȯմϴ.
+	 */
+	static __forceinline QuatWide Slerp(const QuatWide& s, const QuatWide& e, const T& t)
+	{
+		T cosTheta = T::Min(T::Max(Dot(s, e), T(-1.0f)), T(1.0f));
+		T theta = T::ACos(cosTheta);
+
+		T sinTheta;
+		T unused;
+		T::SinCos(theta, sinTheta, unused);
+
+		T sinA;
+		T sinB;
+		T::SinCos((T(1.0f) - t) * theta, sinA, unused);
+		T::SinCos(t * theta, sinB, unused);
+
+		T invSinTheta = T(1.0f) / sinTheta;
+		QuatWide slerp = s * (sinA * invSinTheta) + e * (sinB * invSinTheta);
+
+		return Select(T::Abs(sinTheta) <= T(Epsilon), Nlerp(s, e, t), slerp);
+	}
+
+
+	/**
+	 * @brief ũ  κ ʹϾ մϴ.
+	 */
+	static __forceinline QuatWide Select(const T& mask, const QuatWide& a, const QuatWide& b)
+	{
+		return QuatWide(T::Select(mask, a.x, b.x), T::Select(mask, a.y, b.y), T::Select(mask, a.z, b.z), T::Select(mask, a.w, b.w));
+	}
+
+
+	/**
+	 * @brief ̵ ʹϾ x Դϴ.
+	 */
+	T x;
+
+
+	/**
+	 * @brief ̵ ʹϾ y Դϴ.
+	 */
+	T y;
+
+
+	/**
+	 * @brief ̵ ʹϾ z Դϴ.
+	 */
+	T z;
+
+
+	/**
+	 * @brief ̵ ʹϾ w Դϴ.
+	 */
+	T w;
+};
+
+
+/**
+ * @brief 4  ̵ ʹϾԴϴ.
+ */
+using Quatx4 = QuatWide<Floatx4>;
+
+
+/**
+ * @brief 8  ̵ ʹϾԴϴ.
+ */
+using Quatx8 = QuatWide<Floatx8>;
\ No newline at end of file
@@ -0,0 +1,224 @@
+#pragma once
+
+#include <cstdint>
+
+#include "Quat.h"
+#include "Vec3.h"
+
+
+/**
+ * @brief õ    ƮԴϴ.
+ *
+ * @note
+ * - ˰ xoshiro128**(128Ʈ , ֱ 2^128 - 1) մϴ.
+ * -  õ  Ʈ ׻   մϴ.
+ * - Ʈ 忡  ʽϴ. 帶 GetThreadLocal Ȥ Split   Ʈ ؾ մϴ.
+ * - https://prng.di.unimi.it/xoshiro128starstar.c
+ */
+class RandomStream
+{
+public:
+	/**
+	 * @brief õ带  ʾ  ϴ ⺻ õ Դϴ.
+	 */
+	static const uint64_t DEFAULT_SEED = 0x853C49E6748FEA9BULL;
+
+
+public:
+	/**
+	 * @brief  Ʈ Դϴ.
+	 *
+	 * @param seed  Ʈ õ Դϴ.
+	 */
+	explicit RandomStream(uint64_t seed = DEFAULT_SEED) { Seed(seed); }
+
+
+	/**
+	 * @brief  Ʈ  ҸԴϴ.
+	 */
+	virtual ~RandomStream() {}
+
+
+	/**
+	 * @brief  Ʈ õ带 մϴ.
+	 *
+	 * @param seed  õ Դϴ.
+	 *
+	 * @note õ  SplitMix64 ȮǾ  ¸ ʱȭմϴ.
+	 */
+	void Seed(uint64_t seed);
+
+
+	/**
+	 * @brief  Ʈ 2^64 ܰ  ̵մϴ.
+	 *
+	 * @note  õ忡 Jump  ٸ Ƚŭ ȣ Ʈ 2^64  ̻ ġ ʽϴ.
+	 */
+	void Jump();
+
+
+	/**
+	 * @brief  Ʈ ġ ʴ  Ʈ ϴ.
+	 *
+	 * @return   Ʈ  ȯϰ,  Ʈ 2^64 ܰ  ̵մϴ.
+	 *
+	 * @note Ŀ 帶  Ʈ   մϴ.
+	 */
+	RandomStream Split();
+
+
+	/**
+	 * @brief 32Ʈ ȣ    մϴ.
+	 *
+	 * @return  32Ʈ ȣ    ȯմϴ.
+	 */
+	uint32_t NextUInt()
+	{
+		const uint32_t result = RotateLeft(state_[1] * 5, 7) * 9;
+		const uint32_t t = state_[1] << 9;
+
+		state_[2] ^= state_[0];
+		state_[3] ^= state_[1];
+		state_[1] ^= state_[2];
+		state_[0] ^= state_[3];
+
+		state_[2] ^= t;
+		state_[3] = RotateLeft(state_[3], 11);
+
+		return result;
+	}
+
+
+	/**
+	 * @brief [minValue, maxValue]    մϴ.
+	 *
+	 * @param minValue    ּڰԴϴ.
+	 * @param maxValue    ִԴϴ.
+	 *
+	 * @return    ȯմϴ.
+	 *
+	 * @note ּڰ ִ  ٲ ϸ,   Lemire   Դϴ.
+	 */
+	int32_t NextInt(int32_t minValue, int32_t maxValue);
+
+
+	/**
+	 * @brief [0.0, 1.0)  Ǽ  մϴ.
+	 *
+	 * @return  Ǽ  ȯմϴ.
+	 */
+	float NextFloat()
+	{
+		return static_cast<float>(NextUInt() >> 8) * (1.0f / 16777216.0f);
+	}
+
+
+	/**
+	 * @brief [minValue, maxValue)  Ǽ  մϴ.
+	 *
+	 * @param minValue    ּڰԴϴ.
+	 * @param maxValue    ִԴϴ.
+	 *
+	 * @return  Ǽ  ȯմϴ.
+	 */
+	float NextFloat(float minValue, float maxValue)
+	{
+		return minValue + (maxValue - minValue) * NextFloat();
+	}
+
+
+	/**
+	 * @brief   ǥ鿡 ϰ ϴ  ͸ մϴ.
+	 *
+	 * @return   ͸ ȯմϴ.
+	 */
+	Vec3f NextUnitVec3();
+
+
+	/**
+	 * @brief ȸ  ϰ ϴ  ʹϾ մϴ.
+	 *
+	 * @return   ʹϾ ȯմϴ.
+	 *
+	 * @note Shoemake  մϴ.
+	 */
+	Quat NextUnitQuat();
+
+
+	/**
+	 * @brief 迭 [minValue, maxValue]    äϴ.
+	 *
+	 * @param outValues  ä 迭Դϴ.
+	 * @param count ä  Դϴ.
+	 * @param minValue    ּڰԴϴ.
+	 * @param maxValue    ִԴϴ.
+	 */
+	void Fill(int32_t* outValues, uint32_t count, int32_t minValue, int32_t maxValue);
+
+
+	/**
+	 * @brief 迭 [minValue, maxValue)  Ǽ  äϴ.
+	 *
+	 * @param outValues  ä 迭Դϴ.
+	 * @param count ä  Դϴ.
+	 * @param minValue    ּڰԴϴ.
+	 * @param maxValue    ִԴϴ.
+	 */
+	void Fill(float* outValues, uint32_t count, float minValue = 0.0f, float maxValue = 1.0f);
+
+
+	/**
+	 * @brief 迭   ǥ鿡 ϰ ϴ  ͷ äϴ.
+	 *
+	 * @param outVectors  ͷ ä 迭Դϴ.
+	 * @param count ä  Դϴ.
+	 *
+	 * @note  NextUnitVec3 count ȣ  ϴ.
+	 */
+	void Fill(Vec3f* outVectors, uint32_t count);
+
+
+	/**
+	 * @brief 迭 ȸ  ϰ ϴ  ʹϾ äϴ.
+	 *
+	 * @param outQuats  ʹϾ ä 迭Դϴ.
+	 * @param count ä  Դϴ.
+	 *
+	 * @note  NextUnitQuat count ȣ  ϴ.
+	 */
+	void Fill(Quat* outQuats, uint32_t count);
+
+
+	/**
+	 * @brief   ⺻  Ʈ ϴ.
+	 *
+	 * @return   ⺻  Ʈ ڸ ȯմϴ.
+	 *
+	 * @note
+	 * - 帶  Ʈ , ó   std::random_device   õ带 մϴ.
+	 * -    ʿϴٸ ȯ Ʈ Seed ȣմϴ.
+	 */
+	static RandomStream& GetThreadLocal();
+
+
+private:
+	/**
+	 * @brief 32Ʈ   ȸմϴ.
+	 *
+	 * @param x ȸ Դϴ.
+	 * @param k ȸ Ʈ Դϴ.
+	 *
+	 * @return ȸ  ȯմϴ.
+	 */
+	static __forceinline uint32_t RotateLeft(uint32_t x, int32_t k)
+	{
+		return (x << k) | (x >> (32 - k));
+	}
+
+
+private:
+	/**
+	 * @brief  Ʈ  Դϴ.
+	 */
+	uint32_t state_[4];
+};
\ No newline at end of file
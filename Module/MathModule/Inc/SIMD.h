@@ -0,0 +1,590 @@
+#pragma once
+
+#include <cstdint>
+
+#include "MathModule.h"
+
+
+/**
+ * @brief  Ÿӿ  SIMD ɾ  մϴ.
+ *
+ * @note
+ * - AVX2 ϵ ϸ(/arch:AVX2, -mavx2) AVX2 θ մϴ.
+ * - x86-64 Ÿ SSE θ մϴ. SSE δ SSE2 ɾ ϹǷ  x86-64 CPU մϴ.
+ * - MATH_DISABLE_SIMD ϸ SIMD  ʰ Į ڵ带 մϴ.
+ * - SIMD δ Į ڵ   Ƿ Ʈ    ȯմϴ. MathModule FMA   մϴ.
+ */
+#if !defined(MATH_DISABLE_SIMD)
+#if defined(__AVX2__)
+#define MATH_SIMD_AVX2
+#endif
+#if defined(__AVX2__) || defined(__SSE4_1__) || defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+#define MATH_SIMD_SSE
+#endif
+#endif
+
+#if defined(MATH_SIMD_AVX2)
+#include <immintrin.h>
+#elif defined(MATH_SIMD_SSE)
+#include <emmintrin.h>
+#endif
+
+
+/**
+ * @brief  Ÿ SIMD  մϴ.
+ *
+ * @note
+ * -  Ŭ  ޼ (static) ŸԴϴ.
+ * -  ޼  켱(row-major) ġ  迭 Է , ޸  䱸 ʽϴ.
+ * - MATH_SIMD_SSE ǵ    Ŭ   ϴ.
+ */
+class SIMD
+{
+public:
+#if defined(MATH_SIMD_SSE)
+	/**
+	 * @brief  4x4  մϴ.
+	 *
+	 * @param lhs    4x4   迭Դϴ.
+	 * @param rhs    4x4   迭Դϴ.
+	 * @param outResult    4x4   迭Դϴ.
+	 */
+	static __forceinline void MulMat4x4(const float* lhs, const float* rhs, float* outResult)
+	{
+#if defined(MATH_SIMD_AVX2)
+		__m256 b0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(rhs + 0));
+		__m256 b1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(rhs + 4));
+		__m256 b2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(rhs + 8));
+		__m256 b3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(rhs + 12));
+
+		__m256 a01 = _mm256_loadu_ps(lhs + 0);
+		__m256 a23 = _mm256_loadu_ps(lhs + 8);
+
+		__m256 r01 = _mm256_mul_ps(_mm256_permute_ps(a01, 0x00), b0);
+		r01 = _mm256_add_ps(r01, _mm256_mul_ps(_mm256_permute_ps(a01, 0x55), b1));
+		r01 = _mm256_add_ps(r01, _mm256_mul_ps(_mm256_permute_ps(a01, 0xAA), b2));
+		r01 = _mm256_add_ps(r01, _mm256_mul_ps(_mm256_permute_ps(a01, 0xFF), b3));
+
+		__m256 r23 = _mm256_mul_ps(_mm256_permute_ps(a23, 0x00), b0);
+		r23 = _mm256_add_ps(r23, _mm256_mul_ps(_mm256_permute_ps(a23, 0x55), b1));
+		r23 = _mm256_add_ps(r23, _mm256_mul_ps(_mm256_permute_ps(a23, 0xAA), b2));
+		r23 = _mm256_add_ps(r23, _mm256_mul_ps(_mm256_permute_ps(a23, 0xFF), b3));
+
+		_mm256_storeu_ps(outResult + 0, r01);
+		_mm256_storeu_ps(outResult + 8, r23);
+#else
+		__m128 b0 = _mm_loadu_ps(rhs + 0);
+		__m128 b1 = _mm_loadu_ps(rhs + 4);
+		__m128 b2 = _mm_loadu_ps(rhs + 8);
+		__m128 b3 = _mm_loadu_ps(rhs + 12);
+
+		_mm_storeu_ps(outResult + 0, MulRowMat4x4(_mm_loadu_ps(lhs + 0), b0, b1, b2, b3));
+		_mm_storeu_ps(outResult + 4, MulRowMat4x4(_mm_loadu_ps(lhs + 4), b0, b1, b2, b3));
+		_mm_storeu_ps(outResult + 8, MulRowMat4x4(_mm_loadu_ps(lhs + 8), b0, b1, b2, b3));
+		_mm_storeu_ps(outResult + 12, MulRowMat4x4(_mm_loadu_ps(lhs + 12), b0, b1, b2, b3));
+#endif
+	}
+
+
+	/**
+	 * @brief  4x3   մϴ.
+	 *
+	 * @param lhs    4x3   迭Դϴ.
+	 * @param rhs    4x3   迭Դϴ.
+	 * @param outResult    4x3   迭Դϴ.
+	 *
+	 * @note  迭 12 float̸, 迭  ޸𸮴 аų  ʽϴ.
+	 */
+	static __forceinline void MulMat4x3(const float* lhs, const float* rhs, float* outResult)
+	{
+		__m128 b0 = _mm_loadu_ps(rhs + 0);
+		__m128 b1 = _mm_loadu_ps(rhs + 3);
+		__m128 b2 = _mm_loadu_ps(rhs + 6);
+		__m128 b3 = _mm_loadu_ps(rhs + 8);
+		b3 = _mm_shuffle_ps(b3, b3, _MM_SHUFFLE(3, 3, 2, 1));
+
+		__m128 r0 = MulRowMat4x3(lhs + 0, b0, b1, b2);
+		__m128 r1 = MulRowMat4x3(lhs + 3, b0, b1, b2);
+		__m128 r2 = MulRowMat4x3(lhs + 6, b0, b1, b2);
+		__m128 r3 = _mm_add_ps(MulRowMat4x3(lhs + 9, b0, b1, b2), b3);
+
+		_mm_storeu_ps(outResult + 0, r0);
+		_mm_storeu_ps(outResult + 3, r1);
+		_mm_storeu_ps(outResult + 6, r2);
+		_mm_storel_pi(reinterpret_cast<__m64*>(outResult + 9), r3);
+		_mm_store_ss(outResult + 11, _mm_shuffle_ps(r3, r3, _MM_SHUFFLE(2, 2, 2, 2)));
+	}
+
+
+	/**
+	 * @brief 4x4  ġ  մϴ.
+	 *
+	 * @param m ġ 4x4   迭Դϴ.
+	 * @param outResult ġ   4x4   迭Դϴ.
+	 */
+	static __forceinline void TransposeMat4x4(const float* m, float* outResult)
+	{
+		__m128 r0 = _mm_loadu_ps(m + 0);
+		__m128 r1 = _mm_loadu_ps(m + 4);
+		__m128 r2 = _mm_loadu_ps(m + 8);
+		__m128 r3 = _mm_loadu_ps(m + 12);
+
+		_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+		_mm_storeu_ps(outResult + 0, r0);
+		_mm_storeu_ps(outResult + 4, r1);
+		_mm_storeu_ps(outResult + 8, r2);
+		_mm_storeu_ps(outResult + 12, r3);
+	}
+
+
+	/**
+	 * @brief 4x4  Ľ  մϴ.
+	 *
+	 * @param m Ľ   4x4   迭Դϴ.
+	 *
+	 * @return 4x4  Ľ  ȯմϴ.
+	 */
+	static __forceinline float DeterminantMat4x4(const float* m)
+	{
+		__m128 inv[4];
+		ComputeSignedCofactorMat4x4(m, inv);
+
+		return DotCofactorMat4x4(m, inv);
+	}
+
+
+	/**
+	 * @brief 4x4   մϴ.
+	 *
+	 * @param m   4x4   迭Դϴ.
+	 * @param outResult   4x4   迭Դϴ.
+	 */
+	static __forceinline void InverseMat4x4(const float* m, float* outResult)
+	{
+		__m128 inv[4];
+		ComputeSignedCofactorMat4x4(m, inv);
+
+		float oneOverDeterminant = 1.0f / DotCofactorMat4x4(m, inv);
+		__m128 scale = _mm_set1_ps(oneOverDeterminant);
+
+		_mm_storeu_ps(outResult + 0, _mm_mul_ps(inv[0], scale));
+		_mm_storeu_ps(outResult + 4, _mm_mul_ps(inv[1], scale));
+		_mm_storeu_ps(outResult + 8, _mm_mul_ps(inv[2], scale));
+		_mm_storeu_ps(outResult + 12, _mm_mul_ps(inv[3], scale));
+	}
+
+
+	/**
+	 * @brief  4x4    ̰ Ƿ  ˻մϴ.
+	 *
+	 * @param lhs ˻縦  4x4   迭Դϴ.
+	 * @param rhs ˻縦   ٸ 4x4   迭Դϴ.
+	 *
+	 * @return   ̰ Ƿ ϶ true, ׷  false ȯմϴ.
+	 */
+	static __forceinline bool EqualMat4x4(const float* lhs, const float* rhs)
+	{
+#if defined(MATH_SIMD_AVX2)
+		const __m256 signMask = _mm256_set1_ps(-0.0f);
+		const __m256 epsilon = _mm256_set1_ps(Epsilon);
+
+		__m256 d01 = _mm256_andnot_ps(signMask, _mm256_sub_ps(_mm256_loadu_ps(lhs + 0), _mm256_loadu_ps(rhs + 0)));
+		__m256 d23 = _mm256_andnot_ps(signMask, _mm256_sub_ps(_mm256_loadu_ps(lhs + 8), _mm256_loadu_ps(rhs + 8)));
+
+		__m256 mask = _mm256_and_ps(_mm256_cmp_ps(d01, epsilon, _CMP_LE_OQ), _mm256_cmp_ps(d23, epsilon, _CMP_LE_OQ));
+		return _mm256_movemask_ps(mask) == 0xFF;
+#else
+		const __m128 signMask = _mm_set1_ps(-0.0f);
+		const __m128 epsilon = _mm_set1_ps(Epsilon);
+
+		__m128 mask = _mm_castsi128_ps(_mm_set1_epi32(-1));
+		for (uint32_t row = 0; row < 4; ++row)
+		{
+			__m128 d = _mm_andnot_ps(signMask, _mm_sub_ps(_mm_loadu_ps(lhs + row * 4), _mm_loadu_ps(rhs + row * 4)));
+			mask = _mm_and_ps(mask, _mm_cmple_ps(d, epsilon));
+		}
+
+		return _mm_movemask_ps(mask) == 0xF;
+#endif
+	}
+
+
+	/**
+	 * @brief  4x4    ̰ Ƿк ū Ұ ִ ˻մϴ.
+	 *
+	 * @param lhs ˻縦  4x4   迭Դϴ.
+	 * @param rhs ˻縦   ٸ 4x4   迭Դϴ.
+	 *
+	 * @return  ̰ Ƿк ū Ұ ϳ ִٸ true, ׷  false ȯմϴ.
+	 */
+	static __forceinline bool NotEqualMat4x4(const float* lhs, const float* rhs)
+	{
+#if defined(MATH_SIMD_AVX2)
+		const __m256 signMask = _mm256_set1_ps(-0.0f);
+		const __m256 epsilon = _mm256_set1_ps(Epsilon);
+
+		__m256 d01 = _mm256_andnot_ps(signMask, _mm256_sub_ps(_mm256_loadu_ps(lhs + 0), _mm256_loadu_ps(rhs + 0)));
+		__m256 d23 = _mm256_andnot_ps(signMask, _mm256_sub_ps(_mm256_loadu_ps(lhs + 8), _mm256_loadu_ps(rhs + 8)));
+
+		__m256 mask = _mm256_or_ps(_mm256_cmp_ps(d01, epsilon, _CMP_GT_OQ), _mm256_cmp_ps(d23, epsilon, _CMP_GT_OQ));
+		return _mm256_movemask_ps(mask) != 0;
+#else
+		const __m128 signMask = _mm_set1_ps(-0.0f);
+		const __m128 epsilon = _mm_set1_ps(Epsilon);
+
+		__m128 mask = _mm_setzero_ps();
+		for (uint32_t row = 0; row < 4; ++row)
+		{
+			__m128 d = _mm_andnot_ps(signMask, _mm_sub_ps(_mm_loadu_ps(lhs + row * 4), _mm_loadu_ps(rhs + row * 4)));
+			mask = _mm_or_ps(mask, _mm_cmpgt_ps(d, epsilon));
+		}
+
+		return _mm_movemask_ps(mask) != 0;
+#endif
+	}
+
+
+	/**
+	 * @brief 4   ϴ   ڻ    մϴ.
+	 *
+	 * @param radian   ڻ    Դϴ.
+	 * @param outSin   ϴ  Դϴ.
+	 * @param outCos   ϴ ڻ Դϴ.
+	 *
+	 * @note MathModule::Sin, MathModule::Cos     ̴ϸƽ ٻ մϴ.
+	 */
+	static __forceinline void SinCos4(__m128 radian, __m128& outSin, __m128& outCos)
+	{
+		const __m128 zero = _mm_setzero_ps();
+
+		__m128 quotient = _mm_mul_ps(_mm_set1_ps(OneDivTwoPi), radian);
+		__m128 rounding = Select4(_mm_cmpge_ps(radian, zero), _mm_set1_ps(0.5f), _mm_set1_ps(-0.5f));
+		quotient = _mm_cvtepi32_ps(_mm_cvttps_epi32(_mm_add_ps(quotient, rounding)));
+
+		__m128 y = _mm_sub_ps(radian, _mm_mul_ps(_mm_set1_ps(TwoPi), quotient));
+
+		__m128 greater = _mm_cmpgt_ps(y, _mm_set1_ps(PiDiv2));
+		__m128 less = _mm_cmplt_ps(y, _mm_set1_ps(-PiDiv2));
+
+		y = Select4(greater, _mm_sub_ps(_mm_set1_ps(Pi), y), Select4(less, _mm_sub_ps(_mm_set1_ps(-Pi), y), y));
+		__m128 sign = Select4(_mm_or_ps(greater, less), _mm_set1_ps(-1.0f), _mm_set1_ps(1.0f));
+
+		__m128 y2 = _mm_mul_ps(y, y);
+
+		__m128 s = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(-2.3889859e-08f), y2), _mm_set1_ps(2.7525562e-06f));
+		s = _mm_sub_ps(_mm_mul_ps(s, y2), _mm_set1_ps(0.00019840874f));
+		s = _mm_add_ps(_mm_mul_ps(s, y2), _mm_set1_ps(0.0083333310f));
+		s = _mm_sub_ps(_mm_mul_ps(s, y2), _mm_set1_ps(0.16666667f));
+		s = _mm_add_ps(_mm_mul_ps(s, y2), _mm_set1_ps(1.0f));
+		outSin = _mm_mul_ps(s, y);
+
+		__m128 c = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(-2.6051615e-07f), y2), _mm_set1_ps(2.4760495e-05f));
+		c = _mm_sub_ps(_mm_mul_ps(c, y2), _mm_set1_ps(0.0013888378f));
+		c = _mm_add_ps(_mm_mul_ps(c, y2), _mm_set1_ps(0.041666638f));
+		c = _mm_sub_ps(_mm_mul_ps(c, y2), _mm_set1_ps(0.5f));
+		c = _mm_add_ps(_mm_mul_ps(c, y2), _mm_set1_ps(1.0f));
+		outCos = _mm_mul_ps(sign, c);
+	}
+
+
+	/**
+	 * @brief 4 ε Ҽ  ũ  մϴ.
+	 *
+	 * @param value -1.0  1.0  Դϴ.
+	 *
+	 * @return Է  ũ ( )  ȯմϴ.
+	 *
+	 * @note MathModule::ASin  ̴ϸƽ ٻ մϴ.
+	 */
+	static __forceinline __m128 ASin4(__m128 value)
+	{
+		const __m128 piDiv2 = _mm_set1_ps(PiDiv2);
+		__m128 result = ArcPolynomial4(value);
+
+		return Select4(_mm_cmpge_ps(value, _mm_setzero_ps()), _mm_sub_ps(piDiv2, result), _mm_sub_ps(result, piDiv2));
+	}
+
+
+	/**
+	 * @brief 4 ε Ҽ  ũ ڻ մϴ.
+	 *
+	 * @param value -1.0  1.0  Դϴ.
+	 *
+	 * @return Է  ũ ڻ( ڻ)  ȯմϴ.
+	 *
+	 * @note MathModule::ACos  ̴ϸƽ ٻ մϴ.
+	 */
+	static __forceinline __m128 ACos4(__m128 value)
+	{
+		__m128 result = ArcPolynomial4(value);
+
+		return Select4(_mm_cmpge_ps(value, _mm_setzero_ps()), result, _mm_sub_ps(_mm_set1_ps(Pi), result));
+	}
+
+
+#if defined(MATH_SIMD_AVX2)
+	/**
+	 * @brief 8   ϴ   ڻ    մϴ.
+	 *
+	 * @param radian   ڻ    Դϴ.
+	 * @param outSin   ϴ  Դϴ.
+	 * @param outCos   ϴ ڻ Դϴ.
+	 *
+	 * @note MathModule::Sin, MathModule::Cos     ̴ϸƽ ٻ մϴ.
+	 */
+	static __forceinline void SinCos8(__m256 radian, __m256& outSin, __m256& outCos)
+	{
+		const __m256 zero = _mm256_setzero_ps();
+
+		__m256 quotient = _mm256_mul_ps(_mm256_set1_ps(OneDivTwoPi), radian);
+		__m256 rounding = _mm256_blendv_ps(_mm256_set1_ps(-0.5f), _mm256_set1_ps(0.5f), _mm256_cmp_ps(radian, zero, _CMP_GE_OQ));
+		quotient = _mm256_cvtepi32_ps(_mm256_cvttps_epi32(_mm256_add_ps(quotient, rounding)));
+
+		__m256 y = _mm256_sub_ps(radian, _mm256_mul_ps(_mm256_set1_ps(TwoPi), quotient));
+
+		__m256 greater = _mm256_cmp_ps(y, _mm256_set1_ps(PiDiv2), _CMP_GT_OQ);
+		__m256 less = _mm256_cmp_ps(y, _mm256_set1_ps(-PiDiv2), _CMP_LT_OQ);
+
+		y = _mm256_blendv_ps(_mm256_blendv_ps(y, _mm256_sub_ps(_mm256_set1_ps(-Pi), y), less), _mm256_sub_ps(_mm256_set1_ps(Pi), y), greater);
+		__m256 sign = _mm256_blendv_ps(_mm256_set1_ps(1.0f), _mm256_set1_ps(-1.0f), _mm256_or_ps(greater, less));
+
+		__m256 y2 = _mm256_mul_ps(y, y);
+
+		__m256 s = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(-2.3889859e-08f), y2), _mm256_set1_ps(2.7525562e-06f));
+		s = _mm256_sub_ps(_mm256_mul_ps(s, y2), _mm256_set1_ps(0.00019840874f));
+		s = _mm256_add_ps(_mm256_mul_ps(s, y2), _mm256_set1_ps(0.0083333310f));
+		s = _mm256_sub_ps(_mm256_mul_ps(s, y2), _mm256_set1_ps(0.16666667f));
+		s = _mm256_add_ps(_mm256_mul_ps(s, y2), _mm256_set1_ps(1.0f));
+		outSin = _mm256_mul_ps(s, y);
+
+		__m256 c = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(-2.6051615e-07f), y2), _mm256_set1_ps(2.4760495e-05f));
+		c = _mm256_sub_ps(_mm256_mul_ps(c, y2), _mm256_set1_ps(0.0013888378f));
+		c = _mm256_add_ps(_mm256_mul_ps(c, y2), _mm256_set1_ps(0.041666638f));
+		c = _mm256_sub_ps(_mm256_mul_ps(c, y2), _mm256_set1_ps(0.5f));
+		c = _mm256_add_ps(_mm256_mul_ps(c, y2), _mm256_set1_ps(1.0f));
+		outCos = _mm256_mul_ps(sign, c);
+	}
+
+
+	/**
+	 * @brief 8 ε Ҽ  ũ  մϴ.
+	 *
+	 * @param value -1.0  1.0  Դϴ.
+	 *
+	 * @return Է  ũ ( )  ȯմϴ.
+	 *
+	 * @note MathModule::ASin  ̴ϸƽ ٻ մϴ.
+	 */
+	static __forceinline __m256 ASin8(__m256 value)
+	{
+		const __m256 piDiv2 = _mm256_set1_ps(PiDiv2);
+		__m256 result = ArcPolynomial8(value);
+
+		return _mm256_blendv_ps(_mm256_sub_ps(result, piDiv2), _mm256_sub_ps(piDiv2, result), _mm256_cmp_ps(value, _mm256_setzero_ps(), _CMP_GE_OQ));
+	}
+
+
+	/**
+	 * @brief 8 ε Ҽ  ũ ڻ մϴ.
+	 *
+	 * @param value -1.0  1.0  Դϴ.
+	 *
+	 * @return Է  ũ ڻ( ڻ)  ȯմϴ.
+	 *
+	 * @note MathModule::ACos  ̴ϸƽ ٻ մϴ.
+	 */
+	static __forceinline __m256 ACos8(__m256 value)
+	{
+		__m256 result = ArcPolynomial8(value);
+
+		return _mm256_blendv_ps(_mm256_sub_ps(_mm256_set1_ps(Pi), result), result, _mm256_cmp_ps(value, _mm256_setzero_ps(), _CMP_GE_OQ));
+	}
+#endif
+
+
+private:
+	/**
+	 * @brief ũ     ϳ մϴ.
+	 *
+	 * @param mask  ũԴϴ. Ʈ   a, ׷   b մϴ.
+	 * @param a ũ  ο  Դϴ.
+	 * @param b ũ   ο  Դϴ.
+	 *
+	 * @return õ  ȯմϴ.
+	 */
+	static __forceinline __m128 Select4(__m128 mask, __m128 a, __m128 b)
+	{
+		return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+	}
+
+
+	/**
+	 * @brief ũ , ũ ڻ 꿡  ϴ sqrt(1 - |x|) * P(|x|)  մϴ.
+	 *
+	 * @param value -1.0  1.0  Դϴ.
+	 *
+	 * @return   ȯմϴ.
+	 */
+	static __forceinline __m128 ArcPolynomial4(__m128 value)
+	{
+		__m128 x = _mm_andnot_ps(_mm_set1_ps(-0.0f), value);
+		__m128 omx = _mm_max_ps(_mm_setzero_ps(), _mm_sub_ps(_mm_set1_ps(1.0f), x));
+		__m128 root = _mm_sqrt_ps(omx);
+
+		__m128 result = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(-0.0012624911f), x), _mm_set1_ps(0.0066700901f));
+		result = _mm_sub_ps(_mm_mul_ps(result, x), _mm_set1_ps(0.0170881256f));
+		result = _mm_add_ps(_mm_mul_ps(result, x), _mm_set1_ps(0.0308918810f));
+		result = _mm_sub_ps(_mm_mul_ps(result, x), _mm_set1_ps(0.0501743046f));
+		result = _mm_add_ps(_mm_mul_ps(result, x), _mm_set1_ps(0.0889789874f));
+		result = _mm_sub_ps(_mm_mul_ps(result, x), _mm_set1_ps(0.2145988016f));
+		result = _mm_add_ps(_mm_mul_ps(result, x), _mm_set1_ps(1.5707963050f));
+
+		return _mm_mul_ps(result, root);
+	}
+
+
+#if defined(MATH_SIMD_AVX2)
+	/**
+	 * @brief ũ , ũ ڻ 꿡  ϴ sqrt(1 - |x|) * P(|x|)  մϴ.
+	 *
+	 * @param value -1.0  1.0  Դϴ.
+	 *
+	 * @return   ȯմϴ.
+	 */
+	static __forceinline __m256 ArcPolynomial8(__m256 value)
+	{
+		__m256 x = _mm256_andnot_ps(_mm256_set1_ps(-0.0f), value);
+		__m256 omx = _mm256_max_ps(_mm256_setzero_ps(), _mm256_sub_ps(_mm256_set1_ps(1.0f), x));
+		__m256 root = _mm256_sqrt_ps(omx);
+
+		__m256 result = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(-0.0012624911f), x), _mm256_set1_ps(0.0066700901f));
+		result = _mm256_sub_ps(_mm256_mul_ps(result, x), _mm256_set1_ps(0.0170881256f));
+		result = _mm256_add_ps(_mm256_mul_ps(result, x), _mm256_set1_ps(0.0308918810f));
+		result = _mm256_sub_ps(_mm256_mul_ps(result, x), _mm256_set1_ps(0.0501743046f));
+		result = _mm256_add_ps(_mm256_mul_ps(result, x), _mm256_set1_ps(0.0889789874f));
+		result = _mm256_sub_ps(_mm256_mul_ps(result, x), _mm256_set1_ps(0.2145988016f));
+		result = _mm256_add_ps(_mm256_mul_ps(result, x), _mm256_set1_ps(1.5707963050f));
+
+		return _mm256_mul_ps(result, root);
+	}
+#endif
+
+
+	/**
+	 * @brief 4x4      մϴ.
+	 *
+	 * @param a   Դϴ.
+	 * @param b0   ù ° Դϴ.
+	 * @param b1    ° Դϴ.
+	 * @param b2    ° Դϴ.
+	 * @param b3    ° Դϴ.
+	 *
+	 * @return    ȯմϴ.
+	 */
+	static __forceinline __m128 MulRowMat4x4(__m128 a, __m128 b0, __m128 b1, __m128 b2, __m128 b3)
+	{
+		__m128 r = _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(0, 0, 0, 0)), b0);
+		r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(1, 1, 1, 1)), b1));
+		r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 2, 2, 2)), b2));
+		r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 3, 3, 3)), b3));
+		return r;
+	}
+
+
+	/**
+	 * @brief 4x3      3x3 κ մϴ.
+	 *
+	 * @param a    Ű Դϴ. 3 Ҹ нϴ.
+	 * @param b0   ù ° Դϴ.
+	 * @param b1    ° Դϴ.
+	 * @param b2    ° Դϴ.
+	 *
+	 * @return    ȯմϴ.  ° Ҵ  ʽϴ.
+	 */
+	static __forceinline __m128 MulRowMat4x3(const float* a, __m128 b0, __m128 b1, __m128 b2)
+	{
+		__m128 r = _mm_mul_ps(_mm_set1_ps(a[0]), b0);
+		r = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(a[1]), b1));
+		r = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(a[2]), b2));
+		return r;
+	}
+
+
+	/**
+	 * @brief 4x4  ȣ  μ (   ܰ) մϴ.
+	 *
+	 * @param m μ  4x4   迭Դϴ.
+	 * @param outInv ȣ  μ  Դϴ.
+	 *
+	 * @note Mat4x4::Inverse Į ڵ    մϴ.
+	 */
+	static __forceinline void ComputeSignedCofactorMat4x4(const float* m, __m128 outInv[4])
+	{
+		__m128 r0 = _mm_loadu_ps(m + 0);
+		__m128 r1 = _mm_loadu_ps(m + 4);
+		__m128 r2 = _mm_loadu_ps(m + 8);
+		__m128 r3 = _mm_loadu_ps(m + 12);
+
+		// (a[i], a[i], b[i], b[i])  Ҹ ġմϴ.
+#define PAIR(a, b, i) _mm_shuffle_ps(a, b, _MM_SHUFFLE(i, i, i, i))
+		// (t[0], t[0], t[0], t[2])  Ҹ ġմϴ.
+#define SPLAT3(t) _mm_shuffle_ps(t, t, _MM_SHUFFLE(2, 0, 0, 0))
+		// (t[0], t[2], t[2], t[2])  Ҹ ġմϴ.
+#define SPLAT1(t) _mm_shuffle_ps(t, t, _MM_SHUFFLE(2, 2, 2, 0))
+
+		__m128 fac0 = _mm_sub_ps(_mm_mul_ps(PAIR(r2, r1, 2), SPLAT3(PAIR(r3, r2, 3))), _mm_mul_ps(SPLAT3(PAIR(r3, r2, 2)), PAIR(r2, r1, 3)));
+		__m128 fac1 = _mm_sub_ps(_mm_mul_ps(PAIR(r2, r1, 1), SPLAT3(PAIR(r3, r2, 3))), _mm_mul_ps(SPLAT3(PAIR(r3, r2, 1)), PAIR(r2, r1, 3)));
+		__m128 fac2 = _mm_sub_ps(_mm_mul_ps(PAIR(r2, r1, 1), SPLAT3(PAIR(r3, r2, 2))), _mm_mul_ps(SPLAT3(PAIR(r3, r2, 1)), PAIR(r2, r1, 2)));
+		__m128 fac3 = _mm_sub_ps(_mm_mul_ps(PAIR(r2, r1, 0), SPLAT3(PAIR(r3, r2, 3))), _mm_mul_ps(SPLAT3(PAIR(r3, r2, 0)), PAIR(r2, r1, 3)));
+		__m128 fac4 = _mm_sub_ps(_mm_mul_ps(PAIR(r2, r1, 0), SPLAT3(PAIR(r3, r2, 2))), _mm_mul_ps(SPLAT3(PAIR(r3, r2, 0)), PAIR(r2, r1, 2)));
+		__m128 fac5 = _mm_sub_ps(_mm_mul_ps(PAIR(r2, r1, 0), SPLAT3(PAIR(r3, r2, 1))), _mm_mul_ps(SPLAT3(PAIR(r3, r2, 0)), PAIR(r2, r1, 1)));
+
+		__m128 vec0 = SPLAT1(PAIR(r1, r0, 0));
+		__m128 vec1 = SPLAT1(PAIR(r1, r0, 1));
+		__m128 vec2 = SPLAT1(PAIR(r1, r0, 2));
+		__m128 vec3 = SPLAT1(PAIR(r1, r0, 3));
+
+#undef PAIR
+#undef SPLAT3
+#undef SPLAT1
+
+		__m128 inv0 = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(vec1, fac0), _mm_mul_ps(vec2, fac1)), _mm_mul_ps(vec3, fac2));
+		__m128 inv1 = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(vec0, fac0), _mm_mul_ps(vec2, fac3)), _mm_mul_ps(vec3, fac4));
+		__m128 inv2 = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(vec0, fac1), _mm_mul_ps(vec1, fac3)), _mm_mul_ps(vec3, fac5));
+		__m128 inv3 = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(vec0, fac2), _mm_mul_ps(vec1, fac4)), _mm_mul_ps(vec2, fac5));
+
+		__m128 signA = _mm_setr_ps(+1.0f, -1.0f, +1.0f, -1.0f);
+		__m128 signB = _mm_setr_ps(-1.0f, +1.0f, -1.0f, +1.0f);
+
+		outInv[0] = _mm_mul_ps(inv0, signA);
+		outInv[1] = _mm_mul_ps(inv1, signB);
+		outInv[2] = _mm_mul_ps(inv2, signA);
+		outInv[3] = _mm_mul_ps(inv3, signB);
+	}
+
+
+	/**
+	 * @brief 4x4  ù °  μ (Ľ) մϴ.
+	 *
+	 * @param m Ľ   4x4   迭Դϴ.
+	 * @param inv ȣ  μ  Դϴ.
+	 *
+	 * @return 4x4  Ľ  ȯմϴ.
+	 *
+	 * @note Į ڵ  ġŰ   ʺ  մϴ.
+	 */
+	static __forceinline float DotCofactorMat4x4(const float* m, const __m128 inv[4])
+	{
+		__m128 cofactor = _mm_movelh_ps(_mm_unpacklo_ps(inv[0], inv[1]), _mm_unpacklo_ps(inv[2], inv[3]));
+		__m128 product = _mm_mul_ps(_mm_loadu_ps(m), cofactor);
+
+		float determinant = _mm_cvtss_f32(product);
+		determinant += _mm_cvtss_f32(_mm_shuffle_ps(product, product, _MM_SHUFFLE(1, 1, 1, 1)));
+		determinant += _mm_cvtss_f32(_mm_shuffle_ps(product, product, _MM_SHUFFLE(2, 2, 2, 2)));
+		determinant += _mm_cvtss_f32(_mm_shuffle_ps(product, product, _MM_SHUFFLE(3, 3, 3, 3)));
+
+		return determinant;
+	}
+#endif
+};
\ No newline at end of file
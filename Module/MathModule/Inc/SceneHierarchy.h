@@ -0,0 +1,219 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "Mat4x4.h"
+#include "ParallelFor.h"
+#include "Transform.h"
+
+
+/**
+ * @brief Ʈ θ-ڽ  Դϴ.
+ *
+ * @note
+ * -   Ʈ, θ ġ,  ,  ÷׸   迭 մϴ.
+ * - 迭  켱   ĵǾ θ ׻ ڽĺ տ ְ, ϳ  Ʈ ӵ  մϴ.
+ * - Update 迭   ȸϸ  Ʈ ٲ    Ʈ  ĸ ٽ մϴ.
+ * -  ID AddNode ȯ    ٲ  ʽϴ.
+ */
+class SceneHierarchy
+{
+public:
+	/**
+	 * @brief ȿ   IDԴϴ. θ  Ʈ  θ IḎ⵵ մϴ.
+	 */
+	static const uint32_t INVALID_NODE = 0xFFFFFFFF;
+
+
+public:
+	/**
+	 * @brief   ⺻ Դϴ.
+	 */
+	SceneHierarchy() = default;
+
+
+	/**
+	 * @brief    ҸԴϴ.
+	 */
+	virtual ~SceneHierarchy() {}
+
+
+	/**
+	 * @brief   带 ߰մϴ.
+	 *
+	 * @param localTransform θ   ƮԴϴ.
+	 * @param parent θ  IDԴϴ. INVALID_NODE Ʈ  ߰մϴ.
+	 *
+	 * @return ߰  ID ȯմϴ.
+	 *
+	 * @note θ  ڼ ڿ ٷ    쿡  Update 迭 ٽ մϴ.
+	 */
+	uint32_t AddNode(const Transform& localTransform, uint32_t parent = INVALID_NODE);
+
+
+	/**
+	 * @brief  θ մϴ.
+	 *
+	 * @param node θ   IDԴϴ.
+	 * @param parent ο θ  IDԴϴ. INVALID_NODE Ʈ 尡 ˴ϴ.
+	 *
+	 * @return θ ߴٸ true, ȯ   ߴٸ false ȯմϴ.
+	 *
+	 * @note   Ʈ ü  Update ٽ ˴ϴ.
+	 */
+	bool SetParent(uint32_t node, uint32_t parent);
+
+
+	/**
+	 * @brief  θ ID ϴ.
+	 *
+	 * @param node θ   IDԴϴ.
+	 *
+	 * @return θ  ID ȯմϴ. Ʈ  INVALID_NODE ȯմϴ.
+	 */
+	uint32_t GetParent(uint32_t node) const;
+
+
+	/**
+	 * @brief   Ʈ մϴ.
+	 *
+	 * @param node  Ʈ   IDԴϴ.
+	 * @param localTransform θ   ƮԴϴ.
+	 */
+	void SetLocalTransform(uint32_t node, const Transform& localTransform);
+
+
+	/**
+	 * @brief   Ʈ ϴ.
+	 *
+	 * @param node  Ʈ   IDԴϴ.
+	 *
+	 * @return θ   Ʈ ȯմϴ.
+	 */
+	const Transform& GetLocalTransform(uint32_t node) const { return localTransforms_[nodeToIndex_[node]]; }
+
+
+	/**
+	 * @brief    ϴ.
+	 *
+	 * @param node     IDԴϴ.
+	 *
+	 * @return  Update    ȯմϴ.
+	 */
+	const Mat4x4& GetWorldMatrix(uint32_t node) const { return worldMatrices_[nodeToIndex_[node]]; }
+
+
+	/**
+	 * @brief     ϴ.
+	 *
+	 * @return     ȯմϴ.
+	 */
+	uint32_t GetNodeCount() const { return static_cast<uint32_t>(localTransforms_.size()); }
+
+
+	/**
+	 * @brief ٲ    Ʈ   ٽ մϴ.
+	 *
+	 * @param threadCount    Դϴ. 1̶  忡 մϴ.
+	 * @param parallelFor   Ʈ    ó ԼԴϴ. nullptr̸  忡 ʷ մϴ.
+	 *
+	 * @note
+	 * -  带 ϸ     Ʈ  threadCount ,  ó Լ  ϳ ѱϴ.
+	 * -     ó Լ  ϴ.
+	 */
+	void Update(uint32_t threadCount = 1, const ParallelForFunction& parallelFor = nullptr);
+
+
+	/**
+	 * @brief  켱   ĵ   迭 ϴ.
+	 *
+	 * @return   迭 ȯմϴ. GetSortedNodes  Դϴ.
+	 *
+	 * @note 迭  Update Ŀ ȿմϴ.
+	 */
+	const std::vector<Mat4x4>& GetSortedWorldMatrices() const { return worldMatrices_; }
+
+
+	/**
+	 * @brief  켱   ĵ  ID 迭 ϴ.
+	 *
+	 * @return  ID 迭 ȯմϴ.
+	 *
+	 * @note 迭  Update Ŀ ȿմϴ.
+	 */
+	const std::vector<uint32_t>& GetSortedNodes() const { return indexToNode_; }
+
+
+private:
+	/**
+	 * @brief 迭  켱   ٽ ϰ  Ʈ  ġ մϴ.
+	 */
+	void SortNodes();
+
+
+	/**
+	 * @brief 迭  [begin, end) ִ     մϴ.
+	 *
+	 * @param begin   ġԴϴ.
+	 * @param end   ġԴϴ.
+	 *
+	 * @note  ۿ ִ θ  ̹   ־ մϴ.
+	 */
+	void UpdateRange(uint32_t begin, uint32_t end);
+
+
+private:
+	/**
+	 * @brief      ƮԴϴ.
+	 */
+	std::vector<Transform> localTransforms_;
+
+
+	/**
+	 * @brief    θ  ġԴϴ. Ʈ  INVALID_NODEԴϴ.
+	 */
+	std::vector<uint32_t> parentIndices_;
+
+
+	/**
+	 * @brief      Դϴ.
+	 */
+	std::vector<Mat4x4> worldMatrices_;
+
+
+	/**
+	 * @brief      ÷Դϴ.  Update   ٽ ؾ Ѵٸ 1Դϴ.
+	 */
+	std::vector<uint8_t> dirtyFlags_;
+
+
+	/**
+	 * @brief      Ʈ  ġԴϴ.  Ʈ [ġ,  ġ)  մϴ.
+	 */
+	std::vector<uint32_t> subtreeEnds_;
+
+
+	/**
+	 * @brief  ID ϴ  ġԴϴ.
+	 */
+	std::vector<uint32_t> nodeToIndex_;
+
+
+	/**
+	 * @brief  ġ ϴ  IDԴϴ.
+	 */
+	std::vector<uint32_t> indexToNode_;
+
+
+	/**
+	 * @brief  Update  尡 ִ Դϴ.
+	 */
+	bool bIsDirty_ = false;
+
+
+	/**
+	 * @brief  Update 迭 ٽ ؾ ϴ Դϴ.
+	 */
+	bool bIsUnsorted_ = false;
+};
\ No newline at end of file
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Mat4x3.h"
 #include "Mat4x4.h"
 #include "Quat.h"
 #include "Vec3.h"
@@ -185,31 +186,106 @@ struct Transform
 	}
 
 
+	/**
+	 * @brief Ʈ  ķ ȯմϴ.
+	 *
+	 * @param transform  ķ ȯ ƮԴϴ.
+	 *
+	 * @return ȯ   ȯմϴ.
+	 *
+	 * @note  Mat4x3::ToMat ȯϸ ToMat  ϴ.
+	 */
+	static inline Mat4x3 ToMat4x3(const Transform& transform)
+	{
+		Vec3f x = transform.rotate * Vec3f(1.0f, 0.0f, 0.0f);
+		Vec3f y = transform.rotate * Vec3f(0.0f, 1.0f, 0.0f);
+		Vec3f z = transform.rotate * Vec3f(0.0f, 0.0f, 1.0f);
+
+		x = x * transform.scale.x;
+		y = y * transform.scale.y;
+		z = z * transform.scale.z;
+
+		Vec3f p = transform.position;
+
+		return Mat4x3(
+			x.x, x.y, x.z,
+			y.x, y.y, y.z,
+			z.x, z.y, z.z,
+			p.x, p.y, p.z
+		);
+	}
+
+
 	/**
 	 * @brief  Ʈ ȯմϴ.
 	 *
 	 * @param m Ʈ ȯ Դϴ.
 	 *
 	 * @return ȯ Ʈ ȯմϴ.
+	 *
+	 * @note   ϰ  ķ ȯ  մϴ.
 	 */
 	static inline Transform ToTransform(const Mat4x4& m)
+	{
+		return ToTransform(Mat4x3::ToMat4x3(m));
+	}
+
+
+	/**
+	 * @brief   Ʈ ȯմϴ.
+	 *
+	 * @param m Ʈ ȯ  Դϴ.
+	 *
+	 * @return ȯ Ʈ ȯմϴ.
+	 *
+	 * @note
+	 * - ȸ 0~2  ȭ  ʹϾ  մϴ. w ׻ 0 ̻Դϴ.
+	 * - ũ (ȸ/ũ ) * (ȸ ) 밢 ̸, ̴ i°  i°    Ƿ    մϴ.
+	 * - https://en.wikipedia.org/wiki/Rotation_matrix#Quaternion
+	 */
+	static inline Transform ToTransform(const Mat4x3& m)
 	{
 		Transform t;
 
 		t.position = Vec3f(m.e30, m.e31, m.e32);
-		t.rotate = Quat::ToQuat(m);
 
-		Mat4x4 rotateScale(
-			m.e00, m.e01, m.e02, 0.0f,
-			m.e10, m.e11, m.e12, 0.0f,
-			m.e20, m.e21, m.e22, 0.0f,
-			 0.0f,  0.0f,  0.0f, 1.0f
-		);
+		Vec3f u = Vec3f::Normalize(Vec3f(m.e10, m.e11, m.e12));
+		Vec3f f = Vec3f::Normalize(Vec3f(m.e20, m.e21, m.e22));
+		Vec3f r = Vec3f::Normalize(Vec3f::Cross(u, f));
+		u = Vec3f::Cross(f, r);
+
+		float trace = r.x + u.y + f.z;
+		if (trace > 0.0f)
+		{
+			float s = 0.5f / MathModule::Sqrt(trace + 1.0f);
+			t.rotate = Quat((u.z - f.y) * s, (f.x - r.z) * s, (r.y - u.x) * s, 0.25f / s);
+		}
+		else if (r.x > u.y && r.x > f.z)
+		{
+			float s = 2.0f * MathModule::Sqrt(1.0f + r.x - u.y - f.z);
+			t.rotate = Quat(0.25f * s, (u.x + r.y) / s, (f.x + r.z) / s, (u.z - f.y) / s);
+		}
+		else if (u.y > f.z)
+		{
+			float s = 2.0f * MathModule::Sqrt(1.0f + u.y - r.x - f.z);
+			t.rotate = Quat((u.x + r.y) / s, 0.25f * s, (f.y + u.z) / s, (f.x - r.z) / s);
+		}
+		else
+		{
+			float s = 2.0f * MathModule::Sqrt(1.0f + f.z - r.x - u.y);
+			t.rotate = Quat((f.x + r.z) / s, (f.y + u.z) / s, 0.25f * s, (r.y - u.x) / s);
+		}
 
-		Mat4x4 invRotateScale = Quat::ToMat(Quat::Inverse(t.rotate));
-		Mat4x4 scaleKew = rotateScale * invRotateScale;
+		if (t.rotate.w < 0.0f)
+		{
+			t.rotate = -t.rotate;
+		}
 
-		t.scale = Vec3f(scaleKew.e00, scaleKew.e11, scaleKew.e22);
+		t.scale = Vec3f(
+			Vec3f::Dot(Vec3f(m.e00, m.e01, m.e02), r),
+			Vec3f::Dot(Vec3f(m.e10, m.e11, m.e12), u),
+			Vec3f::Dot(Vec3f(m.e20, m.e21, m.e22), f)
+		);
 
 		return t;
 	}
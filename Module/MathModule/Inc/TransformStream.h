@@ -0,0 +1,202 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "Mat4x4.h"
+#include "Transform.h"
+
+
+/**
+ * @brief ټ Ʈ SoA(Structure of Arrays)  ϰ ϰ óմϴ.
+ *
+ * @note ġ, ȸ, ũ  Ҹ  迭 ϹǷ SIMD Ϳ ״   ֽϴ.
+ * @note  迭 ũ ׻ 4  Ǹ,   ׵ Ʈ äϴ.
+ */
+class TransformStream
+{
+public:
+	/**
+	 * @brief Ʈ Ʈ  Դϴ.
+	 */
+	enum class EComponent : int32_t
+	{
+		PositionX = 0x00,
+		PositionY = 0x01,
+		PositionZ = 0x02,
+		RotateX   = 0x03,
+		RotateY   = 0x04,
+		RotateZ   = 0x05,
+		RotateW   = 0x06,
+		ScaleX    = 0x07,
+		ScaleY    = 0x08,
+		ScaleZ    = 0x09,
+		Count     = 0x0A,
+	};
+
+
+public:
+	/**
+	 * @brief Ʈ Ʈ ⺻ Դϴ.
+	 */
+	TransformStream() = default;
+
+
+	/**
+	 * @brief Ʈ Ʈ Դϴ.
+	 *
+	 * @param size Ʈ Ʈ ũԴϴ.
+	 *
+	 * @note  Ʈ ׵ Ʈ ʱȭ˴ϴ.
+	 */
+	explicit TransformStream(uint32_t size);
+
+
+	/**
+	 * @brief Ʈ Ʈ  ҸԴϴ.
+	 */
+	virtual ~TransformStream() {}
+
+
+	/**
+	 * @brief Ʈ Ʈ ũ⸦ մϴ.
+	 *
+	 * @param size  Ʈ Ʈ ũԴϴ.
+	 *
+	 * @note  ߰ Ʈ ׵ Ʈ ʱȭ˴ϴ.
+	 */
+	void Resize(uint32_t size);
+
+
+	/**
+	 * @brief Ʈ Ʈ ũ⸦ ϴ.
+	 *
+	 * @return Ʈ Ʈ ũ⸦ ȯմϴ.
+	 */
+	uint32_t GetSize() const { return size_; }
+
+
+	/**
+	 * @brief Ʈ Ʈ Ư ġ Ʈ մϴ.
+	 *
+	 * @param index Ʈ  ġԴϴ.
+	 * @param transform  ƮԴϴ.
+	 */
+	void Set(uint32_t index, const Transform& transform);
+
+
+	/**
+	 * @brief Ʈ Ʈ Ư ġ Ʈ ϴ.
+	 *
+	 * @param index Ʈ  ġԴϴ.
+	 *
+	 * @return Ʈ Ʈ Ư ġ Ʈ ȯմϴ.
+	 */
+	Transform Get(uint32_t index) const;
+
+
+	/**
+	 * @brief Ʈ Ʈ  迭 ϴ.
+	 *
+	 * @param component   Դϴ.
+	 *
+	 * @return  迭 ͸ ȯմϴ.
+	 */
+	float* GetComponent(const EComponent& component) { return components_[static_cast<int32_t>(component)].data(); }
+
+
+	/**
+	 * @brief Ʈ Ʈ  迭 ϴ.
+	 *
+	 * @param component   Դϴ.
+	 *
+	 * @return  迭 ͸ ȯմϴ.
+	 */
+	const float* GetComponent(const EComponent& component) const { return components_[static_cast<int32_t>(component)].data(); }
+
+
+	/**
+	 * @brief Ʈ 迭  迭 ϰ ȯմϴ.
+	 *
+	 * @param transforms ķ ȯ Ʈ 迭Դϴ.
+	 * @param outMatrices ȯ   迭Դϴ.
+	 * @param count ȯ Ʈ Դϴ.
+	 *
+	 * @note  Transform::ToMat մϴ.
+	 */
+	static void ToMatrices(const Transform* transforms, Mat4x4* outMatrices, uint32_t count);
+
+
+	/**
+	 * @brief Ʈ Ʈ  迭 ϰ ȯմϴ.
+	 *
+	 * @param stream ķ ȯ Ʈ ƮԴϴ.
+	 * @param outMatrices ȯ   迭Դϴ. 迭 ũ Ʈ Ʈ ũ ̻̾ մϴ.
+	 *
+	 * @note  Transform::ToMat մϴ.
+	 */
+	static void ToMatrices(const TransformStream& stream, Mat4x4* outMatrices);
+
+
+	/**
+	 * @brief  Ʈ 迭 Һ մϴ.
+	 *
+	 * @param lhs  Ʈ 迭Դϴ.
+	 * @param rhs   ٸ Ʈ 迭Դϴ.
+	 * @param outTransforms յ Ʈ  迭Դϴ. lhs Ȥ rhs Ƶ ˴ϴ.
+	 * @param count  Ʈ Դϴ.
+	 *
+	 * @note  Transform::Combine մϴ.
+	 */
+	static void Combine(const Transform* lhs, const Transform* rhs, Transform* outTransforms, uint32_t count);
+
+
+	/**
+	 * @brief  Ʈ Ʈ Һ մϴ.
+	 *
+	 * @param lhs  Ʈ ƮԴϴ.
+	 * @param rhs   ٸ Ʈ ƮԴϴ. ũ lhs ƾ մϴ.
+	 * @param outStream յ Ʈ  Ʈ ƮԴϴ. lhs Ȥ rhs Ƶ ˴ϴ.
+	 *
+	 * @note  Transform::Combine մϴ.
+	 */
+	static void Combine(const TransformStream& lhs, const TransformStream& rhs, TransformStream& outStream);
+
+
+	/**
+	 * @brief Ʈ 迭 ȯ ϰ մϴ.
+	 *
+	 * @param transforms ȯ  Ʈ 迭Դϴ.
+	 * @param outTransforms  ȯ  迭Դϴ. transforms Ƶ ˴ϴ.
+	 * @param count ȯ  Ʈ Դϴ.
+	 *
+	 * @note  Transform::Inverse մϴ.
+	 */
+	static void Inverse(const Transform* transforms, Transform* outTransforms, uint32_t count);
+
+
+	/**
+	 * @brief Ʈ Ʈ ȯ ϰ մϴ.
+	 *
+	 * @param stream ȯ  Ʈ ƮԴϴ.
+	 * @param outStream  ȯ  Ʈ ƮԴϴ. stream Ƶ ˴ϴ.
+	 *
+	 * @note  Transform::Inverse մϴ.
+	 */
+	static void Inverse(const TransformStream& stream, TransformStream& outStream);
+
+
+private:
+	/**
+	 * @brief Ʈ Ʈ ũԴϴ.
+	 */
+	uint32_t size_ = 0;
+
+
+	/**
+	 * @brief Ʈ Ʈ  迭Դϴ.
+	 *
+	 * @note  迭 ũ size_ 4  ø Դϴ.
+	 */
+	std::vector<float> components_[static_cast<int32_t>(EComponent::Count)];
+};
\ No newline at end of file
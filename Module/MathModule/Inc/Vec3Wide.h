@@ -0,0 +1,297 @@
+#pragma once
+
+#include <vector>
+
+#include "FloatWide.h"
+#include "Vec3.h"
+
+
+/**
+ * @brief   3 ͸ SoA  SIMD ο  ̵ Դϴ.
+ *
+ * @note
+ * - T Floatx4 Ȥ Floatx8Դϴ.   ٸ   ڵ մϴ.
+ * -   κ Vec3f  ̸    ȯմϴ.
+ */
+template <typename T>
+struct Vec3Wide
+{
+	/**
+	 * @brief ̵   Դϴ.
+	 */
+	static const uint32_t LANE_COUNT = T::LANE_COUNT;
+
+
+	/**
+	 * @brief ̵  ⺻ Դϴ.  Ҹ 0 ʱȭմϴ.
+	 */
+	Vec3Wide() noexcept : x(0.0f), y(0.0f), z(0.0f) {}
+
+
+	/**
+	 * @brief ̵  Դϴ.
+	 *
+	 * @param xx ̵  x Դϴ.
+	 * @param yy ̵  y Դϴ.
+	 * @param zz ̵  z Դϴ.
+	 */
+	Vec3Wide(const T& xx, const T& yy, const T& zz) noexcept : x(xx), y(yy), z(zz) {}
+
+
+	/**
+	 * @brief ̵  Դϴ.    ͷ ʱȭմϴ.
+	 *
+	 * @param v  ο  Դϴ.
+	 */
+	explicit Vec3Wide(const Vec3f& v) noexcept : x(v.x), y(v.y), z(v.z) {}
+
+
+	/**
+	 * @brief  迭 ̵ ͸ нϴ.
+	 *
+	 * @param vectors   迭Դϴ.
+	 * @param count   Դϴ.      0 äϴ.
+	 *
+	 * @return  ̵ ͸ ȯմϴ.
+	 */
+	static __forceinline Vec3Wide Load(const Vec3f* vectors, uint32_t count = LANE_COUNT)
+	{
+		float elements[3][LANE_COUNT] = {};
+
+		for (uint32_t lane = 0; lane < count && lane < LANE_COUNT; ++lane)
+		{
+			elements[0][lane] = vectors[lane].x;
+			elements[1][lane] = vectors[lane].y;
+			elements[2][lane] = vectors[lane].z;
+		}
+
+		return Vec3Wide(T::Load(elements[0]), T::Load(elements[1]), T::Load(elements[2]));
+	}
+
+
+	/**
+	 * @brief  迭 Ư ġ ̵ ͸ нϴ.
+	 *
+	 * @param vectors   迭Դϴ.
+	 * @param offset б  ġԴϴ. 迭  Ѵ  0 äϴ.
+	 *
+	 * @return  ̵ ͸ ȯմϴ.
+	 */
+	static __forceinline Vec3Wide Load(const std::vector<Vec3f>& vectors, uint32_t offset)
+	{
+		uint32_t size = static_cast<uint32_t>(vectors.size());
+		return Load(vectors.data() + offset, offset < size ? size - offset : 0);
+	}
+
+
+	/**
+	 * @brief ̵ ͸  迭 ϴ.
+	 *
+	 * @param outVectors   迭Դϴ.
+	 * @param count   Դϴ.     θ ϴ.
+	 */
+	__forceinline void Store(Vec3f* outVectors, uint32_t count = LANE_COUNT) const
+	{
+		float elements[3][LANE_COUNT];
+		x.Store(elements[0]);
+		y.Store(elements[1]);
+		z.Store(elements[2]);
+
+		for (uint32_t lane = 0; lane < count && lane < LANE_COUNT; ++lane)
+		{
+			outVectors[lane] = Vec3f(elements[0][lane], elements[1][lane], elements[2][lane]);
+		}
+	}
+
+
+	/**
+	 * @brief ̵ ͸  迭 Ư ġ ϴ.
+	 *
+	 * @param outVectors   迭Դϴ.
+	 * @param offset   ġԴϴ. 迭  Ѵ   ʽϴ.
+	 */
+	__forceinline void Store(std::vector<Vec3f>& outVectors, uint32_t offset) const
+	{
+		uint32_t size = static_cast<uint32_t>(outVectors.size());
+		Store(outVectors.data() + offset, offset < size ? size - offset : 0);
+	}
+
+
+	/**
+	 * @brief Ư  ͸ ϴ.
+	 *
+	 * @param lane ͸  Դϴ.
+	 *
+	 * @return  ͸ ȯմϴ.
+	 */
+	__forceinline Vec3f Get(uint32_t lane) const
+	{
+		return Vec3f(x.Get(lane), y.Get(lane), z.Get(lane));
+	}
+
+
+	Vec3Wide operator-() const { return Vec3Wide(-x, -y, -z); }
+	Vec3Wide operator+(const Vec3Wide& v) const { return Vec3Wide(x + v.x, y + v.y, z + v.z); }
+	Vec3Wide operator-(const Vec3Wide& v) const { return Vec3Wide(x - v.x, y - v.y, z - v.z); }
+	Vec3Wide operator*(const Vec3Wide& v) const { return Vec3Wide(x * v.x, y * v.y, z * v.z); }
+	Vec3Wide operator*(const T& s) const { return Vec3Wide(x * s, y * s, z * s); }
+	Vec3Wide operator/(const T& s) const { return Vec3Wide(x / s, y / s, z / s); }
+	Vec3Wide& operator+=(const Vec3Wide& v) { *this = *this + v; return *this; }
+	Vec3Wide& operator-=(const Vec3Wide& v) { *this = *this - v; return *this; }
+	Vec3Wide& operator*=(const T& s) { *this = *this * s; return *this; }
+
+
+	/**
+	 * @brief ̵    մϴ.
+	 */
+	static __forceinline T Dot(const Vec3Wide& lhs, const Vec3Wide& rhs)
+	{
+		return lhs.x * rhs.x + lhs.y * rhs.y + lhs.z * rhs.z;
+	}
+
+
+	/**
+	 * @brief ̵    մϴ.
+	 */
+	static __forceinline Vec3Wide Cross(const Vec3Wide& lhs, const Vec3Wide& rhs)
+	{
+		return Vec3Wide(
+			lhs.y * rhs.z - lhs.z * rhs.y,
+			lhs.z * rhs.x - lhs.x * rhs.z,
+			lhs.x * rhs.y - lhs.y * rhs.x
+		);
+	}
+
+
+	/**
+	 * @brief ̵  ũ   մϴ.
+	 */
+	static __forceinline T LengthSq(const Vec3Wide& v)
+	{
+		return v.x * v.x + v.y * v.y + v.z * v.z;
+	}
+
+
+	/**
+	 * @brief ̵  ũ⸦ մϴ.
+	 */
+	static __forceinline T Length(const Vec3Wide& v)
+	{
+		return T::Sqrt(LengthSq(v));
+	}
+
+
+	/**
+	 * @brief ̵ ͸ ȭմϴ.
+	 *
+	 * @note Vec3f::Normalize  ũⰡ 0   Է ͸ ״ ȯմϴ.
+	 */
+	static __forceinline Vec3Wide Normalize(const Vec3Wide& v)
+	{
+		T length = Length(v);
+		T nearZero = T::Abs(length) <= T(Epsilon);
+		T invLength = T(1.0f) / length;
+
+		return Vec3Wide(
+			T::Select(nearZero, v.x, v.x * invLength),
+			T::Select(nearZero, v.y, v.y * invLength),
+			T::Select(nearZero, v.z, v.z * invLength)
+		);
+	}
+
+
+	/**
+	 * @brief  ̵ ͸  մϴ.
+	 */
+	static __forceinline Vec3Wide Lerp(const Vec3Wide& s, const Vec3Wide& e, const T& t)
+	{
+		return s * (T(1.0f) - t) + e * t;
+	}
+
+
+	/**
+	 * @brief  ̵ ͸   մϴ.
+	 *
+	 * @note  Ͱ  sin() 0      ȯմϴ.
+	 */
+	static __forceinline Vec3Wide Slerp(const Vec3Wide& s, const Vec3Wide& e, const T& t)
+	{
+		Vec3Wide start = Normalize(s);
+		Vec3Wide end = Normalize(e);
+
+		T theta = T::ACos(Dot(start, end) / (Length(start) * Length(end)));
+
+		T sinTheta;
+		T cosTheta;
+		T::SinCos(theta, sinTheta, cosTheta);
+
+		T sinA;
+		T sinB;
+		T unused;
+		T::SinCos((T(1.0f) - t) * theta, sinA, unused);
+		T::SinCos(t * theta, sinB, unused);
+
+		T nearZero = T::Abs(sinTheta) <= T(Epsilon);
+		T a = T::Select(nearZero, T(1.0f) - t, sinA / sinTheta);
+		T b = T::Select(nearZero, t, sinB / sinTheta);
+
+		return s * a + e * b;
+	}
+
+
+	/**
+	 * @brief ũ  κ ͸ մϴ.
+	 */
+	static __forceinline Vec3Wide Select(const T& mask, const Vec3Wide& a, const Vec3Wide& b)
+	{
+		return Vec3Wide(T::Select(mask, a.x, b.x), T::Select(mask, a.y, b.y), T::Select(mask, a.z, b.z));
+	}
+
+
+	/**
+	 * @brief κ, Һ   մϴ.
+	 */
+	static __forceinline Vec3Wide Min(const Vec3Wide& lhs, const Vec3Wide& rhs)
+	{
+		return Vec3Wide(T::Min(lhs.x, rhs.x), T::Min(lhs.y, rhs.y), T::Min(lhs.z, rhs.z));
+	}
+
+
+	/**
+	 * @brief κ, Һ ū  մϴ.
+	 */
+	static __forceinline Vec3Wide Max(const Vec3Wide& lhs, const Vec3Wide& rhs)
+	{
+		return Vec3Wide(T::Max(lhs.x, rhs.x), T::Max(lhs.y, rhs.y), T::Max(lhs.z, rhs.z));
+	}
+
+
+	/**
+	 * @brief ̵  x Դϴ.
+	 */
+	T x;
+
+
+	/**
+	 * @brief ̵  y Դϴ.
+	 */
+	T y;
+
+
+	/**
+	 * @brief ̵  z Դϴ.
+	 */
+	T z;
+};
+
+
+/**
+ * @brief 4  ̵ 3 Դϴ.
+ */
+using Vec3fx4 = Vec3Wide<Floatx4>;
+
+
+/**
+ * @brief 8  ̵ 3 Դϴ.
+ */
+using Vec3fx8 = Vec3Wide<Floatx8>;
\ No newline at end of file
@@ -0,0 +1,947 @@
+#include <algorithm>
+#include <thread>
+
+#include "BVH.h"
+#include "Vec3Wide.h"
+
+/**
+ * @brief SAH    ึ  (bin) Դϴ.
+ */
+static const uint32_t BIN_COUNT = 16;
+
+/**
+ * @brief    Ƽ  ʰ   ϴ.
+ */
+static const uint32_t MIN_LEAF_SIZE = 4;
+
+/**
+ * @brief    뺸 ũ    Ƽ긦   ϴ.
+ */
+static const uint32_t MAX_LEAF_SIZE = 16;
+
+/**
+ * @brief  Ʈ  忡 ϱ  ּ Ƽ Դϴ.
+ */
+static const uint32_t PARALLEL_BUILD_THRESHOLD = 65536;
+
+/**
+ * @brief SAH  ִ Դϴ. ̺    ݾ  Ʈ ̸ մϴ.
+ */
+static const uint32_t MAX_SAH_DEPTH = 64;
+
+/**
+ * @brief Ž  ũԴϴ. MAX_SAH_DEPTH Ŀ ݾ Ƿ Ʈ ̴    ʽϴ.
+ */
+static const uint32_t STACK_SIZE = 128;
+
+/**
+ * @brief   ǥ Դϴ. SAH  񱳿 ϹǷ 2  ʽϴ.
+ */
+static inline float HalfArea(const Vec3f& minPosition, const Vec3f& maxPosition)
+{
+	Vec3f extent = maxPosition - minPosition;
+	return extent.x * extent.y + extent.y * extent.z + extent.z * extent.x;
+}
+
+/**
+ * @brief  ڸ  Ȥ ٸ  ڸ ϵ ϴ.
+ */
+static inline void Grow(Vec3f& minPosition, Vec3f& maxPosition, const Vec3f& otherMinPosition, const Vec3f& otherMaxPosition)
+{
+	minPosition = Vec3f(MathModule::Min<float>(minPosition.x, otherMinPosition.x), MathModule::Min<float>(minPosition.y, otherMinPosition.y), MathModule::Min<float>(minPosition.z, otherMinPosition.z));
+	maxPosition = Vec3f(MathModule::Max<float>(maxPosition.x, otherMaxPosition.x), MathModule::Max<float>(maxPosition.y, otherMaxPosition.y), MathModule::Max<float>(maxPosition.z, otherMaxPosition.z));
+}
+
+/**
+ * @brief Ʈ  ʿ Ƽ Դϴ.  尡  迭 ϸ,   ġ ʴ ε  մϴ.
+ */
+struct BuildContext
+{
+	const Vec3f* minPositions;
+	const Vec3f* maxPositions;
+	const Vec3f* centroids;
+	uint32_t* indices;
+	uint32_t parallelDepth;
+};
+
+/**
+ * @brief Ƽ  [first, first + count)  Ʈ  outNodes ڿ ߰մϴ.
+ *
+ * @note   leftFirst ü ε 迭 ̰,   leftFirst outNodes Դϴ.
+ */
+static void BuildSubtree(const BuildContext& context, uint32_t first, uint32_t count, uint32_t depth, std::vector<BVH::Node>& outNodes)
+{
+	uint32_t nodeIndex = static_cast<uint32_t>(outNodes.size());
+	outNodes.push_back(BVH::Node());
+
+	Vec3f minPosition(+BVH::MAX_DISTANCE);
+	Vec3f maxPosition(-BVH::MAX_DISTANCE);
+	Vec3f minCentroid(+BVH::MAX_DISTANCE);
+	Vec3f maxCentroid(-BVH::MAX_DISTANCE);
+
+	for (uint32_t index = first; index < first + count; ++index)
+	{
+		uint32_t primitive = context.indices[index];
+		Grow(minPosition, maxPosition, context.minPositions[primitive], context.maxPositions[primitive]);
+		Grow(minCentroid, maxCentroid, context.centroids[primitive], context.centroids[primitive]);
+	}
+
+	outNodes[nodeIndex].minPosition = minPosition;
+	outNodes[nodeIndex].maxPosition = maxPosition;
+	outNodes[nodeIndex].leftFirst = first;
+	outNodes[nodeIndex].count = count;
+
+	if (count <= MIN_LEAF_SIZE)
+	{
+		return;
+	}
+
+	int32_t bestAxis = -1;
+	uint32_t bestSplit = 0;
+	float bestCost = BVH::MAX_DISTANCE;
+
+	for (int32_t axis = 0; axis < 3 && depth < MAX_SAH_DEPTH; ++axis)
+	{
+		float lower = minCentroid.data[axis];
+		float extent = maxCentroid.data[axis] - lower;
+		if (extent <= 0.0f)
+		{
+			continue;
+		}
+
+		float scale = static_cast<float>(BIN_COUNT) / extent;
+
+		Vec3f binMinPositions[BIN_COUNT];
+		Vec3f binMaxPositions[BIN_COUNT];
+		uint32_t binCounts[BIN_COUNT] = {};
+
+		for (uint32_t bin = 0; bin < BIN_COUNT; ++bin)
+		{
+			binMinPositions[bin] = Vec3f(+BVH::MAX_DISTANCE);
+			binMaxPositions[bin] = Vec3f(-BVH::MAX_DISTANCE);
+		}
+
+		for (uint32_t index = first; index < first + count; ++index)
+		{
+			uint32_t primitive = context.indices[index];
+			uint32_t bin = MathModule::Min<uint32_t>(BIN_COUNT - 1, static_cast<uint32_t>((context.centroids[primitive].data[axis] - lower) * scale));
+
+			Grow(binMinPositions[bin], binMaxPositions[bin], context.minPositions[primitive], context.maxPositions[primitive]);
+			binCounts[bin]++;
+		}
+
+		float leftAreas[BIN_COUNT - 1];
+		uint32_t leftCounts[BIN_COUNT - 1];
+		Vec3f leftMinPosition(+BVH::MAX_DISTANCE);
+		Vec3f leftMaxPosition(-BVH::MAX_DISTANCE);
+		uint32_t leftCount = 0;
+
+		for (uint32_t split = 0; split < BIN_COUNT - 1; ++split)
+		{
+			leftCount += binCounts[split];
+			Grow(leftMinPosition, leftMaxPosition, binMinPositions[split], binMaxPositions[split]);
+
+			leftAreas[split] = leftCount > 0 ? HalfArea(leftMinPosition, leftMaxPosition) : 0.0f;
+			leftCounts[split] = leftCount;
+		}
+
+		Vec3f rightMinPosition(+BVH::MAX_DISTANCE);
+		Vec3f rightMaxPosition(-BVH::MAX_DISTANCE);
+		uint32_t rightCount = 0;
+
+		for (uint32_t split = BIN_COUNT - 1; split > 0; --split)
+		{
+			rightCount += binCounts[split];
+			Grow(rightMinPosition, rightMaxPosition, binMinPositions[split], binMaxPositions[split]);
+
+			if (leftCounts[split - 1] == 0 || rightCount == 0)
+			{
+				continue;
+			}
+
+			float cost = static_cast<float>(leftCounts[split - 1]) * leftAreas[split - 1] + static_cast<float>(rightCount) * HalfArea(rightMinPosition, rightMaxPosition);
+			if (cost < bestCost)
+			{
+				bestAxis = axis;
+				bestSplit = split - 1;
+				bestCost = cost;
+			}
+		}
+	}
+
+	float leafCost = static_cast<float>(count) * HalfArea(minPosition, maxPosition);
+	if (count <= MAX_LEAF_SIZE && (bestAxis < 0 || bestCost >= leafCost))
+	{
+		return;
+	}
+
+	uint32_t* begin = context.indices + first;
+	uint32_t* end = begin + count;
+	uint32_t* middle = begin + count / 2;
+
+	if (bestAxis >= 0)
+	{
+		float lower = minCentroid.data[bestAxis];
+		float scale = static_cast<float>(BIN_COUNT) / (maxCentroid.data[bestAxis] - lower);
+
+		middle = std::partition(begin, end, [&](uint32_t primitive)
+			{
+				uint32_t bin = MathModule::Min<uint32_t>(BIN_COUNT - 1, static_cast<uint32_t>((context.centroids[primitive].data[bestAxis] - lower) * scale));
+				return bin <= bestSplit;
+			}
+		);
+	}
+
+	uint32_t leftCount = static_cast<uint32_t>(middle - begin);
+	uint32_t rightCount = count - leftCount;
+
+	outNodes[nodeIndex].count = 0;
+
+	if (depth < context.parallelDepth && count >= PARALLEL_BUILD_THRESHOLD)
+	{
+		std::vector<BVH::Node> rightNodes;
+		std::thread rightBuilder([&]() { BuildSubtree(context, first + leftCount, rightCount, depth + 1, rightNodes); });
+
+		BuildSubtree(context, first, leftCount, depth + 1, outNodes);
+		rightBuilder.join();
+
+		uint32_t offset = static_cast<uint32_t>(outNodes.size());
+		for (BVH::Node& node : rightNodes)
+		{
+			if (node.count == 0)
+			{
+				node.leftFirst += offset;
+			}
+		}
+
+		outNodes[nodeIndex].leftFirst = offset;
+		outNodes.insert(outNodes.end(), rightNodes.begin(), rightNodes.end());
+	}
+	else
+	{
+		BuildSubtree(context, first, leftCount, depth + 1, outNodes);
+
+		outNodes[nodeIndex].leftFirst = static_cast<uint32_t>(outNodes.size());
+		BuildSubtree(context, first + leftCount, rightCount, depth + 1, outNodes);
+	}
+}
+
+/**
+ * @brief    ڿ  t  մϴ.
+ *
+ * @return  [0, tMax)   ڿ   MAX_DISTANCE ȯմϴ.
+ */
+static inline float IntersectBox(const Vec3f& minPosition, const Vec3f& maxPosition, const Vec3f& origin, const Vec3f& invDirection, float tMax)
+{
+	float tx1 = (minPosition.x - origin.x) * invDirection.x;
+	float tx2 = (maxPosition.x - origin.x) * invDirection.x;
+	float tNear = MathModule::Min<float>(tx1, tx2);
+	float tFar = MathModule::Max<float>(tx1, tx2);
+
+	float ty1 = (minPosition.y - origin.y) * invDirection.y;
+	float ty2 = (maxPosition.y - origin.y) * invDirection.y;
+	tNear = MathModule::Max<float>(tNear, MathModule::Min<float>(ty1, ty2));
+	tFar = MathModule::Min<float>(tFar, MathModule::Max<float>(ty1, ty2));
+
+	float tz1 = (minPosition.z - origin.z) * invDirection.z;
+	float tz2 = (maxPosition.z - origin.z) * invDirection.z;
+	tNear = MathModule::Max<float>(tNear, MathModule::Min<float>(tz1, tz2));
+	tFar = MathModule::Min<float>(tFar, MathModule::Max<float>(tz1, tz2));
+
+	tNear = MathModule::Max<float>(tNear, 0.0f);
+	return (tFar >= tNear && tNear < tMax) ? tNear : BVH::MAX_DISTANCE;
+}
+
+/**
+ * @brief Moller-Trumbore   ﰢ(v0, e1, e2)  ˻մϴ.    մϴ.
+ */
+static inline bool IntersectTriangle(const Vec3f* triangle, const Vec3f& origin, const Vec3f& direction, float tMax, float& outT, float& outU, float& outV)
+{
+	const Vec3f& v0 = triangle[0];
+	const Vec3f& e1 = triangle[1];
+	const Vec3f& e2 = triangle[2];
+
+	Vec3f p = Vec3f::Cross(direction, e2);
+	float det = Vec3f::Dot(e1, p);
+	if (det == 0.0f)
+	{
+		return false;
+	}
+
+	float invDet = 1.0f / det;
+	Vec3f s = origin - v0;
+
+	float u = Vec3f::Dot(s, p) * invDet;
+	if (u < 0.0f || u > 1.0f)
+	{
+		return false;
+	}
+
+	Vec3f q = Vec3f::Cross(s, e1);
+	float v = Vec3f::Dot(direction, q) * invDet;
+	if (v < 0.0f || u + v > 1.0f)
+	{
+		return false;
+	}
+
+	float t = Vec3f::Dot(e2, q) * invDet;
+	if (t < 0.0f || t >= tMax)
+	{
+		return false;
+	}
+
+	outT = t;
+	outU = u;
+	outV = v;
+	return true;
+}
+
+/**
+ * @brief   ڱ Ÿ  մϴ.
+ */
+static inline float DistanceSqToBox(const Vec3f& point, const Vec3f& minPosition, const Vec3f& maxPosition)
+{
+	Vec3f closest(
+		MathModule::Clamp<float>(point.x, minPosition.x, maxPosition.x),
+		MathModule::Clamp<float>(point.y, minPosition.y, maxPosition.y),
+		MathModule::Clamp<float>(point.z, minPosition.z, maxPosition.z)
+	);
+
+	return Vec3f::LengthSq(point - closest);
+}
+
+/**
+ * @brief    ﰢ(v0, e1, e2)    ߽ ǥ մϴ.
+ *
+ * @note Real-Time Collision Detection 5.1.5 Դϴ. ȯ     Ÿ Դϴ.
+ */
+static inline float ClosestPointOnTriangle(const Vec3f* triangle, const Vec3f& point, float& outU, float& outV)
+{
+	const Vec3f& a = triangle[0];
+	const Vec3f& ab = triangle[1];
+	const Vec3f& ac = triangle[2];
+
+	Vec3f ap = point - a;
+	float d1 = Vec3f::Dot(ab, ap);
+	float d2 = Vec3f::Dot(ac, ap);
+
+	float u = 0.0f;
+	float v = 0.0f;
+
+	if (d1 <= 0.0f && d2 <= 0.0f)
+	{
+		u = 0.0f;
+		v = 0.0f;
+	}
+	else
+	{
+		Vec3f bp = ap - ab;
+		float d3 = Vec3f::Dot(ab, bp);
+		float d4 = Vec3f::Dot(ac, bp);
+
+		Vec3f cp = ap - ac;
+		float d5 = Vec3f::Dot(ab, cp);
+		float d6 = Vec3f::Dot(ac, cp);
+
+		float vc = d1 * d4 - d3 * d2;
+		float vb = d5 * d2 - d1 * d6;
+		float va = d3 * d6 - d5 * d4;
+
+		if (d3 >= 0.0f && d4 <= d3)
+		{
+			u = 1.0f;
+			v = 0.0f;
+		}
+		else if (vc <= 0.0f && d1 >= 0.0f && d3 <= 0.0f)
+		{
+			u = d1 / (d1 - d3);
+			v = 0.0f;
+		}
+		else if (d6 >= 0.0f && d5 <= d6)
+		{
+			u = 0.0f;
+			v = 1.0f;
+		}
+		else if (vb <= 0.0f && d2 >= 0.0f && d6 <= 0.0f)
+		{
+			u = 0.0f;
+			v = d2 / (d2 - d6);
+		}
+		else if (va <= 0.0f && (d4 - d3) >= 0.0f && (d5 - d6) >= 0.0f)
+		{
+			v = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+			u = 1.0f - v;
+		}
+		else
+		{
+			float invDenom = 1.0f / (va + vb + vc);
+			u = vb * invDenom;
+			v = vc * invDenom;
+		}
+	}
+
+	outU = u;
+	outV = v;
+	return Vec3f::LengthSq(ap - ab * u - ac * v);
+}
+
+/**
+ * @brief Ž  Դϴ. 忡  Ÿ Բ    ٽ ˻ ʰ ġմϴ.
+ */
+struct TraversalEntry
+{
+	uint32_t node;
+	float distance;
+};
+
+void BVH::BuildTriangles(const Vec3f* positions, const uint32_t* indices, uint32_t triangleCount, bool bIsParallel)
+{
+	std::vector<Vec3f> minPositions(triangleCount);
+	std::vector<Vec3f> maxPositions(triangleCount);
+
+	for (uint32_t triangle = 0; triangle < triangleCount; ++triangle)
+	{
+		const Vec3f& v0 = positions[indices[triangle * 3 + 0]];
+		const Vec3f& v1 = positions[indices[triangle * 3 + 1]];
+		const Vec3f& v2 = positions[indices[triangle * 3 + 2]];
+
+		minPositions[triangle] = v0;
+		maxPositions[triangle] = v0;
+		Grow(minPositions[triangle], maxPositions[triangle], v1, v1);
+		Grow(minPositions[triangle], maxPositions[triangle], v2, v2);
+	}
+
+	primitiveType_ = EPrimitive::Triangle;
+	BuildNodes(minPositions, maxPositions, bIsParallel);
+
+	primitivePositions_.resize(primitiveIndices_.size() * 3);
+	for (std::size_t index = 0; index < primitiveIndices_.size(); ++index)
+	{
+		const uint32_t* triangle = indices + primitiveIndices_[index] * 3;
+		const Vec3f& v0 = positions[triangle[0]];
+
+		primitivePositions_[index * 3 + 0] = v0;
+		primitivePositions_[index * 3 + 1] = positions[triangle[1]] - v0;
+		primitivePositions_[index * 3 + 2] = positions[triangle[2]] - v0;
+	}
+}
+
+void BVH::BuildAABBs(const Vec3f* minPositions, const Vec3f* maxPositions, uint32_t count, bool bIsParallel)
+{
+	primitiveType_ = EPrimitive::AABB;
+	BuildNodes(std::vector<Vec3f>(minPositions, minPositions + count), std::vector<Vec3f>(maxPositions, maxPositions + count), bIsParallel);
+
+	primitivePositions_.resize(primitiveIndices_.size() * 2);
+	for (std::size_t index = 0; index < primitiveIndices_.size(); ++index)
+	{
+		primitivePositions_[index * 2 + 0] = minPositions[primitiveIndices_[index]];
+		primitivePositions_[index * 2 + 1] = maxPositions[primitiveIndices_[index]];
+	}
+}
+
+bool BVH::IntersectRay(const Ray& ray, Hit& outHit) const
+{
+	if (nodes_.empty())
+	{
+		return false;
+	}
+
+	Vec3f invDirection(1.0f / ray.direction.x, 1.0f / ray.direction.y, 1.0f / ray.direction.z);
+
+	float closest = ray.tMax;
+	uint32_t hitPrimitive = INVALID_PRIMITIVE;
+	float hitU = 0.0f;
+	float hitV = 0.0f;
+
+	TraversalEntry stack[STACK_SIZE];
+	uint32_t stackSize = 0;
+
+	float rootDistance = IntersectBox(nodes_[0].minPosition, nodes_[0].maxPosition, ray.origin, invDirection, closest);
+	if (rootDistance != MAX_DISTANCE)
+	{
+		stack[stackSize++] = TraversalEntry{ 0, rootDistance };
+	}
+
+	while (stackSize > 0)
+	{
+		TraversalEntry entry = stack[--stackSize];
+		if (entry.distance >= closest)
+		{
+			continue;
+		}
+
+		const Node& node = nodes_[entry.node];
+
+		if (node.count > 0)
+		{
+			for (uint32_t index = node.leftFirst; index < node.leftFirst + node.count; ++index)
+			{
+				if (primitiveType_ == EPrimitive::Triangle)
+				{
+					float t, u, v;
+					if (IntersectTriangle(&primitivePositions_[index * 3], ray.origin, ray.direction, closest, t, u, v))
+					{
+						closest = t;
+						hitPrimitive = index;
+						hitU = u;
+						hitV = v;
+					}
+				}
+				else
+				{
+					float t = IntersectBox(primitivePositions_[index * 2 + 0], primitivePositions_[index * 2 + 1], ray.origin, invDirection, closest);
+					if (t != MAX_DISTANCE)
+					{
+						closest = t;
+						hitPrimitive = index;
+						hitU = 0.0f;
+						hitV = 0.0f;
+					}
+				}
+			}
+			continue;
+		}
+
+		uint32_t nearChild = entry.node + 1;
+		uint32_t farChild = node.leftFirst;
+
+		float nearDistance = IntersectBox(nodes_[nearChild].minPosition, nodes_[nearChild].maxPosition, ray.origin, invDirection, closest);
+		float farDistance = IntersectBox(nodes_[farChild].minPosition, nodes_[farChild].maxPosition, ray.origin, invDirection, closest);
+
+		if (nearDistance > farDistance)
+		{
+			std::swap(nearChild, farChild);
+			std::swap(nearDistance, farDistance);
+		}
+
+		if (farDistance != MAX_DISTANCE)
+		{
+			stack[stackSize++] = TraversalEntry{ farChild, farDistance };
+		}
+
+		if (nearDistance != MAX_DISTANCE)
+		{
+			stack[stackSize++] = TraversalEntry{ nearChild, nearDistance };
+		}
+	}
+
+	if (hitPrimitive == INVALID_PRIMITIVE)
+	{
+		return false;
+	}
+
+	outHit.t = closest;
+	outHit.primitive = primitiveIndices_[hitPrimitive];
+	outHit.u = hitU;
+	outHit.v = hitV;
+	return true;
+}
+
+bool BVH::IsIntersectRay(const Ray& ray) const
+{
+	if (nodes_.empty())
+	{
+		return false;
+	}
+
+	Vec3f invDirection(1.0f / ray.direction.x, 1.0f / ray.direction.y, 1.0f / ray.direction.z);
+
+	uint32_t stack[STACK_SIZE];
+	uint32_t stackSize = 0;
+	stack[stackSize++] = 0;
+
+	while (stackSize > 0)
+	{
+		const Node& node = nodes_[stack[--stackSize]];
+		if (IntersectBox(node.minPosition, node.maxPosition, ray.origin, invDirection, ray.tMax) == MAX_DISTANCE)
+		{
+			continue;
+		}
+
+		if (node.count == 0)
+		{
+			stack[stackSize++] = node.leftFirst;
+			stack[stackSize++] = static_cast<uint32_t>(&node - nodes_.data()) + 1;
+			continue;
+		}
+
+		for (uint32_t index = node.leftFirst; index < node.leftFirst + node.count; ++index)
+		{
+			if (primitiveType_ == EPrimitive::Triangle)
+			{
+				float t, u, v;
+				if (IntersectTriangle(&primitivePositions_[index * 3], ray.origin, ray.direction, ray.tMax, t, u, v))
+				{
+					return true;
+				}
+			}
+			else
+			{
+				if (IntersectBox(primitivePositions_[index * 2 + 0], primitivePositions_[index * 2 + 1], ray.origin, invDirection, ray.tMax) != MAX_DISTANCE)
+				{
+					return true;
+				}
+			}
+		}
+	}
+
+	return false;
+}
+
+int32_t BVH::IntersectRay4(const Ray* rays, Hit* outHits) const
+{
+	if (nodes_.empty())
+	{
+		return 0;
+	}
+
+	Vec3f origins[PACKET_SIZE];
+	Vec3f directions[PACKET_SIZE];
+	Vec3f invDirections[PACKET_SIZE];
+	float tMaxs[PACKET_SIZE];
+
+	for (uint32_t lane = 0; lane < PACKET_SIZE; ++lane)
+	{
+		origins[lane] = rays[lane].origin;
+		directions[lane] = rays[lane].direction;
+		invDirections[lane] = Vec3f(1.0f / rays[lane].direction.x, 1.0f / rays[lane].direction.y, 1.0f / rays[lane].direction.z);
+		tMaxs[lane] = rays[lane].tMax;
+	}
+
+	Vec3fx4 origin = Vec3fx4::Load(origins);
+	Vec3fx4 direction = Vec3fx4::Load(directions);
+	Vec3fx4 invDirection = Vec3fx4::Load(invDirections);
+
+	const Floatx4 zero(0.0f);
+	const Floatx4 one(1.0f);
+	const Floatx4 miss(MAX_DISTANCE);
+
+	Floatx4 closest = Floatx4::Load(tMaxs);
+	Floatx4 hitU = zero;
+	Floatx4 hitV = zero;
+	uint32_t hitPrimitives[PACKET_SIZE] = { INVALID_PRIMITIVE, INVALID_PRIMITIVE, INVALID_PRIMITIVE, INVALID_PRIMITIVE };
+
+	auto intersectBoxes = [&](const Vec3f& minPosition, const Vec3f& maxPosition) -> Floatx4
+		{
+			Floatx4 tx1 = (Floatx4(minPosition.x) - origin.x) * invDirection.x;
+			Floatx4 tx2 = (Floatx4(maxPosition.x) - origin.x) * invDirection.x;
+			Floatx4 tNear = Floatx4::Min(tx1, tx2);
+			Floatx4 tFar = Floatx4::Max(tx1, tx2);
+
+			Floatx4 ty1 = (Floatx4(minPosition.y) - origin.y) * invDirection.y;
+			Floatx4 ty2 = (Floatx4(maxPosition.y) - origin.y) * invDirection.y;
+			tNear = Floatx4::Max(tNear, Floatx4::Min(ty1, ty2));
+			tFar = Floatx4::Min(tFar, Floatx4::Max(ty1, ty2));
+
+			Floatx4 tz1 = (Floatx4(minPosition.z) - origin.z) * invDirection.z;
+			Floatx4 tz2 = (Floatx4(maxPosition.z) - origin.z) * invDirection.z;
+			tNear = Floatx4::Max(tNear, Floatx4::Min(tz1, tz2));
+			tFar = Floatx4::Min(tFar, Floatx4::Max(tz1, tz2));
+
+			tNear = Floatx4::Max(tNear, zero);
+			return Floatx4::Select((tFar >= tNear) & (tNear < closest), tNear, miss);
+		};
+
+	struct PacketEntry
+	{
+		uint32_t node;
+		Floatx4 distance;
+	};
+
+	PacketEntry stack[STACK_SIZE];
+	uint32_t stackSize = 0;
+	stack[stackSize++] = PacketEntry{ 0, intersectBoxes(nodes_[0].minPosition, nodes_[0].maxPosition) };
+
+	while (stackSize > 0)
+	{
+		PacketEntry entry = stack[--stackSize];
+		int32_t activeMask = Floatx4::MoveMask(entry.distance < closest);
+		if (activeMask == 0)
+		{
+			continue;
+		}
+
+		uint32_t nodeIndex = entry.node;
+		const Node& node = nodes_[nodeIndex];
+
+		if (node.count > 0)
+		{
+			for (uint32_t index = node.leftFirst; index < node.leftFirst + node.count; ++index)
+			{
+				Floatx4 t;
+				Floatx4 u = zero;
+				Floatx4 v = zero;
+				Floatx4 hit;
+
+				if (primitiveType_ == EPrimitive::Triangle)
+				{
+					const Vec3f* triangle = &primitivePositions_[index * 3];
+					Vec3fx4 e1(triangle[1]);
+					Vec3fx4 e2(triangle[2]);
+
+					Vec3fx4 p = Vec3fx4::Cross(direction, e2);
+					Floatx4 det = Vec3fx4::Dot(e1, p);
+					Floatx4 invDet = one / det;
+					Vec3fx4 s = origin - Vec3fx4(triangle[0]);
+
+					u = Vec3fx4::Dot(s, p) * invDet;
+					Vec3fx4 q = Vec3fx4::Cross(s, e1);
+					v = Vec3fx4::Dot(direction, q) * invDet;
+					t = Vec3fx4::Dot(e2, q) * invDet;
+
+					hit = (det != zero) & (u >= zero) & (u <= one) & (v >= zero) & (u + v <= one) & (t >= zero) & (t < closest);
+				}
+				else
+				{
+					t = intersectBoxes(primitivePositions_[index * 2 + 0], primitivePositions_[index * 2 + 1]);
+					hit = t != miss;
+				}
+
+				int32_t hitMask = Floatx4::MoveMask(hit);
+				if (hitMask == 0)
+				{
+					continue;
+				}
+
+				closest = Floatx4::Select(hit, t, closest);
+				hitU = Floatx4::Select(hit, u, hitU);
+				hitV = Floatx4::Select(hit, v, hitV);
+
+				for (uint32_t lane = 0; lane < PACKET_SIZE; ++lane)
+				{
+					if ((hitMask >> lane) & 1)
+					{
+						hitPrimitives[lane] = index;
+					}
+				}
+			}
+			continue;
+		}
+
+		uint32_t nearChild = nodeIndex + 1;
+		uint32_t farChild = node.leftFirst;
+
+		Floatx4 nearDistance = intersectBoxes(nodes_[nearChild].minPosition, nodes_[nearChild].maxPosition);
+		Floatx4 farDistance = intersectBoxes(nodes_[farChild].minPosition, nodes_[farChild].maxPosition);
+
+		uint32_t firstLane = 0;
+		while (((activeMask >> firstLane) & 1) == 0)
+		{
+			++firstLane;
+		}
+
+		if (nearDistance.Get(firstLane) > farDistance.Get(firstLane))
+		{
+			std::swap(nearChild, farChild);
+			std::swap(nearDistance, farDistance);
+		}
+
+		if (Floatx4::Any(farDistance != miss))
+		{
+			stack[stackSize++] = PacketEntry{ farChild, farDistance };
+		}
+
+		if (Floatx4::Any(nearDistance != miss))
+		{
+			stack[stackSize++] = PacketEntry{ nearChild, nearDistance };
+		}
+	}
+
+	int32_t resultMask = 0;
+
+	for (uint32_t lane = 0; lane < PACKET_SIZE; ++lane)
+	{
+		if (hitPrimitives[lane] == INVALID_PRIMITIVE)
+		{
+			continue;
+		}
+
+		outHits[lane].t = closest.Get(lane);
+		outHits[lane].primitive = primitiveIndices_[hitPrimitives[lane]];
+		outHits[lane].u = hitU.Get(lane);
+		outHits[lane].v = hitV.Get(lane);
+		resultMask |= 1 << lane;
+	}
+
+	return resultMask;
+}
+
+bool BVH::IntersectSphere(const Vec3f& center, float radius, Hit& outHit) const
+{
+	if (nodes_.empty())
+	{
+		return false;
+	}
+
+	float closestSq = radius * radius;
+	uint32_t hitPrimitive = INVALID_PRIMITIVE;
+	float hitU = 0.0f;
+	float hitV = 0.0f;
+
+	TraversalEntry stack[STACK_SIZE];
+	uint32_t stackSize = 0;
+	stack[stackSize++] = TraversalEntry{ 0, DistanceSqToBox(center, nodes_[0].minPosition, nodes_[0].maxPosition) };
+
+	while (stackSize > 0)
+	{
+		TraversalEntry entry = stack[--stackSize];
+		if (entry.distance > closestSq)
+		{
+			continue;
+		}
+
+		const Node& node = nodes_[entry.node];
+
+		if (node.count > 0)
+		{
+			for (uint32_t index = node.leftFirst; index < node.leftFirst + node.count; ++index)
+			{
+				float distanceSq = 0.0f;
+				float u = 0.0f;
+				float v = 0.0f;
+
+				if (primitiveType_ == EPrimitive::Triangle)
+				{
+					distanceSq = ClosestPointOnTriangle(&primitivePositions_[index * 3], center, u, v);
+				}
+				else
+				{
+					distanceSq = DistanceSqToBox(center, primitivePositions_[index * 2 + 0], primitivePositions_[index * 2 + 1]);
+				}
+
+				if (distanceSq < closestSq || (distanceSq == closestSq && hitPrimitive == INVALID_PRIMITIVE))
+				{
+					closestSq = distanceSq;
+					hitPrimitive = index;
+					hitU = u;
+					hitV = v;
+				}
+			}
+			continue;
+		}
+
+		uint32_t nearChild = entry.node + 1;
+		uint32_t farChild = node.leftFirst;
+
+		float nearDistance = DistanceSqToBox(center, nodes_[nearChild].minPosition, nodes_[nearChild].maxPosition);
+		float farDistance = DistanceSqToBox(center, nodes_[farChild].minPosition, nodes_[farChild].maxPosition);
+
+		if (nearDistance > farDistance)
+		{
+			std::swap(nearChild, farChild);
+			std::swap(nearDistance, farDistance);
+		}
+
+		if (farDistance <= closestSq)
+		{
+			stack[stackSize++] = TraversalEntry{ farChild, farDistance };
+		}
+
+		if (nearDistance <= closestSq)
+		{
+			stack[stackSize++] = TraversalEntry{ nearChild, nearDistance };
+		}
+	}
+
+	if (hitPrimitive == INVALID_PRIMITIVE)
+	{
+		return false;
+	}
+
+	outHit.t = MathModule::Sqrt(closestSq);
+	outHit.primitive = primitiveIndices_[hitPrimitive];
+	outHit.u = hitU;
+	outHit.v = hitV;
+	return true;
+}
+
+bool BVH::IsIntersectSphere(const Vec3f& center, float radius) const
+{
+	if (nodes_.empty())
+	{
+		return false;
+	}
+
+	float radiusSq = radius * radius;
+
+	uint32_t stack[STACK_SIZE];
+	uint32_t stackSize = 0;
+	stack[stackSize++] = 0;
+
+	while (stackSize > 0)
+	{
+		uint32_t nodeIndex = stack[--stackSize];
+		const Node& node = nodes_[nodeIndex];
+
+		if (DistanceSqToBox(center, node.minPosition, node.maxPosition) > radiusSq)
+		{
+			continue;
+		}
+
+		if (node.count == 0)
+		{
+			stack[stackSize++] = node.leftFirst;
+			stack[stackSize++] = nodeIndex + 1;
+			continue;
+		}
+
+		for (uint32_t index = node.leftFirst; index < node.leftFirst + node.count; ++index)
+		{
+			float distanceSq = 0.0f;
+
+			if (primitiveType_ == EPrimitive::Triangle)
+			{
+				float u, v;
+				distanceSq = ClosestPointOnTriangle(&primitivePositions_[index * 3], center, u, v);
+			}
+			else
+			{
+				distanceSq = DistanceSqToBox(center, primitivePositions_[index * 2 + 0], primitivePositions_[index * 2 + 1]);
+			}
+
+			if (distanceSq <= radiusSq)
+			{
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+void BVH::BuildNodes(const std::vector<Vec3f>& primitiveMinPositions, const std::vector<Vec3f>& primitiveMaxPositions, bool bIsParallel)
+{
+	uint32_t count = static_cast<uint32_t>(primitiveMinPositions.size());
+
+	nodes_.clear();
+	primitiveIndices_.resize(count);
+	primitivePositions_.clear();
+
+	if (count == 0)
+	{
+		return;
+	}
+
+	std::vector<Vec3f> centroids(count);
+	for (uint32_t index = 0; index < count; ++index)
+	{
+		primitiveIndices_[index] = index;
+		centroids[index] = (primitiveMinPositions[index] + primitiveMaxPositions[index]) * 0.5f;
+	}
+
+	uint32_t parallelDepth = 0;
+	if (bIsParallel)
+	{
+		uint32_t threadCount = MathModule::Max<uint32_t>(1, std::thread::hardware_concurrency());
+		while ((1u << parallelDepth) < threadCount)
+		{
+			++parallelDepth;
+		}
+	}
+
+	BuildContext context = { primitiveMinPositions.data(), primitiveMaxPositions.data(), centroids.data(), primitiveIndices_.data(), parallelDepth };
+
+	nodes_.reserve(2 * (count / MIN_LEAF_SIZE + 1));
+	BuildSubtree(context, 0, count, 0, nodes_);
+	nodes_.shrink_to_fit();
+}
\ No newline at end of file
@@ -0,0 +1,162 @@
+#include "Frustum.h"
+#include "Vec3Wide.h"
+
+/**
+ * @brief ø    ˻ϴ ü Դϴ.
+ */
+static const uint32_t CULL_LANE_COUNT = Floatx8::LANE_COUNT;
+
+/**
+ * @brief 迭 ִ CULL_LANE_COUNT  нϴ.  ʴ  0 äϴ.
+ */
+static Floatx8 LoadLanes(const float* values, uint32_t count)
+{
+	if (count == CULL_LANE_COUNT)
+	{
+		return Floatx8::Load(values);
+	}
+
+	float elements[CULL_LANE_COUNT] = {};
+	for (uint32_t lane = 0; lane < count; ++lane)
+	{
+		elements[lane] = values[lane];
+	}
+
+	return Floatx8::Load(elements);
+}
+
+/**
+ * @brief ü ũ Ʈ   ε  迭 ϴ.
+ *
+ * @note б    ε  ̴    ġ մϴ.  ġ ׻ ˻ ü  Ƿ  迭   ʽϴ.
+ */
+static uint32_t CompactIndices(int32_t mask, uint32_t offset, uint32_t count, uint32_t* outVisibleIndices)
+{
+	uint32_t visibleCount = 0;
+
+	for (uint32_t lane = 0; lane < count; ++lane)
+	{
+		outVisibleIndices[visibleCount] = offset + lane;
+		visibleCount += static_cast<uint32_t>(mask >> lane) & 1u;
+	}
+
+	return visibleCount;
+}
+
+/**
+ * @brief SIMD θ  ü Դϴ.
+ */
+struct FrustumPlanesx8
+{
+	explicit FrustumPlanesx8(const Vec4f* planes)
+	{
+		for (uint32_t index = 0; index < Frustum::PLANE_COUNT; ++index)
+		{
+			x[index] = Floatx8(planes[index].x);
+			y[index] = Floatx8(planes[index].y);
+			z[index] = Floatx8(planes[index].z);
+			w[index] = Floatx8(planes[index].w);
+		}
+	}
+
+	Floatx8 x[Frustum::PLANE_COUNT];
+	Floatx8 y[Frustum::PLANE_COUNT];
+	Floatx8 z[Frustum::PLANE_COUNT];
+	Floatx8 w[Frustum::PLANE_COUNT];
+};
+
+/**
+ * @brief  ü ϴ  ũ մϴ.
+ */
+static int32_t IntersectSpheres(const FrustumPlanesx8& planes, const Vec3fx8& center, const Floatx8& radius)
+{
+	Floatx8 negRadius = -radius;
+	Floatx8 visible = Floatx8::Mask(true);
+
+	for (uint32_t index = 0; index < Frustum::PLANE_COUNT; ++index)
+	{
+		Floatx8 distance = planes.x[index] * center.x + planes.y[index] * center.y + planes.z[index] * center.z + planes.w[index];
+		visible = visible & (distance >= negRadius);
+	}
+
+	return Floatx8::MoveMask(visible);
+}
+
+uint32_t Frustum::CullSpheres(const Vec3f* centers, const float* radii, uint32_t count, uint32_t* outVisibleIndices) const
+{
+	FrustumPlanesx8 planesx8(planes);
+	uint32_t visibleCount = 0;
+
+	for (uint32_t offset = 0; offset < count; offset += CULL_LANE_COUNT)
+	{
+		uint32_t laneCount = MathModule::Min<uint32_t>(count - offset, CULL_LANE_COUNT);
+
+		Vec3fx8 center = Vec3fx8::Load(centers + offset, laneCount);
+		Floatx8 radius = LoadLanes(radii + offset, laneCount);
+
+		int32_t mask = IntersectSpheres(planesx8, center, radius);
+		if (mask != 0)
+		{
+			visibleCount += CompactIndices(mask, offset, laneCount, outVisibleIndices + visibleCount);
+		}
+	}
+
+	return visibleCount;
+}
+
+uint32_t Frustum::CullSpheres(const float* centerX, const float* centerY, const float* centerZ, const float* radii, uint32_t count, uint32_t* outVisibleIndices) const
+{
+	FrustumPlanesx8 planesx8(planes);
+	uint32_t visibleCount = 0;
+
+	for (uint32_t offset = 0; offset < count; offset += CULL_LANE_COUNT)
+	{
+		uint32_t laneCount = MathModule::Min<uint32_t>(count - offset, CULL_LANE_COUNT);
+
+		Vec3fx8 center(LoadLanes(centerX + offset, laneCount), LoadLanes(centerY + offset, laneCount), LoadLanes(centerZ + offset, laneCount));
+		Floatx8 radius = LoadLanes(radii + offset, laneCount);
+
+		int32_t mask = IntersectSpheres(planesx8, center, radius);
+		if (mask != 0)
+		{
+			visibleCount += CompactIndices(mask, offset, laneCount, outVisibleIndices + visibleCount);
+		}
+	}
+
+	return visibleCount;
+}
+
+uint32_t Frustum::CullAABBs(const Vec3f* minPositions, const Vec3f* maxPositions, uint32_t count, uint32_t* outVisibleIndices) const
+{
+	FrustumPlanesx8 planesx8(planes);
+	uint32_t visibleCount = 0;
+
+	for (uint32_t offset = 0; offset < count; offset += CULL_LANE_COUNT)
+	{
+		uint32_t laneCount = MathModule::Min<uint32_t>(count - offset, CULL_LANE_COUNT);
+
+		Vec3fx8 minPosition = Vec3fx8::Load(minPositions + offset, laneCount);
+		Vec3fx8 maxPosition = Vec3fx8::Load(maxPositions + offset, laneCount);
+		Floatx8 visible = Floatx8::Mask(true);
+
+		for (uint32_t index = 0; index < PLANE_COUNT; ++index)
+		{
+			const Vec4f& plane = planes[index];
+
+			const Floatx8& x = plane.x >= 0.0f ? maxPosition.x : minPosition.x;
+			const Floatx8& y = plane.y >= 0.0f ? maxPosition.y : minPosition.y;
+			const Floatx8& z = plane.z >= 0.0f ? maxPosition.z : minPosition.z;
+
+			Floatx8 distance = planesx8.x[index] * x + planesx8.y[index] * y + planesx8.z[index] * z + planesx8.w[index];
+			visible = visible & (distance >= Floatx8(0.0f));
+		}
+
+		int32_t mask = Floatx8::MoveMask(visible);
+		if (mask != 0)
+		{
+			visibleCount += CompactIndices(mask, offset, laneCount, outVisibleIndices + visibleCount);
+		}
+	}
+
+	return visibleCount;
+}
\ No newline at end of file
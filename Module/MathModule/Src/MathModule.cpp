@@ -1,11 +1,12 @@
-#include <chrono>
-#include <random>
+#include <cmath>
 
 #include "MathModule.h"
+#include "RandomStream.h"
+#include "SIMD.h"
 
 bool MathModule::NearZero(float value, float epsilon)
 {
-	return (std::fabsf(value) <= epsilon);
+	return (std::fabs(value) <= epsilon);
 }
 
 float MathModule::ASin(float value)
@@ -54,35 +55,109 @@ float MathModule::ACos(float value)
 	}
 }
 
+void MathModule::SinCos(const float* radians, float* outSin, float* outCos, uint32_t count)
+{
+	uint32_t index = 0;
+
+#if defined(MATH_SIMD_AVX2)
+	for (; index + 8 <= count; index += 8)
+	{
+		__m256 s;
+		__m256 c;
+		SIMD::SinCos8(_mm256_loadu_ps(radians + index), s, c);
+
+		_mm256_storeu_ps(outSin + index, s);
+		_mm256_storeu_ps(outCos + index, c);
+	}
+#endif
+
+#if defined(MATH_SIMD_SSE)
+	for (; index + 4 <= count; index += 4)
+	{
+		__m128 s;
+		__m128 c;
+		SIMD::SinCos4(_mm_loadu_ps(radians + index), s, c);
+
+		_mm_storeu_ps(outSin + index, s);
+		_mm_storeu_ps(outCos + index, c);
+	}
+#endif
+
+	for (; index < count; ++index)
+	{
+		SinCos(radians[index], outSin[index], outCos[index]);
+	}
+}
+
+void MathModule::ASin(const float* values, float* outValues, uint32_t count)
+{
+	uint32_t index = 0;
+
+#if defined(MATH_SIMD_AVX2)
+	for (; index + 8 <= count; index += 8)
+	{
+		_mm256_storeu_ps(outValues + index, SIMD::ASin8(_mm256_loadu_ps(values + index)));
+	}
+#endif
+
+#if defined(MATH_SIMD_SSE)
+	for (; index + 4 <= count; index += 4)
+	{
+		_mm_storeu_ps(outValues + index, SIMD::ASin4(_mm_loadu_ps(values + index)));
+	}
+#endif
+
+	for (; index < count; ++index)
+	{
+		outValues[index] = ASin(values[index]);
+	}
+}
+
+void MathModule::ACos(const float* values, float* outValues, uint32_t count)
+{
+	uint32_t index = 0;
+
+#if defined(MATH_SIMD_AVX2)
+	for (; index + 8 <= count; index += 8)
+	{
+		_mm256_storeu_ps(outValues + index, SIMD::ACos8(_mm256_loadu_ps(values + index)));
+	}
+#endif
+
+#if defined(MATH_SIMD_SSE)
+	for (; index + 4 <= count; index += 4)
+	{
+		_mm_storeu_ps(outValues + index, SIMD::ACos4(_mm_loadu_ps(values + index)));
+	}
+#endif
+
+	for (; index < count; ++index)
+	{
+		outValues[index] = ACos(values[index]);
+	}
+}
+
 float MathModule::Sqrt(float x)
 {
-	return std::sqrtf(x);
+	return std::sqrt(x);
 }
 
 float MathModule::Abs(float x)
 {
-	return std::fabsf(x);
+	return std::fabs(x);
 }
 
 float MathModule::Fmod(float x, float y)
 {
-	return std::fmodf(x, y);
+	return std::fmod(x, y);
 }
 
 int32_t MathModule::GenerateRandomInt(int32_t minValue, int32_t maxValue)
 {
-	std::random_device randomDevice;
-	std::mt19937 generator(randomDevice());
-	std::uniform_int_distribution<int32_t> distribution(Min<int32_t>(minValue, maxValue), Max<int32_t>(minValue, maxValue));
-
-	return distribution(generator);
+	return RandomStream::GetThreadLocal().NextInt(minValue, maxValue);
 }
 
 float MathModule::GenerateRandomFloat(float minValue, float maxValue)
 {
-	std::random_device randomDevice;
-	std::mt19937 generator(randomDevice());
-	std::uniform_real_distribution<float> distribution(Min<float>(minValue, maxValue), Max<float>(minValue, maxValue));
-
-	return distribution(generator);
+	return RandomStream::GetThreadLocal().NextFloat(Min<float>(minValue, maxValue), Max<float>(minValue, maxValue));
 }
\ No newline at end of file
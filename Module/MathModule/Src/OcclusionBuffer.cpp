@@ -0,0 +1,348 @@
+#include <algorithm>
+
+#include "FloatWide.h"
+#include "OcclusionBuffer.h"
+
+/**
+ * @brief   ȭϴ  ȼ Դϴ.
+ */
+static const uint32_t SPAN_WIDTH = Floatx8::LANE_COUNT;
+
+/**
+ * @brief ȭ  踦   ʱⰪ  float ִԴϴ.
+ */
+static const float MAX_FLOAT = 3.402823466e+38F;
+
+/**
+ * @brief    Դϴ.
+ */
+static const float FAR_DEPTH = 1.0f;
+
+/**
+ * @brief  ۿ ִ   ǥ Դϴ.
+ */
+static const float CLIPPED_DEPTH = -1.0f;
+
+/**
+ * @brief ̺ ̰  ȭ  ﰢ ȭ ʽϴ.
+ */
+static const float MIN_TRIANGLE_AREA = 1.0e-6f;
+
+/**
+ * @brief 8ȼ  ȿ   ȼ Դϴ.
+ */
+static const float LANE_OFFSETS[SPAN_WIDTH] = { 0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f };
+
+/**
+ * @brief    Ծ ȯ  ǥ ϴ.
+ */
+static inline void TransformHomogeneous(const Vec3f& p, const Mat4x4& m, float& outX, float& outY, float& outZ, float& outW)
+{
+	outX = p.x * m.e00 + p.y * m.e10 + p.z * m.e20 + m.e30;
+	outY = p.x * m.e01 + p.y * m.e11 + p.z * m.e21 + m.e31;
+	outZ = p.x * m.e02 + p.y * m.e12 + p.z * m.e22 + m.e32;
+	outW = p.x * m.e03 + p.y * m.e13 + p.z * m.e23 + m.e33;
+}
+
+/**
+ * @brief  ȭ (ȼ x, ȼ y, [0, 1] ) ȯմϴ.
+ *
+ * @return   ʿ ִٸ true, ׷  false ȯմϴ.
+ */
+static inline bool ProjectToScreen(const Vec3f& p, const Mat4x4& viewProjection, float width, float height, Vec3f& outScreen)
+{
+	float x, y, z, w;
+	TransformHomogeneous(p, viewProjection, x, y, z, w);
+
+	if (w <= Epsilon)
+	{
+		return false;
+	}
+
+	float invW = 1.0f / w;
+	float ndcZ = z * invW;
+	if (ndcZ < -1.0f)
+	{
+		return false;
+	}
+
+	outScreen = Vec3f((x * invW * 0.5f + 0.5f) * width, (0.5f - y * invW * 0.5f) * height, ndcZ * 0.5f + 0.5f);
+	return true;
+}
+
+/**
+ * @brief ȭ ǥ [0, maxPixel]  ȼ ε ٲߴϴ.
+ */
+static inline int32_t ToPixel(float coord, int32_t maxPixel)
+{
+	return static_cast<int32_t>(MathModule::Clamp<float>(coord, 0.0f, static_cast<float>(maxPixel)));
+}
+
+OcclusionBuffer::OcclusionBuffer(uint32_t width, uint32_t height)
+{
+	tileCountX_ = MathModule::Max<uint32_t>(1, (width + TILE_WIDTH - 1) / TILE_WIDTH);
+	tileCountY_ = MathModule::Max<uint32_t>(1, (height + TILE_HEIGHT - 1) / TILE_HEIGHT);
+	width_ = tileCountX_ * TILE_WIDTH;
+	height_ = tileCountY_ * TILE_HEIGHT;
+
+	depths_.resize(width_ * height_, FAR_DEPTH);
+	tileBins_.resize(tileCountX_ * tileCountY_);
+}
+
+void OcclusionBuffer::Clear(const Mat4x4& viewProjection)
+{
+	viewProjection_ = viewProjection;
+
+	std::fill(depths_.begin(), depths_.end(), FAR_DEPTH);
+	triangles_.clear();
+	for (std::vector<uint32_t>& bin : tileBins_)
+	{
+		bin.clear();
+	}
+
+	stats_ = Stats();
+}
+
+void OcclusionBuffer::AddOccluder(const Vec3f* positions, uint32_t vertexCount, const uint32_t* indices, uint32_t indexCount, const Mat4x4& world)
+{
+	Mat4x4 worldViewProjection = world * viewProjection_;
+	float width = static_cast<float>(width_);
+	float height = static_cast<float>(height_);
+
+	screenPositions_.resize(vertexCount);
+	for (uint32_t index = 0; index < vertexCount; ++index)
+	{
+		if (!ProjectToScreen(positions[index], worldViewProjection, width, height, screenPositions_[index]))
+		{
+			screenPositions_[index].z = CLIPPED_DEPTH;
+		}
+	}
+
+	int32_t maxPixelX = static_cast<int32_t>(width_) - 1;
+	int32_t maxPixelY = static_cast<int32_t>(height_) - 1;
+
+	for (uint32_t index = 0; index + 2 < indexCount; index += 3)
+	{
+		++stats_.occluderTriangleCount;
+
+		Vec3f v0 = screenPositions_[indices[index + 0]];
+		Vec3f v1 = screenPositions_[indices[index + 1]];
+		Vec3f v2 = screenPositions_[indices[index + 2]];
+
+		if (v0.z < 0.0f || v1.z < 0.0f || v2.z < 0.0f)
+		{
+			continue;
+		}
+
+		float area = (v1.x - v0.x) * (v2.y - v0.y) - (v1.y - v0.y) * (v2.x - v0.x);
+		if (MathModule::Abs(area) < MIN_TRIANGLE_AREA)
+		{
+			continue;
+		}
+
+		if (area < 0.0f)
+		{
+			std::swap(v1, v2);
+		}
+
+		float minX = MathModule::Min<float>(v0.x, MathModule::Min<float>(v1.x, v2.x));
+		float minY = MathModule::Min<float>(v0.y, MathModule::Min<float>(v1.y, v2.y));
+		float maxX = MathModule::Max<float>(v0.x, MathModule::Max<float>(v1.x, v2.x));
+		float maxY = MathModule::Max<float>(v0.y, MathModule::Max<float>(v1.y, v2.y));
+		if (maxX < 0.0f || maxY < 0.0f || minX > width || minY > height)
+		{
+			continue;
+		}
+
+		ScreenTriangle triangle;
+		const Vec3f* vertices[3] = { &v0, &v1, &v2 };
+		for (uint32_t edge = 0; edge < 3; ++edge)
+		{
+			const Vec3f& start = *vertices[edge];
+			const Vec3f& end = *vertices[(edge + 1) % 3];
+
+			triangle.a[edge] = start.y - end.y;
+			triangle.b[edge] = end.x - start.x;
+			triangle.c[edge] = -triangle.a[edge] * start.x - triangle.b[edge] * start.y;
+		}
+
+		triangle.depth = MathModule::Max<float>(v0.z, MathModule::Max<float>(v1.z, v2.z));
+		triangle.minX = ToPixel(minX, maxPixelX);
+		triangle.minY = ToPixel(minY, maxPixelY);
+		triangle.maxX = ToPixel(maxX, maxPixelX);
+		triangle.maxY = ToPixel(maxY, maxPixelY);
+
+		uint32_t triangleIndex = static_cast<uint32_t>(triangles_.size());
+		triangles_.push_back(triangle);
+		++stats_.binnedTriangleCount;
+
+		for (uint32_t tileY = triangle.minY / TILE_HEIGHT; tileY <= triangle.maxY / TILE_HEIGHT; ++tileY)
+		{
+			for (uint32_t tileX = triangle.minX / TILE_WIDTH; tileX <= triangle.maxX / TILE_WIDTH; ++tileX)
+			{
+				tileBins_[tileY * tileCountX_ + tileX].push_back(triangleIndex);
+				++stats_.tileTriangleCount;
+			}
+		}
+	}
+}
+
+void OcclusionBuffer::Rasterize(const ParallelForFunction& parallelFor)
+{
+	if (triangles_.empty())
+	{
+		return;
+	}
+
+	uint32_t tileCount = tileCountX_ * tileCountY_;
+	auto rasterizeTiles = [this](uint32_t begin, uint32_t end)
+		{
+			for (uint32_t tile = begin; tile < end; ++tile)
+			{
+				RasterizeTile(tile);
+			}
+		};
+
+	if (parallelFor)
+	{
+		parallelFor(tileCount, rasterizeTiles);
+	}
+	else
+	{
+		rasterizeTiles(0, tileCount);
+	}
+}
+
+bool OcclusionBuffer::IsVisibleAABB(const Vec3f& minPosition, const Vec3f& maxPosition) const
+{
+	float width = static_cast<float>(width_);
+	float height = static_cast<float>(height_);
+
+	Vec3f minScreen(+MAX_FLOAT, +MAX_FLOAT, +MAX_FLOAT);
+	Vec3f maxScreen(-MAX_FLOAT, -MAX_FLOAT, -MAX_FLOAT);
+	for (uint32_t corner = 0; corner < 8; ++corner)
+	{
+		Vec3f position((corner & 1) ? maxPosition.x : minPosition.x, (corner & 2) ? maxPosition.y : minPosition.y, (corner & 4) ? maxPosition.z : minPosition.z);
+
+		Vec3f screen;
+		if (!ProjectToScreen(position, viewProjection_, width, height, screen))
+		{
+			return true;
+		}
+
+		minScreen = Vec3f(MathModule::Min<float>(minScreen.x, screen.x), MathModule::Min<float>(minScreen.y, screen.y), MathModule::Min<float>(minScreen.z, screen.z));
+		maxScreen = Vec3f(MathModule::Max<float>(maxScreen.x, screen.x), MathModule::Max<float>(maxScreen.y, screen.y), MathModule::Max<float>(maxScreen.z, screen.z));
+	}
+
+	if (maxScreen.x < 0.0f || maxScreen.y < 0.0f || minScreen.x >= width || minScreen.y >= height)
+	{
+		return false;
+	}
+
+	int32_t minX = ToPixel(minScreen.x, static_cast<int32_t>(width_) - 1);
+	int32_t minY = ToPixel(minScreen.y, static_cast<int32_t>(height_) - 1);
+	int32_t maxX = ToPixel(maxScreen.x, static_cast<int32_t>(width_) - 1);
+	int32_t maxY = ToPixel(maxScreen.y, static_cast<int32_t>(height_) - 1);
+
+	Floatx8 laneOffsets = Floatx8::Load(LANE_OFFSETS);
+	Floatx8 minPixelX(static_cast<float>(minX));
+	Floatx8 maxPixelX(static_cast<float>(maxX));
+	Floatx8 nearestDepth(minScreen.z);
+
+	int32_t startX = minX & ~static_cast<int32_t>(SPAN_WIDTH - 1);
+	for (int32_t y = minY; y <= maxY; ++y)
+	{
+		const float* row = depths_.data() + y * width_;
+		for (int32_t x = startX; x <= maxX; x += SPAN_WIDTH)
+		{
+			Floatx8 pixelX = laneOffsets + Floatx8(static_cast<float>(x));
+			Floatx8 mask = (pixelX >= minPixelX) & (pixelX <= maxPixelX) & (Floatx8::Load(row + x) > nearestDepth);
+			if (Floatx8::Any(mask))
+			{
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+bool OcclusionBuffer::IsVisibleSphere(const Vec3f& center, float radius) const
+{
+	if (!(radius < MAX_FLOAT))
+	{
+		return true;
+	}
+
+	Vec3f extent(radius, radius, radius);
+	return IsVisibleAABB(center - extent, center + extent);
+}
+
+uint32_t OcclusionBuffer::CullSpheres(const Vec3f* centers, const float* radii, const uint32_t* indices, uint32_t indexCount, uint32_t* outVisibleIndices) const
+{
+	uint32_t visibleCount = 0;
+	for (uint32_t index = 0; index < indexCount; ++index)
+	{
+		uint32_t sphere = indices[index];
+		if (IsVisibleSphere(centers[sphere], radii[sphere]))
+		{
+			outVisibleIndices[visibleCount++] = sphere;
+		}
+	}
+
+	return visibleCount;
+}
+
+void OcclusionBuffer::RasterizeTile(uint32_t tile)
+{
+	const std::vector<uint32_t>& bin = tileBins_[tile];
+	if (bin.empty())
+	{
+		return;
+	}
+
+	int32_t tileMinX = static_cast<int32_t>((tile % tileCountX_) * TILE_WIDTH);
+	int32_t tileMinY = static_cast<int32_t>((tile / tileCountX_) * TILE_HEIGHT);
+	int32_t tileMaxX = tileMinX + static_cast<int32_t>(TILE_WIDTH) - 1;
+	int32_t tileMaxY = tileMinY + static_cast<int32_t>(TILE_HEIGHT) - 1;
+
+	Floatx8 pixelCenters = Floatx8::Load(LANE_OFFSETS) + Floatx8(0.5f);
+	Floatx8 zero(0.0f);
+
+	for (uint32_t triangleIndex : bin)
+	{
+		const ScreenTriangle& triangle = triangles_[triangleIndex];
+
+		int32_t minX = MathModule::Max<int32_t>(triangle.minX, tileMinX) & ~static_cast<int32_t>(SPAN_WIDTH - 1);
+		int32_t minY = MathModule::Max<int32_t>(triangle.minY, tileMinY);
+		int32_t maxX = MathModule::Min<int32_t>(triangle.maxX, tileMaxX);
+		int32_t maxY = MathModule::Min<int32_t>(triangle.maxY, tileMaxY);
+
+		Floatx8 a0(triangle.a[0]);
+		Floatx8 a1(triangle.a[1]);
+		Floatx8 a2(triangle.a[2]);
+		Floatx8 depth(triangle.depth);
+
+		for (int32_t y = minY; y <= maxY; ++y)
+		{
+			float pixelY = static_cast<float>(y) + 0.5f;
+			Floatx8 row0(triangle.b[0] * pixelY + triangle.c[0]);
+			Floatx8 row1(triangle.b[1] * pixelY + triangle.c[1]);
+			Floatx8 row2(triangle.b[2] * pixelY + triangle.c[2]);
+
+			float* row = depths_.data() + y * width_;
+			for (int32_t x = minX; x <= maxX; x += SPAN_WIDTH)
+			{
+				Floatx8 pixelX = pixelCenters + Floatx8(static_cast<float>(x));
+				Floatx8 inside = (a0 * pixelX + row0 >= zero) & (a1 * pixelX + row1 >= zero) & (a2 * pixelX + row2 >= zero);
+				if (!Floatx8::Any(inside))
+				{
+					continue;
+				}
+
+				Floatx8 current = Floatx8::Load(row + x);
+				Floatx8::Select(inside, Floatx8::Min(current, depth), current).Store(row + x);
+			}
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,228 @@
+#include <random>
+
+#include "MathModule.h"
+#include "RandomStream.h"
+
+/**
+ * @brief Fill   ó  Դϴ.
+ */
+static const uint32_t FILL_CHUNK_SIZE = 64;
+
+/**
+ * @brief SplitMix64 64Ʈ  մϴ. õ Ȯ忡 մϴ.
+ */
+static uint64_t SplitMix64(uint64_t& state)
+{
+	uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+	return z ^ (z >> 31);
+}
+
+void RandomStream::Seed(uint64_t seed)
+{
+	uint64_t state = seed;
+
+	uint64_t s0 = SplitMix64(state);
+	uint64_t s1 = SplitMix64(state);
+
+	state_[0] = static_cast<uint32_t>(s0);
+	state_[1] = static_cast<uint32_t>(s0 >> 32);
+	state_[2] = static_cast<uint32_t>(s1);
+	state_[3] = static_cast<uint32_t>(s1 >> 32);
+
+	if ((state_[0] | state_[1] | state_[2] | state_[3]) == 0)
+	{
+		state_[0] = 1;
+	}
+}
+
+void RandomStream::Jump()
+{
+	static const uint32_t JUMP[] = { 0x8764000B, 0xF542D2D3, 0x6FA035C3, 0x77F2DB5B };
+
+	uint32_t s0 = 0;
+	uint32_t s1 = 0;
+	uint32_t s2 = 0;
+	uint32_t s3 = 0;
+
+	for (uint32_t index = 0; index < 4; ++index)
+	{
+		for (uint32_t bit = 0; bit < 32; ++bit)
+		{
+			if (JUMP[index] & (1u << bit))
+			{
+				s0 ^= state_[0];
+				s1 ^= state_[1];
+				s2 ^= state_[2];
+				s3 ^= state_[3];
+			}
+
+			NextUInt();
+		}
+	}
+
+	state_[0] = s0;
+	state_[1] = s1;
+	state_[2] = s2;
+	state_[3] = s3;
+}
+
+RandomStream RandomStream::Split()
+{
+	RandomStream stream(*this);
+	Jump();
+
+	return stream;
+}
+
+int32_t RandomStream::NextInt(int32_t minValue, int32_t maxValue)
+{
+	int32_t lower = MathModule::Min<int32_t>(minValue, maxValue);
+	int32_t upper = MathModule::Max<int32_t>(minValue, maxValue);
+
+	uint64_t range = static_cast<uint64_t>(static_cast<int64_t>(upper) - static_cast<int64_t>(lower)) + 1;
+	if (range > 0xFFFFFFFFULL)
+	{
+		return static_cast<int32_t>(NextUInt());
+	}
+
+	uint64_t product = static_cast<uint64_t>(NextUInt()) * range;
+	uint32_t low = static_cast<uint32_t>(product);
+
+	if (low < static_cast<uint32_t>(range))
+	{
+		uint32_t threshold = static_cast<uint32_t>((0x100000000ULL - range) % range);
+		while (low < threshold)
+		{
+			product = static_cast<uint64_t>(NextUInt()) * range;
+			low = static_cast<uint32_t>(product);
+		}
+	}
+
+	return static_cast<int32_t>(static_cast<int64_t>(lower) + static_cast<int64_t>(product >> 32));
+}
+
+Vec3f RandomStream::NextUnitVec3()
+{
+	float z = 2.0f * NextFloat() - 1.0f;
+	float radian = TwoPi * NextFloat();
+	float r = MathModule::Sqrt(MathModule::Max<float>(0.0f, 1.0f - z * z));
+
+	float s = 0.0f;
+	float c = 0.0f;
+	MathModule::SinCos(radian, s, c);
+
+	return Vec3f(r * c, r * s, z);
+}
+
+Quat RandomStream::NextUnitQuat()
+{
+	float u = NextFloat();
+	float radian0 = TwoPi * NextFloat();
+	float radian1 = TwoPi * NextFloat();
+
+	float a = MathModule::Sqrt(1.0f - u);
+	float b = MathModule::Sqrt(u);
+
+	float s0 = 0.0f;
+	float c0 = 0.0f;
+	float s1 = 0.0f;
+	float c1 = 0.0f;
+	MathModule::SinCos(radian0, s0, c0);
+	MathModule::SinCos(radian1, s1, c1);
+
+	return Quat(a * s0, a * c0, b * s1, b * c1);
+}
+
+void RandomStream::Fill(int32_t* outValues, uint32_t count, int32_t minValue, int32_t maxValue)
+{
+	for (uint32_t index = 0; index < count; ++index)
+	{
+		outValues[index] = NextInt(minValue, maxValue);
+	}
+}
+
+void RandomStream::Fill(float* outValues, uint32_t count, float minValue, float maxValue)
+{
+	float range = maxValue - minValue;
+
+	for (uint32_t index = 0; index < count; ++index)
+	{
+		outValues[index] = minValue + range * NextFloat();
+	}
+}
+
+void RandomStream::Fill(Vec3f* outVectors, uint32_t count)
+{
+	float z[FILL_CHUNK_SIZE];
+	float radians[FILL_CHUNK_SIZE];
+	float s[FILL_CHUNK_SIZE];
+	float c[FILL_CHUNK_SIZE];
+
+	for (uint32_t offset = 0; offset < count; offset += FILL_CHUNK_SIZE)
+	{
+		uint32_t chunkSize = MathModule::Min<uint32_t>(count - offset, FILL_CHUNK_SIZE);
+
+		for (uint32_t index = 0; index < chunkSize; ++index)
+		{
+			z[index] = 2.0f * NextFloat() - 1.0f;
+			radians[index] = TwoPi * NextFloat();
+		}
+
+		MathModule::SinCos(radians, s, c, chunkSize);
+
+		for (uint32_t index = 0; index < chunkSize; ++index)
+		{
+			float r = MathModule::Sqrt(MathModule::Max<float>(0.0f, 1.0f - z[index] * z[index]));
+			outVectors[offset + index] = Vec3f(r * c[index], r * s[index], z[index]);
+		}
+	}
+}
+
+void RandomStream::Fill(Quat* outQuats, uint32_t count)
+{
+	float u[FILL_CHUNK_SIZE];
+	float radians0[FILL_CHUNK_SIZE];
+	float radians1[FILL_CHUNK_SIZE];
+	float s0[FILL_CHUNK_SIZE];
+	float c0[FILL_CHUNK_SIZE];
+	float s1[FILL_CHUNK_SIZE];
+	float c1[FILL_CHUNK_SIZE];
+
+	for (uint32_t offset = 0; offset < count; offset += FILL_CHUNK_SIZE)
+	{
+		uint32_t chunkSize = MathModule::Min<uint32_t>(count - offset, FILL_CHUNK_SIZE);
+
+		for (uint32_t index = 0; index < chunkSize; ++index)
+		{
+			u[index] = NextFloat();
+			radians0[index] = TwoPi * NextFloat();
+			radians1[index] = TwoPi * NextFloat();
+		}
+
+		MathModule::SinCos(radians0, s0, c0, chunkSize);
+		MathModule::SinCos(radians1, s1, c1, chunkSize);
+
+		for (uint32_t index = 0; index < chunkSize; ++index)
+		{
+			float a = MathModule::Sqrt(1.0f - u[index]);
+			float b = MathModule::Sqrt(u[index]);
+
+			outQuats[offset + index] = Quat(a * s0[index], a * c0[index], b * s1[index], b * c1[index]);
+		}
+	}
+}
+
+RandomStream& RandomStream::GetThreadLocal()
+{
+	static thread_local RandomStream stream(
+		[]()
+		{
+			std::random_device randomDevice;
+			return (static_cast<uint64_t>(randomDevice()) << 32) | static_cast<uint64_t>(randomDevice());
+		}()
+	);
+
+	return stream;
+}
\ No newline at end of file
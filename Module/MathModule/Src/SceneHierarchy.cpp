@@ -0,0 +1,322 @@
+#include <algorithm>
+
+#include "SceneHierarchy.h"
+#include "TransformStream.h"
+
+const uint32_t SceneHierarchy::INVALID_NODE;
+
+/**
+ * @brief    ϱ  ּ  Դϴ. ̺   Ʈ  ۾ ϴ   Ůϴ.
+ */
+static const uint32_t PARALLEL_UPDATE_THRESHOLD = 8192;
+
+/**
+ * @brief  ϳ ô  Ʈ   Դϴ.  罽     ̾ ʵ մϴ.
+ */
+static const uint32_t MAX_RANGE_PER_THREAD = 8;
+
+/**
+ * @brief 迭 ӵ  [begin, end)Դϴ.
+ */
+struct NodeRange
+{
+	uint32_t begin;
+	uint32_t end;
+};
+
+uint32_t SceneHierarchy::AddNode(const Transform& localTransform, uint32_t parent)
+{
+	uint32_t node = static_cast<uint32_t>(localTransforms_.size());
+	uint32_t index = node;
+	uint32_t parentIndex = (parent == INVALID_NODE) ? INVALID_NODE : nodeToIndex_[parent];
+
+	bool bIsAppendable = (parentIndex == INVALID_NODE) || (!bIsUnsorted_ && subtreeEnds_[parentIndex] == index);
+
+	localTransforms_.push_back(localTransform);
+	parentIndices_.push_back(parentIndex);
+	worldMatrices_.push_back(Mat4x4::Identity());
+	dirtyFlags_.push_back(1);
+	subtreeEnds_.push_back(index + 1);
+	nodeToIndex_.push_back(index);
+	indexToNode_.push_back(node);
+
+	if (!bIsAppendable)
+	{
+		bIsUnsorted_ = true;
+	}
+	else if (!bIsUnsorted_)
+	{
+		for (uint32_t ancestor = parentIndex; ancestor != INVALID_NODE; ancestor = parentIndices_[ancestor])
+		{
+			subtreeEnds_[ancestor] = index + 1;
+		}
+	}
+
+	bIsDirty_ = true;
+	return node;
+}
+
+bool SceneHierarchy::SetParent(uint32_t node, uint32_t parent)
+{
+	uint32_t index = nodeToIndex_[node];
+	uint32_t parentIndex = (parent == INVALID_NODE) ? INVALID_NODE : nodeToIndex_[parent];
+
+	for (uint32_t ancestor = parentIndex; ancestor != INVALID_NODE; ancestor = parentIndices_[ancestor])
+	{
+		if (ancestor == index)
+		{
+			return false;
+		}
+	}
+
+	if (parentIndices_[index] != parentIndex)
+	{
+		parentIndices_[index] = parentIndex;
+		dirtyFlags_[index] = 1;
+		bIsDirty_ = true;
+		bIsUnsorted_ = true;
+	}
+
+	return true;
+}
+
+uint32_t SceneHierarchy::GetParent(uint32_t node) const
+{
+	uint32_t parentIndex = parentIndices_[nodeToIndex_[node]];
+	return (parentIndex == INVALID_NODE) ? INVALID_NODE : indexToNode_[parentIndex];
+}
+
+void SceneHierarchy::SetLocalTransform(uint32_t node, const Transform& localTransform)
+{
+	uint32_t index = nodeToIndex_[node];
+
+	localTransforms_[index] = localTransform;
+	dirtyFlags_[index] = 1;
+	bIsDirty_ = true;
+}
+
+void SceneHierarchy::Update(uint32_t threadCount, const ParallelForFunction& parallelFor)
+{
+	if (bIsUnsorted_)
+	{
+		SortNodes();
+	}
+
+	if (!bIsDirty_)
+	{
+		return;
+	}
+
+	uint32_t count = GetNodeCount();
+
+	if (threadCount <= 1 || count < PARALLEL_UPDATE_THRESHOLD)
+	{
+		UpdateRange(0, count);
+	}
+	else
+	{
+		std::vector<NodeRange> ranges;
+		for (uint32_t root = 0; root < count; root = subtreeEnds_[root])
+		{
+			ranges.push_back(NodeRange{ root, subtreeEnds_[root] });
+		}
+
+		uint32_t targetSize = count / threadCount;
+		while (ranges.size() < threadCount * MAX_RANGE_PER_THREAD)
+		{
+			auto largest = std::max_element(ranges.begin(), ranges.end(), [](const NodeRange& lhs, const NodeRange& rhs) { return lhs.end - lhs.begin < rhs.end - rhs.begin; });
+			NodeRange range = *largest;
+			if (range.end - range.begin <= targetSize || range.end - range.begin == 1)
+			{
+				break;
+			}
+
+			UpdateRange(range.begin, range.begin + 1);
+			ranges.erase(largest);
+
+			for (uint32_t child = range.begin + 1; child < range.end; child = subtreeEnds_[child])
+			{
+				ranges.push_back(NodeRange{ child, subtreeEnds_[child] });
+			}
+		}
+
+		std::sort(ranges.begin(), ranges.end(), [](const NodeRange& lhs, const NodeRange& rhs) { return lhs.end - lhs.begin > rhs.end - rhs.begin; });
+
+		std::vector<std::vector<NodeRange>> threadRanges(threadCount);
+		std::vector<uint32_t> threadSizes(threadCount, 0);
+		for (const NodeRange& range : ranges)
+		{
+			uint32_t thread = static_cast<uint32_t>(std::min_element(threadSizes.begin(), threadSizes.end()) - threadSizes.begin());
+			threadRanges[thread].push_back(range);
+			threadSizes[thread] += range.end - range.begin;
+		}
+
+		auto updateThreads = [&](uint32_t begin, uint32_t end)
+			{
+				for (uint32_t thread = begin; thread < end; ++thread)
+				{
+					for (const NodeRange& range : threadRanges[thread])
+					{
+						UpdateRange(range.begin, range.end);
+					}
+				}
+			};
+
+		if (parallelFor)
+		{
+			parallelFor(threadCount, updateThreads);
+		}
+		else
+		{
+			updateThreads(0, threadCount);
+		}
+	}
+
+	std::fill(dirtyFlags_.begin(), dirtyFlags_.end(), 0);
+	bIsDirty_ = false;
+}
+
+void SceneHierarchy::SortNodes()
+{
+	uint32_t count = GetNodeCount();
+
+	std::vector<uint32_t> firstChildren(count, INVALID_NODE);
+	std::vector<uint32_t> nextSiblings(count, INVALID_NODE);
+
+	for (uint32_t index = count; index-- > 0;)
+	{
+		uint32_t parentIndex = parentIndices_[index];
+		if (parentIndex != INVALID_NODE)
+		{
+			nextSiblings[index] = firstChildren[parentIndex];
+			firstChildren[parentIndex] = index;
+		}
+	}
+
+	std::vector<uint32_t> order;
+	order.reserve(count);
+
+	for (uint32_t root = 0; root < count; ++root)
+	{
+		if (parentIndices_[root] != INVALID_NODE)
+		{
+			continue;
+		}
+
+		uint32_t current = root;
+		while (true)
+		{
+			order.push_back(current);
+
+			if (firstChildren[current] != INVALID_NODE)
+			{
+				current = firstChildren[current];
+				continue;
+			}
+
+			while (current != root && nextSiblings[current] == INVALID_NODE)
+			{
+				current = parentIndices_[current];
+			}
+
+			if (current == root)
+			{
+				break;
+			}
+
+			current = nextSiblings[current];
+		}
+	}
+
+	std::vector<uint32_t> newIndices(count);
+	for (uint32_t index = 0; index < count; ++index)
+	{
+		newIndices[order[index]] = index;
+	}
+
+	std::vector<Transform> localTransforms(count);
+	std::vector<uint32_t> parentIndices(count);
+	std::vector<Mat4x4> worldMatrices(count);
+	std::vector<uint8_t> dirtyFlags(count);
+
+	for (uint32_t index = 0; index < count; ++index)
+	{
+		uint32_t oldIndex = order[index];
+		uint32_t parentIndex = parentIndices_[oldIndex];
+
+		localTransforms[index] = localTransforms_[oldIndex];
+		parentIndices[index] = (parentIndex == INVALID_NODE) ? INVALID_NODE : newIndices[parentIndex];
+		worldMatrices[index] = worldMatrices_[oldIndex];
+		dirtyFlags[index] = dirtyFlags_[oldIndex];
+	}
+
+	for (uint32_t node = 0; node < count; ++node)
+	{
+		nodeToIndex_[node] = newIndices[nodeToIndex_[node]];
+		indexToNode_[nodeToIndex_[node]] = node;
+	}
+
+	localTransforms_ = std::move(localTransforms);
+	parentIndices_ = std::move(parentIndices);
+	worldMatrices_ = std::move(worldMatrices);
+	dirtyFlags_ = std::move(dirtyFlags);
+
+	for (uint32_t index = 0; index < count; ++index)
+	{
+		subtreeEnds_[index] = index + 1;
+	}
+
+	for (uint32_t index = count; index-- > 0;)
+	{
+		uint32_t parentIndex = parentIndices_[index];
+		if (parentIndex != INVALID_NODE)
+		{
+			subtreeEnds_[parentIndex] = std::max(subtreeEnds_[parentIndex], subtreeEnds_[index]);
+		}
+	}
+
+	bIsUnsorted_ = false;
+}
+
+void SceneHierarchy::UpdateRange(uint32_t begin, uint32_t end)
+{
+	auto updateRun = [this](uint32_t runBegin, uint32_t runEnd)
+		{
+			TransformStream::ToMatrices(&localTransforms_[runBegin], &worldMatrices_[runBegin], runEnd - runBegin);
+
+			for (uint32_t index = runBegin; index < runEnd; ++index)
+			{
+				uint32_t parentIndex = parentIndices_[index];
+				if (parentIndex != INVALID_NODE)
+				{
+					worldMatrices_[index] = worldMatrices_[index] * worldMatrices_[parentIndex];
+				}
+			}
+		};
+
+	uint32_t runBegin = end;
+
+	for (uint32_t index = begin; index < end; ++index)
+	{
+		uint32_t parentIndex = parentIndices_[index];
+		if (parentIndex != INVALID_NODE && dirtyFlags_[parentIndex])
+		{
+			dirtyFlags_[index] = 1;
+		}
+
+		if (dirtyFlags_[index])
+		{
+			runBegin = MathModule::Min<uint32_t>(runBegin, index);
+		}
+		else if (runBegin != end)
+		{
+			updateRun(runBegin, index);
+			runBegin = end;
+		}
+	}
+
+	if (runBegin != end)
+	{
+		updateRun(runBegin, end);
+	}
+}
\ No newline at end of file
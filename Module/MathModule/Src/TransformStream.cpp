@@ -0,0 +1,485 @@
+#include <algorithm>
+
+#include "SIMD.h"
+#include "TransformStream.h"
+
+/**
+ * @brief ׵ Ʈ  Դϴ. TransformStream::EComponent  ϴ.
+ */
+static const float IDENTITY_COMPONENTS[static_cast<int32_t>(TransformStream::EComponent::Count)] =
+{
+	0.0f, 0.0f, 0.0f,
+	0.0f, 0.0f, 0.0f, 1.0f,
+	1.0f, 1.0f, 1.0f,
+};
+
+TransformStream::TransformStream(uint32_t size)
+{
+	Resize(size);
+}
+
+void TransformStream::Resize(uint32_t size)
+{
+	uint32_t capacity = (size + 3) & ~3u;
+
+	for (int32_t component = 0; component < static_cast<int32_t>(EComponent::Count); ++component)
+	{
+		std::vector<float>& elements = components_[component];
+
+		elements.resize(capacity, IDENTITY_COMPONENTS[component]);
+
+		for (uint32_t index = size; index < capacity; ++index)
+		{
+			elements[index] = IDENTITY_COMPONENTS[component];
+		}
+	}
+
+	size_ = size;
+}
+
+void TransformStream::Set(uint32_t index, const Transform& transform)
+{
+	components_[static_cast<int32_t>(EComponent::PositionX)][index] = transform.position.x;
+	components_[static_cast<int32_t>(EComponent::PositionY)][index] = transform.position.y;
+	components_[static_cast<int32_t>(EComponent::PositionZ)][index] = transform.position.z;
+	components_[static_cast<int32_t>(EComponent::RotateX)][index] = transform.rotate.x;
+	components_[static_cast<int32_t>(EComponent::RotateY)][index] = transform.rotate.y;
+	components_[static_cast<int32_t>(EComponent::RotateZ)][index] = transform.rotate.z;
+	components_[static_cast<int32_t>(EComponent::RotateW)][index] = transform.rotate.w;
+	components_[static_cast<int32_t>(EComponent::ScaleX)][index] = transform.scale.x;
+	components_[static_cast<int32_t>(EComponent::ScaleY)][index] = transform.scale.y;
+	components_[static_cast<int32_t>(EComponent::ScaleZ)][index] = transform.scale.z;
+}
+
+Transform TransformStream::Get(uint32_t index) const
+{
+	return Transform(
+		Vec3f(
+			components_[static_cast<int32_t>(EComponent::PositionX)][index],
+			components_[static_cast<int32_t>(EComponent::PositionY)][index],
+			components_[static_cast<int32_t>(EComponent::PositionZ)][index]
+		),
+		Quat(
+			components_[static_cast<int32_t>(EComponent::RotateX)][index],
+			components_[static_cast<int32_t>(EComponent::RotateY)][index],
+			components_[static_cast<int32_t>(EComponent::RotateZ)][index],
+			components_[static_cast<int32_t>(EComponent::RotateW)][index]
+		),
+		Vec3f(
+			components_[static_cast<int32_t>(EComponent::ScaleX)][index],
+			components_[static_cast<int32_t>(EComponent::ScaleY)][index],
+			components_[static_cast<int32_t>(EComponent::ScaleZ)][index]
+		)
+	);
+}
+
+#if defined(MATH_SIMD_SSE)
+
+/**
+ * @brief 4 Ʈ SoA   SIMD Դϴ.
+ */
+struct TransformLane
+{
+	__m128 c[static_cast<int32_t>(TransformStream::EComponent::Count)];
+};
+
+/**
+ * @brief Ʈ 迭 ִ 4 Ʈ SIMD  нϴ.   ׵ Ʈ äϴ.
+ */
+static __forceinline void LoadLane(const Transform* transforms, uint32_t count, TransformLane& outLane)
+{
+	float elements[static_cast<int32_t>(TransformStream::EComponent::Count)][4];
+
+	for (uint32_t lane = 0; lane < 4; ++lane)
+	{
+		const float* src = IDENTITY_COMPONENTS;
+		float transform[static_cast<int32_t>(TransformStream::EComponent::Count)];
+
+		if (lane < count)
+		{
+			const Transform& t = transforms[lane];
+
+			transform[0] = t.position.x;
+			transform[1] = t.position.y;
+			transform[2] = t.position.z;
+			transform[3] = t.rotate.x;
+			transform[4] = t.rotate.y;
+			transform[5] = t.rotate.z;
+			transform[6] = t.rotate.w;
+			transform[7] = t.scale.x;
+			transform[8] = t.scale.y;
+			transform[9] = t.scale.z;
+
+			src = transform;
+		}
+
+		for (int32_t component = 0; component < static_cast<int32_t>(TransformStream::EComponent::Count); ++component)
+		{
+			elements[component][lane] = src[component];
+		}
+	}
+
+	for (int32_t component = 0; component < static_cast<int32_t>(TransformStream::EComponent::Count); ++component)
+	{
+		outLane.c[component] = _mm_loadu_ps(elements[component]);
+	}
+}
+
+/**
+ * @brief SIMD  Ʈ Ʈ 迭 ִ 4 ϴ.
+ */
+static __forceinline void StoreLane(const TransformLane& lane, Transform* outTransforms, uint32_t count)
+{
+	float elements[static_cast<int32_t>(TransformStream::EComponent::Count)][4];
+
+	for (int32_t component = 0; component < static_cast<int32_t>(TransformStream::EComponent::Count); ++component)
+	{
+		_mm_storeu_ps(elements[component], lane.c[component]);
+	}
+
+	for (uint32_t index = 0; index < count; ++index)
+	{
+		Transform& t = outTransforms[index];
+
+		t.position.x = elements[0][index];
+		t.position.y = elements[1][index];
+		t.position.z = elements[2][index];
+		t.rotate.x = elements[3][index];
+		t.rotate.y = elements[4][index];
+		t.rotate.z = elements[5][index];
+		t.rotate.w = elements[6][index];
+		t.scale.x = elements[7][index];
+		t.scale.y = elements[8][index];
+		t.scale.z = elements[9][index];
+	}
+}
+
+/**
+ * @brief Ʈ Ʈ Ư ġ 4 Ʈ SIMD  нϴ.
+ */
+static __forceinline void LoadLane(const TransformStream& stream, uint32_t index, TransformLane& outLane)
+{
+	for (int32_t component = 0; component < static_cast<int32_t>(TransformStream::EComponent::Count); ++component)
+	{
+		outLane.c[component] = _mm_loadu_ps(stream.GetComponent(static_cast<TransformStream::EComponent>(component)) + index);
+	}
+}
+
+/**
+ * @brief SIMD  Ʈ 4 Ʈ Ʈ Ư ġ ϴ.
+ */
+static __forceinline void StoreLane(const TransformLane& lane, TransformStream& outStream, uint32_t index)
+{
+	for (int32_t component = 0; component < static_cast<int32_t>(TransformStream::EComponent::Count); ++component)
+	{
+		_mm_storeu_ps(outStream.GetComponent(static_cast<TransformStream::EComponent>(component)) + index, lane.c[component]);
+	}
+}
+
+/**
+ * @brief ʹϾ ͸ ȸմϴ. Quat::operator*(const Vec3f&)   մϴ.
+ */
+static __forceinline void RotateLane(__m128 qx, __m128 qy, __m128 qz, __m128 qw, __m128 vx, __m128 vy, __m128 vz, __m128& outX, __m128& outY, __m128& outZ)
+{
+	const __m128 two = _mm_set1_ps(2.0f);
+
+	__m128 dotVVec = _mm_add_ps(_mm_add_ps(_mm_mul_ps(qx, vx), _mm_mul_ps(qy, vy)), _mm_mul_ps(qz, vz));
+	__m128 dotVV = _mm_add_ps(_mm_add_ps(_mm_mul_ps(qx, qx), _mm_mul_ps(qy, qy)), _mm_mul_ps(qz, qz));
+	__m128 s = _mm_sub_ps(_mm_mul_ps(qw, qw), dotVV);
+
+	__m128 cx = _mm_sub_ps(_mm_mul_ps(qy, vz), _mm_mul_ps(qz, vy));
+	__m128 cy = _mm_sub_ps(_mm_mul_ps(qz, vx), _mm_mul_ps(qx, vz));
+	__m128 cz = _mm_sub_ps(_mm_mul_ps(qx, vy), _mm_mul_ps(qy, vx));
+
+	outX = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_mul_ps(qx, two), dotVVec), _mm_mul_ps(vx, s)), _mm_mul_ps(_mm_mul_ps(cx, two), qw));
+	outY = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_mul_ps(qy, two), dotVVec), _mm_mul_ps(vy, s)), _mm_mul_ps(_mm_mul_ps(cy, two), qw));
+	outZ = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_mul_ps(qz, two), dotVVec), _mm_mul_ps(vz, s)), _mm_mul_ps(_mm_mul_ps(cz, two), qw));
+}
+
+/**
+ * @brief SIMD  Ʈ 4 ķ ȯϿ ִ 4 ϴ.
+ *
+ * @note Transform::ToMat   ȸ  Ϳ    մϴ.
+ */
+static __forceinline void ToMatricesLane(const TransformLane& lane, Mat4x4* outMatrices, uint32_t count)
+{
+	const __m128 two = _mm_set1_ps(2.0f);
+	const __m128 zero = _mm_setzero_ps();
+	const __m128 one = _mm_set1_ps(1.0f);
+
+	__m128 qx = lane.c[3];
+	__m128 qy = lane.c[4];
+	__m128 qz = lane.c[5];
+	__m128 qw = lane.c[6];
+
+	__m128 dotVV = _mm_add_ps(_mm_add_ps(_mm_mul_ps(qx, qx), _mm_mul_ps(qy, qy)), _mm_mul_ps(qz, qz));
+	__m128 s = _mm_sub_ps(_mm_mul_ps(qw, qw), dotVV);
+
+	__m128 x2 = _mm_mul_ps(qx, two);
+	__m128 y2 = _mm_mul_ps(qy, two);
+	__m128 z2 = _mm_mul_ps(qz, two);
+
+	__m128 r0[4] =
+	{
+		_mm_mul_ps(_mm_add_ps(_mm_mul_ps(x2, qx), s), lane.c[7]),
+		_mm_mul_ps(_mm_add_ps(_mm_mul_ps(y2, qx), _mm_mul_ps(z2, qw)), lane.c[7]),
+		_mm_mul_ps(_mm_sub_ps(_mm_mul_ps(z2, qx), _mm_mul_ps(y2, qw)), lane.c[7]),
+		zero,
+	};
+
+	__m128 r1[4] =
+	{
+		_mm_mul_ps(_mm_sub_ps(_mm_mul_ps(x2, qy), _mm_mul_ps(z2, qw)), lane.c[8]),
+		_mm_mul_ps(_mm_add_ps(_mm_mul_ps(y2, qy), s), lane.c[8]),
+		_mm_mul_ps(_mm_add_ps(_mm_mul_ps(z2, qy), _mm_mul_ps(x2, qw)), lane.c[8]),
+		zero,
+	};
+
+	__m128 r2[4] =
+	{
+		_mm_mul_ps(_mm_add_ps(_mm_mul_ps(x2, qz), _mm_mul_ps(y2, qw)), lane.c[9]),
+		_mm_mul_ps(_mm_sub_ps(_mm_mul_ps(y2, qz), _mm_mul_ps(x2, qw)), lane.c[9]),
+		_mm_mul_ps(_mm_add_ps(_mm_mul_ps(z2, qz), s), lane.c[9]),
+		zero,
+	};
+
+	__m128 r3[4] = { lane.c[0], lane.c[1], lane.c[2], one, };
+
+	_MM_TRANSPOSE4_PS(r0[0], r0[1], r0[2], r0[3]);
+	_MM_TRANSPOSE4_PS(r1[0], r1[1], r1[2], r1[3]);
+	_MM_TRANSPOSE4_PS(r2[0], r2[1], r2[2], r2[3]);
+	_MM_TRANSPOSE4_PS(r3[0], r3[1], r3[2], r3[3]);
+
+	for (uint32_t index = 0; index < count; ++index)
+	{
+		float* data = outMatrices[index].data;
+
+		_mm_storeu_ps(data + 0, r0[index]);
+		_mm_storeu_ps(data + 4, r1[index]);
+		_mm_storeu_ps(data + 8, r2[index]);
+		_mm_storeu_ps(data + 12, r3[index]);
+	}
+}
+
+/**
+ * @brief SIMD   Ʈ մϴ. Transform::Combine   մϴ.
+ */
+static __forceinline void CombineLane(const TransformLane& lhs, const TransformLane& rhs, TransformLane& outLane)
+{
+	TransformLane t;
+
+	t.c[7] = _mm_mul_ps(lhs.c[7], rhs.c[7]);
+	t.c[8] = _mm_mul_ps(lhs.c[8], rhs.c[8]);
+	t.c[9] = _mm_mul_ps(lhs.c[9], rhs.c[9]);
+
+	__m128 ax = rhs.c[3], ay = rhs.c[4], az = rhs.c[5], aw = rhs.c[6];
+	__m128 bx = lhs.c[3], by = lhs.c[4], bz = lhs.c[5], bw = lhs.c[6];
+
+	t.c[3] = _mm_add_ps(_mm_sub_ps(_mm_add_ps(_mm_mul_ps(ax, bw), _mm_mul_ps(ay, bz)), _mm_mul_ps(az, by)), _mm_mul_ps(aw, bx));
+	t.c[4] = _mm_add_ps(_mm_add_ps(_mm_sub_ps(_mm_mul_ps(ay, bw), _mm_mul_ps(ax, bz)), _mm_mul_ps(az, bx)), _mm_mul_ps(aw, by));
+	t.c[5] = _mm_add_ps(_mm_add_ps(_mm_sub_ps(_mm_mul_ps(ax, by), _mm_mul_ps(ay, bx)), _mm_mul_ps(az, bw)), _mm_mul_ps(aw, bz));
+	t.c[6] = _mm_sub_ps(_mm_mul_ps(aw, bw), _mm_add_ps(_mm_add_ps(_mm_mul_ps(ax, bx), _mm_mul_ps(ay, by)), _mm_mul_ps(az, bz)));
+
+	__m128 px, py, pz;
+	RotateLane(bx, by, bz, bw, _mm_mul_ps(lhs.c[7], rhs.c[0]), _mm_mul_ps(lhs.c[8], rhs.c[1]), _mm_mul_ps(lhs.c[9], rhs.c[2]), px, py, pz);
+
+	t.c[0] = _mm_add_ps(lhs.c[0], px);
+	t.c[1] = _mm_add_ps(lhs.c[1], py);
+	t.c[2] = _mm_add_ps(lhs.c[2], pz);
+
+	outLane = t;
+}
+
+/**
+ * @brief SIMD  Ʈ ȯ մϴ. Transform::Inverse   մϴ.
+ */
+static __forceinline void InverseLane(const TransformLane& lane, TransformLane& outLane)
+{
+	const __m128 signMask = _mm_set1_ps(-0.0f);
+	const __m128 one = _mm_set1_ps(1.0f);
+	const __m128 epsilon = _mm_set1_ps(Epsilon);
+
+	TransformLane inv;
+
+	__m128 lengthSq = _mm_mul_ps(lane.c[3], lane.c[3]);
+	lengthSq = _mm_add_ps(lengthSq, _mm_mul_ps(lane.c[4], lane.c[4]));
+	lengthSq = _mm_add_ps(lengthSq, _mm_mul_ps(lane.c[5], lane.c[5]));
+	lengthSq = _mm_add_ps(lengthSq, _mm_mul_ps(lane.c[6], lane.c[6]));
+
+	__m128 invLengthSq = _mm_div_ps(one, lengthSq);
+
+	inv.c[3] = _mm_mul_ps(_mm_xor_ps(lane.c[3], signMask), invLengthSq);
+	inv.c[4] = _mm_mul_ps(_mm_xor_ps(lane.c[4], signMask), invLengthSq);
+	inv.c[5] = _mm_mul_ps(_mm_xor_ps(lane.c[5], signMask), invLengthSq);
+	inv.c[6] = _mm_mul_ps(lane.c[6], invLengthSq);
+
+	for (int32_t component = 7; component <= 9; ++component)
+	{
+		__m128 nearZero = _mm_cmplt_ps(_mm_andnot_ps(signMask, lane.c[component]), epsilon);
+		inv.c[component] = _mm_andnot_ps(nearZero, _mm_div_ps(one, lane.c[component]));
+	}
+
+	RotateLane(
+		inv.c[3], inv.c[4], inv.c[5], inv.c[6],
+		_mm_mul_ps(inv.c[7], _mm_xor_ps(lane.c[0], signMask)),
+		_mm_mul_ps(inv.c[8], _mm_xor_ps(lane.c[1], signMask)),
+		_mm_mul_ps(inv.c[9], _mm_xor_ps(lane.c[2], signMask)),
+		inv.c[0], inv.c[1], inv.c[2]
+	);
+
+	outLane = inv;
+}
+
+void TransformStream::ToMatrices(const Transform* transforms, Mat4x4* outMatrices, uint32_t count)
+{
+	TransformLane lane;
+
+	for (uint32_t index = 0; index < count; index += 4)
+	{
+		uint32_t laneCount = std::min<uint32_t>(count - index, 4);
+
+		LoadLane(transforms + index, laneCount, lane);
+		ToMatricesLane(lane, outMatrices + index, laneCount);
+	}
+}
+
+void TransformStream::ToMatrices(const TransformStream& stream, Mat4x4* outMatrices)
+{
+	TransformLane lane;
+
+	for (uint32_t index = 0; index < stream.size_; index += 4)
+	{
+		LoadLane(stream, index, lane);
+		ToMatricesLane(lane, outMatrices + index, std::min<uint32_t>(stream.size_ - index, 4));
+	}
+}
+
+void TransformStream::Combine(const Transform* lhs, const Transform* rhs, Transform* outTransforms, uint32_t count)
+{
+	TransformLane lhsLane;
+	TransformLane rhsLane;
+
+	for (uint32_t index = 0; index < count; index += 4)
+	{
+		uint32_t laneCount = std::min<uint32_t>(count - index, 4);
+
+		LoadLane(lhs + index, laneCount, lhsLane);
+		LoadLane(rhs + index, laneCount, rhsLane);
+		CombineLane(lhsLane, rhsLane, lhsLane);
+		StoreLane(lhsLane, outTransforms + index, laneCount);
+	}
+}
+
+void TransformStream::Combine(const TransformStream& lhs, const TransformStream& rhs, TransformStream& outStream)
+{
+	uint32_t size = std::min<uint32_t>(lhs.size_, rhs.size_);
+	if (outStream.size_ != size)
+	{
+		outStream.Resize(size);
+	}
+
+	TransformLane lhsLane;
+	TransformLane rhsLane;
+
+	for (uint32_t index = 0; index < size; index += 4)
+	{
+		LoadLane(lhs, index, lhsLane);
+		LoadLane(rhs, index, rhsLane);
+		CombineLane(lhsLane, rhsLane, lhsLane);
+		StoreLane(lhsLane, outStream, index);
+	}
+}
+
+void TransformStream::Inverse(const Transform* transforms, Transform* outTransforms, uint32_t count)
+{
+	TransformLane lane;
+
+	for (uint32_t index = 0; index < count; index += 4)
+	{
+		uint32_t laneCount = std::min<uint32_t>(count - index, 4);
+
+		LoadLane(transforms + index, laneCount, lane);
+		InverseLane(lane, lane);
+		StoreLane(lane, outTransforms + index, laneCount);
+	}
+}
+
+void TransformStream::Inverse(const TransformStream& stream, TransformStream& outStream)
+{
+	if (outStream.size_ != stream.size_)
+	{
+		outStream.Resize(stream.size_);
+	}
+
+	TransformLane lane;
+
+	for (uint32_t index = 0; index < stream.size_; index += 4)
+	{
+		LoadLane(stream, index, lane);
+		InverseLane(lane, lane);
+		StoreLane(lane, outStream, index);
+	}
+}
+
+#else
+
+void TransformStream::ToMatrices(const Transform* transforms, Mat4x4* outMatrices, uint32_t count)
+{
+	for (uint32_t index = 0; index < count; ++index)
+	{
+		outMatrices[index] = Transform::ToMat(transforms[index]);
+	}
+}
+
+void TransformStream::ToMatrices(const TransformStream& stream, Mat4x4* outMatrices)
+{
+	for (uint32_t index = 0; index < stream.size_; ++index)
+	{
+		outMatrices[index] = Transform::ToMat(stream.Get(index));
+	}
+}
+
+void TransformStream::Combine(const Transform* lhs, const Transform* rhs, Transform* outTransforms, uint32_t count)
+{
+	for (uint32_t index = 0; index < count; ++index)
+	{
+		outTransforms[index] = Transform::Combine(lhs[index], rhs[index]);
+	}
+}
+
+void TransformStream::Combine(const TransformStream& lhs, const TransformStream& rhs, TransformStream& outStream)
+{
+	uint32_t size = std::min<uint32_t>(lhs.size_, rhs.size_);
+	if (outStream.size_ != size)
+	{
+		outStream.Resize(size);
+	}
+
+	for (uint32_t index = 0; index < size; ++index)
+	{
+		outStream.Set(index, Transform::Combine(lhs.Get(index), rhs.Get(index)));
+	}
+}
+
+void TransformStream::Inverse(const Transform* transforms, Transform* outTransforms, uint32_t count)
+{
+	for (uint32_t index = 0; index < count; ++index)
+	{
+		outTransforms[index] = Transform::Inverse(transforms[index]);
+	}
+}
+
+void TransformStream::Inverse(const TransformStream& stream, TransformStream& outStream)
+{
+	if (outStream.size_ != stream.size_)
+	{
+		outStream.Resize(stream.size_);
+	}
+
+	for (uint32_t index = 0; index < stream.size_; ++index)
+	{
+		outStream.Set(index, Transform::Inverse(stream.Get(index)));
+	}
+}
+
+#endif
\ No newline at end of file
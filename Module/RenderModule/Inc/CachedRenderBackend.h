@@ -0,0 +1,306 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <memory>
+
+#include "IRenderBackend.h"
+
+
+/**
+ * @brief ٸ  鿣带 μ ׷Ƚ API ¸ CPU ʿ (shadow)ϴ  鿣Դϴ.
+ *
+ * @note
+ * -  , Ʈ, ε ̴ α׷/ 迭//ؽó ϰ  ٲ ʴ ȣ  鿣忡  ʽϴ.
+ * -  , ̴ α׷,  迭  û   ξٰ   ϴ ȣ(׸,  ,  Ӽ  )  մϴ.
+ *    Bind -> Draw -> Unbind -> Bind ·   ǵȴٰ ٽ ϴ ȣ  鿣忡 ޵ ʽϴ.
+ * - GetRenderState   ϹǷ glGet 迭 Ƿ     ʽϴ.
+ * -  鿣带 ġ ʰ ׷Ƚ API ¸ ٲٸ ݵ Invalidate ȣؾ մϴ.
+ */
+class CachedRenderBackend : public IRenderBackend
+{
+public:
+	/**
+	 * @brief  ĳð ϴ ȣ īԴϴ.
+	 */
+	struct Counters
+	{
+		uint64_t issuedStateCount = 0; //  鿣忡    ȣ Դϴ.
+		uint64_t skippedStateCount = 0; //  ų   ٸ      ȣ Դϴ.
+		uint64_t issuedQueryCount = 0; //  鿣忡    Դϴ.
+		uint64_t servedQueryCount = 0; //      Դϴ.
+	};
+
+
+public:
+	/**
+	 * @brief  ĳ  鿣 Դϴ.
+	 *
+	 * @param device  ׷Ƚ API ȣ  鿣Դϴ.
+	 */
+	explicit CachedRenderBackend(std::unique_ptr<IRenderBackend> device);
+
+
+	/**
+	 * @brief  ĳ  鿣  ҸԴϴ.
+	 */
+	virtual ~CachedRenderBackend() {}
+
+
+	/**
+	 * @brief  ĳ  鿣  ڿ  ڸ  մϴ.
+	 */
+	DISALLOW_COPY_AND_ASSIGN(CachedRenderBackend);
+
+
+	virtual void BeginFrame(float red, float green, float blue, float alpha, float depth, uint8_t stencil) override;
+	virtual void EndFrame() override;
+	virtual bool GetScreenSize(int32_t& outWidth, int32_t& outHeight) override;
+	virtual void SetViewport(int32_t x, int32_t y, int32_t width, int32_t height) override;
+	virtual void SetVsyncMode(bool bIsEnable) override;
+	virtual void SetRenderState(const ERenderState& state, bool bIsEnable) override;
+	virtual bool GetRenderState(const ERenderState& state) override;
+	virtual uint32_t CreateBuffer(const EBufferType& type, const void* bufferPtr, uint32_t byteSize, const VertexBuffer::EUsage& usage) override;
+	virtual void DestroyBuffer(uint32_t bufferID) override;
+	virtual void BindBuffer(const EBufferType& type, uint32_t bufferID) override;
+	virtual void BindBufferBase(const EBufferType& type, uint32_t bindingIndex, uint32_t bufferID) override;
+	virtual void SetBufferData(const EBufferType& type, const void* bufferPtr, uint32_t byteSize, const VertexBuffer::EUsage& usage) override;
+	virtual void SetBufferSubData(const EBufferType& type, uint32_t byteOffset, const void* bufferPtr, uint32_t byteSize) override;
+	virtual void* MapBuffer(const EBufferType& type) override;
+	virtual void UnmapBuffer(const EBufferType& type) override;
+	virtual void* MapBufferPersistent(const EBufferType& type) override;
+	virtual uint64_t CreateFence() override;
+	virtual void WaitFence(uint64_t fence) override;
+	virtual void DestroyFence(uint64_t fence) override;
+	virtual uint32_t CreateVertexArray() override;
+	virtual void DestroyVertexArray(uint32_t vertexArrayID) override;
+	virtual void BindVertexArray(uint32_t vertexArrayID) override;
+	virtual void SetVertexAttribute(uint32_t location, uint32_t componentCount, uint32_t stride, uint32_t byteOffset) override;
+	virtual void EnableVertexAttribute(uint32_t location) override;
+	virtual void SetVertexAttributeDivisor(uint32_t location, uint32_t divisor) override;
+	virtual uint32_t CreateShader(const EShaderType& type, const std::string& source, std::string& outErrorLog) override;
+	virtual void DestroyShader(uint32_t shaderID) override;
+	virtual uint32_t CreateProgram(const std::vector<uint32_t>& shaderIDs, std::string& outErrorLog) override;
+	virtual void DestroyProgram(uint32_t programID) override;
+	virtual void BindProgram(uint32_t programID) override;
+	virtual int32_t GetUniformLocation(uint32_t programID, const std::string& name) override;
+	virtual void SetUniformInt(int32_t location, const int32_t* values, uint32_t componentCount) override;
+	virtual void SetUniformFloat(int32_t location, const float* values, uint32_t componentCount) override;
+	virtual void SetUniformMatrix(int32_t location, const float* values, uint32_t dimension) override;
+	virtual uint32_t CreateTexture2D(int32_t width, int32_t height) override;
+	virtual void DestroyTexture(uint32_t textureID) override;
+	virtual void BindTexture(uint32_t unit, uint32_t textureID) override;
+	virtual void BindImageTexture(uint32_t unit, uint32_t textureID) override;
+	virtual void DispatchCompute(uint32_t workGroupX, uint32_t workGroupY, uint32_t workGroupZ) override;
+	virtual void DrawVertex(const EDrawMode& drawMode, uint32_t vertexCount, uint32_t firstVertex) override;
+	virtual void DrawIndex(const EDrawMode& drawMode, uint32_t indexCount) override;
+	virtual void DrawVertexInstanced(const EDrawMode& drawMode, uint32_t vertexCount, uint32_t instanceCount, uint32_t firstInstance) override;
+	virtual void DrawIndexInstanced(const EDrawMode& drawMode, uint32_t indexCount, uint32_t instanceCount, uint32_t firstInstance) override;
+
+
+	/**
+	 * @brief  鿣 ¸     · ǵϴ.
+	 *
+	 * @note
+	 * -  ̷ û  Ǹ,   ϴ  ȣ  ٽ ˴ϴ.
+	 * - û     Ǵ    鿣忡 ޵˴ϴ.
+	 */
+	void Invalidate();
+
+
+	/**
+	 * @brief  ̷  , ̴ α׷,  迭    鿣忡 մϴ.
+	 */
+	void Flush();
+
+
+	/**
+	 * @brief  ׷Ƚ API ȣϴ  鿣带 ϴ.
+	 *
+	 * @return   鿣 ͸ ȯմϴ.
+	 */
+	IRenderBackend* GetDevice() const { return device_.get(); }
+
+
+	/**
+	 * @brief ϵ ȣ ī͸ ϴ.
+	 *
+	 * @return ϵ ȣ ī  ڸ ȯմϴ.
+	 */
+	const Counters& GetCounters() const { return counters_; }
+
+
+	/**
+	 * @brief ϵ ȣ ī͸  0 ʱȭմϴ.
+	 */
+	void ResetCounters() { counters_ = Counters(); }
+
+
+private:
+	/**
+	 * @brief  ¿ ϴ   ε ϴ.
+	 *
+	 * @param state  Դϴ.
+	 *
+	 * @return   ε ȯմϴ.
+	 */
+	static uint32_t GetRenderStateSlot(const ERenderState& state);
+
+
+	/**
+	 * @brief   ϴ   ε ϴ.
+	 *
+	 * @param type  Դϴ.
+	 *
+	 * @return   ε ȯմϴ.
+	 */
+	static uint32_t GetBufferSlot(const EBufferType& type);
+
+
+	/**
+	 * @brief  ϰ, ٲٸ true ȯմϴ. ٲ ʾҴٸ  ī͸ øϴ.
+	 *
+	 * @param shadow  Դϴ.
+	 * @param value   Դϴ.
+	 *
+	 * @return  鿣忡 ȣ ؾ ϸ true, ׷  false ȯմϴ.
+	 */
+	bool UpdateShadow(uint32_t& shadow, uint32_t value);
+
+
+	/**
+	 * @brief  ̷ Դϴ.
+	 */
+	struct DeferredState
+	{
+		uint32_t requested = UNKNOWN_STATE; //  û Դϴ.
+		uint32_t applied = UNKNOWN_STATE; //  鿣忡  Դϴ.
+		bool bIsDirty = false; // û    ʾҴ Ȯմϴ.
+	};
+
+
+	/**
+	 * @brief  û  մϴ.
+	 *
+	 * @param state û   Դϴ.
+	 * @param value û Դϴ.
+	 */
+	void RequestState(DeferredState& state, uint32_t value);
+
+
+	/**
+	 * @brief  û   Ϸ ǥϰ,  鿣忡 ؾ ϴ Ȯմϴ.
+	 *
+	 * @param state  Դϴ.
+	 *
+	 * @return  鿣忡 ȣ ؾ ϸ true, ׷  false ȯմϴ.
+	 */
+	bool ApplyState(DeferredState& state);
+
+
+	/**
+	 * @brief  ̷     鿣忡 մϴ.
+	 */
+	void FlushRenderStates();
+
+
+	/**
+	 * @brief  ̷ ̴ α׷ ε  鿣忡 մϴ.
+	 */
+	void FlushProgram();
+
+
+	/**
+	 * @brief  ̷  迭 ε  鿣忡 մϴ.
+	 *
+	 * @note ε  ε  迭 ̹Ƿ, ε ۸ ٷ ȣ⵵  ޼带  ȣմϴ.
+	 */
+	void FlushVertexArray();
+
+
+private:
+	/**
+	 * @brief       Ÿ Դϴ.
+	 */
+	static const uint32_t UNKNOWN_STATE = 0xFFFFFFFF;
+
+
+	/**
+	 * @brief ϴ   Դϴ.
+	 */
+	static const uint32_t RENDER_STATE_COUNT = 5;
+
+
+	/**
+	 * @brief ϴ   Դϴ.
+	 */
+	static const uint32_t BUFFER_TYPE_COUNT = 3;
+
+
+	/**
+	 * @brief ϴ ؽó ְ   ε  Դϴ. ̺ ū   ʰ ׻ մϴ.
+	 */
+	static const uint32_t MAX_BINDING_SLOT = 16;
+
+
+	/**
+	 * @brief  ׷Ƚ API ȣϴ  鿣Դϴ.
+	 */
+	std::unique_ptr<IRenderBackend> device_;
+
+
+	/**
+	 * @brief  º  ִ(1)  ִ(0)  Դϴ.
+	 */
+	std::array<DeferredState, RENDER_STATE_COUNT> renderStates_;
+
+
+	/**
+	 * @brief Ʈ X, Y, ,  Դϴ.
+	 */
+	std::array<int32_t, 4> viewport_;
+
+
+	/**
+	 * @brief Ʈ ϵǾ ִ Ȯմϴ.
+	 */
+	bool bIsViewportKnown_ = false;
+
+
+	/**
+	 * @brief ε ̴ α׷ IDԴϴ.
+	 */
+	DeferredState program_;
+
+
+	/**
+	 * @brief ε  迭 IDԴϴ.
+	 */
+	DeferredState vertexArray_;
+
+
+	/**
+	 * @brief   ε  IDԴϴ.
+	 *
+	 * @note ε  ε  迭 ̹Ƿ  鿣  迭 ٲ    ° ˴ϴ.
+	 */
+	std::array<uint32_t, BUFFER_TYPE_COUNT> buffers_;
+
+
+	/**
+	 * @brief   ε    IDԴϴ.
+	 */
+	std::array<uint32_t, MAX_BINDING_SLOT> uniformBindings_;
+
+
+	/**
+	 * @brief ؽó ֺ ε ؽó IDԴϴ.
+	 */
+	std::array<uint32_t, MAX_BINDING_SLOT> textures_;
+
+
+	/**
+	 * @brief ϵ ȣ īԴϴ.
+	 */
+	Counters counters_;
+};
\ No newline at end of file
@@ -0,0 +1,216 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+
+/**
+ * @brief OpenGL API ȣ  ˻ å մϴ.
+ *
+ * @note
+ * -  Ŭ    ޼  (static) ŸԴϴ.
+ * - GL_FAILED ũδ ȣ⸶ CheckCall ȣϰ,      CheckFrame ȣմϴ.
+ * - ׷Ƚ API Լ Լ ̺  ȣϹǷ ¥ Լ ̺ ٲ㼭 å   ֽϴ.
+ */
+class GLErrorCheck
+{
+public:
+	/**
+	 * @brief  ˻ åԴϴ.
+	 *
+	 * @note
+	 * - Off :  ˻ ʽϴ.
+	 * - PerFrame : ȣ ġ ϰ      ˻մϴ.  ߰ߵǸ PerCall ٲ  Ȯ ġ մϴ.
+	 * - PerCall : ȣ⸶ glGetError ˻մϴ. ̹ ȭǹǷ  ϴ.
+	 * - DebugCallback : KHR_debug ݹ  ް,  Ų ȣ  CheckCall ġ մϴ.   PerFrame ٲϴ.
+	 */
+	enum class EMode : int32_t
+	{
+		Off           = 0x00,
+		PerFrame      = 0x01,
+		PerCall       = 0x02,
+		DebugCallback = 0x03,
+	};
+
+
+	/**
+	 * @brief   ޽ ޹޴ ݹ Լ ŸԴϴ.
+	 *
+	 * @param type ޽ Դϴ. GL_DEBUG_TYPE_ERROR ޽  óմϴ.
+	 * @param message ޽ ڿԴϴ.
+	 */
+	using DebugMessageCallback = void(*)(uint32_t type, const char* message);
+
+
+	/**
+	 * @brief  ˻翡 ϴ ׷Ƚ API Լ ̺Դϴ.
+	 */
+	struct FunctionTable
+	{
+		uint32_t(*getError)() = nullptr; // glGetError մϴ.
+		bool(*enableDebugOutput)(DebugMessageCallback callback) = nullptr; //   Ѱ ݹ մϴ.   false ȯմϴ.
+		void(*disableDebugOutput)() = nullptr; //    ݹ մϴ.
+	};
+
+
+	/**
+	 * @brief  ˻簡 ϴ īԴϴ.
+	 */
+	struct Counters
+	{
+		uint64_t errorQueryCount = 0; // getError ȣ Դϴ.
+		uint64_t errorCount = 0; // ߰  Դϴ.
+	};
+
+
+public:
+	/**
+	 * @brief  ˻翡  Լ ̺ մϴ.
+	 *
+	 * @param functionTable  Լ ̺Դϴ.
+	 *
+	 * @note  å  Լ ̺ ٽ մϴ.
+	 */
+	static void SetFunctionTable(const FunctionTable& functionTable);
+
+
+	/**
+	 * @brief  ˻ å մϴ.
+	 *
+	 * @param mode   ˻ åԴϴ.
+	 */
+	static void SetMode(const EMode& mode);
+
+
+	/**
+	 * @brief   ˻ å ϴ.
+	 *
+	 * @return   ˻ å ȯմϴ.
+	 */
+	static EMode GetMode() { return mode; }
+
+
+	/**
+	 * @brief OpenGL API ȣ Ŀ ȣ ġ ޹޾ å °  ˻մϴ.
+	 *
+	 * @param file ȣ  ̸Դϴ.
+	 * @param line ȣ  ȣԴϴ.
+	 * @param expression ȣ ǥԴϴ.
+	 */
+	static void CheckCall(const char* file, int32_t line, const char* expression)
+	{
+		switch (mode)
+		{
+		case EMode::PerFrame:
+			lastFile = file;
+			lastLine = line;
+			lastExpression = expression;
+			break;
+
+		case EMode::PerCall:
+			QueryError(file, line, expression);
+			break;
+
+		case EMode::DebugCallback:
+			if (bIsPendingError)
+			{
+				ReportPendingError(file, line, expression);
+			}
+			break;
+
+		default:
+			break;
+		}
+	}
+
+
+	/**
+	 * @brief    å °  ˻մϴ.
+	 */
+	static void CheckFrame();
+
+
+	/**
+	 * @brief ϵ ī͸ ϴ.
+	 *
+	 * @return ϵ ī  ڸ ȯմϴ.
+	 */
+	static const Counters& GetCounters() { return counters; }
+
+
+	/**
+	 * @brief ϵ ī͸  0 ʱȭմϴ.
+	 */
+	static void ResetCounters() { counters = Counters(); }
+
+
+private:
+	/**
+	 * @brief getError    ,   ־ ġ մϴ.
+	 *
+	 * @param file   ̸Դϴ.
+	 * @param line   ȣԴϴ.
+	 * @param expression  ȣ ǥԴϴ.
+	 *
+	 * @return  ־ٸ true, ׷  false ȯմϴ.
+	 */
+	static bool QueryError(const char* file, int32_t line, const char* expression);
+
+
+	/**
+	 * @brief   ݹ   ־ ġ մϴ.
+	 *
+	 * @param file   ̸Դϴ.
+	 * @param line   ȣԴϴ.
+	 * @param expression  ȣ ǥԴϴ.
+	 */
+	static void ReportPendingError(const char* file, int32_t line, const char* expression);
+
+
+	/**
+	 * @brief   ޽ ޹޽ϴ.
+	 *
+	 * @param type ޽ Դϴ.
+	 * @param message ޽ ڿԴϴ.
+	 */
+	static void OnDebugMessage(uint32_t type, const char* message);
+
+
+private:
+	/**
+	 * @brief   ˻ åԴϴ.
+	 */
+	static EMode mode;
+
+
+	/**
+	 * @brief  ˻翡 ϴ Լ ̺Դϴ.
+	 */
+	static FunctionTable functionTable;
+
+
+	/**
+	 * @brief PerFrame å   ȣ ġԴϴ.
+	 */
+	static const char* lastFile;
+	static int32_t lastLine;
+	static const char* lastExpression;
+
+
+	/**
+	 * @brief DebugCallback å  ġ    ִ Ȯմϴ.
+	 */
+	static bool bIsPendingError;
+
+
+	/**
+	 * @brief DebugCallback å  ġ    ޽Դϴ.
+	 */
+	static std::string pendingMessage;
+
+
+	/**
+	 * @brief ϵ īԴϴ.
+	 */
+	static Counters counters;
+};
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <array>
+#include <memory>
 #include <vector>
 
 #include "RenderModule.h"
@@ -14,6 +15,35 @@
  */
 class GeometryRenderer3D : public Shader
 {
+public:
+	/**
+	 * @brief 3D ⺻   ׸ Դϴ.
+	 */
+	enum class EMode : int32_t
+	{
+		Immediate = 0x00, // ׸ Լ ȣ   εϰ ׸ϴ.
+		Batched   = 0x01, //    Ҵٰ     εϰ ׸ϴ.    ĸ  νϽ ׸ϴ.
+	};
+
+
+	/**
+	 * @brief 3D ⺻    Դϴ.
+	 */
+	struct Stats
+	{
+		uint32_t primitiveCount = 0; // ׸ Լ ȣ ȽԴϴ.
+		uint32_t vertexCount = 0; // ׸ Լ ޵  Դϴ.
+		uint32_t flushCount = 0; //   ε ȽԴϴ.
+		uint32_t drawCallCount = 0; //  鿣忡 û ׸ ȣ Դϴ.
+	};
+
+
+	/**
+	 * @brief (retained)  ȿ  ڵ Դϴ.
+	 */
+	static const uint32_t INVALID_RETAINED = 0;
+
+
 public:
 	/**
 	 * @brief 3D ⺻  ׸  Ʈ Դϴ.
@@ -42,19 +72,39 @@ public:
 
 
 	/**
-	 * @brief    մϴ.
-	 * 
-	 * @param view   Դϴ.
+	 * @brief  ׸  մϴ.
+	 *
+	 * @param mode  ׸ Դϴ.
+	 *
+	 * @note ġ 忡   ٲٸ ׶    ׸ϴ.
 	 */
-	void SetView(const Mat4x4& view) { view_ = view; }
+	void SetMode(const EMode& mode);
 
 
 	/**
-	 * @brief    մϴ.
-	 * 
-	 * @param projection   Դϴ.
+	 * @brief  ׸  ϴ.
+	 *
+	 * @return  ׸  ȯմϴ.
+	 */
+	EMode GetMode() const { return mode_; }
+
+
+	/**
+	 * @brief ġ 忡   εϰ ׸ 庰   ׸ϴ.
+	 *
+	 * @note
+	 * -   EndFrame ڵ ȣ˴ϴ.  ߰ ׸      ȣմϴ.
+	 * -  忡 ƹ ۵  ʽϴ.
 	 */
-	void SetProjection(const Mat4x4& projection) { projection_ = projection; }
+	void Flush();
+
+
+	/**
+	 * @brief   踦 ϴ.
+	 *
+	 * @return   踦 ȯմϴ.
+	 */
+	const Stats& GetFrameStats() const { return frameStats_; }
 
 
 	/**
@@ -139,7 +189,116 @@ public:
 	void DrawGrid3D(const Vec3f& extensions, float stride);
 
 
+	/**
+	 * @brief 3D ť긦  ۿ   ϰ   ڵ ϴ.
+	 *
+	 * @param extents ť X/Y/Z   ũԴϴ.
+	 * @param color ť Դϴ.
+	 *
+	 * @return    ڵ ȯմϴ.
+	 */
+	uint32_t CreateRetainedCube3D(const Vec3f& extents, const Vec4f& color);
+
+
+	/**
+	 * @brief 3D   ۿ   ϰ   ڵ ϴ.
+	 *
+	 * @param radius   Դϴ.
+	 * @param color  Դϴ.
+	 *
+	 * @return    ڵ ȯմϴ.
+	 */
+	uint32_t CreateRetainedSphere3D(float radius, const Vec4f& color);
+
+
+	/**
+	 * @brief ڸ  ۿ   ϰ   ڵ ϴ.
+	 *
+	 * @param extensions  XYZ  ũԴϴ.
+	 * @param stride  Դϴ.
+	 *
+	 * @return    ڵ ȯմϴ.
+	 */
+	uint32_t CreateRetainedGrid3D(const Vec3f& extensions, float stride);
+
+
+	/**
+	 * @brief   ׸ϴ.
+	 *
+	 * @param handle ׸   ڵԴϴ.
+	 * @param world  Դϴ.
+	 *
+	 * @note  ٽ ϰų ε ʽϴ. ġ 忡  ĸ Ҵٰ, Flush   νϽ ׸   ׸ϴ.
+	 */
+	void DrawRetained(uint32_t handle, const Mat4x4& world);
+
+
+	/**
+	 * @brief   մϴ.
+	 *
+	 * @param handle    ڵԴϴ.
+	 *
+	 * @note  Ű ٲ  ڵ ϰ  ؾ մϴ.
+	 */
+	void DestroyRetained(uint32_t handle);
+
+
 private:
+	/**
+	 * @brief 3D ť   Ͽ մϴ.
+	 *
+	 * @param extents ť X/Y/Z   ũԴϴ.
+	 * @param color ť Դϴ.
+	 *
+	 * @return    ȯմϴ.
+	 */
+	uint32_t BuildCube3D(const Vec3f& extents, const Vec4f& color);
+
+
+	/**
+	 * @brief 3D    Ͽ մϴ.
+	 *
+	 * @param radius   Դϴ.
+	 * @param color  Դϴ.
+	 *
+	 * @return    ȯմϴ.
+	 */
+	uint32_t BuildSphere3D(float radius, const Vec4f& color);
+
+
+	/**
+	 * @brief    Ͽ մϴ.
+	 *
+	 * @param extensions  XYZ  ũԴϴ.
+	 * @param stride  Դϴ.
+	 *
+	 * @return    ȯմϴ.
+	 */
+	uint32_t BuildGrid3D(const Vec3f& extensions, float stride);
+
+
+	/**
+	 * @brief      մϴ.
+	 *
+	 * @param drawMode ׸ ŸԴϴ.
+	 * @param vertexCount  Դϴ.
+	 *
+	 * @return    ڵ ȯմϴ.
+	 */
+	uint32_t CreateRetained(const EDrawMode& drawMode, uint32_t vertexCount);
+
+
+	/**
+	 * @brief 󺰷 ĳ  ũ   ϴ. ĳð   INVALID_RETAINED ȯմϴ.
+	 *
+	 * @param cache    ĳԴϴ.
+	 * @param color  Դϴ.
+	 * @param bIsSphere ̸ true, ť̸ falseԴϴ.
+	 *
+	 * @return ĳ   ڵ ȯմϴ.
+	 */
+	uint32_t GetUnitShape(std::vector<std::pair<Vec4f, uint32_t>>& cache, const Vec4f& color, bool bIsSphere);
+
 	/**
 	 * @brief 3D ⺻  ׸⸦ մϴ.
 	 * 
@@ -149,7 +308,100 @@ private:
 	void DrawGeometry3D(const EDrawMode& drawMode, uint32_t vertexCount);
 
 
+	/**
+	 * @brief  迭 εϰ  ׸⸦ մϴ.
+	 *
+	 * @param drawMode ׸ ŸԴϴ.
+	 * @param vertexArrayObject ׸  迭Դϴ.
+	 * @param vertexCount  Դϴ.
+	 * @param firstVertex ù °  εԴϴ.
+	 */
+	void DrawVertexArray(const EDrawMode& drawMode, uint32_t vertexArrayObject, uint32_t vertexCount, uint32_t firstVertex);
+
+
+	/**
+	 * @brief    ķ ȯ ġ ߰մϴ.
+	 *
+	 * @param drawMode ׸ ŸԴϴ.
+	 * @param vertices ߰  Դϴ.
+	 * @param vertexCount  Դϴ.
+	 *
+	 * @note  (LineStrip)  (Lines) Ǯ ߰մϴ.
+	 */
+	void AppendBatch(const EDrawMode& drawMode, const VertexPositionColor3D* vertices, uint32_t vertexCount);
+
+
+	/**
+	 * @brief ġ 忡      νϽ ׸   ׸ϴ.
+	 *
+	 * @note   νϽ Ӽ ۿ , MAX_INSTANCE_SIZE  ׸ϴ.
+	 */
+	void FlushRetained();
+
+
+	/**
+	 * @brief ġ  ۰      ֵ ũ⸦ øϴ.
+	 *
+	 * @param vertexCount ƾ   Դϴ.
+	 */
+	void ReserveBatchBuffer(uint32_t vertexCount);
+
+
+	/**
+	 * @brief    踦 մϴ.
+	 */
+	void EndFrame();
+
+
 private:
+	/**
+	 * @brief ġ ׸  Դϴ.
+	 */
+	enum class EBatch : int32_t
+	{
+		Points = 0x00,
+		Lines  = 0x01,
+		Count  = 0x02,
+	};
+
+
+	/**
+	 * @brief ġ ׸  Դϴ.
+	 */
+	static const uint32_t BATCH_COUNT = static_cast<uint32_t>(EBatch::Count);
+
+
+	/**
+	 * @brief  Դϴ.
+	 */
+	struct RetainedGeometry
+	{
+		EDrawMode drawMode = EDrawMode::None; // ׸ ŸԴϴ. None̸  ִ Դϴ.
+		uint32_t vertexCount = 0; //  Դϴ.
+		std::unique_ptr<VertexBuffer> vertexBuffer; //    ε   Դϴ.
+		uint32_t vertexArrayObject = 0; //   ۿ νϽ Ӽ ۸ ϴ  迭Դϴ.
+		std::vector<Mat4x4> batchWorlds; // ġ 忡 ̹ ӿ    Դϴ.   ޸𸮸 մϴ.
+	};
+
+
+	/**
+	 * @brief 󺰷 ĳ   ִ Դϴ.
+	 */
+	static const uint32_t MAX_UNIT_SHAPE_SIZE = 16;
+
+
+	/**
+	 * @brief   νϽ ׸⿡ ׸  ִ ִ νϽ Դϴ.
+	 */
+	static const uint32_t MAX_INSTANCE_SIZE = 4096;
+
+
+	/**
+	 * @brief    νϽ Ӽ ù ° ġԴϴ. mat4   ġ մϴ.
+	 */
+	static const uint32_t INSTANCE_WORLD_LOCATION = 2;
+
+
 	/**
 	 * @brief    ִ ũԴϴ.
 	 */
@@ -169,21 +421,21 @@ private:
 
 
 	/**
-	 * @brief   Դϴ.
+	 * @brief  ũԴϴ.
 	 */
-	Mat4x4 view_;
+	float pointSize_ = 1.0f;
 
 
 	/**
-	 * @brief   Դϴ.
+	 * @brief ̴     ġԴϴ.
 	 */
-	Mat4x4 projection_;
+	int32_t worldLocation_ = -1;
 
 
 	/**
-	 * @brief  ũԴϴ.
+	 * @brief ̴  ũ   ġԴϴ.
 	 */
-	float pointSize_ = 1.0f;
+	int32_t pointSizeLocation_ = -1;
 
 
 	/**
@@ -193,7 +445,109 @@ private:
 
 
 	/**
-	 * @brief  Դϴ.
+	 * @brief  忡 ϴ  Դϴ.
+	 *
+	 * @note StreamRing ̹Ƿ ׸⸶  ϴ  , ȯ ù °  ε ׸ϴ.
 	 */
 	VertexBuffer vertexBuffer_;
+
+
+	/**
+	 * @brief  ׸ Դϴ.
+	 */
+	EMode mode_ = EMode::Immediate;
+
+
+	/**
+	 * @brief ġ ׸ 庰     Դϴ.
+	 */
+	std::array<std::vector<VertexPositionColor3D>, BATCH_COUNT> batchVertices_;
+
+
+	/**
+	 * @brief ġ ׸ 庰 ̹ ӿ   Դϴ.
+	 *
+	 * @note Flush   0 ǵ   ũ ϹǷ, Ӹ   ٽ äų ø ʽϴ.
+	 */
+	std::array<uint32_t, BATCH_COUNT> batchVertexCounts_ = {};
+
+
+	/**
+	 * @brief ġ 忡 ̹ ӿ      ڵ Դϴ.
+	 */
+	std::vector<uint32_t> batchRetained_;
+
+
+	/**
+	 * @brief ġ 忡   νϽ  ķ ׸ ̴Դϴ.
+	 */
+	std::unique_ptr<Shader> instancedShader_;
+
+
+	/**
+	 * @brief νϽ     Դϴ.
+	 */
+	std::unique_ptr<VertexBuffer> instanceBuffer_;
+
+
+	/**
+	 * @brief ġ ׸  ũԴϴ.
+	 *
+	 * @note   Flush ȿ    ũ⸦   մϴ.
+	 */
+	float batchPointSize_ = 1.0f;
+
+
+	/**
+	 * @brief ġ    ƮԴϴ.
+	 */
+	uint32_t batchVertexArrayObject_ = 0;
+
+
+	/**
+	 * @brief ġ  Դϴ.    뷮   辿 øϴ.
+	 */
+	std::unique_ptr<VertexBuffer> batchVertexBuffer_;
+
+
+	/**
+	 * @brief ġ  ۰   ִ  Դϴ.
+	 */
+	uint32_t batchVertexCapacity_ = 0;
+
+
+	/**
+	 * @brief   Դϴ. ڵ  ε 1  Դϴ.
+	 */
+	std::vector<RetainedGeometry> retained_;
+
+
+	/**
+	 * @brief   ִ    ε Դϴ.
+	 */
+	std::vector<uint32_t> freeRetained_;
+
+
+	/**
+	 * @brief DrawCube3D ϴ   ť ĳԴϴ.
+	 */
+	std::vector<std::pair<Vec4f, uint32_t>> unitCubes_;
+
+
+	/**
+	 * @brief DrawSphere3D ϴ    ĳԴϴ.
+	 */
+	std::vector<std::pair<Vec4f, uint32_t>> unitSpheres_;
+
+
+	/**
+	 * @brief   Դϴ.
+	 */
+	Stats currentStats_;
+
+
+	/**
+	 * @brief   Դϴ.
+	 */
+	Stats frameStats_;
 };
\ No newline at end of file
@@ -0,0 +1,510 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "IResource.h"
+#include "VertexBuffer.h"
+
+
+/**
+ * @brief ⺻  ׸ Դϴ.
+ */
+enum class EDrawMode : int32_t
+{
+	Points      = 0x0000,
+	Lines       = 0x0001,
+	LineStrip   = 0x0003,
+	Triangles   = 0x0004,
+	TriangleFan = 0x0006,
+	None        = 0xFFFF,
+};
+
+
+/**
+ * @brief  鿣  Դϴ.
+ */
+enum class EBufferType : int32_t
+{
+	Vertex  = 0x8892,
+	Index   = 0x8893,
+	Uniform = 0x8A11,
+};
+
+
+/**
+ * @brief  鿣忡 Ѱ   ִ  Դϴ.
+ */
+enum class ERenderState : int32_t
+{
+	Depth       = 0x0B71,
+	Stencil     = 0x0B90,
+	AlphaBlend  = 0x0BE2,
+	Multisample = 0x809D,
+	PointSize   = 0x8642,
+};
+
+
+/**
+ * @brief  鿣 ̴ Դϴ.
+ */
+enum class EShaderType : int32_t
+{
+	Vertex     = 0x8B31,
+	Control    = 0x8E88,
+	Evaluation = 0x8E87,
+	Geometry   = 0x8DD9,
+	Fragment   = 0x8B30,
+	Compute    = 0x91B9,
+};
+
+
+/**
+ * @brief    ҽ ׷Ƚ API ȣ  ϴ  鿣 ̽Դϴ.
+ *
+ * @note
+ * -     ҽ ׷Ƚ API  ȣ ʰ  ̽  ȣմϴ.
+ * -   OpenGL  ϴ. Ʈ ID 0̸ ȿ  ƮԴϴ.
+ * - ,  迭, α׷ ε OpenGL    Ģ ϴ.
+ */
+class IRenderBackend
+{
+public:
+	/**
+	 * @brief  鿣 Ʈ Դϴ.
+	 */
+	IRenderBackend() = default;
+
+
+	/**
+	 * @brief  鿣  ҸԴϴ.
+	 */
+	virtual ~IRenderBackend() {}
+
+
+	/**
+	 * @brief  鿣  ڿ  ڸ  մϴ.
+	 */
+	DISALLOW_COPY_AND_ASSIGN(IRenderBackend);
+
+
+	/**
+	 * @brief   ϰ , , ٽ ۸ ʱȭմϴ.
+	 *
+	 * @param red   R Դϴ.
+	 * @param green   G Դϴ.
+	 * @param blue   B Դϴ.
+	 * @param alpha   A Դϴ.
+	 * @param depth   ʱȭ Դϴ.
+	 * @param stencil ٽ  ʱȭ Դϴ.
+	 */
+	virtual void BeginFrame(float red, float green, float blue, float alpha, float depth, uint8_t stencil) = 0;
+
+
+	/**
+	 * @brief    ۸ ȭ鿡 ǥմϴ.
+	 */
+	virtual void EndFrame() = 0;
+
+
+	/**
+	 * @brief   ũ⸦ ϴ.
+	 *
+	 * @param outWidth    ũԴϴ.
+	 * @param outHeight    ũԴϴ.
+	 *
+	 * @return ũ⸦   ϸ true, ׷  false ȯմϴ.
+	 */
+	virtual bool GetScreenSize(int32_t& outWidth, int32_t& outHeight) = 0;
+
+
+	/**
+	 * @brief  Ʈ մϴ.
+	 *
+	 * @param x Ʈ 簢  Ʒ 𼭸(ȼ)Դϴ.
+	 * @param y Ʈ 簢  Ʒ 𼭸(ȼ)Դϴ.
+	 * @param width Ʈ ʺԴϴ.
+	 * @param height Ʈ Դϴ.
+	 */
+	virtual void SetViewport(int32_t x, int32_t y, int32_t width, int32_t height) = 0;
+
+
+	/**
+	 * @brief  ȭ ɼ մϴ.
+	 *
+	 * @param bIsEnable  ȭ ɼ ȰȭϷ true, ȰȭϷ falseԴϴ.
+	 */
+	virtual void SetVsyncMode(bool bIsEnable) = 0;
+
+
+	/**
+	 * @brief  ¸ Ѱų ϴ.
+	 *
+	 * @param state   Դϴ.
+	 * @param bIsEnable  ¸ ȰȭϷ true, ȰȭϷ falseԴϴ.
+	 *
+	 * @note   Ѹ  Լ (SRC_ALPHA, ONE_MINUS_SRC_ALPHA, ONE, ZERO) ˴ϴ.
+	 */
+	virtual void SetRenderState(const ERenderState& state, bool bIsEnable) = 0;
+
+
+	/**
+	 * @brief  °  ִ Ȯմϴ.
+	 *
+	 * @param state Ȯ  Դϴ.
+	 *
+	 * @return  °  ִٸ true, ׷  false ȯմϴ.
+	 */
+	virtual bool GetRenderState(const ERenderState& state) = 0;
+
+
+	/**
+	 * @brief ۸ ϰ ͸ ϴ.
+	 *
+	 * @param type  Դϴ.
+	 * @param bufferPtr ʱȭ  Դϴ. nullptr̸  Ҵմϴ.
+	 * @param byteSize  Ʈ ũԴϴ.
+	 * @param usage   Դϴ.
+	 *
+	 * @return   ID ȯմϴ.
+	 *
+	 * @note
+	 * -  ۴ type ε · ϴ.  迭 ε ۸    Ģ մϴ.
+	 * -   StreamRing̸ ũ⸦ ٲ        Ҵմϴ.
+	 */
+	virtual uint32_t CreateBuffer(const EBufferType& type, const void* bufferPtr, uint32_t byteSize, const VertexBuffer::EUsage& usage) = 0;
+
+
+	/**
+	 * @brief ۸ մϴ.
+	 *
+	 * @param bufferID   IDԴϴ.
+	 */
+	virtual void DestroyBuffer(uint32_t bufferID) = 0;
+
+
+	/**
+	 * @brief ۸ εմϴ.
+	 *
+	 * @param type ε  Դϴ.
+	 * @param bufferID ε  IDԴϴ. 0̸ ε մϴ.
+	 */
+	virtual void BindBuffer(const EBufferType& type, uint32_t bufferID) = 0;
+
+
+	/**
+	 * @brief ۸ ̴ ϴ ε ε  մϴ.
+	 *
+	 * @param type   Դϴ.
+	 * @param bindingIndex ̴ binding ڷ  ε Դϴ.
+	 * @param bufferID   IDԴϴ.
+	 */
+	virtual void BindBufferBase(const EBufferType& type, uint32_t bindingIndex, uint32_t bufferID) = 0;
+
+
+	/**
+	 * @brief ε     Ҵϰ ͸ ϴ.
+	 *
+	 * @param type ͸   Դϴ.
+	 * @param bufferPtr ۿ   Դϴ.
+	 * @param byteSize ۿ   ũԴϴ.
+	 * @param usage   Դϴ.
+	 */
+	virtual void SetBufferData(const EBufferType& type, const void* bufferPtr, uint32_t byteSize, const VertexBuffer::EUsage& usage) = 0;
+
+
+	/**
+	 * @brief ε  Ϻ  ͸ ϴ.
+	 *
+	 * @param type ͸   Դϴ.
+	 * @param byteOffset ͸   Ʈ Դϴ.
+	 * @param bufferPtr ۿ   Դϴ.
+	 * @param byteSize ۿ   ũԴϴ.
+	 */
+	virtual void SetBufferSubData(const EBufferType& type, uint32_t byteOffset, const void* bufferPtr, uint32_t byteSize) = 0;
+
+
+	/**
+	 * @brief ε ۸   մϴ.
+	 *
+	 * @param type   Դϴ.
+	 *
+	 * @return ε  ͸ ȯմϴ. ο ϸ nullptr ȯմϴ.
+	 */
+	virtual void* MapBuffer(const EBufferType& type) = 0;
+
+
+	/**
+	 * @brief ε   մϴ.
+	 *
+	 * @param type    Դϴ.
+	 */
+	virtual void UnmapBuffer(const EBufferType& type) = 0;
+
+
+	/**
+	 * @brief StreamRing   ε  ü    մϴ.
+	 *
+	 * @param type   Դϴ.
+	 *
+	 * @return ε  ͸ ȯմϴ. ο ϸ nullptr ȯմϴ.
+	 *
+	 * @note  ۸   Ǹ, ε Ϳ  ʹ  ε  GPU Դϴ.
+	 */
+	virtual void* MapBufferPersistent(const EBufferType& type) = 0;
+
+
+	/**
+	 * @brief ݱ  GPU  ڿ 潺 ġմϴ.
+	 *
+	 * @return ġ 潺 ڵ ȯմϴ.
+	 */
+	virtual uint64_t CreateFence() = 0;
+
+
+	/**
+	 * @brief 潺  GPU     մϴ.
+	 *
+	 * @param fence  潺 ڵԴϴ.
+	 */
+	virtual void WaitFence(uint64_t fence) = 0;
+
+
+	/**
+	 * @brief 潺 մϴ.
+	 *
+	 * @param fence  潺 ڵԴϴ.
+	 */
+	virtual void DestroyFence(uint64_t fence) = 0;
+
+
+	/**
+	 * @brief  迭 մϴ.
+	 *
+	 * @return   迭 ID ȯմϴ.
+	 */
+	virtual uint32_t CreateVertexArray() = 0;
+
+
+	/**
+	 * @brief  迭 մϴ.
+	 *
+	 * @param vertexArrayID   迭 IDԴϴ.
+	 */
+	virtual void DestroyVertexArray(uint32_t vertexArrayID) = 0;
+
+
+	/**
+	 * @brief  迭 εմϴ.
+	 *
+	 * @param vertexArrayID ε  迭 IDԴϴ. 0̸ ε մϴ.
+	 */
+	virtual void BindVertexArray(uint32_t vertexArrayID) = 0;
+
+
+	/**
+	 * @brief ε   float Ÿ  Ӽ մϴ.
+	 *
+	 * @param location  Ӽ ġԴϴ.
+	 * @param componentCount  Ӽ  Դϴ.
+	 * @param stride  ϳ Ʈ ũԴϴ.
+	 * @param byteOffset  ȿ  Ӽ Ʈ Դϴ.
+	 */
+	virtual void SetVertexAttribute(uint32_t location, uint32_t componentCount, uint32_t stride, uint32_t byteOffset) = 0;
+
+
+	/**
+	 * @brief  Ӽ Ȱȭմϴ.
+	 *
+	 * @param location Ȱȭ  Ӽ ġԴϴ.
+	 */
+	virtual void EnableVertexAttribute(uint32_t location) = 0;
+
+
+	/**
+	 * @brief  Ӽ   νϽ   Ѿ մϴ.
+	 *
+	 * @param location  Ӽ ġԴϴ.
+	 * @param divisor   Ѿ νϽ Դϴ. 0̸  Ѿϴ.
+	 */
+	virtual void SetVertexAttributeDivisor(uint32_t location, uint32_t divisor) = 0;
+
+
+	/**
+	 * @brief ̴ մϴ.
+	 *
+	 * @param type ̴ Դϴ.
+	 * @param source ̴ ҽ ڵԴϴ.
+	 * @param outErrorLog Ͽ    αԴϴ.
+	 *
+	 * @return ϵ ̴ ID ȯմϴ. Ͽ ϸ 0 ȯմϴ.
+	 */
+	virtual uint32_t CreateShader(const EShaderType& type, const std::string& source, std::string& outErrorLog) = 0;
+
+
+	/**
+	 * @brief ̴ մϴ.
+	 *
+	 * @param shaderID  ̴ IDԴϴ.
+	 */
+	virtual void DestroyShader(uint32_t shaderID) = 0;
+
+
+	/**
+	 * @brief ̴  ̴ α׷ մϴ.
+	 *
+	 * @param shaderIDs ̴ α׷ ߰ ̴ ID Դϴ.
+	 * @param outErrorLog ῡ    αԴϴ.
+	 *
+	 * @return  ̴ α׷ ID ȯմϴ. ῡ ϸ 0 ȯմϴ.
+	 */
+	virtual uint32_t CreateProgram(const std::vector<uint32_t>& shaderIDs, std::string& outErrorLog) = 0;
+
+
+	/**
+	 * @brief ̴ α׷ մϴ.
+	 *
+	 * @param programID  ̴ α׷ IDԴϴ.
+	 */
+	virtual void DestroyProgram(uint32_t programID) = 0;
+
+
+	/**
+	 * @brief ̴ α׷ εմϴ.
+	 *
+	 * @param programID ε ̴ α׷ IDԴϴ. 0̸ ε մϴ.
+	 */
+	virtual void BindProgram(uint32_t programID) = 0;
+
+
+	/**
+	 * @brief ̴ α׷    ġ ϴ.
+	 *
+	 * @param programID ̴ α׷ IDԴϴ.
+	 * @param name   ̸Դϴ.
+	 *
+	 * @return   ġ ȯմϴ. ã ϸ -1 ȯմϴ.
+	 */
+	virtual int32_t GetUniformLocation(uint32_t programID, const std::string& name) = 0;
+
+
+	/**
+	 * @brief ε ̴ α׷     մϴ.
+	 *
+	 * @param location   ġԴϴ.
+	 * @param values   Դϴ.
+	 * @param componentCount   Դϴ. 1 ̻ 4 Դϴ.
+	 */
+	virtual void SetUniformInt(int32_t location, const int32_t* values, uint32_t componentCount) = 0;
+
+
+	/**
+	 * @brief ε ̴ α׷ Ǽ    մϴ.
+	 *
+	 * @param location   ġԴϴ.
+	 * @param values   Դϴ.
+	 * @param componentCount   Դϴ. 1 ̻ 4 Դϴ.
+	 */
+	virtual void SetUniformFloat(int32_t location, const float* values, uint32_t componentCount) = 0;
+
+
+	/**
+	 * @brief ε ̴ α׷     մϴ.
+	 *
+	 * @param location   ġԴϴ.
+	 * @param values    Դϴ.
+	 * @param dimension  Դϴ. 2 ̻ 4 Դϴ.
+	 */
+	virtual void SetUniformMatrix(int32_t location, const float* values, uint32_t dimension) = 0;
+
+
+	/**
+	 * @brief RGBA32F  2D ؽó մϴ.
+	 *
+	 * @param width ؽó  ũԴϴ.
+	 * @param height ؽó  ũԴϴ.
+	 *
+	 * @return  ؽó ID ȯմϴ.
+	 *
+	 * @note ؽó ͸  ͸, ǥ   CLAMP_TO_EDGEԴϴ.
+	 */
+	virtual uint32_t CreateTexture2D(int32_t width, int32_t height) = 0;
+
+
+	/**
+	 * @brief ؽó մϴ.
+	 *
+	 * @param textureID  ؽó IDԴϴ.
+	 */
+	virtual void DestroyTexture(uint32_t textureID) = 0;
+
+
+	/**
+	 * @brief ؽó ؽó ֿ εմϴ.
+	 *
+	 * @param unit ε ؽó Դϴ.
+	 * @param textureID ε ؽó IDԴϴ.
+	 */
+	virtual void BindTexture(uint32_t unit, uint32_t textureID) = 0;
+
+
+	/**
+	 * @brief ؽó   ̹ ֿ εմϴ.
+	 *
+	 * @param unit ε ̹ Դϴ.
+	 * @param textureID ε ؽó IDԴϴ.
+	 */
+	virtual void BindImageTexture(uint32_t unit, uint32_t textureID) = 0;
+
+
+	/**
+	 * @brief ε ǻƮ ̴ մϴ.
+	 *
+	 * @param workGroupX X ۾ ׷ Դϴ.
+	 * @param workGroupY Y ۾ ׷ Դϴ.
+	 * @param workGroupZ Z ۾ ׷ Դϴ.
+	 */
+	virtual void DispatchCompute(uint32_t workGroupX, uint32_t workGroupY, uint32_t workGroupZ) = 0;
+
+
+	/**
+	 * @brief ε  迭  ׸⸦ մϴ.
+	 *
+	 * @param drawMode ׸ Դϴ.
+	 * @param vertexCount ׸     Դϴ.
+	 * @param firstVertex ׸    ù °  εԴϴ.
+	 */
+	virtual void DrawVertex(const EDrawMode& drawMode, uint32_t vertexCount, uint32_t firstVertex) = 0;
+
+
+	/**
+	 * @brief ε  迭 ε ۷ ׸⸦ մϴ.
+	 *
+	 * @param drawMode ׸ Դϴ.
+	 * @param indexCount ׸    ε Դϴ.
+	 */
+	virtual void DrawIndex(const EDrawMode& drawMode, uint32_t indexCount) = 0;
+
+
+	/**
+	 * @brief ε  迭   νϽ   ׸ϴ.
+	 *
+	 * @param drawMode ׸ Դϴ.
+	 * @param vertexCount νϽ ϳ ׸    Դϴ.
+	 * @param instanceCount ׸ νϽ Դϴ.
+	 * @param firstInstance νϽ Ӽ  ù ° νϽ εԴϴ.
+	 */
+	virtual void DrawVertexInstanced(const EDrawMode& drawMode, uint32_t vertexCount, uint32_t instanceCount, uint32_t firstInstance) = 0;
+
+
+	/**
+	 * @brief ε  迭 ε ۷  νϽ   ׸ϴ.
+	 *
+	 * @param drawMode ׸ Դϴ.
+	 * @param indexCount νϽ ϳ ׸   ε Դϴ.
+	 * @param instanceCount ׸ νϽ Դϴ.
+	 * @param firstInstance νϽ Ӽ  ù ° νϽ εԴϴ.
+	 */
+	virtual void DrawIndexInstanced(const EDrawMode& drawMode, uint32_t indexCount, uint32_t instanceCount, uint32_t firstInstance) = 0;
+};
\ No newline at end of file
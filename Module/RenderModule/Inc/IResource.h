@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstdint>
+
 
 /**
  * @brief Ÿ(Ŭ Ȥ ü)     ڸ  ϵ մϴ.
@@ -17,6 +19,13 @@ TypeName& operator=(const TypeName) = delete;
 #endif
 
 
+/**
+ * @brief ҽ Ǯ ̽ ҽ Ǯ Ŭ  Դϴ.
+ */
+class IResourcePool;
+template <typename TResource> class ResourcePool;
+
+
 /**
  * @brief   ҽ ̽Դϴ.
  * 
@@ -64,6 +73,41 @@ public:
 	bool IsInitialized() const { return bIsInitialized_; }
 
 
+	/**
+	 * @brief ҽ  Ǯ ϴ.
+	 *
+	 * @return ҽ  Ǯ ͸ ȯմϴ. Ǯ ۿ  ҽ nullptr ȯմϴ.
+	 */
+	IResourcePool* GetPool() const { return pool_; }
+
+
+	/**
+	 * @brief Ǯ ȿ ҽ Ű ڵ ID ϴ.
+	 *
+	 * @return ҽ ڵ ID ȯմϴ. Ǯ ۿ  ҽ 0 ȯմϴ.
+	 */
+	uint32_t GetPoolHandleID() const { return poolHandleID_; }
+
+
+private:
+	/**
+	 * @brief ҽ Ǯ ҽ   Ǯ ڵ ID   ֵ մϴ.
+	 */
+	template <typename TResource> friend class ResourcePool;
+
+
+	/**
+	 * @brief ҽ  ǮԴϴ.
+	 */
+	IResourcePool* pool_ = nullptr;
+
+
+	/**
+	 * @brief Ǯ ȿ ҽ Ű ڵ IDԴϴ.
+	 */
+	uint32_t poolHandleID_ = 0;
+
+
 protected:
 	/**
 	 * @brief ҽ ʱȭǾ Ȯմϴ.
@@ -1,16 +1,20 @@
 #pragma once
 
 #include <array>
+#include <memory>
 #include <vector>
 
 #include "RenderModule.h"
 #include "Shader.h"
 #include "Vertex3D.h"
 #include "StaticMesh.h"
+#include "VertexBuffer.h"
 
 
 /**
  * @brief ޽ø ϴ Դϴ.
+ *
+ * @note DrawMesh ٷ ׸ ʰ ޽ÿ ؽó  ȣⳢ Ҵٰ, Flush ׷츶 νϽ   ׸ϴ.
  */
 class MeshRenderer : public Shader
 {
@@ -42,40 +46,96 @@ public:
 
 
 	/**
-	 * @brief    մϴ.
+	 * @brief 3D ޽ø ׸ϴ.
+	 * 
+	 * @param mesh ׸⸦  3D ޽Դϴ.
+	 * @param world  Դϴ.
+	 * @param texture ޽ÿ ε ؽóԴϴ.
 	 *
-	 * @param view   Դϴ.
+	 * @note ޽ÿ ؽó   ȣ  Flush Բ ׷ϴ.
 	 */
-	void SetView(const Mat4x4& view) { view_ = view; }
+	void DrawMesh(StaticMesh<VertexPositionNormalUv3D>* mesh, const Mat4x4& world, IResource* texture);
 
 
 	/**
-	 * @brief    մϴ.
+	 * @brief  3D ޽ø   ķ   ׸ϴ.
 	 *
-	 * @param projection   Դϴ.
+	 * @param mesh ׸⸦  3D ޽Դϴ.
+	 * @param worlds νϽ   Դϴ.
+	 * @param instanceCount ׸ νϽ Դϴ.
+	 * @param texture ޽ÿ ε ؽóԴϴ.
+	 *
+	 * @note   νϽ Ӽ ۿ , MAX_INSTANCE_SIZE  ׸ϴ.
 	 */
-	void SetProjection(const Mat4x4& projection) { projection_ = projection; }
+	void DrawMeshInstanced(StaticMesh<VertexPositionNormalUv3D>* mesh, const Mat4x4* worlds, uint32_t instanceCount, IResource* texture);
 
 
 	/**
-	 * @brief 3D ޽ø ׸ϴ.
-	 * 
+	 * @brief  3D ޽ø   ķ   ׸ϴ.
+	 *
 	 * @param mesh ׸⸦  3D ޽Դϴ.
-	 * @param world  Դϴ.
+	 * @param worlds νϽ   Դϴ.
 	 * @param texture ޽ÿ ε ؽóԴϴ.
 	 */
-	void DrawMesh(StaticMesh<VertexPositionNormalUv3D>* mesh, const Mat4x4& world, IResource* texture);
+	void DrawMeshInstanced(StaticMesh<VertexPositionNormalUv3D>* mesh, const std::vector<Mat4x4>& worlds, IResource* texture)
+	{
+		DrawMeshInstanced(mesh, worlds.data(), static_cast<uint32_t>(worlds.size()), texture);
+	}
+
+
+	/**
+	 * @brief DrawMesh  ޽ø ׷츶 νϽ ׸ϴ.
+	 *
+	 * @note   EndFrame ڵ ȣ˴ϴ.
+	 */
+	void Flush();
+
+
+private:
+	/**
+	 * @brief ޽ÿ ؽó  DrawMesh ȣ Դϴ.
+	 */
+	struct MeshGroup
+	{
+		StaticMesh<VertexPositionNormalUv3D>* mesh = nullptr;
+		IResource* texture = nullptr;
+		std::vector<Mat4x4> worlds;
+	};
+
+
+	/**
+	 * @brief   ׸⿡ ׸  ִ ִ νϽ Դϴ.
+	 */
+	static const uint32_t MAX_INSTANCE_SIZE = 4096;
+
+
+	/**
+	 * @brief    νϽ Ӽ ù ° ġԴϴ. mat4   ġ մϴ.
+	 */
+	static const uint32_t INSTANCE_WORLD_LOCATION = 3;
 
 
 private:
 	/**
-	 * @brief   Դϴ.
+	 * @brief νϽ   д ̴Դϴ.
+	 */
+	std::unique_ptr<Shader> instancedShader_;
+
+
+	/**
+	 * @brief νϽ     Դϴ.
+	 */
+	std::unique_ptr<VertexBuffer> instanceBuffer_;
+
+
+	/**
+	 * @brief DrawMesh  ޽ ׷ Դϴ.   ޸𸮸 մϴ.
 	 */
-	Mat4x4 view_;
+	std::vector<MeshGroup> groups_;
 
 
 	/**
-	 * @brief   Դϴ.
+	 * @brief    ޽ ׷ Դϴ.
 	 */
-	Mat4x4 projection_;
+	uint32_t groupCount_ = 0;
 };
\ No newline at end of file
@@ -0,0 +1,208 @@
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "IRenderBackend.h"
+
+
+/**
+ * @brief ׷Ƚ API ȣ ʰ ȣ  īͿ ϴ  鿣Դϴ.
+ *
+ * @note
+ * - GPU       ϱ  մϴ.
+ * - Ʈ ID 1 ʷ ߱ϸ, ̴ ϰ α׷  ׻ մϴ.
+ * -    ӽ ޸𸮸 ȯϹǷ ε Ϳ   մϴ.
+ * -  ε ۿ   鿣带 ġ Ƿ ε īͿ ϵ , 潺 ׻  ȣ ° ˴ϴ.
+ */
+class NullRenderBackend : public IRenderBackend
+{
+public:
+	/**
+	 * @brief   鿣尡 ϴ ȣ īԴϴ.
+	 */
+	struct Counters
+	{
+		uint64_t frameCount = 0;
+		uint64_t drawCallCount = 0;
+		uint64_t drawVertexCount = 0;
+		uint64_t drawIndexCount = 0;
+		uint64_t drawInstanceCount = 0;
+		uint64_t bufferCreateCount = 0;
+		uint64_t bufferUploadCount = 0;
+		uint64_t bufferUploadBytes = 0;
+		uint64_t stateChangeCount = 0;
+		uint64_t stateQueryCount = 0;
+		uint64_t programBindCount = 0;
+		uint64_t vertexArrayBindCount = 0;
+		uint64_t bufferBindCount = 0;
+		uint64_t textureBindCount = 0;
+		uint64_t uniformUpdateCount = 0;
+		uint64_t shaderCompileCount = 0;
+		uint64_t programLinkCount = 0;
+		uint64_t textureCreateCount = 0;
+		uint64_t computeDispatchCount = 0;
+		uint64_t fenceCreateCount = 0;
+		uint64_t fenceWaitCount = 0;
+	};
+
+
+public:
+	/**
+	 * @brief   鿣 Դϴ.
+	 *
+	 * @param screenWidth     ũԴϴ.
+	 * @param screenHeight     ũԴϴ.
+	 */
+	NullRenderBackend(int32_t screenWidth, int32_t screenHeight);
+
+
+	/**
+	 * @brief   鿣  ҸԴϴ.
+	 */
+	virtual ~NullRenderBackend() {}
+
+
+	/**
+	 * @brief   鿣  ڿ  ڸ  մϴ.
+	 */
+	DISALLOW_COPY_AND_ASSIGN(NullRenderBackend);
+
+
+	virtual void BeginFrame(float red, float green, float blue, float alpha, float depth, uint8_t stencil) override;
+	virtual void EndFrame() override;
+	virtual bool GetScreenSize(int32_t& outWidth, int32_t& outHeight) override;
+	virtual void SetViewport(int32_t x, int32_t y, int32_t width, int32_t height) override;
+	virtual void SetVsyncMode(bool bIsEnable) override;
+	virtual void SetRenderState(const ERenderState& state, bool bIsEnable) override;
+	virtual bool GetRenderState(const ERenderState& state) override;
+	virtual uint32_t CreateBuffer(const EBufferType& type, const void* bufferPtr, uint32_t byteSize, const VertexBuffer::EUsage& usage) override;
+	virtual void DestroyBuffer(uint32_t bufferID) override;
+	virtual void BindBuffer(const EBufferType& type, uint32_t bufferID) override;
+	virtual void BindBufferBase(const EBufferType& type, uint32_t bindingIndex, uint32_t bufferID) override;
+	virtual void SetBufferData(const EBufferType& type, const void* bufferPtr, uint32_t byteSize, const VertexBuffer::EUsage& usage) override;
+	virtual void SetBufferSubData(const EBufferType& type, uint32_t byteOffset, const void* bufferPtr, uint32_t byteSize) override;
+	virtual void* MapBuffer(const EBufferType& type) override;
+	virtual void UnmapBuffer(const EBufferType& type) override;
+	virtual void* MapBufferPersistent(const EBufferType& type) override;
+	virtual uint64_t CreateFence() override;
+	virtual void WaitFence(uint64_t fence) override;
+	virtual void DestroyFence(uint64_t fence) override;
+	virtual uint32_t CreateVertexArray() override;
+	virtual void DestroyVertexArray(uint32_t vertexArrayID) override;
+	virtual void BindVertexArray(uint32_t vertexArrayID) override;
+	virtual void SetVertexAttribute(uint32_t location, uint32_t componentCount, uint32_t stride, uint32_t byteOffset) override;
+	virtual void EnableVertexAttribute(uint32_t location) override;
+	virtual void SetVertexAttributeDivisor(uint32_t location, uint32_t divisor) override;
+	virtual uint32_t CreateShader(const EShaderType& type, const std::string& source, std::string& outErrorLog) override;
+	virtual void DestroyShader(uint32_t shaderID) override;
+	virtual uint32_t CreateProgram(const std::vector<uint32_t>& shaderIDs, std::string& outErrorLog) override;
+	virtual void DestroyProgram(uint32_t programID) override;
+	virtual void BindProgram(uint32_t programID) override;
+	virtual int32_t GetUniformLocation(uint32_t programID, const std::string& name) override;
+	virtual void SetUniformInt(int32_t location, const int32_t* values, uint32_t componentCount) override;
+	virtual void SetUniformFloat(int32_t location, const float* values, uint32_t componentCount) override;
+	virtual void SetUniformMatrix(int32_t location, const float* values, uint32_t dimension) override;
+	virtual uint32_t CreateTexture2D(int32_t width, int32_t height) override;
+	virtual void DestroyTexture(uint32_t textureID) override;
+	virtual void BindTexture(uint32_t unit, uint32_t textureID) override;
+	virtual void BindImageTexture(uint32_t unit, uint32_t textureID) override;
+	virtual void DispatchCompute(uint32_t workGroupX, uint32_t workGroupY, uint32_t workGroupZ) override;
+	virtual void DrawVertex(const EDrawMode& drawMode, uint32_t vertexCount, uint32_t firstVertex) override;
+	virtual void DrawIndex(const EDrawMode& drawMode, uint32_t indexCount) override;
+	virtual void DrawVertexInstanced(const EDrawMode& drawMode, uint32_t vertexCount, uint32_t instanceCount, uint32_t firstInstance) override;
+	virtual void DrawIndexInstanced(const EDrawMode& drawMode, uint32_t indexCount, uint32_t instanceCount, uint32_t firstInstance) override;
+
+
+	/**
+	 * @brief ϵ ȣ ī͸ ϴ.
+	 *
+	 * @return ϵ ȣ ī  ڸ ȯմϴ.
+	 */
+	const Counters& GetCounters() const { return counters_; }
+
+
+	/**
+	 * @brief ϵ ȣ ī͸  0 ʱȭմϴ.
+	 */
+	void ResetCounters() { counters_ = Counters(); }
+
+
+private:
+	/**
+	 * @brief   ϴ ε  ε ϴ.
+	 *
+	 * @param type  Դϴ.
+	 *
+	 * @return ε  ε ȯմϴ.
+	 */
+	static uint32_t GetBindingSlot(const EBufferType& type) { return type == EBufferType::Vertex ? 0 : (type == EBufferType::Index ? 1 : 2); }
+
+
+private:
+	/**
+	 * @brief     ũԴϴ.
+	 */
+	int32_t screenWidth_ = 0;
+
+
+	/**
+	 * @brief     ũԴϴ.
+	 */
+	int32_t screenHeight_ = 0;
+
+
+	/**
+	 * @brief  ߱ Ʈ IDԴϴ.
+	 */
+	uint32_t nextObjectID_ = 1;
+
+
+	/**
+	 * @brief  ߱   ġԴϴ.
+	 */
+	int32_t nextUniformLocation_ = 0;
+
+
+	/**
+	 * @brief  ִ   Դϴ.
+	 */
+	std::unordered_map<int32_t, bool> renderStates_;
+
+
+	/**
+	 * @brief  ID ϴ  Ʈ ũԴϴ.
+	 */
+	std::unordered_map<uint32_t, uint32_t> bufferSizes_;
+
+
+	/**
+	 * @brief   ε  IDԴϴ.
+	 */
+	uint32_t boundBuffers_[3] = { 0, 0, 0 };
+
+
+	/**
+	 * @brief    ȯϴ ӽ ޸Դϴ.
+	 */
+	std::vector<uint8_t> mappedBuffer_;
+
+
+	/**
+	 * @brief  ID ϴ   ޸Դϴ.
+	 */
+	std::unordered_map<uint32_t, std::vector<uint8_t>> persistentBuffers_;
+
+
+	/**
+	 * @brief  ߱ 潺 ڵԴϴ.
+	 */
+	uint64_t nextFence_ = 1;
+
+
+	/**
+	 * @brief ϵ ȣ īԴϴ.
+	 */
+	Counters counters_;
+};
\ No newline at end of file
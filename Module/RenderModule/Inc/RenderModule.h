@@ -1,17 +1,15 @@
 #pragma once
 
-#include <array>
 #include <cstdint>
+#include <functional>
 #include <memory>
-#include <map>
 #include <string>
+#include <typeinfo>
 #include <unordered_map>
 #include <vector>
 
 #if defined(_WIN32) || defined(_WIN64)
 #include <windows.h>
-#else
-#error "not support platform"
 #endif
 
 #include "Vec2.h"
@@ -19,21 +17,10 @@
 #include "Vec4.h"
 #include "Mat4x4.h"
 
+#include "CachedRenderBackend.h"
+#include "IRenderBackend.h"
 #include "IResource.h"
-
-
-/**
- * @brief ⺻  ׸ Դϴ.
- */
-enum class EDrawMode : int32_t
-{
-	Points      = 0x0000,
-	Lines       = 0x0001,
-	LineStrip   = 0x0003,
-	Triangles   = 0x0004,
-	TriangleFan = 0x0006,
-	None        = 0xFFFF,
-};
+#include "ResourcePool.h"
 
 
 /**
@@ -60,7 +47,29 @@ public:
 	};
 
 
+	/**
+	 * @brief  ̴ α׷ ϴ   Դϴ.
+	 *
+	 * @note std140 ̾ƿ , ̴ FrameUniform ϰ   ƾ մϴ.
+	 */
+	struct FrameUniform
+	{
+		Mat4x4 view; // þ Դϴ.
+		Mat4x4 projection; //  Դϴ.
+		Mat4x4 viewProjection; // þ İ    Դϴ.
+		float time = 0.0f; //   ʱȭ  帥 ð()Դϴ.
+		float padding[3] = { 0.0f, 0.0f, 0.0f }; // std140  ߱  Դϴ.
+	};
+
+
+	/**
+	 * @brief ̴ FrameUniform  ϴ ε Դϴ.
+	 */
+	static const uint32_t FRAME_UNIFORM_BINDING = 0;
+
+
 public:
+#if defined(_WIN32) || defined(_WIN64)
 	/**
 	 * @brief   ʱȭմϴ.
 	 *
@@ -69,6 +78,22 @@ public:
 	 * @return ʱȭ ϸ Errors  OK , ׷     ȯմϴ.
 	 */
 	static Errors Init(HWND windowHandle);
+#endif
+
+
+	/**
+	 * @brief  GPU    ʱȭմϴ.
+	 *
+	 * @param screenWidth     ũԴϴ.
+	 * @param screenHeight     ũԴϴ.
+	 *
+	 * @return ʱȭ ϸ Errors  OK , ׷     ȯմϴ.
+	 *
+	 * @note
+	 * - ׷Ƚ API  ȣ  īͿ ϴ NullRenderBackend մϴ.
+	 * - ̴ ҽ  ״ Ƿ Resource  ִ ο ؾ մϴ.
+	 */
+	static Errors InitHeadless(int32_t screenWidth, int32_t screenHeight);
 
 
 	/**
@@ -100,6 +125,27 @@ public:
 	static void EndFrame();
 
 
+	/**
+	 * @brief    þ İ   մϴ.
+	 *
+	 * @param view  þ Դϴ.
+	 * @param projection   Դϴ.
+	 *
+	 * @note
+	 * -   ۴ BeginFrame   εǾ  ̴ α׷ մϴ.
+	 * - ġ νϽ ׸⸦ ̷   ׸   ϹǷ, ӿ ׸    ؾ մϴ.
+	 */
+	static void SetViewProjection(const Mat4x4& view, const Mat4x4& projection);
+
+
+	/**
+	 * @brief     ϴ.
+	 *
+	 * @return     ڸ ȯմϴ.
+	 */
+	static const FrameUniform& GetFrameUniform() { return frameUniform; }
+
+
 	/**
 	 * @brief  Ʈ մϴ.
 	 *
@@ -171,65 +217,95 @@ public:
 	 * @param args ҽ ڿ  ڵԴϴ.
 	 *
 	 * @return  ҽ ͸ ȯմϴ. ҽ  ϸ nullptr ȯմϴ.
+	 *
+	 * @note ҽ ŸԺ Ǯ Ǹ, Ǯ   Ͽ  Ƿ ҽ   O(1)Դϴ.
 	 */
 	template <typename TResource, typename... Args>
 	static TResource* CreateResource(Args&&... args)
 	{
-		if (!(0 <= cacheSize && cacheSize < MAX_RESOURCE_SIZE))
-		{
-			return nullptr;
-		}
+		ResourcePool<TResource>& pool = GetResourcePool<TResource>();
+		return pool.Get(pool.Create(std::forward<Args>(args)...));
+	}
 
-		int32_t resourceID = -1;
-		for (uint32_t index = 0; index < cacheSize; ++index)
-		{
-			if (!cache[index])
-			{
-				resourceID = static_cast<int32_t>(index);
-				break;
-			}
-		}
 
-		if (resourceID == -1)
-		{
-			resourceID = cacheSize++;
-		}
+	/**
+	 * @brief ҽ ϰ ڵ ϴ.
+	 *
+	 * @param args ҽ ڿ  ڵԴϴ.
+	 *
+	 * @return  ҽ ڵ ȯմϴ. ҽ  ϸ ƹ͵ Ű ʴ ڵ ȯմϴ.
+	 */
+	template <typename TResource, typename... Args>
+	static ResourceHandle<TResource> CreateResourceHandle(Args&&... args)
+	{
+		return GetResourcePool<TResource>().Create(std::forward<Args>(args)...);
+	}
 
-		cache[resourceID] = std::make_unique<TResource>(args...);
-		return reinterpret_cast<TResource*>(cache[resourceID].get());
+
+	/**
+	 * @brief ڵ Ű ҽ ϴ.
+	 *
+	 * @param handle ҽ ڵԴϴ.
+	 *
+	 * @return ִ ҽ ҽ ,  ҽ ڵ̶ nullptr ȯմϴ.
+	 */
+	template <typename TResource>
+	static TResource* GetResource(const ResourceHandle<TResource>& handle)
+	{
+		return GetResourcePool<TResource>().Get(handle);
+	}
+
+
+	/**
+	 * @brief ҽ ڵ ϴ.
+	 *
+	 * @param resource ڵ  ҽԴϴ. CreateResource  ҽ մϴ.
+	 *
+	 * @return ҽ ڵ ȯմϴ.
+	 */
+	template <typename TResource>
+	static ResourceHandle<TResource> GetResourceHandle(const TResource* resource)
+	{
+		return ResourceHandle<TResource>(resource ? resource->GetPoolHandleID() : 0);
 	}
 
 
 	/**
-	 * @brief ҽ Ŵ ϴ ҽ մϴ.
+	 * @brief ҽ մϴ.
+	 *
+	 * @param resource  ҽ Դϴ.
 	 *
-	 * @param resourceID  ҽ IDԴϴ.
+	 * @note ҽ ϵ Ǯ ڵ ID ٷ ϹǷ O(1)Դϴ. ̹  ҽ ƹ͵  ʽϴ.
 	 */
 	static void DestroyResource(const IResource* resource)
 	{
-		int32_t resourceID = -1;
-		for (uint32_t index = 0; index < cacheSize; ++index)
+		if (resource && resource->GetPool())
 		{
-			IResource* cacheResource = cache[index].get();
-			if (resource == cacheResource)
-			{
-				resourceID = static_cast<int32_t>(index);
-				break;
-			}
+			resource->GetPool()->Destroy(resource->GetPoolHandleID());
 		}
+	}
 
-		if (resourceID != -1 && cache[resourceID])
-		{
-			if (cache[resourceID]->IsInitialized())
-			{
-				cache[resourceID]->Release();
-			}
 
-			cache[resourceID].reset();
-		}
+	/**
+	 * @brief ڵ Ű ҽ մϴ.
+	 *
+	 * @param handle  ҽ ڵԴϴ. ̹  ҽ ڵ̶ ƹ͵  ʽϴ.
+	 */
+	template <typename TResource>
+	static void DestroyResource(const ResourceHandle<TResource>& handle)
+	{
+		GetResourcePool<TResource>().Destroy(handle.id);
 	}
 
 
+	/**
+	 * @brief ҽ ŸԺ Ǯ 뷮 ϴ.
+	 *
+	 * @param outStats Ǯ 뷮  Դϴ. Ǯ ó   ϴ.
+	 */
+	static void GetResourcePoolStats(std::vector<ResourcePoolStats>& outStats);
+
+
 	/**
 	 * @brief ũ ũ⸦ ϴ.
 	 *
@@ -255,21 +331,40 @@ public:
 	/**
 	 * @brief    ϴ  ҽ ϴ.
 	 * 
-	 * @param key  ҽ Ű Դϴ.
+	 * @param keyHash HashResourceKey ̸ ؽ  ҽ Ű Դϴ.
 	 * 
-	 * @return  ҽ Ű  ϴ ҽ ͸ ȯմϴ.
+	 * @return  ҽ Ű  ϴ ҽ ͸ ȯմϴ. Ű ų, Ÿ ٸų,  ҽ nullptr ȯմϴ.
 	 */
 	template <typename TResource>
-	static TResource* GetGlobalResource(const std::string& key)
+	static TResource* GetGlobalResource(uint64_t keyHash)
 	{
-		auto iter = globalResources.find(key);
+		auto iter = globalResources.find(keyHash);
 		if (iter == globalResources.end())
 		{
 			return nullptr;
 		}
 
-		TResource* resource = reinterpret_cast<TResource*>(iter->second);
-		return resource;
+		ResourcePool<TResource>& pool = GetResourcePool<TResource>();
+		if (iter->second.pool != &pool)
+		{
+			return nullptr;
+		}
+
+		return pool.Get(ResourceHandle<TResource>(iter->second.handleID));
+	}
+
+
+	/**
+	 * @brief    ϴ  ҽ ϴ.
+	 * 
+	 * @param key  ҽ Ű Դϴ. ȣ  ؽϹǷ,  ȣѴٸ ̸ ؽ Ű ؾ մϴ.
+	 * 
+	 * @return  ҽ Ű  ϴ ҽ ͸ ȯմϴ.
+	 */
+	template <typename TResource>
+	static TResource* GetGlobalResource(const std::string& key)
+	{
+		return GetGlobalResource<TResource>(HashResourceKey(key.c_str()));
 	}
 
 
@@ -286,8 +381,9 @@ public:
 	 * 
 	 * @param vertexCount ׸    ؽ  Դϴ.
 	 * @param drawMode ׸ Դϴ.
+	 * @param firstVertex ׸    ù °  εԴϴ.
 	 */
-	static void ExecuteDrawVertex(uint32_t vertexCount, const EDrawMode& drawMode);
+	static void ExecuteDrawVertex(uint32_t vertexCount, const EDrawMode& drawMode, uint32_t firstVertex = 0);
 
 
 	/**
@@ -299,7 +395,132 @@ public:
 	static void ExecuteDrawIndex(uint32_t indexCount, const EDrawMode& drawMode);
 
 
+	/**
+	 * @brief ο ε  ۸   νϽ   ׸ϴ.
+	 *
+	 * @param vertexCount νϽ ϳ ׸    Դϴ.
+	 * @param instanceCount ׸ νϽ Դϴ.
+	 * @param drawMode ׸ Դϴ.
+	 * @param firstInstance νϽ Ӽ  ù ° νϽ εԴϴ.
+	 */
+	static void ExecuteDrawVertexInstanced(uint32_t vertexCount, uint32_t instanceCount, const EDrawMode& drawMode, uint32_t firstInstance = 0);
+
+
+	/**
+	 * @brief ο ε ҽ   νϽ   ׸ϴ.
+	 *
+	 * @param indexCount νϽ ϳ ׸   ε  Դϴ.
+	 * @param instanceCount ׸ νϽ Դϴ.
+	 * @param drawMode ׸ Դϴ.
+	 * @param firstInstance νϽ Ӽ  ù ° νϽ εԴϴ.
+	 */
+	static void ExecuteDrawIndexInstanced(uint32_t indexCount, uint32_t instanceCount, const EDrawMode& drawMode, uint32_t firstInstance = 0);
+
+
+	/**
+	 * @brief   ϴ  鿣带 ϴ.
+	 *
+	 * @return  鿣 ͸ ȯմϴ. ʱȭ  nullptr ȯմϴ.
+	 *
+	 * @note ȯϴ  鿣  ĳ̸,  ׷Ƚ API ȣϴ  鿣 GetDeviceBackend ϴ.
+	 */
+	static IRenderBackend* GetBackend() { return backend.get(); }
+
+
+	/**
+	 * @brief    ĳø ϴ.
+	 *
+	 * @return  ĳ ͸ ȯմϴ. ʱȭ  nullptr ȯմϴ.
+	 */
+	static CachedRenderBackend* GetStateCache() { return backend.get(); }
+
+
+	/**
+	 * @brief  ĳð ΰ ִ   鿣带 ϴ.
+	 *
+	 * @return   鿣 ͸ ȯմϴ. ʱȭ  nullptr ȯմϴ.
+	 */
+	static IRenderBackend* GetDeviceBackend() { return backend ? backend->GetDevice() : nullptr; }
+
+
+	/**
+	 * @brief   帮  ʱȭǾ Ȯմϴ.
+	 *
+	 * @return 帮  ʱȭǾٸ true, ׷  false ȯմϴ.
+	 */
+	static bool IsHeadless() { return bIsHeadless; }
+
+
+	/**
+	 * @brief ݱ    ϴ.
+	 *
+	 * @return EndFrame ȣ Ƚ ȯմϴ.
+	 */
+	static uint64_t GetFrameCount() { return frameCount; }
+
+
+	/**
+	 * @brief    ȣ ݹ ߰մϴ.
+	 *
+	 * @param owner ݹ  ҽԴϴ.
+	 * @param callback    ȣ ݹԴϴ.
+	 *
+	 * @note ݹ ߰  ۸ ϱ  ȣ˴ϴ. ҽ   ݵ RemoveEndFrameCallback ȣؾ մϴ.
+	 */
+	static void AddEndFrameCallback(const IResource* owner, const std::function<void()>& callback);
+
+
+	/**
+	 * @brief ҽ    ݹ  մϴ.
+	 *
+	 * @param owner ݹ  ҽԴϴ.
+	 */
+	static void RemoveEndFrameCallback(const IResource* owner);
+
+
 private:
+	/**
+	 * @brief ҽ Ÿ Ǯ ϴ. ó ȣ  Ǯ  Ǯ Ͽ մϴ.
+	 *
+	 * @return ҽ Ÿ Ǯ ڸ ȯմϴ.
+	 */
+	template <typename TResource>
+	static ResourcePool<TResource>& GetResourcePool()
+	{
+		static ResourcePool<TResource>* pool = static_cast<ResourcePool<TResource>*>(RegisterResourcePool(std::make_unique<ResourcePool<TResource>>(GetResourceTypeName(typeid(TResource)))));
+		return *pool;
+	}
+
+
+	/**
+	 * @brief ҽ Ÿ   ִ ̸ ϴ.
+	 *
+	 * @param typeInfo ҽ Ÿ Ÿ Դϴ.
+	 *
+	 * @return Ϸ ͱ۸ ̸ Ǯ "StaticMesh<VertexPositionNormalUv3D>"ó ҽ ڵ  ̸ ȯմϴ.
+	 */
+	static std::string GetResourceTypeName(const std::type_info& typeInfo);
+
+
+	/**
+	 * @brief ҽ Ǯ Ǯ Ͽ մϴ.
+	 *
+	 * @param pool  ҽ ǮԴϴ.
+	 *
+	 * @return  ҽ Ǯ ͸ ȯմϴ.
+	 */
+	static IResourcePool* RegisterResourcePool(std::unique_ptr<IResourcePool> pool);
+
+
+	/**
+	 * @brief  ҽ մϴ.
+	 *
+	 * @param keyHash HashResourceKey ̸ ؽ  ҽ Ű Դϴ.
+	 * @param resource  ҽԴϴ. CreateResource  ҽ մϴ.
+	 */
+	static void SetGlobalResource(uint64_t keyHash, const IResource* resource);
+
+
 	/**
 	 * @brief  ޽ մϴ.
 	 *
@@ -308,6 +529,13 @@ private:
 	static void SetLastErrorMessage(const std::wstring& message);
 
 
+	/**
+	 * @brief      ۸ մϴ.
+	 */
+	static void CreateFrameUniformBuffer();
+
+
+#if defined(_WIN32) || defined(_WIN64)
 	/**
 	 * @brief Windows ޽ մϴ.
 	 *
@@ -330,6 +558,7 @@ private:
 	 * @return Windows GL ؽƮ  ϸ Errors  OK , ׷     ȯմϴ.
 	 */
 	static Errors CreateWGLContext();
+#endif
 
 
 private:
@@ -339,6 +568,19 @@ private:
 	static bool bIsInit;
 
 
+	/**
+	 * @brief   帮  ʱȭǾ Ȯմϴ.
+	 */
+	static bool bIsHeadless;
+
+
+	/**
+	 * @brief ׷Ƚ API ȣ ϴ  鿣Դϴ.
+	 */
+	static std::unique_ptr<CachedRenderBackend> backend;
+
+
+#if defined(_WIN32) || defined(_WIN64)
 	/**
 	 * @brief   Ǵ  ڵԴϴ.
 	 */
@@ -355,6 +597,7 @@ private:
 	 * @brief   OpenGL ؽƮ ڵԴϴ.
 	 */
 	static HGLRC glRenderContext;
+#endif
 
 
 	/**
@@ -376,25 +619,49 @@ private:
 
 
 	/**
-	 * @brief   ִ ִ ҽ Դϴ.
+	 * @brief  ҽ Ǯ ڵ IDԴϴ.
+	 */
+	struct GlobalResource
+	{
+		IResourcePool* pool = nullptr; // ҽ  ǮԴϴ. ҽ Ÿ Ȯ  մϴ.
+		uint32_t handleID = 0; // Ǯ ȿ ҽ Ű ڵ IDԴϴ.
+	};
+
+
+	/**
+	 * @brief ҽ ŸԺ Ǯ Դϴ. Ǯ ó   ϴ.
+	 *
+	 * @note Ǯ α׷   Ǹ, Uninit Ǯ ҽ մϴ.
+	 */
+	static std::vector<std::unique_ptr<IResourcePool>> resourcePools;
+
+
+	/**
+	 * @brief ̸ ؽ Ű ã   ҽ Դϴ.
+	 */
+	static std::unordered_map<uint64_t, GlobalResource> globalResources;
+
+
+	/**
+	 * @brief    ȣ ݹ Դϴ.
 	 */
-	static const uint32_t MAX_RESOURCE_SIZE = 200;
+	static std::vector<std::pair<const IResource*, std::function<void()>>> endFrameCallbacks;
 
 
 	/**
-	 * @brief ĳ ũԴϴ.
+	 * @brief ݱ   Դϴ.
 	 */
-	static uint32_t cacheSize;
+	static uint64_t frameCount;
 
 
 	/**
-	 * @brief ҽ ĳԴϴ.
+	 * @brief    Դϴ.
 	 */
-	static std::array<std::unique_ptr<IResource>, MAX_RESOURCE_SIZE> cache;
+	static FrameUniform frameUniform;
 
 
 	/**
-	 * @brief ο   ҽ ĳԴϴ.
+	 * @brief       IDԴϴ.
 	 */
-	static std::map<std::string, IResource*> globalResources;
+	static uint32_t frameUniformBufferID;
 };
\ No newline at end of file
@@ -0,0 +1,309 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "Mat4x4.h"
+
+#include "IResource.h"
+#include "StaticMesh.h"
+#include "Vertex3D.h"
+
+class GeometryRenderer3D;
+class MeshRenderer;
+
+
+/**
+ * @brief ƼƼ ׸ û  Ű Բ Ҵٰ,    ٽ ϴ   ťԴϴ.
+ *
+ * @note
+ * -   (Reset, Push...) -> (Sort) -> (Replay)  ܰ ,  ܰ GPU     ֽϴ.
+ * -  64Ʈ  Ű  Ʒ(payloads_) ε ̷,  Ű   (radix sort)Դϴ.
+ * - / н Ű [н 4 | ̴ 8 |  12 | ޽ 16 |  24] Ʈ,      տ   ĵ˴ϴ.
+ * -  н Ű [н 4 |   24 | ̴ 8 |  12 | ޽ 16] Ʈ, ڿ   ĵ˴ϴ.
+ * -   , ޽, ؽó  ޽  ӵǸ   νϽ ȣ ׸ϴ.
+ */
+class RenderQueue : public IResource
+{
+public:
+	/**
+	 * @brief  нԴϴ.   н  ׷ϴ.
+	 */
+	enum class EPass : uint8_t
+	{
+		Opaque      = 0x00,
+		Debug       = 0x01,
+		Transparent = 0x02,
+	};
+
+
+	/**
+	 * @brief    Դϴ.
+	 */
+	struct Stats
+	{
+		uint32_t commandCount = 0; // ϵ  Դϴ.
+		uint32_t drawCallCount = 0; //   ׸ ȣ Դϴ.
+		uint32_t shaderChangeCount = 0; // (̴) ٲ ȽԴϴ.
+		uint32_t materialChangeCount = 0; // ؽó() ٲ ȽԴϴ.
+		uint32_t meshChangeCount = 0; // ޽ð ٲ ȽԴϴ.
+	};
+
+
+public:
+	/**
+	 * @brief   ť Ʈ Դϴ.
+	 */
+	explicit RenderQueue();
+
+
+	/**
+	 * @brief   ť  ҸԴϴ.
+	 *
+	 * @note   ť ο Ҵ Ҹ ϱ ؼ ݵ Release ȣؾ մϴ.
+	 */
+	virtual ~RenderQueue();
+
+
+	/**
+	 * @brief   ť  ڿ  ڸ  մϴ.
+	 */
+	DISALLOW_COPY_AND_ASSIGN(RenderQueue);
+
+
+	/**
+	 * @brief   ť  ҽ Ҵ մϴ.
+	 */
+	virtual void Release() override;
+
+
+	/**
+	 * @brief ϵ       մϴ.
+	 *
+	 * @param view ̸  þ Դϴ.
+	 * @param farZ ̸ ȭ ִ ŸԴϴ. ̺    ̷ մϴ.
+	 *
+	 * @note ɰ  Ʒ ޸𸮴   մϴ.
+	 */
+	void Reset(const Mat4x4& view, float farZ);
+
+
+	/**
+	 * @brief ޽ ׸  մϴ.
+	 *
+	 * @param renderer ޽ø ׸ Դϴ.
+	 * @param mesh ׸ 3D ޽Դϴ.
+	 * @param world  Դϴ.
+	 * @param texture ޽ÿ ε ؽóԴϴ.
+	 * @param pass  ׸  нԴϴ.
+	 */
+	void PushMesh(MeshRenderer* renderer, StaticMesh<VertexPositionNormalUv3D>* mesh, const Mat4x4& world, IResource* texture, const EPass& pass = EPass::Opaque);
+
+
+	/**
+	 * @brief   ׸  մϴ.
+	 *
+	 * @param renderer   ׸ Դϴ.
+	 * @param handle ׸   ڵԴϴ.
+	 * @param world  Դϴ.
+	 * @param pass  ׸  нԴϴ.
+	 */
+	void PushRetained(GeometryRenderer3D* renderer, uint32_t handle, const Mat4x4& world, const EPass& pass = EPass::Debug);
+
+
+	/**
+	 * @brief ϵ   Ű  մϴ.
+	 */
+	void Sort();
+
+
+	/**
+	 * @brief ĵ   մϴ.
+	 *
+	 * @note ϵ   Reset ǹǷ       ֽϴ.
+	 */
+	void Replay();
+
+
+	/**
+	 * @brief ϵ   ϴ.
+	 *
+	 * @return ϵ   ȯմϴ.
+	 */
+	uint32_t GetCommandCount() const { return static_cast<uint32_t>(commands_.size()); }
+
+
+	/**
+	 * @brief    踦 ϴ.
+	 *
+	 * @return    踦 ȯմϴ.
+	 */
+	const Stats& GetStats() const { return stats_; }
+
+
+private:
+	/**
+	 * @brief  Ű ̷ε Դϴ.
+	 */
+	enum class EPayload : uint8_t
+	{
+		Mesh     = 0x00,
+		Retained = 0x01,
+	};
+
+
+	/**
+	 * @brief  Ʒ ϴ  Դϴ.
+	 */
+	struct Payload
+	{
+		EPayload type = EPayload::Mesh;
+		void* renderer = nullptr;
+		void* resource = nullptr; // ޽ ̸ ޽,   ̸ nullptrԴϴ.
+		IResource* texture = nullptr;
+		uint32_t handle = 0; //    ڵԴϴ.
+		Mat4x4 world;
+	};
+
+
+	/**
+	 * @brief  Ű  Ʒ ε ̷ Դϴ.
+	 */
+	struct Command
+	{
+		uint64_t key = 0;
+		uint32_t payload = 0;
+	};
+
+
+	/**
+	 * @brief ֱٿ ȸ ü Ŀ IDԴϴ.
+	 */
+	struct SortIDCache
+	{
+		const void* object = nullptr;
+		uint32_t id = 0;
+	};
+
+
+	/**
+	 * @brief  մϴ.
+	 *
+	 * @param pass  ׸  нԴϴ.
+	 * @param payload  Ʒ  ߰  Դϴ.
+	 * @param meshID  Ű ޽ ʵ忡  Դϴ.
+	 */
+	void Push(const EPass& pass, const Payload& payload, uint32_t meshID);
+
+
+	/**
+	 * @brief ü Ŀ ID ϴ. ó  ü  ID ߱մϴ.
+	 *
+	 * @param object ID  üԴϴ.
+	 *
+	 * @return ü Ŀ ID ȯմϴ. nullptr ID 0Դϴ.
+	 */
+	uint32_t GetSortID(const void* object);
+
+
+	/**
+	 * @brief   ġ þ  ̷ ٲٰ ȭմϴ.
+	 *
+	 * @param world  Դϴ.
+	 *
+	 * @return ȭ   ȯմϴ.
+	 */
+	uint32_t QuantizeDepth(const Mat4x4& world) const;
+
+
+private:
+	/**
+	 * @brief  Ű ʵ庰 Ʈ Դϴ.
+	 */
+	static const uint32_t PASS_BITS = 4;
+	static const uint32_t SHADER_BITS = 8;
+	static const uint32_t MATERIAL_BITS = 12;
+	static const uint32_t MESH_BITS = 16;
+	static const uint32_t DEPTH_BITS = 24;
+
+
+	/**
+	 * @brief    ڸ Ʈ Դϴ.
+	 */
+	static const uint32_t RADIX_BITS = 8;
+
+
+	/**
+	 * @brief    ڸ   ִ  Դϴ.
+	 */
+	static const uint32_t RADIX_SIZE = 1 << RADIX_BITS;
+
+
+	/**
+	 * @brief   ڸԴϴ.
+	 */
+	static const uint32_t RADIX_PASS_COUNT = 64 / RADIX_BITS;
+
+
+	/**
+	 * @brief Ŀ ID ؽ ̺  ãƺ ĳ ũԴϴ.
+	 */
+	static const uint32_t SORT_ID_CACHE_SIZE = 64;
+
+
+private:
+	/**
+	 * @brief ̸  þ Դϴ.
+	 */
+	Mat4x4 view_;
+
+
+	/**
+	 * @brief ̸ ȭ ִ ŸԴϴ.
+	 */
+	float farZ_ = 1.0f;
+
+
+	/**
+	 * @brief ϵ  Դϴ. Sort Ŀ ĵ Դϴ.
+	 */
+	std::vector<Command> commands_;
+
+
+	/**
+	 * @brief  Ŀ ϴ ӽ  Դϴ.
+	 */
+	std::vector<Command> sortCommands_;
+
+
+	/**
+	 * @brief   ϴ  ƷԴϴ.
+	 */
+	std::vector<Payload> payloads_;
+
+
+	/**
+	 * @brief ü Ŀ IDԴϴ.   ˴ϴ.
+	 */
+	std::unordered_map<const void*, uint32_t> sortIDs_;
+
+
+	/**
+	 * @brief ü ּҷ ã Ŀ ID ĳԴϴ.
+	 */
+	std::array<SortIDCache, SORT_ID_CACHE_SIZE> sortIDCaches_;
+
+
+	/**
+	 * @brief   ӵ ޽     Դϴ.
+	 */
+	std::vector<Mat4x4> instanceWorlds_;
+
+
+	/**
+	 * @brief    Դϴ.
+	 */
+	Stats stats_;
+};
\ No newline at end of file
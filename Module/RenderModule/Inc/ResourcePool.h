@@ -0,0 +1,413 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "IResource.h"
+
+
+/**
+ * @brief ҽ Ǯ  ҽ Ű Ÿ ִ ڵԴϴ.
+ *
+ * @note
+ * -  20Ʈ Ǯ  ε,  12Ʈ  (generation)Դϴ.
+ * - ҽ Ǹ  밡 ٲǷ,  ҽ ڵδ  ҽ   ϴ.
+ * - id 0 ڵ  ҽ Ű ʽϴ.
+ */
+template <typename TResource>
+struct ResourceHandle
+{
+	/**
+	 * @brief ҽ ڵ ⺻ Դϴ. ƹ ҽ Ű ʽϴ.
+	 */
+	ResourceHandle() = default;
+
+
+	/**
+	 * @brief ҽ ڵ Դϴ.
+	 *
+	 * @param handleID Ǯ  ε 븦 ģ Դϴ.
+	 */
+	explicit ResourceHandle(uint32_t handleID) : id(handleID) {}
+
+
+	/**
+	 * @brief ڵ ƹ ҽ Ű ʴ Ȯմϴ.
+	 */
+	bool IsNull() const { return id == 0; }
+
+
+	/**
+	 * @brief  ڵ  ҽ Ű Ȯմϴ.
+	 */
+	bool operator==(const ResourceHandle& rhs) const { return id == rhs.id; }
+	bool operator!=(const ResourceHandle& rhs) const { return id != rhs.id; }
+
+
+	/**
+	 * @brief Ǯ  ε 븦 ģ Դϴ.
+	 */
+	uint32_t id = 0;
+};
+
+
+/**
+ * @brief  ҽ ڿ Ű 64Ʈ ؽ  ٲߴϴ.
+ *
+ * @param key ؽ   ŰԴϴ.
+ *
+ * @return FNV-1a ؽ  ȯմϴ.
+ *
+ * @note constexpr̹Ƿ  Ű  ð ̸ ؽ  ֽϴ.
+ */
+constexpr uint64_t HashResourceKey(const char* key)
+{
+	uint64_t hash = 0xCBF29CE484222325ull;
+	for (; *key != '\0'; ++key)
+	{
+		hash = (hash ^ static_cast<uint8_t>(*key)) * 0x100000001B3ull;
+	}
+
+	return hash;
+}
+
+
+/**
+ * @brief ҽ Ǯ 뷮Դϴ.
+ */
+struct ResourcePoolStats
+{
+	const char* typeName = nullptr; // Ǯ  ҽ Ÿ ̸Դϴ.
+	uint32_t liveCount = 0; // ִ ҽ Դϴ.
+	uint32_t slotCount = 0; // Ҵ  Դϴ.
+	std::size_t liveBytes = 0; // ִ ҽ ü ϴ Ʈ Դϴ. ҽ  Ҵ ޸𸮴  ʽϴ.
+	std::size_t reservedBytes = 0; // Ǯ Ҵ  Ʈ Դϴ.
+};
+
+
+/**
+ * @brief ҽ Ÿ԰  ҽ Ǯ ٷ ̽Դϴ.
+ */
+class IResourcePool
+{
+public:
+	/**
+	 * @brief ҽ Ǯ ̽ Ʈ Դϴ.
+	 */
+	IResourcePool() = default;
+
+
+	/**
+	 * @brief ҽ Ǯ ̽  ҸԴϴ.
+	 */
+	virtual ~IResourcePool() {}
+
+
+	/**
+	 * @brief ҽ Ǯ ̽  ڿ  ڸ  մϴ.
+	 */
+	DISALLOW_COPY_AND_ASSIGN(IResourcePool);
+
+
+	/**
+	 * @brief ڵ ID Ű ҽ մϴ. ̹  ҽ ƹ͵  ʽϴ.
+	 *
+	 * @param handleID  ҽ ڵ IDԴϴ.
+	 */
+	virtual void Destroy(uint32_t handleID) = 0;
+
+
+	/**
+	 * @brief Ǯ  ҽ մϴ. Ҵ  ״ Ӵϴ.
+	 */
+	virtual void Clear() = 0;
+
+
+	/**
+	 * @brief Ǯ 뷮 ϴ.
+	 *
+	 * @return Ǯ 뷮 ȯմϴ.
+	 */
+	virtual ResourcePoolStats GetStats() const = 0;
+};
+
+
+/**
+ * @brief  Ÿ ҽ  ǮԴϴ.
+ *
+ * @note
+ * - ҽ   Ҵ  ȿ  ϸ,  Ű Ƿ ҽ ּҰ ٲ ʽϴ.
+ * -    Ʈ ϹǷ , , ȸ  O(1)Դϴ.
+ * - 븦    ٽ  Ƿ,  ҽ ڵ  ҽ Ű  ϴ.
+ */
+template <typename TResource>
+class ResourcePool : public IResourcePool
+{
+public:
+	/**
+	 * @brief ڵ ID  ε ϴ Ʈ Դϴ.
+	 */
+	static const uint32_t INDEX_BITS = 20;
+
+
+	/**
+	 * @brief Ǯ ϳ ÿ   ִ ִ ҽ Դϴ.
+	 */
+	static const uint32_t MAX_RESOURCE_COUNT = 1u << INDEX_BITS;
+
+
+	/**
+	 * @brief  ִ Դϴ.
+	 */
+	static const uint32_t MAX_GENERATION = (1u << (32 - INDEX_BITS)) - 1;
+
+
+	/**
+	 * @brief  ϳ ǥ ϴ Ʈ Դϴ.
+	 */
+	static const uint32_t PAGE_BYTES = 16 * 1024;
+
+
+	/**
+	 * @brief  ϳ   Դϴ.
+	 *
+	 * @note ó ũⰡ ū ҽ  ϳ  ϳ Ƿ,  ʴ  ̸ Ҵ ʽϴ.
+	 */
+	static const uint32_t PAGE_SIZE = sizeof(TResource) < PAGE_BYTES ? static_cast<uint32_t>(PAGE_BYTES / sizeof(TResource)) : 1;
+
+
+public:
+	/**
+	 * @brief ҽ Ǯ Դϴ.
+	 *
+	 * @param typeName Ǯ 뷮 ǥ ҽ Ÿ ̸Դϴ.
+	 */
+	explicit ResourcePool(const std::string& typeName) : typeName_(typeName) {}
+
+
+	/**
+	 * @brief ҽ Ǯ  ҸԴϴ. ִ ҽ  մϴ.
+	 */
+	virtual ~ResourcePool()
+	{
+		Clear();
+	}
+
+
+	/**
+	 * @brief ҽ Ǯ  ڿ  ڸ  մϴ.
+	 */
+	DISALLOW_COPY_AND_ASSIGN(ResourcePool);
+
+
+	/**
+	 * @brief ҽ մϴ.
+	 *
+	 * @param args ҽ ڿ  ڵԴϴ.
+	 *
+	 * @return  ҽ ڵ ȯմϴ. Ǯ  áٸ ƹ͵ Ű ʴ ڵ ȯմϴ.
+	 */
+	template <typename... Args>
+	ResourceHandle<TResource> Create(Args&&... args)
+	{
+		uint32_t index = AllocateSlot();
+		if (index == INVALID_SLOT)
+		{
+			return ResourceHandle<TResource>();
+		}
+
+		TResource* resource = new (GetSlot(index).storage) TResource(std::forward<Args>(args)...);
+
+		Slot& slot = GetSlot(index);
+		slot.bIsAlive = true;
+		++liveCount_;
+
+		ResourceHandle<TResource> handle((slot.generation << INDEX_BITS) | index);
+		IResource* base = resource;
+		base->pool_ = this;
+		base->poolHandleID_ = handle.id;
+
+		return handle;
+	}
+
+
+	/**
+	 * @brief ڵ Ű ҽ ϴ.
+	 *
+	 * @param handle ҽ ڵԴϴ.
+	 *
+	 * @return ִ ҽ ҽ , Ǿų ȿ  ڵ̶ nullptr ȯմϴ.
+	 */
+	TResource* Get(const ResourceHandle<TResource>& handle) const
+	{
+		uint32_t index = handle.id & (MAX_RESOURCE_COUNT - 1);
+		if (index >= slotCount_)
+		{
+			return nullptr;
+		}
+
+		const Slot& slot = GetSlot(index);
+		if (!slot.bIsAlive || slot.generation != (handle.id >> INDEX_BITS))
+		{
+			return nullptr;
+		}
+
+		return std::launder(reinterpret_cast<TResource*>(const_cast<unsigned char*>(slot.storage)));
+	}
+
+
+	/**
+	 * @brief ڵ ID Ű ҽ մϴ. ̹  ҽ ƹ͵  ʽϴ.
+	 *
+	 * @param handleID  ҽ ڵ IDԴϴ.
+	 */
+	virtual void Destroy(uint32_t handleID) override
+	{
+		TResource* resource = Get(ResourceHandle<TResource>(handleID));
+		if (!resource)
+		{
+			return;
+		}
+
+		if (resource->IsInitialized())
+		{
+			resource->Release();
+		}
+		resource->~TResource();
+
+		uint32_t index = handleID & (MAX_RESOURCE_COUNT - 1);
+		Slot& slot = GetSlot(index);
+		slot.bIsAlive = false;
+		--liveCount_;
+
+		if (slot.generation < MAX_GENERATION)
+		{
+			++slot.generation;
+			slot.nextFree = freeHead_;
+			freeHead_ = index;
+		}
+	}
+
+
+	/**
+	 * @brief Ǯ  ҽ   մϴ. Ҵ  ״ Ӵϴ.
+	 */
+	virtual void Clear() override
+	{
+		for (uint32_t index = slotCount_; index > 0; --index)
+		{
+			const Slot& slot = GetSlot(index - 1);
+			if (slot.bIsAlive)
+			{
+				Destroy((slot.generation << INDEX_BITS) | (index - 1));
+			}
+		}
+	}
+
+
+	/**
+	 * @brief Ǯ 뷮 ϴ.
+	 *
+	 * @return Ǯ 뷮 ȯմϴ.
+	 */
+	virtual ResourcePoolStats GetStats() const override
+	{
+		ResourcePoolStats stats;
+		stats.typeName = typeName_.c_str();
+		stats.liveCount = liveCount_;
+		stats.slotCount = slotCount_;
+		stats.liveBytes = static_cast<std::size_t>(liveCount_) * sizeof(TResource);
+		stats.reservedBytes = pages_.size() * PAGE_SIZE * sizeof(Slot);
+		return stats;
+	}
+
+
+private:
+	/**
+	 * @brief ҽ ϳ  Դϴ.
+	 */
+	struct Slot
+	{
+		alignas(TResource) unsigned char storage[sizeof(TResource)]; // ҽ  ޸Դϴ.
+		uint32_t generation = 1; //   Դϴ. ҽ   1 մϴ.
+		uint32_t nextFree = INVALID_SLOT; //   Ͽ    εԴϴ.
+		bool bIsAlive = false; // Կ ִ ҽ ִ Դϴ.
+	};
+
+
+	/**
+	 * @brief  ε  ϴ.
+	 */
+	Slot& GetSlot(uint32_t index) { return pages_[index / PAGE_SIZE][index % PAGE_SIZE]; }
+	const Slot& GetSlot(uint32_t index) const { return pages_[index / PAGE_SIZE][index % PAGE_SIZE]; }
+
+
+	/**
+	 * @brief   Ͽ  ϴ.   ٸ   Ҵմϴ.
+	 *
+	 * @return   ε ȯմϴ. Ǯ  áٸ INVALID_SLOT ȯմϴ.
+	 */
+	uint32_t AllocateSlot()
+	{
+		if (freeHead_ != INVALID_SLOT)
+		{
+			uint32_t index = freeHead_;
+			freeHead_ = GetSlot(index).nextFree;
+			return index;
+		}
+
+		if (slotCount_ >= MAX_RESOURCE_COUNT)
+		{
+			return INVALID_SLOT;
+		}
+
+		if (slotCount_ % PAGE_SIZE == 0)
+		{
+			pages_.push_back(std::make_unique<Slot[]>(PAGE_SIZE));
+		}
+
+		return slotCount_++;
+	}
+
+
+private:
+	/**
+	 * @brief     Ÿ εԴϴ.
+	 */
+	static const uint32_t INVALID_SLOT = 0xFFFFFFFF;
+
+
+	/**
+	 * @brief Ǯ  ҽ Ÿ ̸Դϴ.
+	 */
+	std::string typeName_;
+
+
+	/**
+	 * @brief   Դϴ.
+	 */
+	std::vector<std::unique_ptr<Slot[]>> pages_;
+
+
+	/**
+	 * @brief Ҵ  Դϴ.
+	 */
+	uint32_t slotCount_ = 0;
+
+
+	/**
+	 * @brief ִ ҽ Դϴ.
+	 */
+	uint32_t liveCount_ = 0;
+
+
+	/**
+	 * @brief    ù °  εԴϴ.
+	 */
+	uint32_t freeHead_ = INVALID_SLOT;
+};
\ No newline at end of file
@@ -11,6 +11,7 @@
 #include "Vec3.h"
 #include "Vec4.h"
 
+#include "IRenderBackend.h"
 #include "IResource.h"
 
 
@@ -251,21 +252,6 @@ public:
 	void SetUniform(const std::string& name, const Mat4x4& value);
 
 
-protected:
-	/**
-	 * @brief ̴ Դϴ.
-	 */
-	enum class EType : int32_t
-	{
-		Vertex     = 0x8B31,
-		Control    = 0x8E88,
-		Evaluation = 0x8E87,
-		Geometry   = 0x8DD9,
-		Fragment   = 0x8B30,
-		Compute    = 0x91B9,
-	};
-
-
 	/**
 	 * @brief ̴   ü ġ ϴ.
 	 *
@@ -273,11 +259,50 @@ protected:
 	 *
 	 * @return ̴   ü ġ ȯմϴ. ã ϸ -1 ȯմϴ.
 	 *
+	 * @note  ׸⸶ ϴ     ġ   , ġ ޴ SetUniform մϴ.
+	 *
 	 * @see https://registry.khronos.org/OpenGL-Refpages/gl4/html/glGetUniformLocation.xhtml
 	 */
 	int32_t GetUniformLocation(const std::string& name);
 
-	
+
+	/**
+	 * @brief ̴  int Ÿ   մϴ.
+	 *
+	 * @param location GetUniformLocation    ġԴϴ.
+	 * @param value    Դϴ.
+	 */
+	void SetUniform(int32_t location, int32_t value);
+
+
+	/**
+	 * @brief ̴  float Ÿ   մϴ.
+	 *
+	 * @param location GetUniformLocation    ġԴϴ.
+	 * @param value    Դϴ.
+	 */
+	void SetUniform(int32_t location, float value);
+
+
+	/**
+	 * @brief ̴  4  Ÿ   մϴ.
+	 *
+	 * @param location GetUniformLocation    ġԴϴ.
+	 * @param value    Դϴ.
+	 */
+	void SetUniform(int32_t location, const Vec4f& value);
+
+
+	/**
+	 * @brief ̴  4x4  Ÿ   մϴ.
+	 *
+	 * @param location GetUniformLocation    ġԴϴ.
+	 * @param value    Դϴ.
+	 */
+	void SetUniform(int32_t location, const Mat4x4& value);
+
+
+protected:
 	/**
 	 * @brief ̴ Ʈ մϴ.
 	 *
@@ -289,7 +314,7 @@ protected:
 	 *
 	 * @return  ̴ ü ̵ ȯմϴ.
 	 */
-	uint32_t CreateShader(const EType& type, const std::string& path, const char* entryPoint = "main");
+	uint32_t CreateShader(const EShaderType& type, const std::string& path, const char* entryPoint = "main");
 
 
 	/**
@@ -71,6 +71,14 @@ public:
 	const std::vector<VertexType>& GetVertices() const { return vertices_; }
 
 
+	/**
+	 * @brief ޽ ε  ϴ.
+	 *
+	 * @return ޽ ε   ڸ ȯմϴ.
+	 */
+	const std::vector<uint32_t>& GetIndices() const { return indices_; }
+
+
 private:
 	/**
 	 * @brief  Դϴ.
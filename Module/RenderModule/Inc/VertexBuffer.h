@@ -1,5 +1,6 @@
 #pragma once
 
+#include <array>
 #include <cstdint>
 
 
@@ -14,22 +15,38 @@ public:
 	/**
 	 * @brief    Դϴ.
 	 *
+	 * @note
+	 * - StreamRing OpenGL   ƴմϴ.  ε(persistent, coherent) ۸     ۷ մϴ.
+	 * - StreamRing ۿ SetBufferData  WriteRingData ͸  մϴ.
+	 *
 	 * @see https://registry.khronos.org/OpenGL-Refpages/gl2.1/xhtml/glBufferData.xml
+	 * @see https://registry.khronos.org/OpenGL-Refpages/gl4/html/glBufferStorage.xhtml
 	 */
 	enum class EUsage
 	{
-		Stream  = 0x88E0,
-		Static  = 0x88E4,
-		Dynamic = 0x88E8,
+		Stream     = 0x88E0,
+		Static     = 0x88E4,
+		Dynamic    = 0x88E8,
+		StreamRing = 0x0000,
 	};
 
 
+	/**
+	 * @brief StreamRing ۸   Դϴ.
+	 *
+	 * @note CPU   GPU д  ġ ʵ   ư մϴ.
+	 */
+	static const uint32_t RING_SEGMENT_COUNT = 3;
+
+
 public:
 	/**
 	 * @brief ̴    ۸ մϴ.
 	 *
 	 * @param byteSize   Ʈ ũԴϴ.
 	 * @param usage    Դϴ.
+	 *
+	 * @note   StreamRing̸ byteSize   ũ̸, δ RING_SEGMENT_COUNT ũ ۸ Ҵմϴ. ̶ byteSize  ũ  մϴ.
 	 */
 	VertexBuffer(uint32_t byteSize, const EUsage& usage);
 
@@ -69,7 +86,30 @@ public:
 	 * @param bufferSize ۿ   ũԴϴ.
 	 */
 	void SetBufferData(const void* bufferPtr, uint32_t bufferSize);
-	
+
+
+	/**
+	 * @brief StreamRing     ͸ ̾ ϴ.
+	 *
+	 * @param bufferPtr ۿ    Դϴ.
+	 * @param stride  ϳ Ʈ ũԴϴ.
+	 * @param vertexCount ۿ   Դϴ.
+	 *
+	 * @return ׸    ù °  ε ȯմϴ.
+	 *
+	 * @note
+	 * -   Ʈ ۿ ϸ,  ε ȣ ʿ ʽϴ.
+	 * -  ٲų     潺 ġϰ   Ѿ, GPU      մϴ.
+	 */
+	uint32_t WriteRingData(const void* bufferPtr, uint32_t stride, uint32_t vertexCount);
+
+
+private:
+	/**
+	 * @brief StreamRing    潺 ġϰ   Ѿϴ.
+	 */
+	void AdvanceRingSegment();
+
 
 private:
 	/**
@@ -88,4 +128,34 @@ private:
 	 * @brief    Դϴ.
 	 */
 	EUsage usage_ = EUsage::Static;
+
+
+	/**
+	 * @brief StreamRing   ε Դϴ.
+	 */
+	uint8_t* ringBufferPtr_ = nullptr;
+
+
+	/**
+	 * @brief StreamRing ۿ   ִ  εԴϴ.
+	 */
+	uint32_t ringSegment_ = 0;
+
+
+	/**
+	 * @brief StreamRing       ġ(Ʈ)Դϴ.
+	 */
+	uint32_t ringOffset_ = 0;
+
+
+	/**
+	 * @brief StreamRing ۿ  ͸   ȣԴϴ.
+	 */
+	uint64_t ringFrame_ = 0;
+
+
+	/**
+	 * @brief StreamRing   潺Դϴ. 0̸ 潺 ϴ.
+	 */
+	std::array<uint64_t, RING_SEGMENT_COUNT> ringFences_ = { 0, 0, 0 };
 };
\ No newline at end of file
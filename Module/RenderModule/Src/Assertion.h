@@ -5,7 +5,28 @@
 #include <cstdio>
 #include <cstring>
 #include <string>
+
+#if defined(_WIN32) || defined(_WIN64)
 #include <windows.h>
+#else
+#include <csignal>
+#include <cstdlib>
+#include <cwchar>
+
+/**
+ * @brief Windows ̿ ÷  극ũ Ʈ մϴ.
+ */
+#ifndef __debugbreak
+#define __debugbreak() std::raise(SIGTRAP)
+#endif
+
+/**
+ * @brief Windows ̿ ÷ μ Ḧ մϴ.
+ */
+#ifndef ExitProcess
+#define ExitProcess(ExitCode) std::exit(ExitCode)
+#endif
+#endif
 
 
 #if defined(DEBUG_MODE) || defined(RELEASE_MODE) || defined(DEVELOPMENT_MODE)
@@ -26,10 +47,17 @@ inline void DebugPrintF(const char* format, ...)
 
 	va_list args;
 	va_start(args, format);
+#if defined(_WIN32) || defined(_WIN64)
 	int32_t size = _vsnprintf_s(buffer, BUFFER_SIZE, BUFFER_SIZE, format, args);
 	va_end(args);
 
 	OutputDebugStringA(buffer);
+#else
+	std::vsnprintf(buffer, BUFFER_SIZE, format, args);
+	va_end(args);
+
+	std::fputs(buffer, stderr);
+#endif
 }
 
 
@@ -50,10 +78,17 @@ inline void DebugPrintF(const wchar_t* format, ...)
 
 	va_list args;
 	va_start(args, format);
+#if defined(_WIN32) || defined(_WIN64)
 	int32_t size = _vsnwprintf_s(buffer, BUFFER_SIZE, format, args);
 	va_end(args);
 
 	OutputDebugStringW(buffer);
+#else
+	std::vswprintf(buffer, BUFFER_SIZE, format, args);
+	va_end(args);
+
+	std::fputws(buffer, stderr);
+#endif
 }
 #endif
 
@@ -142,6 +177,8 @@ inline void DebugPrintF(const wchar_t* format, ...)
 
 
 #if defined(__glad_h_)
+#include "GLErrorCheck.h"
+
 /**
  * @brief  ڵ忡 ϴ ޽ ϴ.
  *
@@ -319,37 +356,15 @@ Expression;
  * @param Expression ˻ ȣⰪԴϴ.
  *
  * @note
- * - Debug  Release 忡 򰡽 ˻ Shipping 忡 򰡽 ˻ ʽϴ.
+ * - Debug  Release 忡 GLErrorCheck å  ˻ Shipping 忡 ˻ ʽϴ.
+ * - ⺻ å Debug 忡 ȣ⸶ ˻(PerCall), Release 忡 Ӹ ˻(PerFrame)Դϴ.
  * - Ű ϸ 극ũ Ʈ ɸϴ.
  */
-#if defined(DEBUG_MODE)
-#ifndef GL_FAILED
-#define GL_FAILED(Expression)\
-Expression;\
-{\
-	GLenum _errorCode = glGetError();                                                                                           \
-	if (_errorCode != GL_NO_ERROR)                                                                                              \
-	{                                                                                                                           \
-		DebugPrintF("\nOpenGL API call has failed!\nFile : %s\nLine : %d\nExpression : %s\n", __FILE__, __LINE__, #Expression); \
-		DebugPrintF("OpenGL error message : %s\n\n", GetErrorCodeMessageA(_errorCode).c_str());                                 \
-		__debugbreak();                                                                                                         \
-		ExitProcess(-1);                                                                                                        \
-	}\
-}
-#endif
-#elif defined(RELEASE_MODE) || defined(DEVELOPMENT_MODE)
+#if defined(DEBUG_MODE) || defined(RELEASE_MODE) || defined(DEVELOPMENT_MODE)
 #ifndef GL_FAILED
 #define GL_FAILED(Expression)\
 Expression;\
-{\
-	GLenum _errorCode = glGetError();                                                                                           \
-	if (_errorCode != GL_NO_ERROR)                                                                                              \
-	{                                                                                                                           \
-		DebugPrintF("\nOpenGL API call has failed!\nFile : %s\nLine : %d\nExpression : %s\n", __FILE__, __LINE__, #Expression); \
-		DebugPrintF("OpenGL error message : %s\n\n", GetErrorCodeMessageA(_errorCode).c_str());                                 \
-		__debugbreak();                                                                                                         \
-	}\
-}
+GLErrorCheck::CheckCall(__FILE__, __LINE__, #Expression);
 #endif
 #else // defined(SHIPPING_MODE)
 #ifndef GL_FAILED
@@ -0,0 +1,531 @@
+#include "Assertion.h"
+#include "CachedRenderBackend.h"
+
+const uint32_t CachedRenderBackend::UNKNOWN_STATE;
+
+CachedRenderBackend::CachedRenderBackend(std::unique_ptr<IRenderBackend> device)
+	: device_(std::move(device))
+{
+	CHECK(device_ != nullptr);
+	Invalidate();
+}
+
+void CachedRenderBackend::BeginFrame(float red, float green, float blue, float alpha, float depth, uint8_t stencil)
+{
+	device_->BeginFrame(red, green, blue, alpha, depth, stencil);
+}
+
+void CachedRenderBackend::EndFrame()
+{
+	Flush();
+	device_->EndFrame();
+
+	Invalidate();
+}
+
+bool CachedRenderBackend::GetScreenSize(int32_t& outWidth, int32_t& outHeight)
+{
+	return device_->GetScreenSize(outWidth, outHeight);
+}
+
+void CachedRenderBackend::SetViewport(int32_t x, int32_t y, int32_t width, int32_t height)
+{
+	if (bIsViewportKnown_ && viewport_[0] == x && viewport_[1] == y && viewport_[2] == width && viewport_[3] == height)
+	{
+		counters_.skippedStateCount++;
+		return;
+	}
+
+	viewport_ = { x, y, width, height };
+	bIsViewportKnown_ = true;
+
+	counters_.issuedStateCount++;
+	device_->SetViewport(x, y, width, height);
+}
+
+void CachedRenderBackend::SetVsyncMode(bool bIsEnable)
+{
+	device_->SetVsyncMode(bIsEnable);
+}
+
+void CachedRenderBackend::SetRenderState(const ERenderState& state, bool bIsEnable)
+{
+	RequestState(renderStates_[GetRenderStateSlot(state)], bIsEnable ? 1 : 0);
+}
+
+bool CachedRenderBackend::GetRenderState(const ERenderState& state)
+{
+	DeferredState& renderState = renderStates_[GetRenderStateSlot(state)];
+
+	if (renderState.requested == UNKNOWN_STATE)
+	{
+		counters_.issuedQueryCount++;
+		renderState.requested = device_->GetRenderState(state) ? 1 : 0;
+		renderState.applied = renderState.requested;
+	}
+	else
+	{
+		counters_.servedQueryCount++;
+	}
+
+	return renderState.requested == 1;
+}
+
+uint32_t CachedRenderBackend::CreateBuffer(const EBufferType& type, const void* bufferPtr, uint32_t byteSize, const VertexBuffer::EUsage& usage)
+{
+	if (type == EBufferType::Index)
+	{
+		FlushVertexArray();
+	}
+
+	uint32_t bufferID = device_->CreateBuffer(type, bufferPtr, byteSize, usage);
+	buffers_[GetBufferSlot(type)] = bufferID;
+
+	return bufferID;
+}
+
+void CachedRenderBackend::DestroyBuffer(uint32_t bufferID)
+{
+	FlushVertexArray();
+	device_->DestroyBuffer(bufferID);
+
+	for (uint32_t& buffer : buffers_)
+	{
+		if (buffer == bufferID)
+		{
+			buffer = 0;
+		}
+	}
+
+	for (uint32_t& uniformBinding : uniformBindings_)
+	{
+		if (uniformBinding == bufferID)
+		{
+			uniformBinding = 0;
+		}
+	}
+}
+
+void CachedRenderBackend::BindBuffer(const EBufferType& type, uint32_t bufferID)
+{
+	if (type == EBufferType::Index)
+	{
+		FlushVertexArray();
+	}
+
+	if (UpdateShadow(buffers_[GetBufferSlot(type)], bufferID))
+	{
+		device_->BindBuffer(type, bufferID);
+	}
+}
+
+void CachedRenderBackend::BindBufferBase(const EBufferType& type, uint32_t bindingIndex, uint32_t bufferID)
+{
+	if (type == EBufferType::Uniform && bindingIndex < MAX_BINDING_SLOT)
+	{
+		if (!UpdateShadow(uniformBindings_[bindingIndex], bufferID))
+		{
+			return;
+		}
+	}
+	else
+	{
+		counters_.issuedStateCount++;
+	}
+
+	device_->BindBufferBase(type, bindingIndex, bufferID);
+	buffers_[GetBufferSlot(type)] = bufferID;
+}
+
+void CachedRenderBackend::SetBufferData(const EBufferType& type, const void* bufferPtr, uint32_t byteSize, const VertexBuffer::EUsage& usage)
+{
+	if (type == EBufferType::Index)
+	{
+		FlushVertexArray();
+	}
+
+	device_->SetBufferData(type, bufferPtr, byteSize, usage);
+}
+
+void CachedRenderBackend::SetBufferSubData(const EBufferType& type, uint32_t byteOffset, const void* bufferPtr, uint32_t byteSize)
+{
+	if (type == EBufferType::Index)
+	{
+		FlushVertexArray();
+	}
+
+	device_->SetBufferSubData(type, byteOffset, bufferPtr, byteSize);
+}
+
+void* CachedRenderBackend::MapBuffer(const EBufferType& type)
+{
+	if (type == EBufferType::Index)
+	{
+		FlushVertexArray();
+	}
+
+	return device_->MapBuffer(type);
+}
+
+void CachedRenderBackend::UnmapBuffer(const EBufferType& type)
+{
+	if (type == EBufferType::Index)
+	{
+		FlushVertexArray();
+	}
+
+	device_->UnmapBuffer(type);
+}
+
+void* CachedRenderBackend::MapBufferPersistent(const EBufferType& type)
+{
+	if (type == EBufferType::Index)
+	{
+		FlushVertexArray();
+	}
+
+	return device_->MapBufferPersistent(type);
+}
+
+uint64_t CachedRenderBackend::CreateFence()
+{
+	return device_->CreateFence();
+}
+
+void CachedRenderBackend::WaitFence(uint64_t fence)
+{
+	device_->WaitFence(fence);
+}
+
+void CachedRenderBackend::DestroyFence(uint64_t fence)
+{
+	device_->DestroyFence(fence);
+}
+
+uint32_t CachedRenderBackend::CreateVertexArray()
+{
+	return device_->CreateVertexArray();
+}
+
+void CachedRenderBackend::DestroyVertexArray(uint32_t vertexArrayID)
+{
+	FlushVertexArray();
+	device_->DestroyVertexArray(vertexArrayID);
+
+	if (vertexArray_.applied == vertexArrayID)
+	{
+		vertexArray_.requested = 0;
+		vertexArray_.applied = 0;
+		buffers_[GetBufferSlot(EBufferType::Index)] = UNKNOWN_STATE;
+	}
+}
+
+void CachedRenderBackend::BindVertexArray(uint32_t vertexArrayID)
+{
+	RequestState(vertexArray_, vertexArrayID);
+}
+
+void CachedRenderBackend::SetVertexAttribute(uint32_t location, uint32_t componentCount, uint32_t stride, uint32_t byteOffset)
+{
+	FlushVertexArray();
+	device_->SetVertexAttribute(location, componentCount, stride, byteOffset);
+}
+
+void CachedRenderBackend::EnableVertexAttribute(uint32_t location)
+{
+	FlushVertexArray();
+	device_->EnableVertexAttribute(location);
+}
+
+void CachedRenderBackend::SetVertexAttributeDivisor(uint32_t location, uint32_t divisor)
+{
+	FlushVertexArray();
+	device_->SetVertexAttributeDivisor(location, divisor);
+}
+
+uint32_t CachedRenderBackend::CreateShader(const EShaderType& type, const std::string& source, std::string& outErrorLog)
+{
+	return device_->CreateShader(type, source, outErrorLog);
+}
+
+void CachedRenderBackend::DestroyShader(uint32_t shaderID)
+{
+	device_->DestroyShader(shaderID);
+}
+
+uint32_t CachedRenderBackend::CreateProgram(const std::vector<uint32_t>& shaderIDs, std::string& outErrorLog)
+{
+	return device_->CreateProgram(shaderIDs, outErrorLog);
+}
+
+void CachedRenderBackend::DestroyProgram(uint32_t programID)
+{
+	FlushProgram();
+	device_->DestroyProgram(programID);
+
+	if (program_.applied == programID)
+	{
+		program_.requested = UNKNOWN_STATE;
+		program_.applied = UNKNOWN_STATE;
+	}
+}
+
+void CachedRenderBackend::BindProgram(uint32_t programID)
+{
+	RequestState(program_, programID);
+}
+
+int32_t CachedRenderBackend::GetUniformLocation(uint32_t programID, const std::string& name)
+{
+	return device_->GetUniformLocation(programID, name);
+}
+
+void CachedRenderBackend::SetUniformInt(int32_t location, const int32_t* values, uint32_t componentCount)
+{
+	FlushProgram();
+	device_->SetUniformInt(location, values, componentCount);
+}
+
+void CachedRenderBackend::SetUniformFloat(int32_t location, const float* values, uint32_t componentCount)
+{
+	FlushProgram();
+	device_->SetUniformFloat(location, values, componentCount);
+}
+
+void CachedRenderBackend::SetUniformMatrix(int32_t location, const float* values, uint32_t dimension)
+{
+	FlushProgram();
+	device_->SetUniformMatrix(location, values, dimension);
+}
+
+uint32_t CachedRenderBackend::CreateTexture2D(int32_t width, int32_t height)
+{
+	uint32_t textureID = device_->CreateTexture2D(width, height);
+	textures_.fill(UNKNOWN_STATE);
+
+	return textureID;
+}
+
+void CachedRenderBackend::DestroyTexture(uint32_t textureID)
+{
+	device_->DestroyTexture(textureID);
+
+	for (uint32_t& texture : textures_)
+	{
+		if (texture == textureID)
+		{
+			texture = 0;
+		}
+	}
+}
+
+void CachedRenderBackend::BindTexture(uint32_t unit, uint32_t textureID)
+{
+	if (unit < MAX_BINDING_SLOT)
+	{
+		if (!UpdateShadow(textures_[unit], textureID))
+		{
+			return;
+		}
+	}
+	else
+	{
+		counters_.issuedStateCount++;
+	}
+
+	device_->BindTexture(unit, textureID);
+}
+
+void CachedRenderBackend::BindImageTexture(uint32_t unit, uint32_t textureID)
+{
+	device_->BindImageTexture(unit, textureID);
+}
+
+void CachedRenderBackend::DispatchCompute(uint32_t workGroupX, uint32_t workGroupY, uint32_t workGroupZ)
+{
+	FlushProgram();
+	device_->DispatchCompute(workGroupX, workGroupY, workGroupZ);
+}
+
+void CachedRenderBackend::DrawVertex(const EDrawMode& drawMode, uint32_t vertexCount, uint32_t firstVertex)
+{
+	Flush();
+	device_->DrawVertex(drawMode, vertexCount, firstVertex);
+}
+
+void CachedRenderBackend::DrawIndex(const EDrawMode& drawMode, uint32_t indexCount)
+{
+	Flush();
+	device_->DrawIndex(drawMode, indexCount);
+}
+
+void CachedRenderBackend::DrawVertexInstanced(const EDrawMode& drawMode, uint32_t vertexCount, uint32_t instanceCount, uint32_t firstInstance)
+{
+	Flush();
+	device_->DrawVertexInstanced(drawMode, vertexCount, instanceCount, firstInstance);
+}
+
+void CachedRenderBackend::DrawIndexInstanced(const EDrawMode& drawMode, uint32_t indexCount, uint32_t instanceCount, uint32_t firstInstance)
+{
+	Flush();
+	device_->DrawIndexInstanced(drawMode, indexCount, instanceCount, firstInstance);
+}
+
+void CachedRenderBackend::Invalidate()
+{
+	for (DeferredState& renderState : renderStates_)
+	{
+		renderState.applied = UNKNOWN_STATE;
+		renderState.bIsDirty = (renderState.requested != UNKNOWN_STATE);
+	}
+
+	program_.applied = UNKNOWN_STATE;
+	program_.bIsDirty = (program_.requested != UNKNOWN_STATE);
+
+	vertexArray_.applied = UNKNOWN_STATE;
+	vertexArray_.bIsDirty = (vertexArray_.requested != UNKNOWN_STATE);
+
+	bIsViewportKnown_ = false;
+	buffers_.fill(UNKNOWN_STATE);
+	uniformBindings_.fill(UNKNOWN_STATE);
+	textures_.fill(UNKNOWN_STATE);
+}
+
+void CachedRenderBackend::Flush()
+{
+	FlushRenderStates();
+	FlushProgram();
+	FlushVertexArray();
+}
+
+uint32_t CachedRenderBackend::GetRenderStateSlot(const ERenderState& state)
+{
+	switch (state)
+	{
+	case ERenderState::Depth:
+		return 0;
+
+	case ERenderState::Stencil:
+		return 1;
+
+	case ERenderState::AlphaBlend:
+		return 2;
+
+	case ERenderState::Multisample:
+		return 3;
+
+	case ERenderState::PointSize:
+		return 4;
+
+	default:
+		ASSERT(false, "undefined render state");
+		return 0;
+	}
+}
+
+uint32_t CachedRenderBackend::GetBufferSlot(const EBufferType& type)
+{
+	switch (type)
+	{
+	case EBufferType::Vertex:
+		return 0;
+
+	case EBufferType::Index:
+		return 1;
+
+	case EBufferType::Uniform:
+		return 2;
+
+	default:
+		ASSERT(false, "undefined buffer type");
+		return 0;
+	}
+}
+
+bool CachedRenderBackend::UpdateShadow(uint32_t& shadow, uint32_t value)
+{
+	if (shadow == value)
+	{
+		counters_.skippedStateCount++;
+		return false;
+	}
+
+	shadow = value;
+	counters_.issuedStateCount++;
+	return true;
+}
+
+void CachedRenderBackend::RequestState(DeferredState& state, uint32_t value)
+{
+	if (state.requested == value)
+	{
+		counters_.skippedStateCount++;
+		return;
+	}
+
+	if (state.bIsDirty)
+	{
+		counters_.skippedStateCount++;
+	}
+
+	state.requested = value;
+	state.bIsDirty = true;
+}
+
+bool CachedRenderBackend::ApplyState(DeferredState& state)
+{
+	if (!state.bIsDirty)
+	{
+		return false;
+	}
+
+	state.bIsDirty = false;
+
+	if (state.applied == state.requested)
+	{
+		counters_.skippedStateCount++;
+		return false;
+	}
+
+	state.applied = state.requested;
+	counters_.issuedStateCount++;
+	return true;
+}
+
+void CachedRenderBackend::FlushRenderStates()
+{
+	static const ERenderState renderStates[RENDER_STATE_COUNT] =
+	{
+		ERenderState::Depth,
+		ERenderState::Stencil,
+		ERenderState::AlphaBlend,
+		ERenderState::Multisample,
+		ERenderState::PointSize,
+	};
+
+	for (const ERenderState& renderState : renderStates)
+	{
+		DeferredState& state = renderStates_[GetRenderStateSlot(renderState)];
+		if (ApplyState(state))
+		{
+			device_->SetRenderState(renderState, state.applied == 1);
+		}
+	}
+}
+
+void CachedRenderBackend::FlushProgram()
+{
+	if (ApplyState(program_))
+	{
+		device_->BindProgram(program_.applied);
+	}
+}
+
+void CachedRenderBackend::FlushVertexArray()
+{
+	if (ApplyState(vertexArray_))
+	{
+		device_->BindVertexArray(vertexArray_.applied);
+		buffers_[GetBufferSlot(EBufferType::Index)] = UNKNOWN_STATE;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,203 @@
+#include "Assertion.h"
+#include "GLErrorCheck.h"
+
+/**
+ * @brief ׷Ƚ API   ϴ  ڵ  ޽ Դϴ.
+ */
+static const uint32_t GL_ERROR_NONE = 0x0000;
+static const uint32_t GL_DEBUG_MESSAGE_TYPE_ERROR = 0x824C;
+
+/**
+ * @brief   ˻翡   ִ Դϴ. ؽƮ     ȯ  Ƿ մϴ.
+ */
+static const uint32_t MAX_ERROR_QUERY_COUNT = 16;
+
+/**
+ * @brief  ڵ忡 ϴ ̸ ϴ.
+ *
+ * @param errorCode Ȯ  ڵԴϴ.
+ *
+ * @return  ڵ忡 ϴ ̸ ȯմϴ.
+ */
+static const char* GetErrorCodeName(uint32_t errorCode)
+{
+	switch (errorCode)
+	{
+	case 0x0500:
+		return "GL_INVALID_ENUM";
+
+	case 0x0501:
+		return "GL_INVALID_VALUE";
+
+	case 0x0502:
+		return "GL_INVALID_OPERATION";
+
+	case 0x0503:
+		return "GL_STACK_OVERFLOW";
+
+	case 0x0504:
+		return "GL_STACK_UNDERFLOW";
+
+	case 0x0505:
+		return "GL_OUT_OF_MEMORY";
+
+	case 0x0506:
+		return "GL_INVALID_FRAMEBUFFER_OPERATION";
+
+	case 0x0507:
+		return "GL_CONTEXT_LOST";
+
+	default:
+		return "Undefined error code";
+	}
+}
+
+/**
+ * @brief ߰  մϴ.
+ *
+ * @param file  Ų  ̸Դϴ.
+ * @param line  Ų  ȣԴϴ.
+ * @param expression  Ų ȣ ǥԴϴ.
+ * @param message  ޽Դϴ.
+ *
+ * @note
+ * - Debug 忡 μ ϰ, Release 忡 극ũ Ʈ ̴ϴ.
+ * - Shipping 忡  ʽϴ.
+ */
+static void ReportError(const char* file, int32_t line, const char* expression, const char* message)
+{
+#if defined(DEBUG_MODE)
+	DebugPrintF("\nOpenGL API call has failed!\nFile : %s\nLine : %d\nExpression : %s\n", file, line, expression);
+	DebugPrintF("OpenGL error message : %s\n\n", message);
+	__debugbreak();
+	ExitProcess(-1);
+#elif defined(RELEASE_MODE) || defined(DEVELOPMENT_MODE)
+	DebugPrintF("\nOpenGL API call has failed!\nFile : %s\nLine : %d\nExpression : %s\n", file, line, expression);
+	DebugPrintF("OpenGL error message : %s\n\n", message);
+	__debugbreak();
+#endif
+}
+
+#if defined(DEBUG_MODE)
+GLErrorCheck::EMode GLErrorCheck::mode = GLErrorCheck::EMode::PerCall;
+#elif defined(RELEASE_MODE) || defined(DEVELOPMENT_MODE)
+GLErrorCheck::EMode GLErrorCheck::mode = GLErrorCheck::EMode::PerFrame;
+#else // defined(SHIPPING_MODE)
+GLErrorCheck::EMode GLErrorCheck::mode = GLErrorCheck::EMode::Off;
+#endif
+GLErrorCheck::FunctionTable GLErrorCheck::functionTable;
+const char* GLErrorCheck::lastFile = "unknown";
+int32_t GLErrorCheck::lastLine = 0;
+const char* GLErrorCheck::lastExpression = "unknown";
+bool GLErrorCheck::bIsPendingError = false;
+std::string GLErrorCheck::pendingMessage;
+GLErrorCheck::Counters GLErrorCheck::counters;
+
+void GLErrorCheck::SetFunctionTable(const FunctionTable& table)
+{
+	if (mode == EMode::DebugCallback && functionTable.disableDebugOutput)
+	{
+		functionTable.disableDebugOutput();
+	}
+
+	functionTable = table;
+
+	SetMode(mode);
+}
+
+void GLErrorCheck::SetMode(const EMode& checkMode)
+{
+	if (mode == EMode::DebugCallback && checkMode != EMode::DebugCallback && functionTable.disableDebugOutput)
+	{
+		functionTable.disableDebugOutput();
+	}
+
+	mode = checkMode;
+	bIsPendingError = false;
+
+	if (mode == EMode::DebugCallback)
+	{
+		if (!functionTable.enableDebugOutput || !functionTable.enableDebugOutput(OnDebugMessage))
+		{
+			mode = EMode::PerFrame;
+		}
+	}
+}
+
+void GLErrorCheck::CheckFrame()
+{
+	switch (mode)
+	{
+	case EMode::PerFrame:
+		if (QueryError(lastFile, lastLine, lastExpression))
+		{
+			mode = EMode::PerCall;
+		}
+		break;
+
+	case EMode::DebugCallback:
+		if (bIsPendingError)
+		{
+			ReportPendingError("unknown", 0, "unchecked call before the end of frame");
+		}
+		break;
+
+	default:
+		break;
+	}
+}
+
+bool GLErrorCheck::QueryError(const char* file, int32_t line, const char* expression)
+{
+	if (!functionTable.getError)
+	{
+		return false;
+	}
+
+	bool bIsFailed = false;
+	for (uint32_t count = 0; count < MAX_ERROR_QUERY_COUNT; ++count)
+	{
+		counters.errorQueryCount++;
+
+		uint32_t errorCode = functionTable.getError();
+		if (errorCode == GL_ERROR_NONE)
+		{
+			break;
+		}
+
+		counters.errorCount++;
+		bIsFailed = true;
+
+		ReportError(file, line, expression, GetErrorCodeName(errorCode));
+	}
+
+	return bIsFailed;
+}
+
+void GLErrorCheck::ReportPendingError(const char* file, int32_t line, const char* expression)
+{
+	bIsPendingError = false;
+	counters.errorCount++;
+
+	ReportError(file, line, expression, pendingMessage.c_str());
+}
+
+void GLErrorCheck::OnDebugMessage(uint32_t type, const char* message)
+{
+	if (type != GL_DEBUG_MESSAGE_TYPE_ERROR)
+	{
+		return;
+	}
+
+	if (bIsPendingError)
+	{
+		pendingMessage += "\n";
+		pendingMessage += message;
+	}
+	else
+	{
+		pendingMessage = message;
+	}
+
+	bIsPendingError = true;
+}
\ No newline at end of file
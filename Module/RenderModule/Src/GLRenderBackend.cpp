@@ -0,0 +1,463 @@
+#if defined(_WIN32) || defined(_WIN64)
+#include <glad/glad.h>
+#include <glad/glad_wgl.h>
+
+#include <imgui.h>
+#include <imgui_impl_opengl3.h>
+
+#include "Assertion.h"
+#include "GLErrorCheck.h"
+#include "GLRenderBackend.h"
+
+/**
+ * @brief   ޽  GLErrorCheck ݹԴϴ.
+ */
+static GLErrorCheck::DebugMessageCallback debugMessageCallback = nullptr;
+
+static uint32_t GetGLError()
+{
+	return static_cast<uint32_t>(glGetError());
+}
+
+static void APIENTRY OnGLDebugMessage(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar* message, const void* userParam)
+{
+	if (debugMessageCallback)
+	{
+		debugMessageCallback(static_cast<uint32_t>(type), message);
+	}
+}
+
+static bool EnableGLDebugOutput(GLErrorCheck::DebugMessageCallback callback)
+{
+	if (!GLAD_GL_VERSION_4_3 || !glDebugMessageCallback)
+	{
+		return false;
+	}
+
+	debugMessageCallback = callback;
+
+	glEnable(GL_DEBUG_OUTPUT);
+	glEnable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+	glDebugMessageCallback(OnGLDebugMessage, nullptr);
+
+	return true;
+}
+
+static void DisableGLDebugOutput()
+{
+	glDebugMessageCallback(nullptr, nullptr);
+	glDisable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+	glDisable(GL_DEBUG_OUTPUT);
+
+	debugMessageCallback = nullptr;
+}
+
+GLRenderBackend::GLRenderBackend(HWND renderTargetHandle, HDC deviceContext)
+	: renderTargetHandle_(renderTargetHandle)
+	, deviceContext_(deviceContext)
+{
+	GLErrorCheck::FunctionTable functionTable;
+	functionTable.getError = GetGLError;
+	functionTable.enableDebugOutput = EnableGLDebugOutput;
+	functionTable.disableDebugOutput = DisableGLDebugOutput;
+
+	GLErrorCheck::SetFunctionTable(functionTable);
+}
+
+GLRenderBackend::~GLRenderBackend()
+{
+	GLErrorCheck::SetFunctionTable(GLErrorCheck::FunctionTable());
+}
+
+void GLRenderBackend::BeginFrame(float red, float green, float blue, float alpha, float depth, uint8_t stencil)
+{
+	ImGui::Render();
+
+	glClearColor(red, green, blue, alpha);
+	glClearDepth(depth);
+	glClearStencil(stencil);
+
+	GL_FAILED(glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT));
+}
+
+void GLRenderBackend::EndFrame()
+{
+	ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+
+	GLErrorCheck::CheckFrame();
+
+	CHECK(SwapBuffers(deviceContext_));
+}
+
+bool GLRenderBackend::GetScreenSize(int32_t& outWidth, int32_t& outHeight)
+{
+	RECT windowRect;
+	if (!GetClientRect(renderTargetHandle_, &windowRect))
+	{
+		return false;
+	}
+
+	outWidth = static_cast<int32_t>(windowRect.right - windowRect.left);
+	outHeight = static_cast<int32_t>(windowRect.bottom - windowRect.top);
+
+	return true;
+}
+
+void GLRenderBackend::SetViewport(int32_t x, int32_t y, int32_t width, int32_t height)
+{
+	glViewport(x, y, width, height);
+}
+
+void GLRenderBackend::SetVsyncMode(bool bIsEnable)
+{
+	CHECK(wglSwapIntervalEXT(static_cast<int32_t>(bIsEnable)));
+}
+
+void GLRenderBackend::SetRenderState(const ERenderState& state, bool bIsEnable)
+{
+	if (bIsEnable)
+	{
+		GL_FAILED(glEnable(static_cast<GLenum>(state)));
+
+		if (state == ERenderState::AlphaBlend)
+		{
+			GL_FAILED(glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ZERO));
+		}
+	}
+	else
+	{
+		GL_FAILED(glDisable(static_cast<GLenum>(state)));
+	}
+}
+
+bool GLRenderBackend::GetRenderState(const ERenderState& state)
+{
+	GLboolean bIsEnable;
+	GL_FAILED(glGetBooleanv(static_cast<GLenum>(state), &bIsEnable));
+
+	return bIsEnable == GL_TRUE;
+}
+
+uint32_t GLRenderBackend::CreateBuffer(const EBufferType& type, const void* bufferPtr, uint32_t byteSize, const VertexBuffer::EUsage& usage)
+{
+	uint32_t bufferID = 0;
+
+	GL_FAILED(glGenBuffers(1, &bufferID));
+	GL_FAILED(glBindBuffer(static_cast<GLenum>(type), bufferID));
+
+	if (usage == VertexBuffer::EUsage::StreamRing)
+	{
+		GL_FAILED(glBufferStorage(static_cast<GLenum>(type), byteSize, bufferPtr, GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT));
+	}
+	else
+	{
+		GL_FAILED(glBufferData(static_cast<GLenum>(type), byteSize, bufferPtr, static_cast<GLenum>(usage)));
+	}
+
+	return bufferID;
+}
+
+void GLRenderBackend::DestroyBuffer(uint32_t bufferID)
+{
+	GL_FAILED(glDeleteBuffers(1, &bufferID));
+}
+
+void GLRenderBackend::BindBuffer(const EBufferType& type, uint32_t bufferID)
+{
+	GL_FAILED(glBindBuffer(static_cast<GLenum>(type), bufferID));
+}
+
+void GLRenderBackend::BindBufferBase(const EBufferType& type, uint32_t bindingIndex, uint32_t bufferID)
+{
+	GL_FAILED(glBindBufferBase(static_cast<GLenum>(type), bindingIndex, bufferID));
+}
+
+void GLRenderBackend::SetBufferData(const EBufferType& type, const void* bufferPtr, uint32_t byteSize, const VertexBuffer::EUsage& usage)
+{
+	GL_FAILED(glBufferData(static_cast<GLenum>(type), byteSize, bufferPtr, static_cast<GLenum>(usage)));
+}
+
+void GLRenderBackend::SetBufferSubData(const EBufferType& type, uint32_t byteOffset, const void* bufferPtr, uint32_t byteSize)
+{
+	GL_FAILED(glBufferSubData(static_cast<GLenum>(type), byteOffset, byteSize, bufferPtr));
+}
+
+void* GLRenderBackend::MapBuffer(const EBufferType& type)
+{
+	return glMapBuffer(static_cast<GLenum>(type), GL_WRITE_ONLY);
+}
+
+void GLRenderBackend::UnmapBuffer(const EBufferType& type)
+{
+	GL_FAILED(glUnmapBuffer(static_cast<GLenum>(type)));
+}
+
+void* GLRenderBackend::MapBufferPersistent(const EBufferType& type)
+{
+	GLint byteSize = 0;
+	GL_FAILED(glGetBufferParameteriv(static_cast<GLenum>(type), GL_BUFFER_SIZE, &byteSize));
+
+	return glMapBufferRange(static_cast<GLenum>(type), 0, byteSize, GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT);
+}
+
+uint64_t GLRenderBackend::CreateFence()
+{
+	GLsync fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	return reinterpret_cast<uint64_t>(fence);
+}
+
+void GLRenderBackend::WaitFence(uint64_t fence)
+{
+	static const GLuint64 WAIT_TIMEOUT_NS = 1000000;
+
+	GLsync sync = reinterpret_cast<GLsync>(fence);
+	while (true)
+	{
+		GLenum result = glClientWaitSync(sync, GL_SYNC_FLUSH_COMMANDS_BIT, WAIT_TIMEOUT_NS);
+		if (result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED || result == GL_WAIT_FAILED)
+		{
+			break;
+		}
+	}
+}
+
+void GLRenderBackend::DestroyFence(uint64_t fence)
+{
+	GL_FAILED(glDeleteSync(reinterpret_cast<GLsync>(fence)));
+}
+
+uint32_t GLRenderBackend::CreateVertexArray()
+{
+	uint32_t vertexArrayID = 0;
+	GL_FAILED(glGenVertexArrays(1, &vertexArrayID));
+
+	return vertexArrayID;
+}
+
+void GLRenderBackend::DestroyVertexArray(uint32_t vertexArrayID)
+{
+	GL_FAILED(glDeleteVertexArrays(1, &vertexArrayID));
+}
+
+void GLRenderBackend::BindVertexArray(uint32_t vertexArrayID)
+{
+	GL_FAILED(glBindVertexArray(vertexArrayID));
+}
+
+void GLRenderBackend::SetVertexAttribute(uint32_t location, uint32_t componentCount, uint32_t stride, uint32_t byteOffset)
+{
+	GL_FAILED(glVertexAttribPointer(location, componentCount, GL_FLOAT, GL_FALSE, stride, reinterpret_cast<const void*>(static_cast<uintptr_t>(byteOffset))));
+}
+
+void GLRenderBackend::EnableVertexAttribute(uint32_t location)
+{
+	GL_FAILED(glEnableVertexAttribArray(location));
+}
+
+void GLRenderBackend::SetVertexAttributeDivisor(uint32_t location, uint32_t divisor)
+{
+	GL_FAILED(glVertexAttribDivisor(location, divisor));
+}
+
+uint32_t GLRenderBackend::CreateShader(const EShaderType& type, const std::string& source, std::string& outErrorLog)
+{
+	uint32_t shaderID = glCreateShader(static_cast<GLenum>(type));
+	const char* sourcePtr = source.c_str();
+
+	GL_FAILED(glShaderSource(shaderID, 1, &sourcePtr, nullptr));
+	GL_FAILED(glCompileShader(shaderID));
+
+	int32_t status;
+	GL_FAILED(glGetShaderiv(shaderID, GL_COMPILE_STATUS, &status));
+	if (!status)
+	{
+		char buffer[1024];
+
+		glGetShaderInfoLog(shaderID, 1024, nullptr, buffer);
+		outErrorLog = buffer;
+
+		GL_FAILED(glDeleteShader(shaderID));
+		return 0;
+	}
+
+	return shaderID;
+}
+
+void GLRenderBackend::DestroyShader(uint32_t shaderID)
+{
+	GL_FAILED(glDeleteShader(shaderID));
+}
+
+uint32_t GLRenderBackend::CreateProgram(const std::vector<uint32_t>& shaderIDs, std::string& outErrorLog)
+{
+	uint32_t programID = glCreateProgram();
+	CHECK(programID != 0);
+
+	for (const uint32_t shaderID : shaderIDs)
+	{
+		GL_FAILED(glAttachShader(programID, shaderID));
+	}
+	GL_FAILED(glLinkProgram(programID));
+
+	int32_t status;
+	GL_FAILED(glGetProgramiv(programID, GL_LINK_STATUS, &status));
+	if (!status)
+	{
+		char buffer[1024];
+
+		glGetProgramInfoLog(programID, 1024, nullptr, buffer);
+		outErrorLog = buffer;
+
+		GL_FAILED(glDeleteProgram(programID));
+		return 0;
+	}
+
+	return programID;
+}
+
+void GLRenderBackend::DestroyProgram(uint32_t programID)
+{
+	GL_FAILED(glDeleteProgram(programID));
+}
+
+void GLRenderBackend::BindProgram(uint32_t programID)
+{
+	GL_FAILED(glUseProgram(programID));
+}
+
+int32_t GLRenderBackend::GetUniformLocation(uint32_t programID, const std::string& name)
+{
+	return glGetUniformLocation(programID, name.c_str());
+}
+
+void GLRenderBackend::SetUniformInt(int32_t location, const int32_t* values, uint32_t componentCount)
+{
+	switch (componentCount)
+	{
+	case 1:
+		GL_FAILED(glUniform1iv(location, 1, values));
+		break;
+
+	case 2:
+		GL_FAILED(glUniform2iv(location, 1, values));
+		break;
+
+	case 3:
+		GL_FAILED(glUniform3iv(location, 1, values));
+		break;
+
+	case 4:
+		GL_FAILED(glUniform4iv(location, 1, values));
+		break;
+
+	default:
+		ASSERT(false, "undefined uniform component count %d", componentCount);
+		break;
+	}
+}
+
+void GLRenderBackend::SetUniformFloat(int32_t location, const float* values, uint32_t componentCount)
+{
+	switch (componentCount)
+	{
+	case 1:
+		GL_FAILED(glUniform1fv(location, 1, values));
+		break;
+
+	case 2:
+		GL_FAILED(glUniform2fv(location, 1, values));
+		break;
+
+	case 3:
+		GL_FAILED(glUniform3fv(location, 1, values));
+		break;
+
+	case 4:
+		GL_FAILED(glUniform4fv(location, 1, values));
+		break;
+
+	default:
+		ASSERT(false, "undefined uniform component count %d", componentCount);
+		break;
+	}
+}
+
+void GLRenderBackend::SetUniformMatrix(int32_t location, const float* values, uint32_t dimension)
+{
+	switch (dimension)
+	{
+	case 2:
+		GL_FAILED(glUniformMatrix2fv(location, 1, GL_FALSE, values));
+		break;
+
+	case 3:
+		GL_FAILED(glUniformMatrix3fv(location, 1, GL_FALSE, values));
+		break;
+
+	case 4:
+		GL_FAILED(glUniformMatrix4fv(location, 1, GL_FALSE, values));
+		break;
+
+	default:
+		ASSERT(false, "undefined uniform matrix dimension %d", dimension);
+		break;
+	}
+}
+
+uint32_t GLRenderBackend::CreateTexture2D(int32_t width, int32_t height)
+{
+	uint32_t textureID = 0;
+
+	GL_FAILED(glGenTextures(1, &textureID));
+	GL_FAILED(glBindTexture(GL_TEXTURE_2D, textureID));
+	GL_FAILED(glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA32F, width, height, 0, GL_RGBA, GL_FLOAT, nullptr));
+	GL_FAILED(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE));
+	GL_FAILED(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE));
+	GL_FAILED(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR));
+	GL_FAILED(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR));
+	GL_FAILED(glBindTexture(GL_TEXTURE_2D, 0));
+
+	return textureID;
+}
+
+void GLRenderBackend::DestroyTexture(uint32_t textureID)
+{
+	GL_FAILED(glDeleteTextures(1, &textureID));
+}
+
+void GLRenderBackend::BindTexture(uint32_t unit, uint32_t textureID)
+{
+	GL_FAILED(glActiveTexture(GL_TEXTURE0 + unit));
+	GL_FAILED(glBindTexture(GL_TEXTURE_2D, textureID));
+}
+
+void GLRenderBackend::BindImageTexture(uint32_t unit, uint32_t textureID)
+{
+	GL_FAILED(glBindImageTexture(unit, textureID, 0, GL_FALSE, 0, GL_WRITE_ONLY, GL_RGBA32F));
+}
+
+void GLRenderBackend::DispatchCompute(uint32_t workGroupX, uint32_t workGroupY, uint32_t workGroupZ)
+{
+	GL_FAILED(glDispatchCompute(workGroupX, workGroupY, workGroupZ));
+}
+
+void GLRenderBackend::DrawVertex(const EDrawMode& drawMode, uint32_t vertexCount, uint32_t firstVertex)
+{
+	GL_FAILED(glDrawArrays(static_cast<GLenum>(drawMode), firstVertex, vertexCount));
+}
+
+void GLRenderBackend::DrawIndex(const EDrawMode& drawMode, uint32_t indexCount)
+{
+	GL_FAILED(glDrawElements(static_cast<GLenum>(drawMode), indexCount, GL_UNSIGNED_INT, nullptr));
+}
+
+void GLRenderBackend::DrawVertexInstanced(const EDrawMode& drawMode, uint32_t vertexCount, uint32_t instanceCount, uint32_t firstInstance)
+{
+	GL_FAILED(glDrawArraysInstancedBaseInstance(static_cast<GLenum>(drawMode), 0, vertexCount, instanceCount, firstInstance));
+}
+
+void GLRenderBackend::DrawIndexInstanced(const EDrawMode& drawMode, uint32_t indexCount, uint32_t instanceCount, uint32_t firstInstance)
+{
+	GL_FAILED(glDrawElementsInstancedBaseInstance(static_cast<GLenum>(drawMode), indexCount, GL_UNSIGNED_INT, nullptr, instanceCount, firstInstance));
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,97 @@
+#pragma once
+
+#if defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+
+#include "IRenderBackend.h"
+
+
+/**
+ * @brief OpenGL 4.6 ȣϴ  鿣Դϴ.
+ *
+ * @note
+ * -  鿣   WGL ؽƮ OpenGL Լ ε  ڿ ؾ մϴ.
+ * -   GLErrorCheck OpenGL Լ ̺ ϰ,    GLErrorCheck::CheckFrame ȣմϴ.
+ */
+class GLRenderBackend : public IRenderBackend
+{
+public:
+	/**
+	 * @brief OpenGL  鿣 Դϴ.
+	 *
+	 * @param renderTargetHandle   Ǵ  ڵԴϴ.
+	 * @param deviceContext   ̽ ؽƮ ڵԴϴ.
+	 */
+	GLRenderBackend(HWND renderTargetHandle, HDC deviceContext);
+
+
+	/**
+	 * @brief OpenGL  鿣  ҸԴϴ.
+	 */
+	virtual ~GLRenderBackend();
+
+
+	/**
+	 * @brief OpenGL  鿣  ڿ  ڸ  մϴ.
+	 */
+	DISALLOW_COPY_AND_ASSIGN(GLRenderBackend);
+
+
+	virtual void BeginFrame(float red, float green, float blue, float alpha, float depth, uint8_t stencil) override;
+	virtual void EndFrame() override;
+	virtual bool GetScreenSize(int32_t& outWidth, int32_t& outHeight) override;
+	virtual void SetViewport(int32_t x, int32_t y, int32_t width, int32_t height) override;
+	virtual void SetVsyncMode(bool bIsEnable) override;
+	virtual void SetRenderState(const ERenderState& state, bool bIsEnable) override;
+	virtual bool GetRenderState(const ERenderState& state) override;
+	virtual uint32_t CreateBuffer(const EBufferType& type, const void* bufferPtr, uint32_t byteSize, const VertexBuffer::EUsage& usage) override;
+	virtual void DestroyBuffer(uint32_t bufferID) override;
+	virtual void BindBuffer(const EBufferType& type, uint32_t bufferID) override;
+	virtual void BindBufferBase(const EBufferType& type, uint32_t bindingIndex, uint32_t bufferID) override;
+	virtual void SetBufferData(const EBufferType& type, const void* bufferPtr, uint32_t byteSize, const VertexBuffer::EUsage& usage) override;
+	virtual void SetBufferSubData(const EBufferType& type, uint32_t byteOffset, const void* bufferPtr, uint32_t byteSize) override;
+	virtual void* MapBuffer(const EBufferType& type) override;
+	virtual void UnmapBuffer(const EBufferType& type) override;
+	virtual void* MapBufferPersistent(const EBufferType& type) override;
+	virtual uint64_t CreateFence() override;
+	virtual void WaitFence(uint64_t fence) override;
+	virtual void DestroyFence(uint64_t fence) override;
+	virtual uint32_t CreateVertexArray() override;
+	virtual void DestroyVertexArray(uint32_t vertexArrayID) override;
+	virtual void BindVertexArray(uint32_t vertexArrayID) override;
+	virtual void SetVertexAttribute(uint32_t location, uint32_t componentCount, uint32_t stride, uint32_t byteOffset) override;
+	virtual void EnableVertexAttribute(uint32_t location) override;
+	virtual void SetVertexAttributeDivisor(uint32_t location, uint32_t divisor) override;
+	virtual uint32_t CreateShader(const EShaderType& type, const std::string& source, std::string& outErrorLog) override;
+	virtual void DestroyShader(uint32_t shaderID) override;
+	virtual uint32_t CreateProgram(const std::vector<uint32_t>& shaderIDs, std::string& outErrorLog) override;
+	virtual void DestroyProgram(uint32_t programID) override;
+	virtual void BindProgram(uint32_t programID) override;
+	virtual int32_t GetUniformLocation(uint32_t programID, const std::string& name) override;
+	virtual void SetUniformInt(int32_t location, const int32_t* values, uint32_t componentCount) override;
+	virtual void SetUniformFloat(int32_t location, const float* values, uint32_t componentCount) override;
+	virtual void SetUniformMatrix(int32_t location, const float* values, uint32_t dimension) override;
+	virtual uint32_t CreateTexture2D(int32_t width, int32_t height) override;
+	virtual void DestroyTexture(uint32_t textureID) override;
+	virtual void BindTexture(uint32_t unit, uint32_t textureID) override;
+	virtual void BindImageTexture(uint32_t unit, uint32_t textureID) override;
+	virtual void DispatchCompute(uint32_t workGroupX, uint32_t workGroupY, uint32_t workGroupZ) override;
+	virtual void DrawVertex(const EDrawMode& drawMode, uint32_t vertexCount, uint32_t firstVertex) override;
+	virtual void DrawIndex(const EDrawMode& drawMode, uint32_t indexCount) override;
+	virtual void DrawVertexInstanced(const EDrawMode& drawMode, uint32_t vertexCount, uint32_t instanceCount, uint32_t firstInstance) override;
+	virtual void DrawIndexInstanced(const EDrawMode& drawMode, uint32_t indexCount, uint32_t instanceCount, uint32_t firstInstance) override;
+
+
+private:
+	/**
+	 * @brief   Ǵ  ڵԴϴ.
+	 */
+	HWND renderTargetHandle_ = nullptr;
+
+
+	/**
+	 * @brief   ̽ ؽƮ ڵԴϴ.
+	 */
+	HDC deviceContext_ = nullptr;
+};
+#endif
\ No newline at end of file
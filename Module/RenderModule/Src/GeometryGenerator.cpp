@@ -67,15 +67,20 @@ void GeometryGenerator::CreateSphere(float radius, uint32_t tessellation, std::v
 	{
 		float v = 1.0f - static_cast<float>(vertical) / static_cast<float>(verticalSegments);
 		float latitude = Pi * (static_cast<float>(vertical) / static_cast<float>(verticalSegments)) - PiDiv2;
-		float dy = MathModule::Sin(latitude);
-		float dxz = MathModule::Cos(latitude);
+		float dy = 0.0f;
+		float dxz = 0.0f;
+		MathModule::SinCos(latitude, dy, dxz);
 
 		for (uint32_t horizon = 0; horizon <= horizontalSegments; ++horizon)
 		{
 			float u = static_cast<float>(horizon) / static_cast<float>(horizontalSegments);
 			float longitude = TwoPi * static_cast<float>(horizon) / static_cast<float>(horizontalSegments);
-			float dx = dxz * MathModule::Sin(longitude);
-			float dz = dxz * MathModule::Cos(longitude);
+			float sinLongitude = 0.0f;
+			float cosLongitude = 0.0f;
+			MathModule::SinCos(longitude, sinLongitude, cosLongitude);
+
+			float dx = dxz * sinLongitude;
+			float dz = dxz * cosLongitude;
 
 			Vec3f position(radius * dx, radius * dy, radius * dz);
 			Vec3f normal(dx, dy, dz);
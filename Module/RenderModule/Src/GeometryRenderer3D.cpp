@@ -1,27 +1,53 @@
-#include <glad/glad.h>
+#include <cstddef>
 
 #include "Assertion.h"
 #include "GeometryRenderer3D.h"
+#include "Mat4x3.h"
 
-GeometryRenderer3D::GeometryRenderer3D() 
-	: Shader("Resource/Shader/GeometryRenderer3D.vert", "Resource/Shader/GeometryRenderer3D.frag")
-	, vertexBuffer_(static_cast<uint32_t>(VertexPositionColor3D::GetStride() * vertices_.size()), VertexBuffer::EUsage::Dynamic)
+/**
+ * @brief ġ   ּ  Դϴ.
+ */
+static const uint32_t MIN_BATCH_VERTEX_CAPACITY = 4096;
 
+/**
+ * @brief  ۸ ϴ ġ/  迭 մϴ.
+ */
+static uint32_t CreatePositionColorVertexArray(VertexBuffer& vertexBuffer)
 {
-	GL_FAILED(glGenVertexArrays(1, &vertexArrayObject_));
-	GL_FAILED(glBindVertexArray(vertexArrayObject_));
+	IRenderBackend* backend = RenderModule::GetBackend();
+
+	uint32_t vertexArrayObject = backend->CreateVertexArray();
+	backend->BindVertexArray(vertexArrayObject);
 	{
-		vertexBuffer_.Bind();
+		vertexBuffer.Bind();
 
-		GL_FAILED(glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, VertexPositionColor3D::GetStride(), (void*)(offsetof(VertexPositionColor3D, position))));
-		GL_FAILED(glEnableVertexAttribArray(0));
+		backend->SetVertexAttribute(0, 3, VertexPositionColor3D::GetStride(), static_cast<uint32_t>(offsetof(VertexPositionColor3D, position)));
+		backend->EnableVertexAttribute(0);
 
-		GL_FAILED(glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, VertexPositionColor3D::GetStride(), (void*)(offsetof(VertexPositionColor3D, color))));
-		GL_FAILED(glEnableVertexAttribArray(1));
+		backend->SetVertexAttribute(1, 4, VertexPositionColor3D::GetStride(), static_cast<uint32_t>(offsetof(VertexPositionColor3D, color)));
+		backend->EnableVertexAttribute(1);
 
-		vertexBuffer_.Unbind();
+		vertexBuffer.Unbind();
 	}
-	GL_FAILED(glBindVertexArray(0));
+	backend->BindVertexArray(0);
+
+	return vertexArrayObject;
+}
+
+GeometryRenderer3D::GeometryRenderer3D() 
+	: Shader("Resource/Shader/GeometryRenderer3D.vert", "Resource/Shader/GeometryRenderer3D.frag")
+	, vertexBuffer_(static_cast<uint32_t>(VertexPositionColor3D::GetStride() * vertices_.size()), VertexBuffer::EUsage::StreamRing)
+
+{
+	vertexArrayObject_ = CreatePositionColorVertexArray(vertexBuffer_);
+
+	instancedShader_ = std::make_unique<Shader>("Resource/Shader/GeometryRenderer3DInstanced.vert", "Resource/Shader/GeometryRenderer3D.frag");
+	instanceBuffer_ = std::make_unique<VertexBuffer>(static_cast<uint32_t>(sizeof(Mat4x4)) * MAX_INSTANCE_SIZE, VertexBuffer::EUsage::StreamRing);
+
+	worldLocation_ = Shader::GetUniformLocation("world");
+	pointSizeLocation_ = Shader::GetUniformLocation("pointSize");
+
+	RenderModule::AddEndFrameCallback(this, [this]() { EndFrame(); });
 }
 
 GeometryRenderer3D::~GeometryRenderer3D()
@@ -38,7 +64,152 @@ void GeometryRenderer3D::Release()
 
 	Shader::Release();
 
-	GL_FAILED(glDeleteVertexArrays(1, &vertexArrayObject_));
+	RenderModule::RemoveEndFrameCallback(this);
+
+	// ̴ Ƿ, ׸  νϽ    մϴ.
+	for (uint32_t handle : batchRetained_)
+	{
+		retained_[handle - 1].batchWorlds.clear();
+	}
+	batchRetained_.clear();
+
+	for (uint32_t index = 0; index < retained_.size(); ++index)
+	{
+		if (retained_[index].drawMode != EDrawMode::None)
+		{
+			DestroyRetained(index + 1);
+		}
+	}
+
+	retained_.clear();
+	freeRetained_.clear();
+	unitCubes_.clear();
+	unitSpheres_.clear();
+
+	if (batchVertexArrayObject_)
+	{
+		RenderModule::GetBackend()->DestroyVertexArray(batchVertexArrayObject_);
+		batchVertexArrayObject_ = 0;
+	}
+
+	batchVertexBuffer_.reset();
+	batchVertexCapacity_ = 0;
+
+	instanceBuffer_.reset();
+
+	instancedShader_->Release();
+	instancedShader_.reset();
+
+	RenderModule::GetBackend()->DestroyVertexArray(vertexArrayObject_);
+}
+
+void GeometryRenderer3D::SetMode(const EMode& mode)
+{
+	if (mode_ == EMode::Batched && mode != EMode::Batched)
+	{
+		Flush();
+	}
+
+	mode_ = mode;
+}
+
+void GeometryRenderer3D::Flush()
+{
+	if (mode_ != EMode::Batched)
+	{
+		return;
+	}
+
+	uint32_t maxVertexCount = 0;
+	for (uint32_t batchVertexCount : batchVertexCounts_)
+	{
+		maxVertexCount = MathModule::Max<uint32_t>(maxVertexCount, batchVertexCount);
+	}
+
+	if (maxVertexCount == 0 && batchRetained_.empty())
+	{
+		return;
+	}
+
+	IRenderBackend* backend = RenderModule::GetBackend();
+	bool bIsEnableDepth = backend->GetRenderState(ERenderState::Depth);
+
+	RenderModule::SetDepthMode(true);
+	if (!batchRetained_.empty())
+	{
+		FlushRetained();
+	}
+
+	if (maxVertexCount != 0)
+	{
+		ReserveBatchBuffer(maxVertexCount);
+
+		Shader::Bind();
+
+		Shader::SetUniform(worldLocation_, Mat4x4::Identity());
+
+		backend->BindVertexArray(batchVertexArrayObject_);
+
+		for (uint32_t batch = 0; batch < BATCH_COUNT; ++batch)
+		{
+			uint32_t vertexCount = batchVertexCounts_[batch];
+			if (vertexCount == 0)
+			{
+				continue;
+			}
+
+			EDrawMode drawMode = EDrawMode::Lines;
+			if (batch == static_cast<uint32_t>(EBatch::Points))
+			{
+				drawMode = EDrawMode::Points;
+				Shader::SetUniform(pointSizeLocation_, batchPointSize_);
+			}
+
+			batchVertexBuffer_->SetBufferData(batchVertices_[batch].data(), vertexCount * VertexPositionColor3D::GetStride());
+			RenderModule::ExecuteDrawVertex(vertexCount, drawMode);
+
+			batchVertexCounts_[batch] = 0;
+			currentStats_.drawCallCount++;
+		}
+
+		backend->BindVertexArray(0);
+
+		Shader::Unbind();
+	}
+	RenderModule::SetDepthMode(bIsEnableDepth);
+
+	currentStats_.flushCount++;
+}
+
+void GeometryRenderer3D::FlushRetained()
+{
+	IRenderBackend* backend = RenderModule::GetBackend();
+
+	instancedShader_->Bind();
+	{
+		for (uint32_t handle : batchRetained_)
+		{
+			RetainedGeometry& geometry = retained_[handle - 1];
+			uint32_t instanceCount = static_cast<uint32_t>(geometry.batchWorlds.size());
+
+			backend->BindVertexArray(geometry.vertexArrayObject);
+			for (uint32_t offset = 0; offset < instanceCount; offset += MAX_INSTANCE_SIZE)
+			{
+				uint32_t count = MathModule::Min<uint32_t>(instanceCount - offset, MAX_INSTANCE_SIZE);
+				uint32_t firstInstance = instanceBuffer_->WriteRingData(geometry.batchWorlds.data() + offset, static_cast<uint32_t>(sizeof(Mat4x4)), count);
+
+				RenderModule::ExecuteDrawVertexInstanced(geometry.vertexCount, count, geometry.drawMode, firstInstance);
+				currentStats_.drawCallCount++;
+			}
+
+			geometry.batchWorlds.clear();
+		}
+
+		backend->BindVertexArray(0);
+	}
+	instancedShader_->Unbind();
+
+	batchRetained_.clear();
 }
 
 void GeometryRenderer3D::DrawPoints3D(const std::vector<Vec3f>& positions, const Vec4f& color, float pointSize)
@@ -105,6 +276,108 @@ void GeometryRenderer3D::DrawLines3D(const std::vector<Vec3f>& positions, const
 }
 
 void GeometryRenderer3D::DrawCube3D(const Mat4x4& world, const Vec3f& extents, const Vec4f& color)
+{
+	uint32_t handle = GetUnitShape(unitCubes_, color, false);
+	if (handle != INVALID_RETAINED)
+	{
+		DrawRetained(handle, Mat4x4::Scale(extents) * world);
+		return;
+	}
+
+	uint32_t vertexCount = BuildCube3D(extents, color);
+
+	world_ = world;
+	DrawGeometry3D(EDrawMode::Lines, vertexCount);
+}
+
+void GeometryRenderer3D::DrawSphere3D(const Mat4x4& world, float radius, const Vec4f& color)
+{
+	uint32_t handle = GetUnitShape(unitSpheres_, color, true);
+	if (handle != INVALID_RETAINED)
+	{
+		DrawRetained(handle, Mat4x4::Scale(radius, radius, radius) * world);
+		return;
+	}
+
+	uint32_t vertexCount = BuildSphere3D(radius, color);
+
+	world_ = world;
+	DrawGeometry3D(EDrawMode::Lines, vertexCount);
+}
+
+void GeometryRenderer3D::DrawGrid3D(const Vec3f& extensions, float stride)
+{
+	uint32_t vertexCount = BuildGrid3D(extensions, stride);
+
+	world_ = Mat4x4::Identity();
+	DrawGeometry3D(EDrawMode::Lines, vertexCount);
+}
+
+uint32_t GeometryRenderer3D::CreateRetainedCube3D(const Vec3f& extents, const Vec4f& color)
+{
+	return CreateRetained(EDrawMode::Lines, BuildCube3D(extents, color));
+}
+
+uint32_t GeometryRenderer3D::CreateRetainedSphere3D(float radius, const Vec4f& color)
+{
+	return CreateRetained(EDrawMode::Lines, BuildSphere3D(radius, color));
+}
+
+uint32_t GeometryRenderer3D::CreateRetainedGrid3D(const Vec3f& extensions, float stride)
+{
+	return CreateRetained(EDrawMode::Lines, BuildGrid3D(extensions, stride));
+}
+
+void GeometryRenderer3D::DrawRetained(uint32_t handle, const Mat4x4& world)
+{
+	CHECK(handle != INVALID_RETAINED && handle <= retained_.size());
+
+	RetainedGeometry& geometry = retained_[handle - 1];
+	CHECK(geometry.drawMode != EDrawMode::None);
+
+	currentStats_.primitiveCount++;
+	currentStats_.vertexCount += geometry.vertexCount;
+
+	//    ̹   ۿ Ƿ,  CPU ȯ ٽ ε ʰ  ĸ ϴ.
+	if (mode_ == EMode::Batched)
+	{
+		if (geometry.batchWorlds.empty())
+		{
+			batchRetained_.push_back(handle);
+		}
+
+		geometry.batchWorlds.push_back(world);
+		return;
+	}
+
+	world_ = world;
+	DrawVertexArray(geometry.drawMode, geometry.vertexArrayObject, geometry.vertexCount, 0);
+}
+
+void GeometryRenderer3D::DestroyRetained(uint32_t handle)
+{
+	CHECK(handle != INVALID_RETAINED && handle <= retained_.size());
+
+	RetainedGeometry& geometry = retained_[handle - 1];
+	CHECK(geometry.drawMode != EDrawMode::None);
+
+	// ̹ ӿ  νϽ  ִٸ  迭 ϱ   ׸ϴ.
+	if (!geometry.batchWorlds.empty())
+	{
+		Flush();
+	}
+
+	RenderModule::GetBackend()->DestroyVertexArray(geometry.vertexArrayObject);
+
+	geometry.drawMode = EDrawMode::None;
+	geometry.vertexCount = 0;
+	geometry.vertexBuffer.reset();
+	geometry.vertexArrayObject = 0;
+
+	freeRetained_.push_back(handle - 1);
+}
+
+uint32_t GeometryRenderer3D::BuildCube3D(const Vec3f& extents, const Vec4f& color)
 {
 	uint32_t vertexCount = 0;
 
@@ -147,33 +420,43 @@ void GeometryRenderer3D::DrawCube3D(const Mat4x4& world, const Vec3f& extents, c
 	vertices_[vertexCount++] = VertexPositionColor3D(Vec3f(maxPosition.x, maxPosition.y, minPosition.z), color);
 	vertices_[vertexCount++] = VertexPositionColor3D(Vec3f(maxPosition.x, minPosition.y, minPosition.z), color);
 
-	world_ = world;
-	DrawGeometry3D(EDrawMode::Lines, vertexCount);
+	return vertexCount;
 }
 
-void GeometryRenderer3D::DrawSphere3D(const Mat4x4& world, float radius, const Vec4f& color)
+uint32_t GeometryRenderer3D::BuildSphere3D(float radius, const Vec4f& color)
 {
 	static const uint32_t sliceCount = 20;
 
+	std::array<float, sliceCount + 2> angles;
+	std::array<float, sliceCount + 2> sinAngles;
+	std::array<float, sliceCount + 2> cosAngles;
+
 	uint32_t vertexCount = 0;
 	float stackStep = Pi / static_cast<float>(sliceCount);
 	float sliceStep = TwoPi / static_cast<float>(sliceCount);
 
+	for (uint32_t slice = 0; slice <= sliceCount; ++slice)
+	{
+		angles[slice] = static_cast<float>(slice) * sliceStep;
+	}
+	MathModule::SinCos(angles.data(), sinAngles.data(), cosAngles.data(), sliceCount + 1);
+
 	for (uint32_t stack = 0; stack <= sliceCount; ++stack)
 	{
 		float phi = static_cast<float>(stack) * stackStep;
 
+		float sinPhi = 0.0f;
+		float cosPhi = 0.0f;
+		MathModule::SinCos(phi, sinPhi, cosPhi);
+
 		for (uint32_t slice = 0; slice < sliceCount; ++slice)
 		{
-			float theta0 = static_cast<float>(slice + 0) * sliceStep;
-			float theta1 = static_cast<float>(slice + 1) * sliceStep;
-
 			CHECK(0 <= vertexCount && vertexCount < MAX_VERTEX_SIZE);
 			vertices_[vertexCount++] = VertexPositionColor3D(
 				Vec3f(
-					radius * MathModule::Sin(phi) * MathModule::Cos(theta0),
-					radius * MathModule::Cos(phi),
-					radius * MathModule::Sin(phi) * MathModule::Sin(theta0)
+					radius * sinPhi * cosAngles[slice + 0],
+					radius * cosPhi,
+					radius * sinPhi * sinAngles[slice + 0]
 				),
 				color
 			);
@@ -181,9 +464,9 @@ void GeometryRenderer3D::DrawSphere3D(const Mat4x4& world, float radius, const V
 			CHECK(0 <= vertexCount && vertexCount < MAX_VERTEX_SIZE);
 			vertices_[vertexCount++] = VertexPositionColor3D(
 				Vec3f(
-					radius * MathModule::Sin(phi) * MathModule::Cos(theta1),
-					radius * MathModule::Cos(phi),
-					radius * MathModule::Sin(phi) * MathModule::Sin(theta1)
+					radius * sinPhi * cosAngles[slice + 1],
+					radius * cosPhi,
+					radius * sinPhi * sinAngles[slice + 1]
 				),
 				color
 			);
@@ -191,21 +474,28 @@ void GeometryRenderer3D::DrawSphere3D(const Mat4x4& world, float radius, const V
 	}
 
 	stackStep = TwoPi / static_cast<float>(sliceCount);
+	for (uint32_t stack = 0; stack <= sliceCount + 1; ++stack)
+	{
+		angles[stack] = static_cast<float>(stack) * stackStep;
+	}
+	MathModule::SinCos(angles.data(), sinAngles.data(), cosAngles.data(), sliceCount + 2);
+
 	for (uint32_t slice = 0; slice < sliceCount; ++slice)
 	{
 		float theta = static_cast<float>(slice) * sliceStep;
+
+		float sinTheta = 0.0f;
+		float cosTheta = 0.0f;
+		MathModule::SinCos(theta, sinTheta, cosTheta);
 		
 		for (uint32_t stack = 0; stack <= sliceCount; ++stack)
 		{
-			float phi0 = static_cast<float>(stack + 0) * stackStep;
-			float phi1 = static_cast<float>(stack + 1) * stackStep;
-
 			CHECK(0 <= vertexCount && vertexCount < MAX_VERTEX_SIZE);
 			vertices_[vertexCount++] = VertexPositionColor3D(
 				Vec3f(
-					radius * MathModule::Cos(phi0) * MathModule::Cos(theta),
-					radius * MathModule::Sin(phi0),
-					radius * MathModule::Cos(phi0) * MathModule::Sin(theta)
+					radius * cosAngles[stack + 0] * cosTheta,
+					radius * sinAngles[stack + 0],
+					radius * cosAngles[stack + 0] * sinTheta
 				),
 				color
 			);
@@ -213,21 +503,19 @@ void GeometryRenderer3D::DrawSphere3D(const Mat4x4& world, float radius, const V
 			CHECK(0 <= vertexCount && vertexCount < MAX_VERTEX_SIZE);
 			vertices_[vertexCount++] = VertexPositionColor3D(
 				Vec3f(
-					radius * MathModule::Cos(phi1) * MathModule::Cos(theta),
-					radius * MathModule::Sin(phi1),
-					radius * MathModule::Cos(phi1) * MathModule::Sin(theta)
+					radius * cosAngles[stack + 1] * cosTheta,
+					radius * sinAngles[stack + 1],
+					radius * cosAngles[stack + 1] * sinTheta
 				),
 				color
 			);
 		}
 	}
 
-
-	world_ = world;
-	DrawGeometry3D(EDrawMode::Lines, vertexCount);
+	return vertexCount;
 }
 
-void GeometryRenderer3D::DrawGrid3D(const Vec3f& extensions, float stride)
+uint32_t GeometryRenderer3D::BuildGrid3D(const Vec3f& extensions, float stride)
 {
 	CHECK(stride >= 1.0f);
 
@@ -267,39 +555,194 @@ void GeometryRenderer3D::DrawGrid3D(const Vec3f& extensions, float stride)
 	CHECK(0 <= vertexCount && vertexCount < MAX_VERTEX_SIZE);
 	vertices_[vertexCount++] = VertexPositionColor3D(Vec3f(0.0f, maxYPosition, 0.0f), Vec4f(0.0f, 1.0f, 0.0f, 1.0f));
 
-	world_ = Mat4x4::Identity();
-	DrawGeometry3D(EDrawMode::Lines, static_cast<uint32_t>(vertexCount));
+	return static_cast<uint32_t>(vertexCount);
+}
+
+uint32_t GeometryRenderer3D::CreateRetained(const EDrawMode& drawMode, uint32_t vertexCount)
+{
+	CHECK(drawMode != EDrawMode::None && vertexCount > 0);
+
+	uint32_t index = static_cast<uint32_t>(retained_.size());
+	if (!freeRetained_.empty())
+	{
+		index = freeRetained_.back();
+		freeRetained_.pop_back();
+	}
+	else
+	{
+		retained_.emplace_back();
+	}
+
+	RetainedGeometry& geometry = retained_[index];
+	geometry.drawMode = drawMode;
+	geometry.vertexCount = vertexCount;
+	geometry.vertexBuffer = std::make_unique<VertexBuffer>(vertices_.data(), vertexCount * VertexPositionColor3D::GetStride(), VertexBuffer::EUsage::Static);
+	geometry.vertexArrayObject = CreatePositionColorVertexArray(*geometry.vertexBuffer);
+
+	// ġ  νϽ ׸⿡    Ӽ  迭   մϴ.
+	IRenderBackend* backend = RenderModule::GetBackend();
+	backend->BindVertexArray(geometry.vertexArrayObject);
+	{
+		instanceBuffer_->Bind();
+		for (uint32_t column = 0; column < 4; ++column)
+		{
+			uint32_t location = INSTANCE_WORLD_LOCATION + column;
+
+			backend->SetVertexAttribute(location, 4, static_cast<uint32_t>(sizeof(Mat4x4)), static_cast<uint32_t>(sizeof(float) * 4 * column));
+			backend->EnableVertexAttribute(location);
+			backend->SetVertexAttributeDivisor(location, 1);
+		}
+		instanceBuffer_->Unbind();
+	}
+	backend->BindVertexArray(0);
+
+	return index + 1;
+}
+
+uint32_t GeometryRenderer3D::GetUnitShape(std::vector<std::pair<Vec4f, uint32_t>>& cache, const Vec4f& color, bool bIsSphere)
+{
+	for (const std::pair<Vec4f, uint32_t>& unitShape : cache)
+	{
+		if (unitShape.first == color)
+		{
+			return unitShape.second;
+		}
+	}
+
+	if (cache.size() >= MAX_UNIT_SHAPE_SIZE)
+	{
+		return INVALID_RETAINED;
+	}
+
+	uint32_t vertexCount = bIsSphere ? BuildSphere3D(1.0f, color) : BuildCube3D(Vec3f(1.0f, 1.0f, 1.0f), color);
+	uint32_t handle = CreateRetained(EDrawMode::Lines, vertexCount);
+
+	cache.emplace_back(color, handle);
+	return handle;
 }
 
 void GeometryRenderer3D::DrawGeometry3D(const EDrawMode& drawMode, uint32_t vertexCount)
 {
 	CHECK(drawMode != EDrawMode::None);
 
-	GLboolean originEnableDepth;
-	GL_FAILED(glGetBooleanv(GL_DEPTH_TEST, &originEnableDepth));
+	currentStats_.primitiveCount++;
+	currentStats_.vertexCount += vertexCount;
 
-	RenderModule::SetDepthMode(true);
+	if (mode_ == EMode::Batched)
 	{
-		const void* vertexPtr = reinterpret_cast<const void*>(vertices_.data());
-		uint32_t bufferByteSize = static_cast<uint32_t>(VertexPositionColor3D::GetStride() * vertices_.size());
-		vertexBuffer_.SetBufferData(vertexPtr, bufferByteSize);
+		AppendBatch(drawMode, vertices_.data(), vertexCount);
+		return;
+	}
+
+	const void* vertexPtr = reinterpret_cast<const void*>(vertices_.data());
+	uint32_t firstVertex = vertexBuffer_.WriteRingData(vertexPtr, VertexPositionColor3D::GetStride(), vertexCount);
 
+	DrawVertexArray(drawMode, vertexArrayObject_, vertexCount, firstVertex);
+}
+
+void GeometryRenderer3D::DrawVertexArray(const EDrawMode& drawMode, uint32_t vertexArrayObject, uint32_t vertexCount, uint32_t firstVertex)
+{
+	bool bIsEnableDepth = RenderModule::GetBackend()->GetRenderState(ERenderState::Depth);
+
+	RenderModule::SetDepthMode(true);
+	{
 		Shader::Bind();
 
-		Shader::SetUniform("world", world_);
-		Shader::SetUniform("view", view_);
-		Shader::SetUniform("projection", projection_);
+		Shader::SetUniform(worldLocation_, world_);
 
 		if (drawMode == EDrawMode::Points)
 		{
-			Shader::SetUniform("pointSize", pointSize_);
+			Shader::SetUniform(pointSizeLocation_, pointSize_);
 		}
 
-		GL_FAILED(glBindVertexArray(vertexArrayObject_));
-		RenderModule::ExecuteDrawVertex(vertexCount, drawMode);
-		GL_FAILED(glBindVertexArray(0));
+		RenderModule::GetBackend()->BindVertexArray(vertexArrayObject);
+		RenderModule::ExecuteDrawVertex(vertexCount, drawMode, firstVertex);
+		RenderModule::GetBackend()->BindVertexArray(0);
 
 		Shader::Unbind();
 	}
-	RenderModule::SetDepthMode(originEnableDepth);
+	RenderModule::SetDepthMode(bIsEnableDepth);
+
+	currentStats_.drawCallCount++;
+}
+
+void GeometryRenderer3D::AppendBatch(const EDrawMode& drawMode, const VertexPositionColor3D* vertices, uint32_t vertexCount)
+{
+	CHECK(drawMode == EDrawMode::Points || drawMode == EDrawMode::Lines || drawMode == EDrawMode::LineStrip);
+
+	EBatch batch = (drawMode == EDrawMode::Points) ? EBatch::Points : EBatch::Lines;
+	std::vector<VertexPositionColor3D>& batchVertices = batchVertices_[static_cast<uint32_t>(batch)];
+	uint32_t& batchVertexCount = batchVertexCounts_[static_cast<uint32_t>(batch)];
+
+	if (drawMode == EDrawMode::Points)
+	{
+		batchPointSize_ = pointSize_;
+	}
+
+	uint32_t appendCount = vertexCount;
+	if (drawMode == EDrawMode::LineStrip)
+	{
+		appendCount = (vertexCount < 2) ? 0 : (vertexCount - 1) * 2;
+	}
+
+	//      Ƿ,    Ӻ Ŀ  ũ⸦ ø  0 äϴ.
+	uint32_t offset = batchVertexCount;
+	batchVertexCount += appendCount;
+	if (batchVertexCount > batchVertices.size())
+	{
+		batchVertices.resize(MathModule::Max<std::size_t>(batchVertexCount, batchVertices.size() * 2));
+	}
+
+	Mat4x3 world = Mat4x3::ToMat4x3(world_);
+	VertexPositionColor3D* batchVertexPtr = batchVertices.data() + offset;
+
+	if (drawMode == EDrawMode::LineStrip)
+	{
+		for (uint32_t index = 0; index + 1 < vertexCount; ++index)
+		{
+			batchVertexPtr[index * 2 + 0].position = Mat4x3::TransformPoint(vertices[index + 0].position, world);
+			batchVertexPtr[index * 2 + 0].color = vertices[index + 0].color;
+			batchVertexPtr[index * 2 + 1].position = Mat4x3::TransformPoint(vertices[index + 1].position, world);
+			batchVertexPtr[index * 2 + 1].color = vertices[index + 1].color;
+		}
+	}
+	else
+	{
+		for (uint32_t index = 0; index < vertexCount; ++index)
+		{
+			batchVertexPtr[index].position = Mat4x3::TransformPoint(vertices[index].position, world);
+			batchVertexPtr[index].color = vertices[index].color;
+		}
+	}
+}
+
+void GeometryRenderer3D::ReserveBatchBuffer(uint32_t vertexCount)
+{
+	if (vertexCount <= batchVertexCapacity_)
+	{
+		return;
+	}
+
+	uint32_t capacity = MathModule::Max<uint32_t>(batchVertexCapacity_, MIN_BATCH_VERTEX_CAPACITY);
+	while (capacity < vertexCount)
+	{
+		capacity *= 2;
+	}
+
+	if (batchVertexArrayObject_)
+	{
+		RenderModule::GetBackend()->DestroyVertexArray(batchVertexArrayObject_);
+	}
+
+	batchVertexBuffer_ = std::make_unique<VertexBuffer>(capacity * VertexPositionColor3D::GetStride(), VertexBuffer::EUsage::Stream);
+	batchVertexArrayObject_ = CreatePositionColorVertexArray(*batchVertexBuffer_);
+	batchVertexCapacity_ = capacity;
+}
+
+void GeometryRenderer3D::EndFrame()
+{
+	Flush();
+
+	frameStats_ = currentStats_;
+	currentStats_ = Stats();
 }
\ No newline at end of file
@@ -1,5 +1,3 @@
-#include <glad/glad.h>
-
 #include "Assertion.h"
 #include "MeshRenderer.h"
 #include "RenderModule.h"
@@ -8,6 +6,10 @@
 MeshRenderer::MeshRenderer()
 	: Shader("Resource/Shader/MeshRenderer.vert", "Resource/Shader/MeshRenderer.frag")
 {
+	instancedShader_ = std::make_unique<Shader>("Resource/Shader/MeshRendererInstanced.vert", "Resource/Shader/MeshRenderer.frag");
+	instanceBuffer_ = std::make_unique<VertexBuffer>(static_cast<uint32_t>(sizeof(Mat4x4)) * MAX_INSTANCE_SIZE, VertexBuffer::EUsage::StreamRing);
+
+	RenderModule::AddEndFrameCallback(this, [this]() { Flush(); });
 }
 
 MeshRenderer::~MeshRenderer()
@@ -21,24 +23,93 @@ MeshRenderer::~MeshRenderer()
 void MeshRenderer::Release()
 {
 	CHECK(bIsInitialized_);
+
+	RenderModule::RemoveEndFrameCallback(this);
+
+	groups_.clear();
+	groupCount_ = 0;
+
+	instanceBuffer_.reset();
+
+	instancedShader_->Release();
+	instancedShader_.reset();
+
 	Shader::Release();
 }
 
 void MeshRenderer::DrawMesh(StaticMesh<VertexPositionNormalUv3D>* mesh, const Mat4x4& world, IResource* texture)
 {
+	for (uint32_t index = groupCount_; index-- > 0;)
+	{
+		MeshGroup& group = groups_[index];
+		if (group.mesh == mesh && group.texture == texture)
+		{
+			group.worlds.push_back(world);
+			return;
+		}
+	}
+
+	if (groupCount_ == groups_.size())
+	{
+		groups_.emplace_back();
+	}
+
+	MeshGroup& group = groups_[groupCount_++];
+	group.mesh = mesh;
+	group.texture = texture;
+	group.worlds.clear();
+	group.worlds.push_back(world);
+}
+
+void MeshRenderer::DrawMeshInstanced(StaticMesh<VertexPositionNormalUv3D>* mesh, const Mat4x4* worlds, uint32_t instanceCount, IResource* texture)
+{
+	if (instanceCount == 0)
+	{
+		return;
+	}
+
+	IRenderBackend* backend = RenderModule::GetBackend();
 	TileMap* tileMap = reinterpret_cast<TileMap*>(texture);
 
-	Shader::Bind();
+	instancedShader_->Bind();
 	{
 		tileMap->Active(0);
 
-		Shader::SetUniform("world", world);
-		Shader::SetUniform("view", view_);
-		Shader::SetUniform("projection", projection_);
-
 		mesh->Bind();
-		RenderModule::ExecuteDrawIndex(mesh->GetIndexCount(), EDrawMode::Triangles);
+		{
+			instanceBuffer_->Bind();
+			for (uint32_t column = 0; column < 4; ++column)
+			{
+				uint32_t location = INSTANCE_WORLD_LOCATION + column;
+
+				backend->SetVertexAttribute(location, 4, static_cast<uint32_t>(sizeof(Mat4x4)), static_cast<uint32_t>(sizeof(float) * 4 * column));
+				backend->EnableVertexAttribute(location);
+				backend->SetVertexAttributeDivisor(location, 1);
+			}
+			instanceBuffer_->Unbind();
+
+			for (uint32_t offset = 0; offset < instanceCount; offset += MAX_INSTANCE_SIZE)
+			{
+				uint32_t count = MathModule::Min<uint32_t>(instanceCount - offset, MAX_INSTANCE_SIZE);
+				uint32_t firstInstance = instanceBuffer_->WriteRingData(worlds + offset, static_cast<uint32_t>(sizeof(Mat4x4)), count);
+
+				RenderModule::ExecuteDrawIndexInstanced(mesh->GetIndexCount(), count, EDrawMode::Triangles, firstInstance);
+			}
+		}
 		mesh->Unbind();
 	}
-	Shader::Unbind();
+	instancedShader_->Unbind();
+}
+
+void MeshRenderer::Flush()
+{
+	for (uint32_t index = 0; index < groupCount_; ++index)
+	{
+		MeshGroup& group = groups_[index];
+
+		DrawMeshInstanced(group.mesh, group.worlds, group.texture);
+		group.worlds.clear();
+	}
+
+	groupCount_ = 0;
 }
\ No newline at end of file
@@ -0,0 +1,286 @@
+#include "Assertion.h"
+#include "NullRenderBackend.h"
+
+NullRenderBackend::NullRenderBackend(int32_t screenWidth, int32_t screenHeight)
+	: screenWidth_(screenWidth)
+	, screenHeight_(screenHeight)
+{
+}
+
+void NullRenderBackend::BeginFrame(float, float, float, float, float, uint8_t)
+{
+	counters_.frameCount++;
+}
+
+void NullRenderBackend::EndFrame()
+{
+}
+
+bool NullRenderBackend::GetScreenSize(int32_t& outWidth, int32_t& outHeight)
+{
+	outWidth = screenWidth_;
+	outHeight = screenHeight_;
+
+	return true;
+}
+
+void NullRenderBackend::SetViewport(int32_t, int32_t, int32_t, int32_t)
+{
+	counters_.stateChangeCount++;
+}
+
+void NullRenderBackend::SetVsyncMode(bool)
+{
+}
+
+void NullRenderBackend::SetRenderState(const ERenderState& state, bool bIsEnable)
+{
+	renderStates_[static_cast<int32_t>(state)] = bIsEnable;
+	counters_.stateChangeCount++;
+}
+
+bool NullRenderBackend::GetRenderState(const ERenderState& state)
+{
+	counters_.stateQueryCount++;
+
+	auto iter = renderStates_.find(static_cast<int32_t>(state));
+	return iter != renderStates_.end() && iter->second;
+}
+
+uint32_t NullRenderBackend::CreateBuffer(const EBufferType& type, const void* bufferPtr, uint32_t byteSize, const VertexBuffer::EUsage&)
+{
+	uint32_t bufferID = nextObjectID_++;
+
+	bufferSizes_.insert({ bufferID, byteSize });
+	boundBuffers_[GetBindingSlot(type)] = bufferID;
+
+	counters_.bufferCreateCount++;
+	if (bufferPtr != nullptr)
+	{
+		counters_.bufferUploadCount++;
+		counters_.bufferUploadBytes += byteSize;
+	}
+
+	return bufferID;
+}
+
+void NullRenderBackend::DestroyBuffer(uint32_t bufferID)
+{
+	bufferSizes_.erase(bufferID);
+	persistentBuffers_.erase(bufferID);
+
+	for (uint32_t& boundBuffer : boundBuffers_)
+	{
+		if (boundBuffer == bufferID)
+		{
+			boundBuffer = 0;
+		}
+	}
+}
+
+void NullRenderBackend::BindBuffer(const EBufferType& type, uint32_t bufferID)
+{
+	boundBuffers_[GetBindingSlot(type)] = bufferID;
+	counters_.bufferBindCount++;
+}
+
+void NullRenderBackend::BindBufferBase(const EBufferType& type, uint32_t, uint32_t bufferID)
+{
+	CHECK(bufferSizes_.find(bufferID) != bufferSizes_.end());
+
+	boundBuffers_[GetBindingSlot(type)] = bufferID;
+	counters_.bufferBindCount++;
+}
+
+void NullRenderBackend::SetBufferData(const EBufferType& type, const void*, uint32_t byteSize, const VertexBuffer::EUsage&)
+{
+	uint32_t bufferID = boundBuffers_[GetBindingSlot(type)];
+	CHECK(bufferID != 0);
+
+	bufferSizes_[bufferID] = byteSize;
+
+	counters_.bufferUploadCount++;
+	counters_.bufferUploadBytes += byteSize;
+}
+
+void NullRenderBackend::SetBufferSubData(const EBufferType& type, uint32_t byteOffset, const void*, uint32_t byteSize)
+{
+	uint32_t bufferID = boundBuffers_[GetBindingSlot(type)];
+	CHECK(bufferID != 0 && byteOffset + byteSize <= bufferSizes_[bufferID]);
+
+	counters_.bufferUploadCount++;
+	counters_.bufferUploadBytes += byteSize;
+}
+
+void* NullRenderBackend::MapBuffer(const EBufferType& type)
+{
+	uint32_t bufferID = boundBuffers_[GetBindingSlot(type)];
+	CHECK(bufferID != 0);
+
+	uint32_t byteSize = bufferSizes_[bufferID];
+	if (mappedBuffer_.size() < byteSize)
+	{
+		mappedBuffer_.resize(byteSize);
+	}
+
+	counters_.bufferUploadCount++;
+	counters_.bufferUploadBytes += byteSize;
+
+	return mappedBuffer_.data();
+}
+
+void NullRenderBackend::UnmapBuffer(const EBufferType&)
+{
+}
+
+void* NullRenderBackend::MapBufferPersistent(const EBufferType& type)
+{
+	uint32_t bufferID = boundBuffers_[GetBindingSlot(type)];
+	CHECK(bufferID != 0);
+
+	std::vector<uint8_t>& persistentBuffer = persistentBuffers_[bufferID];
+	persistentBuffer.resize(bufferSizes_[bufferID]);
+
+	return persistentBuffer.data();
+}
+
+uint64_t NullRenderBackend::CreateFence()
+{
+	counters_.fenceCreateCount++;
+	return nextFence_++;
+}
+
+void NullRenderBackend::WaitFence(uint64_t fence)
+{
+	CHECK(fence != 0);
+	counters_.fenceWaitCount++;
+}
+
+void NullRenderBackend::DestroyFence(uint64_t)
+{
+}
+
+uint32_t NullRenderBackend::CreateVertexArray()
+{
+	return nextObjectID_++;
+}
+
+void NullRenderBackend::DestroyVertexArray(uint32_t)
+{
+}
+
+void NullRenderBackend::BindVertexArray(uint32_t)
+{
+	counters_.vertexArrayBindCount++;
+}
+
+void NullRenderBackend::SetVertexAttribute(uint32_t, uint32_t, uint32_t, uint32_t)
+{
+	CHECK(boundBuffers_[GetBindingSlot(EBufferType::Vertex)] != 0);
+}
+
+void NullRenderBackend::EnableVertexAttribute(uint32_t)
+{
+}
+
+void NullRenderBackend::SetVertexAttributeDivisor(uint32_t, uint32_t)
+{
+}
+
+uint32_t NullRenderBackend::CreateShader(const EShaderType&, const std::string&, std::string&)
+{
+	counters_.shaderCompileCount++;
+	return nextObjectID_++;
+}
+
+void NullRenderBackend::DestroyShader(uint32_t)
+{
+}
+
+uint32_t NullRenderBackend::CreateProgram(const std::vector<uint32_t>& shaderIDs, std::string&)
+{
+	CHECK(shaderIDs.size() > 0);
+
+	counters_.programLinkCount++;
+	return nextObjectID_++;
+}
+
+void NullRenderBackend::DestroyProgram(uint32_t)
+{
+}
+
+void NullRenderBackend::BindProgram(uint32_t)
+{
+	counters_.programBindCount++;
+}
+
+int32_t NullRenderBackend::GetUniformLocation(uint32_t, const std::string&)
+{
+	return nextUniformLocation_++;
+}
+
+void NullRenderBackend::SetUniformInt(int32_t, const int32_t*, uint32_t)
+{
+	counters_.uniformUpdateCount++;
+}
+
+void NullRenderBackend::SetUniformFloat(int32_t, const float*, uint32_t)
+{
+	counters_.uniformUpdateCount++;
+}
+
+void NullRenderBackend::SetUniformMatrix(int32_t, const float*, uint32_t)
+{
+	counters_.uniformUpdateCount++;
+}
+
+uint32_t NullRenderBackend::CreateTexture2D(int32_t, int32_t)
+{
+	counters_.textureCreateCount++;
+	return nextObjectID_++;
+}
+
+void NullRenderBackend::DestroyTexture(uint32_t)
+{
+}
+
+void NullRenderBackend::BindTexture(uint32_t, uint32_t)
+{
+	counters_.textureBindCount++;
+}
+
+void NullRenderBackend::BindImageTexture(uint32_t, uint32_t)
+{
+	counters_.textureBindCount++;
+}
+
+void NullRenderBackend::DispatchCompute(uint32_t, uint32_t, uint32_t)
+{
+	counters_.computeDispatchCount++;
+}
+
+void NullRenderBackend::DrawVertex(const EDrawMode&, uint32_t vertexCount, uint32_t)
+{
+	counters_.drawCallCount++;
+	counters_.drawVertexCount += vertexCount;
+}
+
+void NullRenderBackend::DrawIndex(const EDrawMode&, uint32_t indexCount)
+{
+	counters_.drawCallCount++;
+	counters_.drawIndexCount += indexCount;
+}
+
+void NullRenderBackend::DrawVertexInstanced(const EDrawMode&, uint32_t vertexCount, uint32_t instanceCount, uint32_t)
+{
+	counters_.drawCallCount++;
+	counters_.drawVertexCount += static_cast<uint64_t>(vertexCount) * instanceCount;
+	counters_.drawInstanceCount += instanceCount;
+}
+
+void NullRenderBackend::DrawIndexInstanced(const EDrawMode&, uint32_t indexCount, uint32_t instanceCount, uint32_t)
+{
+	counters_.drawCallCount++;
+	counters_.drawIndexCount += static_cast<uint64_t>(indexCount) * instanceCount;
+	counters_.drawInstanceCount += instanceCount;
+}
\ No newline at end of file
@@ -1,22 +1,52 @@
+#if defined(_WIN32) || defined(_WIN64)
 #include <glad/glad.h>
 #include <glad/glad_wgl.h>
 
 #include <imgui.h>
 #include <imgui_impl_opengl3.h>
 
+#include "GLRenderBackend.h"
+#endif
+
+#if defined(__GNUC__)
+#include <cxxabi.h>
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+
 #include "Assertion.h"
+#include "NullRenderBackend.h"
 #include "Shader.h"
 #include "RenderModule.h"
 
 bool RenderModule::bIsInit = false;
+bool RenderModule::bIsHeadless = false;
+std::unique_ptr<CachedRenderBackend> RenderModule::backend = nullptr;
+#if defined(_WIN32) || defined(_WIN64)
 HWND RenderModule::renderTargetHandle = nullptr;
 HDC RenderModule::deviceContext = nullptr;
 HGLRC RenderModule::glRenderContext = nullptr;
+#endif
 Mat4x4 RenderModule::ortho;
 wchar_t RenderModule::lastErrorMessage[MAX_BUFFER_SIZE];
-uint32_t RenderModule::cacheSize = 0;
-std::array<std::unique_ptr<IResource>, RenderModule::MAX_RESOURCE_SIZE> RenderModule::cache;
-std::map<std::string, IResource*> RenderModule::globalResources;
+std::vector<std::unique_ptr<IResourcePool>> RenderModule::resourcePools;
+std::unordered_map<uint64_t, RenderModule::GlobalResource> RenderModule::globalResources;
+std::vector<std::pair<const IResource*, std::function<void()>>> RenderModule::endFrameCallbacks;
+uint64_t RenderModule::frameCount = 0;
+RenderModule::FrameUniform RenderModule::frameUniform;
+uint32_t RenderModule::frameUniformBufferID = 0;
+
+/**
+ * @brief Ÿϸ  ǻƮ ̴  ҽ ŰԴϴ.
+ */
+static constexpr uint64_t TILE_MAP_GENERATOR_KEY = HashResourceKey("TileMapGenerator");
+
+/**
+ * @brief   ʱȭ Դϴ.    ð    մϴ.
+ */
+static std::chrono::steady_clock::time_point initTime;
 
 /**
  * @brief OpenGL Դϴ.
@@ -26,6 +56,7 @@ std::map<std::string, IResource*> RenderModule::globalResources;
 #define FIX_OPENGL_MAJOR_VERSION 4 // OpenGL (4) Դϴ.
 #define FIX_OPENGL_MINOR_VERSION 6 // OpenGL (6) Դϴ.
 
+#if defined(_WIN32) || defined(_WIN64)
 RenderModule::Errors RenderModule::Init(HWND windowHandle)
 {
 	if (bIsInit)
@@ -62,8 +93,31 @@ RenderModule::Errors RenderModule::Init(HWND windowHandle)
 		return Errors::ERR_IMGUI;
 	}
 
-	globalResources.insert({ "TileMapGenerator", RenderModule::CreateResource<Shader>("Resource/Shader/TileMapGenerator.comp") });
+	backend = std::make_unique<CachedRenderBackend>(std::make_unique<GLRenderBackend>(renderTargetHandle, deviceContext));
+	CreateFrameUniformBuffer();
+
+	SetGlobalResource(TILE_MAP_GENERATOR_KEY, RenderModule::CreateResource<Shader>("Resource/Shader/TileMapGenerator.comp"));
 	
+	bIsHeadless = false;
+	bIsInit = true;
+	return Errors::OK;
+}
+#endif
+
+RenderModule::Errors RenderModule::InitHeadless(int32_t screenWidth, int32_t screenHeight)
+{
+	if (bIsInit)
+	{
+		SetLastErrorMessage(L"Already initialize platform module.");
+		return Errors::ERR_PREV_INIT;
+	}
+
+	backend = std::make_unique<CachedRenderBackend>(std::make_unique<NullRenderBackend>(screenWidth, screenHeight));
+	CreateFrameUniformBuffer();
+
+	SetGlobalResource(TILE_MAP_GENERATOR_KEY, RenderModule::CreateResource<Shader>("Resource/Shader/TileMapGenerator.comp"));
+
+	bIsHeadless = true;
 	bIsInit = true;
 	return Errors::OK;
 }
@@ -76,21 +130,35 @@ RenderModule::Errors RenderModule::Uninit()
 		return Errors::ERR_NOT_INIT;
 	}
 
-	ImGui_ImplOpenGL3_Shutdown();
+#if defined(_WIN32) || defined(_WIN64)
+	if (!bIsHeadless)
+	{
+		ImGui_ImplOpenGL3_Shutdown();
+	}
+#endif
 
-	for (std::size_t index = 0; index < cacheSize; ++index)
+	for (auto pool = resourcePools.rbegin(); pool != resourcePools.rend(); ++pool)
 	{
-		if (cache[index])
-		{
-			if (cache[index]->IsInitialized())
-			{
-				cache[index]->Release();
-			}
+		(*pool)->Clear();
+	}
 
-			cache[index].reset();
-		}
+	globalResources.clear();
+	endFrameCallbacks.clear();
+
+	backend->DestroyBuffer(frameUniformBufferID);
+	frameUniformBufferID = 0;
+
+	backend.reset();
+
+	if (bIsHeadless)
+	{
+		bIsHeadless = false;
+		bIsInit = false;
+
+		return Errors::OK;
 	}
 
+#if defined(_WIN32) || defined(_WIN64)
 	if (!::wglMakeCurrent(nullptr, nullptr))
 	{
 		SetLastWindowsErrorMessage();
@@ -117,6 +185,7 @@ RenderModule::Errors RenderModule::Uninit()
 	}
 
 	renderTargetHandle = nullptr;
+#endif
 	bIsInit = false;
 
 	return Errors::OK;
@@ -124,8 +193,6 @@ RenderModule::Errors RenderModule::Uninit()
 
 void RenderModule::BeginFrame(float red, float green, float blue, float alpha, float depth, uint8_t stencil)
 {
-	ImGui::Render();
-
 	int32_t width = 0;
 	int32_t height = 0;
 	GetScreenSize(width, height);
@@ -133,23 +200,36 @@ void RenderModule::BeginFrame(float red, float green, float blue, float alpha, f
 	SetViewport(0, 0, width, height);
 	ortho = Mat4x4::Ortho(0.0f, static_cast<float>(width), static_cast<float>(height), 0.0f, -1.0f, 1.0f);
 
-	glClearColor(red, green, blue, alpha);
-	glClearDepth(depth);
-	glClearStencil(stencil);
-
-	GL_FAILED(glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT));
+	backend->BeginFrame(red, green, blue, alpha, depth, stencil);
+	backend->BindBufferBase(EBufferType::Uniform, FRAME_UNIFORM_BINDING, frameUniformBufferID);
 }
 
 void RenderModule::EndFrame()
 {
-	ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+	for (const auto& endFrameCallback : endFrameCallbacks)
+	{
+		endFrameCallback.second();
+	}
 
-	CHECK(SwapBuffers(deviceContext));
+	backend->EndFrame();
+	frameCount++;
+}
+
+void RenderModule::SetViewProjection(const Mat4x4& view, const Mat4x4& projection)
+{
+	frameUniform.view = view;
+	frameUniform.projection = projection;
+	frameUniform.viewProjection = view * projection;
+	frameUniform.time = std::chrono::duration<float>(std::chrono::steady_clock::now() - initTime).count();
+
+	backend->BindBuffer(EBufferType::Uniform, frameUniformBufferID);
+	backend->SetBufferSubData(EBufferType::Uniform, 0, &frameUniform, static_cast<uint32_t>(sizeof(FrameUniform)));
+	backend->BindBuffer(EBufferType::Uniform, 0);
 }
 
 void RenderModule::SetViewport(int32_t x, int32_t y, int32_t width, int32_t height)
 {
-	glViewport(x, y, width, height);
+	backend->SetViewport(x, y, width, height);
 }
 
 void RenderModule::SetWindowViewport()
@@ -162,82 +242,47 @@ void RenderModule::SetWindowViewport()
 
 void RenderModule::SetVsyncMode(bool bIsEnable)
 {
-	CHECK(wglSwapIntervalEXT(static_cast<int32_t>(bIsEnable)));
+	backend->SetVsyncMode(bIsEnable);
 }
 
 void RenderModule::SetDepthMode(bool bIsEnable)
 {
-	if (bIsEnable)
-	{
-		GL_FAILED(glEnable(GL_DEPTH_TEST));
-	}
-	else
-	{
-		GL_FAILED(glDisable(GL_DEPTH_TEST));
-	}
+	backend->SetRenderState(ERenderState::Depth, bIsEnable);
 }
 
 void RenderModule::SetStencilMode(bool bIsEnable)
 {
-	if (bIsEnable)
-	{
-		GL_FAILED(glEnable(GL_STENCIL_TEST));
-	}
-	else
-	{
-		GL_FAILED(glDisable(GL_STENCIL_TEST));
-	}
+	backend->SetRenderState(ERenderState::Stencil, bIsEnable);
 }
 
 void RenderModule::SetAlphaBlendMode(bool bIsEnable)
 {
-	if (bIsEnable)
-	{
-		GL_FAILED(glEnable(GL_BLEND));
-		GL_FAILED(glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ZERO));
-	}
-	else
-	{
-		GL_FAILED(glDisable(GL_BLEND));
-	}
+	backend->SetRenderState(ERenderState::AlphaBlend, bIsEnable);
 }
 
 void RenderModule::SetMultisampleMode(bool bIsEnable)
 {
-	if (bIsEnable)
-	{
-		GL_FAILED(glEnable(GL_MULTISAMPLE));
-	}
-	else
-	{
-		GL_FAILED(glDisable(GL_MULTISAMPLE));
-	}
+	backend->SetRenderState(ERenderState::Multisample, bIsEnable);
 }
 
 void RenderModule::SetPointSizeMode(bool bIsEnable)
 {
-	if (bIsEnable)
-	{
-		GL_FAILED(glEnable(GL_PROGRAM_POINT_SIZE));
-	}
-	else
-	{
-		GL_FAILED(glDisable(GL_PROGRAM_POINT_SIZE));
-	}
+	backend->SetRenderState(ERenderState::PointSize, bIsEnable);
 }
 
 RenderModule::Errors RenderModule::GetScreenSize(int32_t& outWidth, int32_t& outHeight)
 {
-	RECT windowRect;
-	if (!GetClientRect(renderTargetHandle, &windowRect))
+	if (!backend->GetScreenSize(outWidth, outHeight))
 	{
+#if defined(_WIN32) || defined(_WIN64)
 		SetLastWindowsErrorMessage();
 		return Errors::ERR_WIN;
+#else
+		SetLastErrorMessage(L"Failed to get screen size.");
+		return Errors::FAILED;
+#endif
 	}
 
-	outWidth = static_cast<int32_t>(windowRect.right - windowRect.left);
-	outHeight = static_cast<int32_t>(windowRect.bottom - windowRect.top);
-
 	return Errors::OK;
 }
 
@@ -250,19 +295,110 @@ Mat4x4 RenderModule::GetScreenOrtho(float nearZ, float farZ)
 	return Mat4x4::Ortho(0.0f, static_cast<float>(width), static_cast<float>(height), 0.0f, nearZ, farZ);
 }
 
+void RenderModule::AddEndFrameCallback(const IResource* owner, const std::function<void()>& callback)
+{
+	endFrameCallbacks.push_back({ owner, callback });
+}
+
+void RenderModule::RemoveEndFrameCallback(const IResource* owner)
+{
+	auto iter = std::remove_if(endFrameCallbacks.begin(), endFrameCallbacks.end(),
+		[&](const std::pair<const IResource*, std::function<void()>>& endFrameCallback)
+		{
+			return endFrameCallback.first == owner;
+		}
+	);
+
+	endFrameCallbacks.erase(iter, endFrameCallbacks.end());
+}
+
 const wchar_t* RenderModule::GetLastErrorMessage()
 {
 	return lastErrorMessage;
 }
 
-void RenderModule::ExecuteDrawVertex(uint32_t vertexCount, const EDrawMode& drawMode)
+void RenderModule::GetResourcePoolStats(std::vector<ResourcePoolStats>& outStats)
 {
-	GL_FAILED(glDrawArrays(static_cast<GLenum>(drawMode), 0, vertexCount));
+	outStats.clear();
+	outStats.reserve(resourcePools.size());
+
+	for (const auto& pool : resourcePools)
+	{
+		outStats.push_back(pool->GetStats());
+	}
+}
+
+IResourcePool* RenderModule::RegisterResourcePool(std::unique_ptr<IResourcePool> pool)
+{
+	resourcePools.push_back(std::move(pool));
+	return resourcePools.back().get();
+}
+
+std::string RenderModule::GetResourceTypeName(const std::type_info& typeInfo)
+{
+#if defined(__GNUC__)
+	int32_t status = 0;
+	char* demangledName = abi::__cxa_demangle(typeInfo.name(), nullptr, nullptr, &status);
+	if (status != 0 || !demangledName)
+	{
+		return typeInfo.name();
+	}
+
+	std::string typeName = demangledName;
+	std::free(demangledName);
+	return typeName;
+#else
+	// MSVC ͱ۸  ̸ ȯ, "class Shader"ó Ÿ  پ Ƿ մϴ.
+	std::string typeName = typeInfo.name();
+	for (const std::string& prefix : { std::string("class "), std::string("struct ") })
+	{
+		std::size_t position = 0;
+		while ((position = typeName.find(prefix, position)) != std::string::npos)
+		{
+			typeName.erase(position, prefix.size());
+		}
+	}
+	return typeName;
+#endif
+}
+
+void RenderModule::SetGlobalResource(uint64_t keyHash, const IResource* resource)
+{
+	if (!resource)
+	{
+		return;
+	}
+
+	globalResources[keyHash] = GlobalResource{ resource->GetPool(), resource->GetPoolHandleID() };
+}
+
+void RenderModule::ExecuteDrawVertex(uint32_t vertexCount, const EDrawMode& drawMode, uint32_t firstVertex)
+{
+	backend->DrawVertex(drawMode, vertexCount, firstVertex);
 }
 
 void RenderModule::ExecuteDrawIndex(uint32_t indexCount, const EDrawMode& drawMode)
 {
-	GL_FAILED(glDrawElements(static_cast<GLenum>(drawMode), indexCount, GL_UNSIGNED_INT, nullptr));
+	backend->DrawIndex(drawMode, indexCount);
+}
+
+void RenderModule::ExecuteDrawVertexInstanced(uint32_t vertexCount, uint32_t instanceCount, const EDrawMode& drawMode, uint32_t firstInstance)
+{
+	backend->DrawVertexInstanced(drawMode, vertexCount, instanceCount, firstInstance);
+}
+
+void RenderModule::ExecuteDrawIndexInstanced(uint32_t indexCount, uint32_t instanceCount, const EDrawMode& drawMode, uint32_t firstInstance)
+{
+	backend->DrawIndexInstanced(drawMode, indexCount, instanceCount, firstInstance);
+}
+
+void RenderModule::CreateFrameUniformBuffer()
+{
+	initTime = std::chrono::steady_clock::now();
+	frameUniform = FrameUniform();
+
+	frameUniformBufferID = backend->CreateBuffer(EBufferType::Uniform, &frameUniform, static_cast<uint32_t>(sizeof(FrameUniform)), VertexBuffer::EUsage::Dynamic);
+	backend->BindBuffer(EBufferType::Uniform, 0);
 }
 
 void RenderModule::SetLastErrorMessage(const std::wstring& message)
@@ -270,6 +406,7 @@ void RenderModule::SetLastErrorMessage(const std::wstring& message)
 	std::copy(message.begin(), message.end(), lastErrorMessage);
 }
 
+#if defined(_WIN32) || defined(_WIN64)
 void RenderModule::SetLastWindowsErrorMessage()
 {
 	DWORD errorCode = static_cast<DWORD>(GetLastError());
@@ -455,4 +592,5 @@ RenderModule::Errors RenderModule::CreateWGLContext()
 	}
 
 	return Errors::OK;
-}
\ No newline at end of file
+}
+#endif
\ No newline at end of file
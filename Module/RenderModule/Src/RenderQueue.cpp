@@ -0,0 +1,244 @@
+#include <utility>
+
+#include "Assertion.h"
+#include "GeometryRenderer3D.h"
+#include "MathModule.h"
+#include "MeshRenderer.h"
+#include "RenderQueue.h"
+
+RenderQueue::RenderQueue()
+	: view_(Mat4x4::Identity())
+{
+	bIsInitialized_ = true;
+}
+
+RenderQueue::~RenderQueue()
+{
+	if (bIsInitialized_)
+	{
+		Release();
+	}
+}
+
+void RenderQueue::Release()
+{
+	CHECK(bIsInitialized_);
+
+	commands_.clear();
+	sortCommands_.clear();
+	payloads_.clear();
+	sortIDs_.clear();
+	sortIDCaches_.fill(SortIDCache());
+	instanceWorlds_.clear();
+
+	bIsInitialized_ = false;
+}
+
+void RenderQueue::Reset(const Mat4x4& view, float farZ)
+{
+	CHECK(farZ > 0.0f);
+
+	view_ = view;
+	farZ_ = farZ;
+
+	commands_.clear();
+	payloads_.clear();
+}
+
+void RenderQueue::PushMesh(MeshRenderer* renderer, StaticMesh<VertexPositionNormalUv3D>* mesh, const Mat4x4& world, IResource* texture, const EPass& pass)
+{
+	Payload& payload = payloads_.emplace_back();
+	payload.type = EPayload::Mesh;
+	payload.renderer = renderer;
+	payload.resource = mesh;
+	payload.texture = texture;
+	payload.world = world;
+
+	Push(pass, payload, GetSortID(mesh));
+}
+
+void RenderQueue::PushRetained(GeometryRenderer3D* renderer, uint32_t handle, const Mat4x4& world, const EPass& pass)
+{
+	Payload& payload = payloads_.emplace_back();
+	payload.type = EPayload::Retained;
+	payload.renderer = renderer;
+	payload.handle = handle;
+	payload.world = world;
+
+	Push(pass, payload, handle);
+}
+
+void RenderQueue::Sort()
+{
+	uint32_t commandCount = static_cast<uint32_t>(commands_.size());
+	if (commandCount <= 1)
+	{
+		return;
+	}
+
+	sortCommands_.resize(commandCount);
+
+	uint32_t histograms[RADIX_PASS_COUNT][RADIX_SIZE] = { };
+	for (const Command& command : commands_)
+	{
+		for (uint32_t pass = 0; pass < RADIX_PASS_COUNT; ++pass)
+		{
+			histograms[pass][(command.key >> (pass * RADIX_BITS)) & (RADIX_SIZE - 1)]++;
+		}
+	}
+
+	Command* srcCommands = commands_.data();
+	Command* dstCommands = sortCommands_.data();
+
+	for (uint32_t pass = 0; pass < RADIX_PASS_COUNT; ++pass)
+	{
+		uint32_t shift = pass * RADIX_BITS;
+		uint32_t* histogram = histograms[pass];
+
+		if (histogram[(srcCommands[0].key >> shift) & (RADIX_SIZE - 1)] == commandCount)
+		{
+			continue; //    ڸ Ƿ  ٲ ʽϴ.
+		}
+
+		uint32_t offset = 0;
+		for (uint32_t digit = 0; digit < RADIX_SIZE; ++digit)
+		{
+			uint32_t count = histogram[digit];
+			histogram[digit] = offset;
+			offset += count;
+		}
+
+		for (uint32_t index = 0; index < commandCount; ++index)
+		{
+			const Command& command = srcCommands[index];
+			dstCommands[histogram[(command.key >> shift) & (RADIX_SIZE - 1)]++] = command;
+		}
+
+		std::swap(srcCommands, dstCommands);
+	}
+
+	if (srcCommands != commands_.data())
+	{
+		commands_.swap(sortCommands_);
+	}
+}
+
+void RenderQueue::Replay()
+{
+	stats_ = Stats();
+	stats_.commandCount = static_cast<uint32_t>(commands_.size());
+
+	const void* prevRenderer = nullptr;
+	const IResource* prevTexture = nullptr;
+	const void* prevMesh = nullptr;
+	uint32_t prevHandle = 0;
+
+	uint32_t commandCount = static_cast<uint32_t>(commands_.size());
+	for (uint32_t index = 0; index < commandCount;)
+	{
+		const Payload& payload = payloads_[commands_[index].payload];
+
+		stats_.shaderChangeCount += (payload.renderer != prevRenderer) ? 1 : 0;
+		stats_.materialChangeCount += (payload.texture != prevTexture) ? 1 : 0;
+		stats_.meshChangeCount += (payload.resource != prevMesh || payload.handle != prevHandle) ? 1 : 0;
+
+		prevRenderer = payload.renderer;
+		prevTexture = payload.texture;
+		prevMesh = payload.resource;
+		prevHandle = payload.handle;
+
+		if (payload.type == EPayload::Mesh)
+		{
+			instanceWorlds_.clear();
+
+			for (; index < commandCount; ++index)
+			{
+				const Payload& instance = payloads_[commands_[index].payload];
+				if (instance.type != EPayload::Mesh || instance.renderer != payload.renderer || instance.resource != payload.resource || instance.texture != payload.texture)
+				{
+					break;
+				}
+
+				instanceWorlds_.push_back(instance.world);
+			}
+
+			MeshRenderer* renderer = reinterpret_cast<MeshRenderer*>(payload.renderer);
+			StaticMesh<VertexPositionNormalUv3D>* mesh = reinterpret_cast<StaticMesh<VertexPositionNormalUv3D>*>(payload.resource);
+
+			renderer->DrawMeshInstanced(mesh, instanceWorlds_.data(), static_cast<uint32_t>(instanceWorlds_.size()), payload.texture);
+		}
+		else
+		{
+			GeometryRenderer3D* renderer = reinterpret_cast<GeometryRenderer3D*>(payload.renderer);
+			renderer->DrawRetained(payload.handle, payload.world);
+
+			index++;
+		}
+
+		stats_.drawCallCount++;
+	}
+}
+
+void RenderQueue::Push(const EPass& pass, const Payload& payload, uint32_t meshID)
+{
+	static const uint64_t SHADER_MASK = (1ULL << SHADER_BITS) - 1;
+	static const uint64_t MATERIAL_MASK = (1ULL << MATERIAL_BITS) - 1;
+	static const uint64_t MESH_MASK = (1ULL << MESH_BITS) - 1;
+	static const uint64_t DEPTH_MASK = (1ULL << DEPTH_BITS) - 1;
+
+	uint64_t passKey = static_cast<uint64_t>(pass);
+	uint64_t shaderKey = static_cast<uint64_t>(GetSortID(payload.renderer)) & SHADER_MASK;
+	uint64_t materialKey = static_cast<uint64_t>(GetSortID(payload.texture)) & MATERIAL_MASK;
+	uint64_t meshKey = static_cast<uint64_t>(meshID) & MESH_MASK;
+	uint64_t depthKey = static_cast<uint64_t>(QuantizeDepth(payload.world));
+
+	Command& command = commands_.emplace_back();
+	command.payload = static_cast<uint32_t>(payloads_.size() - 1);
+
+	if (pass == EPass::Transparent)
+	{
+		command.key = (passKey << (64 - PASS_BITS))
+			| ((DEPTH_MASK - depthKey) << (SHADER_BITS + MATERIAL_BITS + MESH_BITS))
+			| (shaderKey << (MATERIAL_BITS + MESH_BITS))
+			| (materialKey << MESH_BITS)
+			| meshKey;
+	}
+	else
+	{
+		command.key = (passKey << (64 - PASS_BITS))
+			| (shaderKey << (MATERIAL_BITS + MESH_BITS + DEPTH_BITS))
+			| (materialKey << (MESH_BITS + DEPTH_BITS))
+			| (meshKey << DEPTH_BITS)
+			| depthKey;
+	}
+}
+
+uint32_t RenderQueue::GetSortID(const void* object)
+{
+	if (!object)
+	{
+		return 0;
+	}
+
+	SortIDCache& cache = sortIDCaches_[(reinterpret_cast<uintptr_t>(object) >> 4) & (SORT_ID_CACHE_SIZE - 1)];
+	if (cache.object == object)
+	{
+		return cache.id;
+	}
+
+	auto result = sortIDs_.insert({ object, static_cast<uint32_t>(sortIDs_.size() + 1) });
+
+	cache.object = object;
+	cache.id = result.first->second;
+	return cache.id;
+}
+
+uint32_t RenderQueue::QuantizeDepth(const Mat4x4& world) const
+{
+	static const float DEPTH_SCALE = static_cast<float>((1 << DEPTH_BITS) - 1);
+
+	float depth = -(world.e30 * view_.e02 + world.e31 * view_.e12 + world.e32 * view_.e22 + view_.e32);
+	depth = MathModule::Clamp<float>(depth / farZ_, 0.0f, 1.0f);
+
+	return static_cast<uint32_t>(depth * DEPTH_SCALE);
+}
\ No newline at end of file
@@ -1,23 +1,20 @@
-#include <windows.h>
-
-#include <glad/glad.h>
-
 #include "FileModule.h"
 
 #include "Assertion.h"
+#include "RenderModule.h"
 #include "Shader.h"
 
 Shader::Shader(const std::string& csPath)
 {
 	uniformLocationCache_ = std::map<std::string, uint32_t>();
 
-	uint32_t csID = CreateShader(EType::Compute, csPath);
+	uint32_t csID = CreateShader(EShaderType::Compute, csPath);
 	ASSERT(csID != 0, "failed to create %s", csPath.c_str());
 
 	std::vector<uint32_t> shaderIDs = { csID };
 	programID_ = CreateProgram(shaderIDs);
 
-	GL_FAILED(glDeleteShader(csID));
+	RenderModule::GetBackend()->DestroyShader(csID);
 
 	bIsInitialized_ = true;
 }
@@ -26,17 +23,17 @@ Shader::Shader(const std::string& vsPath, const std::string& fsPath)
 {
 	uniformLocationCache_ = std::map<std::string, uint32_t>();
 
-	uint32_t vsID = CreateShader(EType::Vertex, vsPath);
+	uint32_t vsID = CreateShader(EShaderType::Vertex, vsPath);
 	ASSERT(vsID != 0, "failed to create %s", vsPath.c_str());
 
-	uint32_t fsID = CreateShader(EType::Fragment, fsPath);
+	uint32_t fsID = CreateShader(EShaderType::Fragment, fsPath);
 	ASSERT(fsID != 0, "failed to create %s", fsPath.c_str());
 
 	std::vector<uint32_t> shaderIDs = { vsID, fsID };
 	programID_ = CreateProgram(shaderIDs);
 	
-	GL_FAILED(glDeleteShader(vsID));
-	GL_FAILED(glDeleteShader(fsID));
+	RenderModule::GetBackend()->DestroyShader(vsID);
+	RenderModule::GetBackend()->DestroyShader(fsID);
 
 	bIsInitialized_ = true;
 }
@@ -45,21 +42,21 @@ Shader::Shader(const std::string& vsPath, const std::string& gsPath, const std::
 {
 	uniformLocationCache_ = std::map<std::string, uint32_t>();
 
-	uint32_t vsID = CreateShader(EType::Vertex, vsPath);
+	uint32_t vsID = CreateShader(EShaderType::Vertex, vsPath);
 	ASSERT(vsID != 0, "failed to create %s", vsPath.c_str());
 
-	uint32_t gsID = CreateShader(EType::Geometry, gsPath);
+	uint32_t gsID = CreateShader(EShaderType::Geometry, gsPath);
 	ASSERT(gsID != 0, "failed to create %s", gsPath.c_str());
 
-	uint32_t fsID = CreateShader(EType::Fragment, fsPath);
+	uint32_t fsID = CreateShader(EShaderType::Fragment, fsPath);
 	ASSERT(fsID != 0, "failed to create %s", fsPath.c_str());
 
 	std::vector<uint32_t> shaderIDs = { vsID, gsID, fsID };
 	programID_ = CreateProgram(shaderIDs);
 
-	GL_FAILED(glDeleteShader(vsID));
-	GL_FAILED(glDeleteShader(gsID));
-	GL_FAILED(glDeleteShader(fsID));
+	RenderModule::GetBackend()->DestroyShader(vsID);
+	RenderModule::GetBackend()->DestroyShader(gsID);
+	RenderModule::GetBackend()->DestroyShader(fsID);
 
 	bIsInitialized_ = true;
 }
@@ -78,7 +75,7 @@ void Shader::Release()
 
 	if (programID_)
 	{
-		GL_FAILED(glDeleteProgram(programID_));
+		RenderModule::GetBackend()->DestroyProgram(programID_);
 	}
 
 	bIsInitialized_ = false;
@@ -86,30 +83,31 @@ void Shader::Release()
 
 void Shader::Bind()
 {
-	GL_FAILED(glUseProgram(programID_));
+	RenderModule::GetBackend()->BindProgram(programID_);
 }
 
 void Shader::Unbind()
 {
-	GL_FAILED(glUseProgram(0));
+	RenderModule::GetBackend()->BindProgram(0);
 }
 
 void Shader::SetUniform(const std::string& name, bool value)
 {
 	int32_t location = GetUniformLocation(name);
-	GL_FAILED(glUniform1i(location, static_cast<int32_t>(value)));
+	int32_t intValue = static_cast<int32_t>(value);
+	RenderModule::GetBackend()->SetUniformInt(location, &intValue, 1);
 }
 
 void Shader::SetUniform(const std::string& name, int32_t value)
 {
 	int32_t location = GetUniformLocation(name);
-	GL_FAILED(glUniform1i(location, value));
+	RenderModule::GetBackend()->SetUniformInt(location, &value, 1);
 }
 
 void Shader::SetUniform(const std::string& name, float value)
 {
 	int32_t location = GetUniformLocation(name);
-	GL_FAILED(glUniform1f(location, value));
+	RenderModule::GetBackend()->SetUniformFloat(location, &value, 1);
 }
 
 void Shader::SetUniform(const std::string& name, const Vec2f& value)
@@ -117,13 +115,14 @@ void Shader::SetUniform(const std::string& name, const Vec2f& value)
 	int32_t location = GetUniformLocation(name);
 
 	const float* valuePtr = value.GetPtr();
-	GL_FAILED(glUniform2fv(location, 1, valuePtr));
+	RenderModule::GetBackend()->SetUniformFloat(location, valuePtr, 2);
 }
 
 void Shader::SetUniform(const std::string& name, float x, float y)
 {
 	int32_t location = GetUniformLocation(name);
-	GL_FAILED(glUniform2f(location, x, y));
+	float values[2] = { x, y };
+	RenderModule::GetBackend()->SetUniformFloat(location, values, 2);
 }
 
 void Shader::SetUniform(const std::string& name, const Vec2i& value)
@@ -131,13 +130,14 @@ void Shader::SetUniform(const std::string& name, const Vec2i& value)
 	int32_t location = GetUniformLocation(name);
 
 	const int32_t* valuePtr = value.GetPtr();
-	GL_FAILED(glUniform2iv(location, 1, valuePtr));
+	RenderModule::GetBackend()->SetUniformInt(location, valuePtr, 2);
 }
 
 void Shader::SetUniform(const std::string& name, int32_t x, int32_t y)
 {
 	int32_t location = GetUniformLocation(name);
-	GL_FAILED(glUniform2i(location, x, y));
+	int32_t values[2] = { x, y };
+	RenderModule::GetBackend()->SetUniformInt(location, values, 2);
 }
 
 void Shader::SetUniform(const std::string& name, const Vec3f& value)
@@ -145,13 +145,14 @@ void Shader::SetUniform(const std::string& name, const Vec3f& value)
 	int32_t location = GetUniformLocation(name);
 
 	const float* valuePtr = value.GetPtr();
-	GL_FAILED(glUniform3fv(location, 1, valuePtr));
+	RenderModule::GetBackend()->SetUniformFloat(location, valuePtr, 3);
 }
 
 void Shader::SetUniform(const std::string& name, float x, float y, float z)
 {
 	int32_t location = GetUniformLocation(name);
-	GL_FAILED(glUniform3f(location, x, y, z));
+	float values[3] = { x, y, z };
+	RenderModule::GetBackend()->SetUniformFloat(location, values, 3);
 }
 
 void Shader::SetUniform(const std::string& name, const Vec3i& value)
@@ -159,13 +160,14 @@ void Shader::SetUniform(const std::string& name, const Vec3i& value)
 	int32_t location = GetUniformLocation(name);
 
 	const int32_t* valuePtr = value.GetPtr();
-	GL_FAILED(glUniform3iv(location, 1, valuePtr));
+	RenderModule::GetBackend()->SetUniformInt(location, valuePtr, 3);
 }
 
 void Shader::SetUniform(const std::string& name, int32_t x, int32_t y, int32_t z)
 {
 	int32_t location = GetUniformLocation(name);
-	GL_FAILED(glUniform3i(location, x, y, z));
+	int32_t values[3] = { x, y, z };
+	RenderModule::GetBackend()->SetUniformInt(location, values, 3);
 }
 
 void Shader::SetUniform(const std::string& name, const Vec4f& value)
@@ -173,13 +175,14 @@ void Shader::SetUniform(const std::string& name, const Vec4f& value)
 	int32_t location = GetUniformLocation(name);
 
 	const float* valuePtr = value.GetPtr();
-	GL_FAILED(glUniform4fv(location, 1, valuePtr));
+	RenderModule::GetBackend()->SetUniformFloat(location, valuePtr, 4);
 }
 
 void Shader::SetUniform(const std::string& name, float x, float y, float z, float w)
 {
 	int32_t location = GetUniformLocation(name);
-	GL_FAILED(glUniform4f(location, x, y, z, w));
+	float values[4] = { x, y, z, w };
+	RenderModule::GetBackend()->SetUniformFloat(location, values, 4);
 }
 
 void Shader::SetUniform(const std::string& name, const Vec4i& value)
@@ -187,31 +190,52 @@ void Shader::SetUniform(const std::string& name, const Vec4i& value)
 	int32_t location = GetUniformLocation(name);
 
 	const int32_t* valuePtr = value.GetPtr();
-	GL_FAILED(glUniform4iv(location, 1, valuePtr));
+	RenderModule::GetBackend()->SetUniformInt(location, valuePtr, 4);
 }
 
 void Shader::SetUniform(const std::string& name, int32_t x, int32_t y, int32_t z, int32_t w)
 {
 	int32_t location = GetUniformLocation(name);
-	GL_FAILED(glUniform4i(location, x, y, z, w));
+	int32_t values[4] = { x, y, z, w };
+	RenderModule::GetBackend()->SetUniformInt(location, values, 4);
 }
 
 void Shader::SetUniform(const std::string& name, const Mat2x2& value)
 {
 	int32_t location = GetUniformLocation(name);
-	GL_FAILED(glUniformMatrix2fv(location, 1, GL_FALSE, value.GetPtr()));
+	RenderModule::GetBackend()->SetUniformMatrix(location, value.GetPtr(), 2);
 }
 
 void Shader::SetUniform(const std::string& name, const Mat3x3& value)
 {
 	int32_t location = GetUniformLocation(name);
-	GL_FAILED(glUniformMatrix3fv(location, 1, GL_FALSE, value.GetPtr()));
+	RenderModule::GetBackend()->SetUniformMatrix(location, value.GetPtr(), 3);
 }
 
 void Shader::SetUniform(const std::string& name, const Mat4x4& value)
 {
 	int32_t location = GetUniformLocation(name);
-	GL_FAILED(glUniformMatrix4fv(location, 1, GL_FALSE, value.GetPtr()));
+	RenderModule::GetBackend()->SetUniformMatrix(location, value.GetPtr(), 4);
+}
+
+void Shader::SetUniform(int32_t location, int32_t value)
+{
+	RenderModule::GetBackend()->SetUniformInt(location, &value, 1);
+}
+
+void Shader::SetUniform(int32_t location, float value)
+{
+	RenderModule::GetBackend()->SetUniformFloat(location, &value, 1);
+}
+
+void Shader::SetUniform(int32_t location, const Vec4f& value)
+{
+	RenderModule::GetBackend()->SetUniformFloat(location, value.GetPtr(), 4);
+}
+
+void Shader::SetUniform(int32_t location, const Mat4x4& value)
+{
+	RenderModule::GetBackend()->SetUniformMatrix(location, value.GetPtr(), 4);
 }
 
 int32_t Shader::GetUniformLocation(const std::string& name)
@@ -220,7 +244,7 @@ int32_t Shader::GetUniformLocation(const std::string& name)
 
 	if (uniformLocation == uniformLocationCache_.end())
 	{
-		int32_t location = glGetUniformLocation(programID_, name.c_str());
+		int32_t location = RenderModule::GetBackend()->GetUniformLocation(programID_, name);
 		CHECK(location != -1);
 
 		uniformLocationCache_.insert({ name, location });
@@ -232,28 +256,16 @@ int32_t Shader::GetUniformLocation(const std::string& name)
 	}
 }
 
-uint32_t Shader::CreateShader(const EType& type, const std::string& path, const char* entryPoint)
+uint32_t Shader::CreateShader(const EShaderType& type, const std::string& path, const char*)
 {
-	uint32_t shaderID = glCreateShader(static_cast<GLenum>(type));
-
 	std::vector<uint8_t> buffer;
 	ASSERT(FileModule::ReadFile(path, buffer) == FileModule::Errors::OK, "failed to read %s shader file", path.c_str());
 
 	std::string source = std::string(buffer.begin(), buffer.end());
-	const char* sourcePtr = source.c_str();
-
-	GL_FAILED(glShaderSource(shaderID, 1, &sourcePtr, nullptr));
-	GL_FAILED(glCompileShader(shaderID));
+	std::string errorLog;
 
-	int32_t status;
-	GL_FAILED(glGetShaderiv(shaderID, GL_COMPILE_STATUS, &status));
-	if (!status)
-	{
-		char buffer[1024];
-
-		glGetShaderInfoLog(shaderID, 1024, nullptr, buffer);
-		ASSERT(false, "failed to compile shader\n%s", buffer);
-	}
+	uint32_t shaderID = RenderModule::GetBackend()->CreateShader(type, source, errorLog);
+	ASSERT(shaderID != 0, "failed to compile shader\n%s", errorLog.c_str());
 
 	return shaderID;
 }
@@ -262,24 +274,10 @@ uint32_t Shader::CreateProgram(const std::vector<uint32_t>& shaderIDs)
 {
 	CHECK(shaderIDs.size() > 0);
 
-	uint32_t programID = glCreateProgram();
-	CHECK(programID != 0);
+	std::string errorLog;
 
-	for (const uint32_t shaderID : shaderIDs)
-	{
-		GL_FAILED(glAttachShader(programID, shaderID));
-	}
-	GL_FAILED(glLinkProgram(programID));
-
-	int32_t status;
-	GL_FAILED(glGetProgramiv(programID, GL_LINK_STATUS, &status));
-	if (!status)
-	{
-		char buffer[1024];
-
-		glGetProgramInfoLog(programID_, 1024, nullptr, buffer);
-		ASSERT(false, "failed to link shader program\n%s", buffer);
-	}
+	uint32_t programID = RenderModule::GetBackend()->CreateProgram(shaderIDs, errorLog);
+	ASSERT(programID != 0, "failed to link shader program\n%s", errorLog.c_str());
 
 	return programID;
 }
\ No newline at end of file
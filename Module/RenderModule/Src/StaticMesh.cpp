@@ -1,14 +1,9 @@
-#include <glad/glad.h>
+#include <cstddef>
 
 #include "Assertion.h"
+#include "RenderModule.h"
 #include "StaticMesh.h"
 
-template StaticMesh<VertexPosition3D>;
-template StaticMesh<VertexPositionColor3D>;
-template StaticMesh<VertexPositionUv3D>;
-template StaticMesh<VertexPositionNormal3D>;
-template StaticMesh<VertexPositionNormalUv3D>;
-
 template<>
 StaticMesh<VertexPosition3D>::StaticMesh(const std::vector<VertexPosition3D>& vertices, const std::vector<uint32_t>& indices)
 	: vertices_(vertices)
@@ -18,22 +13,21 @@ StaticMesh<VertexPosition3D>::StaticMesh(const std::vector<VertexPosition3D>& ve
 	const void* indexBufferPtr = reinterpret_cast<const void*>(indices_.data());
 	uint32_t indexBufferSize = static_cast<uint32_t>(indices_.size()) * sizeof(uint32_t);
 
-	GL_FAILED(glGenVertexArrays(1, &vertexArrayObject_));
-	GL_FAILED(glBindVertexArray(vertexArrayObject_));
+	IRenderBackend* backend = RenderModule::GetBackend();
+
+	vertexArrayObject_ = backend->CreateVertexArray();
+	backend->BindVertexArray(vertexArrayObject_);
 	{
 		vertexBuffer_.Bind();
-		GL_FAILED(glGenBuffers(1, &indexBufferID_));
+		indexBufferID_ = backend->CreateBuffer(EBufferType::Index, indexBufferPtr, indexBufferSize, VertexBuffer::EUsage::Static);
 
-		GL_FAILED(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBufferID_));
-		GL_FAILED(glBufferData(GL_ELEMENT_ARRAY_BUFFER, indexBufferSize, indexBufferPtr, GL_STATIC_DRAW));
-
-		GL_FAILED(glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, VertexPosition3D::GetStride(), (void*)(offsetof(VertexPosition3D, position))));
-		GL_FAILED(glEnableVertexAttribArray(0));
+		backend->SetVertexAttribute(0, 3, VertexPosition3D::GetStride(), static_cast<uint32_t>(offsetof(VertexPosition3D, position)));
+		backend->EnableVertexAttribute(0);
 
 		vertexBuffer_.Unbind();
 	}
 
-	GL_FAILED(glBindVertexArray(0));
+	backend->BindVertexArray(0);
 
 	bIsInitialized_ = true;
 }
@@ -47,25 +41,24 @@ StaticMesh<VertexPositionColor3D>::StaticMesh(const std::vector<VertexPositionCo
 	const void* indexBufferPtr = reinterpret_cast<const void*>(indices_.data());
 	uint32_t indexBufferSize = static_cast<uint32_t>(indices_.size()) * sizeof(uint32_t);
 
-	GL_FAILED(glGenVertexArrays(1, &vertexArrayObject_));
-	GL_FAILED(glBindVertexArray(vertexArrayObject_));
+	IRenderBackend* backend = RenderModule::GetBackend();
+
+	vertexArrayObject_ = backend->CreateVertexArray();
+	backend->BindVertexArray(vertexArrayObject_);
 	{
 		vertexBuffer_.Bind();
-		GL_FAILED(glGenBuffers(1, &indexBufferID_));
+		indexBufferID_ = backend->CreateBuffer(EBufferType::Index, indexBufferPtr, indexBufferSize, VertexBuffer::EUsage::Static);
 
-		GL_FAILED(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBufferID_));
-		GL_FAILED(glBufferData(GL_ELEMENT_ARRAY_BUFFER, indexBufferSize, indexBufferPtr, GL_STATIC_DRAW));
+		backend->SetVertexAttribute(0, 3, VertexPositionColor3D::GetStride(), static_cast<uint32_t>(offsetof(VertexPositionColor3D, position)));
+		backend->EnableVertexAttribute(0);
 
-		GL_FAILED(glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, VertexPositionColor3D::GetStride(), (void*)(offsetof(VertexPositionColor3D, position))));
-		GL_FAILED(glEnableVertexAttribArray(0));
-
-		GL_FAILED(glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, VertexPositionColor3D::GetStride(), (void*)(offsetof(VertexPositionColor3D, color))));
-		GL_FAILED(glEnableVertexAttribArray(1));
+		backend->SetVertexAttribute(1, 4, VertexPositionColor3D::GetStride(), static_cast<uint32_t>(offsetof(VertexPositionColor3D, color)));
+		backend->EnableVertexAttribute(1);
 
 		vertexBuffer_.Unbind();
 	}
 
-	GL_FAILED(glBindVertexArray(0));
+	backend->BindVertexArray(0);
 
 	bIsInitialized_ = true;
 }
@@ -79,25 +72,24 @@ StaticMesh<VertexPositionUv3D>::StaticMesh(const std::vector<VertexPositionUv3D>
 	const void* indexBufferPtr = reinterpret_cast<const void*>(indices_.data());
 	uint32_t indexBufferSize = static_cast<uint32_t>(indices_.size()) * sizeof(uint32_t);
 
-	GL_FAILED(glGenVertexArrays(1, &vertexArrayObject_));
-	GL_FAILED(glBindVertexArray(vertexArrayObject_));
+	IRenderBackend* backend = RenderModule::GetBackend();
+
+	vertexArrayObject_ = backend->CreateVertexArray();
+	backend->BindVertexArray(vertexArrayObject_);
 	{
 		vertexBuffer_.Bind();
-		GL_FAILED(glGenBuffers(1, &indexBufferID_));
-
-		GL_FAILED(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBufferID_));
-		GL_FAILED(glBufferData(GL_ELEMENT_ARRAY_BUFFER, indexBufferSize, indexBufferPtr, GL_STATIC_DRAW));
+		indexBufferID_ = backend->CreateBuffer(EBufferType::Index, indexBufferPtr, indexBufferSize, VertexBuffer::EUsage::Static);
 
-		GL_FAILED(glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, VertexPositionUv3D::GetStride(), (void*)(offsetof(VertexPositionUv3D, position))));
-		GL_FAILED(glEnableVertexAttribArray(0));
+		backend->SetVertexAttribute(0, 3, VertexPositionUv3D::GetStride(), static_cast<uint32_t>(offsetof(VertexPositionUv3D, position)));
+		backend->EnableVertexAttribute(0);
 
-		GL_FAILED(glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, VertexPositionUv3D::GetStride(), (void*)(offsetof(VertexPositionUv3D, uv))));
-		GL_FAILED(glEnableVertexAttribArray(2));
+		backend->SetVertexAttribute(1, 2, VertexPositionUv3D::GetStride(), static_cast<uint32_t>(offsetof(VertexPositionUv3D, uv)));
+		backend->EnableVertexAttribute(2);
 
 		vertexBuffer_.Unbind();
 	}
 
-	GL_FAILED(glBindVertexArray(0));
+	backend->BindVertexArray(0);
 
 	bIsInitialized_ = true;
 }
@@ -111,25 +103,24 @@ StaticMesh<VertexPositionNormal3D>::StaticMesh(const std::vector<VertexPositionN
 	const void* indexBufferPtr = reinterpret_cast<const void*>(indices_.data());
 	uint32_t indexBufferSize = static_cast<uint32_t>(indices_.size()) * sizeof(uint32_t);
 
-	GL_FAILED(glGenVertexArrays(1, &vertexArrayObject_));
-	GL_FAILED(glBindVertexArray(vertexArrayObject_));
+	IRenderBackend* backend = RenderModule::GetBackend();
+
+	vertexArrayObject_ = backend->CreateVertexArray();
+	backend->BindVertexArray(vertexArrayObject_);
 	{
 		vertexBuffer_.Bind();
-		GL_FAILED(glGenBuffers(1, &indexBufferID_));
-
-		GL_FAILED(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBufferID_));
-		GL_FAILED(glBufferData(GL_ELEMENT_ARRAY_BUFFER, indexBufferSize, indexBufferPtr, GL_STATIC_DRAW));
+		indexBufferID_ = backend->CreateBuffer(EBufferType::Index, indexBufferPtr, indexBufferSize, VertexBuffer::EUsage::Static);
 
-		GL_FAILED(glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, VertexPositionNormal3D::GetStride(), (void*)(offsetof(VertexPositionNormal3D, position))));
-		GL_FAILED(glEnableVertexAttribArray(0));
+		backend->SetVertexAttribute(0, 3, VertexPositionNormal3D::GetStride(), static_cast<uint32_t>(offsetof(VertexPositionNormal3D, position)));
+		backend->EnableVertexAttribute(0);
 
-		GL_FAILED(glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, VertexPositionNormal3D::GetStride(), (void*)(offsetof(VertexPositionNormal3D, normal))));
-		GL_FAILED(glEnableVertexAttribArray(1));
+		backend->SetVertexAttribute(1, 3, VertexPositionNormal3D::GetStride(), static_cast<uint32_t>(offsetof(VertexPositionNormal3D, normal)));
+		backend->EnableVertexAttribute(1);
 
 		vertexBuffer_.Unbind();
 	}
 
-	GL_FAILED(glBindVertexArray(0));
+	backend->BindVertexArray(0);
 
 	bIsInitialized_ = true;
 }
@@ -143,28 +134,27 @@ StaticMesh<VertexPositionNormalUv3D>::StaticMesh(const std::vector<VertexPositio
 	const void* indexBufferPtr = reinterpret_cast<const void*>(indices_.data());
 	uint32_t indexBufferSize = static_cast<uint32_t>(indices_.size()) * sizeof(uint32_t);
 
-	GL_FAILED(glGenVertexArrays(1, &vertexArrayObject_));
-	GL_FAILED(glBindVertexArray(vertexArrayObject_));
+	IRenderBackend* backend = RenderModule::GetBackend();
+
+	vertexArrayObject_ = backend->CreateVertexArray();
+	backend->BindVertexArray(vertexArrayObject_);
 	{
 		vertexBuffer_.Bind();
-		GL_FAILED(glGenBuffers(1, &indexBufferID_));
+		indexBufferID_ = backend->CreateBuffer(EBufferType::Index, indexBufferPtr, indexBufferSize, VertexBuffer::EUsage::Static);
 
-		GL_FAILED(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBufferID_));
-		GL_FAILED(glBufferData(GL_ELEMENT_ARRAY_BUFFER, indexBufferSize, indexBufferPtr, GL_STATIC_DRAW));
+		backend->SetVertexAttribute(0, 3, VertexPositionNormalUv3D::GetStride(), static_cast<uint32_t>(offsetof(VertexPositionNormalUv3D, position)));
+		backend->EnableVertexAttribute(0);
 
-		GL_FAILED(glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, VertexPositionNormalUv3D::GetStride(), (void*)(offsetof(VertexPositionNormalUv3D, position))));
-		GL_FAILED(glEnableVertexAttribArray(0));
+		backend->SetVertexAttribute(1, 3, VertexPositionNormalUv3D::GetStride(), static_cast<uint32_t>(offsetof(VertexPositionNormalUv3D, normal)));
+		backend->EnableVertexAttribute(1);
 
-		GL_FAILED(glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, VertexPositionNormalUv3D::GetStride(), (void*)(offsetof(VertexPositionNormalUv3D, normal))));
-		GL_FAILED(glEnableVertexAttribArray(1));
-
-		GL_FAILED(glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, VertexPositionNormalUv3D::GetStride(), (void*)(offsetof(VertexPositionNormalUv3D, uv))));
-		GL_FAILED(glEnableVertexAttribArray(2));
+		backend->SetVertexAttribute(2, 2, VertexPositionNormalUv3D::GetStride(), static_cast<uint32_t>(offsetof(VertexPositionNormalUv3D, uv)));
+		backend->EnableVertexAttribute(2);
 		
 		vertexBuffer_.Unbind();
 	}
 
-	GL_FAILED(glBindVertexArray(0));
+	backend->BindVertexArray(0);
 
 	bIsInitialized_ = true;
 }
@@ -183,9 +173,9 @@ void StaticMesh<VertexType>::Release()
 {
 	CHECK(bIsInitialized_);
 
-	GL_FAILED(glDeleteBuffers(1, &indexBufferID_));
+	RenderModule::GetBackend()->DestroyBuffer(indexBufferID_);
 	vertexBuffer_.~VertexBuffer();
-	GL_FAILED(glDeleteVertexArrays(1, &vertexArrayObject_));
+	RenderModule::GetBackend()->DestroyVertexArray(vertexArrayObject_);
 
 	bIsInitialized_ = false;
 }
@@ -193,11 +183,17 @@ void StaticMesh<VertexType>::Release()
 template <typename VertexType>
 void StaticMesh<VertexType>::Bind()
 {
-	GL_FAILED(glBindVertexArray(vertexArrayObject_));
+	RenderModule::GetBackend()->BindVertexArray(vertexArrayObject_);
 }
 
 template <typename VertexType>
 void StaticMesh<VertexType>::Unbind()
 {
-	GL_FAILED(glBindVertexArray(0));
-}
\ No newline at end of file
+	RenderModule::GetBackend()->BindVertexArray(0);
+}
+
+template class StaticMesh<VertexPosition3D>;
+template class StaticMesh<VertexPositionColor3D>;
+template class StaticMesh<VertexPositionUv3D>;
+template class StaticMesh<VertexPositionNormal3D>;
+template class StaticMesh<VertexPositionNormalUv3D>;
\ No newline at end of file
@@ -1,71 +1,149 @@
-#include <glad/glad.h>
+#include <cstring>
 
 #include "Assertion.h"
+#include "RenderModule.h"
 #include "VertexBuffer.h"
 
 VertexBuffer::VertexBuffer(uint32_t byteSize, const EUsage& usage)
 	: byteSize_(byteSize)
 	, usage_(usage)
 {
-	GL_FAILED(glGenBuffers(1, &vertexBufferID_));
-	GL_FAILED(glBindBuffer(GL_ARRAY_BUFFER, vertexBufferID_));
-	GL_FAILED(glBufferData(GL_ARRAY_BUFFER, byteSize_, nullptr, static_cast<GLenum>(usage)));
-	GL_FAILED(glBindBuffer(GL_ARRAY_BUFFER, 0));
+	IRenderBackend* backend = RenderModule::GetBackend();
+
+	if (usage_ == EUsage::StreamRing)
+	{
+		vertexBufferID_ = backend->CreateBuffer(EBufferType::Vertex, nullptr, byteSize_ * RING_SEGMENT_COUNT, usage_);
+		ringBufferPtr_ = reinterpret_cast<uint8_t*>(backend->MapBufferPersistent(EBufferType::Vertex));
+		CHECK(ringBufferPtr_ != nullptr);
+
+		ringFrame_ = RenderModule::GetFrameCount();
+	}
+	else
+	{
+		vertexBufferID_ = backend->CreateBuffer(EBufferType::Vertex, nullptr, byteSize_, usage_);
+	}
+
+	backend->BindBuffer(EBufferType::Vertex, 0);
 }
 
 VertexBuffer::VertexBuffer(const void* bufferPtr, uint32_t byteSize, const EUsage& usage)
 	: byteSize_(byteSize)
 	, usage_(usage)
 {
-	GL_FAILED(glGenBuffers(1, &vertexBufferID_));
-	GL_FAILED(glBindBuffer(GL_ARRAY_BUFFER, vertexBufferID_));
-	GL_FAILED(glBufferData(GL_ARRAY_BUFFER, byteSize_, bufferPtr, static_cast<GLenum>(usage)));
-	GL_FAILED(glBindBuffer(GL_ARRAY_BUFFER, 0));
+	CHECK(usage_ != EUsage::StreamRing);
+
+	IRenderBackend* backend = RenderModule::GetBackend();
+
+	vertexBufferID_ = backend->CreateBuffer(EBufferType::Vertex, bufferPtr, byteSize_, usage_);
+	backend->BindBuffer(EBufferType::Vertex, 0);
 }
 
 VertexBuffer::~VertexBuffer()
 {
-	GL_FAILED(glDeleteBuffers(1, &vertexBufferID_));
+	IRenderBackend* backend = RenderModule::GetBackend();
+
+	for (uint64_t& ringFence : ringFences_)
+	{
+		if (ringFence)
+		{
+			backend->DestroyFence(ringFence);
+			ringFence = 0;
+		}
+	}
+
+	backend->DestroyBuffer(vertexBufferID_);
 }
 
 void VertexBuffer::Bind()
 {
-	GL_FAILED(glBindBuffer(GL_ARRAY_BUFFER, vertexBufferID_));
+	RenderModule::GetBackend()->BindBuffer(EBufferType::Vertex, vertexBufferID_);
 }
 
 void VertexBuffer::Unbind()
 {
-	GL_FAILED(glBindBuffer(GL_ARRAY_BUFFER, 0));
+	RenderModule::GetBackend()->BindBuffer(EBufferType::Vertex, 0);
 }
 
 void VertexBuffer::SetBufferData(const void* bufferPtr, uint32_t bufferSize)
 {
 	CHECK(bufferPtr != nullptr && bufferSize <= byteSize_);
 
+	IRenderBackend* backend = RenderModule::GetBackend();
+
 	Bind();
 
 	switch (usage_)
 	{
 	case EUsage::Stream:
-		GL_FAILED(glBufferData(GL_ARRAY_BUFFER, bufferSize, bufferPtr, static_cast<GLenum>(usage_)));
+		backend->SetBufferData(EBufferType::Vertex, bufferPtr, bufferSize, usage_);
 		break;
 
 	case EUsage::Static:
-		GL_FAILED(glBufferSubData(GL_ARRAY_BUFFER, 0, bufferSize, bufferPtr));
+		backend->SetBufferSubData(EBufferType::Vertex, 0, bufferPtr, bufferSize);
 		break;
 
 	case EUsage::Dynamic:
 		{
-			void* vertexBufferPtr = glMapBuffer(GL_ARRAY_BUFFER, GL_WRITE_ONLY);
+			void* vertexBufferPtr = backend->MapBuffer(EBufferType::Vertex);
 			std::memcpy(vertexBufferPtr, bufferPtr, bufferSize);
-			GL_FAILED(glUnmapBuffer(GL_ARRAY_BUFFER));
+			backend->UnmapBuffer(EBufferType::Vertex);
 		}
 	break;
 
+	case EUsage::StreamRing:
+		ASSERT(false, "stream ring buffer must be written by WriteRingData");
+		break;
+
 	default:
 		ASSERT(false, "undefined buffer usage type");
 		break;
 	}
 
 	Unbind();
+}
+
+uint32_t VertexBuffer::WriteRingData(const void* bufferPtr, uint32_t stride, uint32_t vertexCount)
+{
+	uint32_t bufferSize = stride * vertexCount;
+	CHECK(usage_ == EUsage::StreamRing && bufferPtr != nullptr && stride > 0 && bufferSize <= byteSize_);
+
+	uint32_t segmentOffset = byteSize_ * ringSegment_;
+	uint32_t writeOffset = ((segmentOffset + ringOffset_ + stride - 1) / stride) * stride;
+
+	uint64_t frame = RenderModule::GetFrameCount();
+	if (frame != ringFrame_ || writeOffset + bufferSize > segmentOffset + byteSize_)
+	{
+		AdvanceRingSegment();
+		ringFrame_ = frame;
+
+		segmentOffset = byteSize_ * ringSegment_;
+		writeOffset = ((segmentOffset + stride - 1) / stride) * stride;
+		CHECK(writeOffset + bufferSize <= segmentOffset + byteSize_);
+	}
+
+	std::memcpy(ringBufferPtr_ + writeOffset, bufferPtr, bufferSize);
+	ringOffset_ = writeOffset + bufferSize - segmentOffset;
+
+	return writeOffset / stride;
+}
+
+void VertexBuffer::AdvanceRingSegment()
+{
+	IRenderBackend* backend = RenderModule::GetBackend();
+
+	if (ringOffset_ > 0)
+	{
+		ringFences_[ringSegment_] = backend->CreateFence();
+	}
+
+	ringSegment_ = (ringSegment_ + 1) % RING_SEGMENT_COUNT;
+	ringOffset_ = 0;
+
+	uint64_t& ringFence = ringFences_[ringSegment_];
+	if (ringFence)
+	{
+		backend->WaitFence(ringFence);
+		backend->DestroyFence(ringFence);
+		ringFence = 0;
+	}
 }
\ No newline at end of file
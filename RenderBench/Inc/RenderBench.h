@@ -0,0 +1,154 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "BenchModule.h"
+#include "GeometryRenderer3D.h"
+#include "Mat4x4.h"
+#include "MeshRenderer.h"
+#include "StaticMesh.h"
+#include "TileMap.h"
+#include "Vertex3D.h"
+
+
+/**
+ * @brief  ӿ ׸ ޽ Դϴ.
+ */
+static const uint32_t BENCH_MESH_COUNT = 64;
+
+
+/**
+ * @brief  ӿ ׸  (, ť) Դϴ.
+ */
+static const uint32_t BENCH_DEBUG_SHAPE_COUNT = 16;
+
+
+/**
+ * @brief  ġũ ϴ Դϴ.
+ *
+ * @note  ҽ 帮  ʱȭ  ⿡ մϴ.
+ */
+struct BenchScene
+{
+	/**
+	 * @brief   ҽ մϴ.
+	 */
+	void Initialize();
+
+
+	/**
+	 * @brief   մϴ.
+	 *
+	 * @note  ø̼        ȣմϴ.
+	 */
+	void RenderFrame();
+
+
+	/**
+	 * @brief 3D ⺻  ׸ Դϴ.
+	 */
+	GeometryRenderer3D* geometryRenderer = nullptr;
+
+
+	/**
+	 * @brief    ڵԴϴ.
+	 */
+	uint32_t grid = GeometryRenderer3D::INVALID_RETAINED;
+
+
+	/**
+	 * @brief ޽ø ׸ Դϴ.
+	 */
+	MeshRenderer* meshRenderer = nullptr;
+
+
+	/**
+	 * @brief  ޽Դϴ.
+	 */
+	StaticMesh<VertexPositionNormalUv3D>* mesh = nullptr;
+
+
+	/**
+	 * @brief ޽ÿ  ŸϸԴϴ.
+	 */
+	TileMap* tileMap = nullptr;
+
+
+	/**
+	 * @brief  þ Դϴ.
+	 */
+	Mat4x4 view;
+
+
+	/**
+	 * @brief   Դϴ.
+	 */
+	Mat4x4 projection;
+
+
+	/**
+	 * @brief ޽   Դϴ.
+	 */
+	std::vector<Mat4x4> meshWorlds;
+
+
+	/**
+	 * @brief     Դϴ.
+	 */
+	std::vector<Mat4x4> shapeWorlds;
+};
+
+
+/**
+ * @brief  ġũ ϴ Դϴ.
+ */
+extern BenchScene benchScene;
+
+
+/**
+ * @brief   ġ   Ӿ ϰ,  鿣忡 ϵ ȣ ī͸ մϴ.
+ */
+void PrintFrameCounters();
+
+
+/**
+ * @brief    ġũ մϴ.
+ */
+void RegisterFrameBenchmarks();
+
+
+/**
+ * @brief ¥ OpenGL Լ ̺  ˻ å glGetError ȣ  մϴ.
+ */
+void PrintErrorCheckCounters();
+
+
+/**
+ * @brief OpenGL  ˻ å ġũ մϴ.
+ */
+void RegisterErrorCheckBenchmarks();
+
+
+/**
+ * @brief   ť ƼƼ  ĵ  ϰ,  踦 մϴ.
+ */
+void PrintQueueCounters();
+
+
+/**
+ * @brief   ť , ,  ġũ մϴ.
+ */
+void RegisterQueueBenchmarks();
+
+
+/**
+ * @brief ҽ Ǯ 뷮 ڵ ˻  մϴ.
+ */
+void PrintResourcePoolCounters();
+
+
+/**
+ * @brief ҽ Ǯ /, ڵ ȸ,  ҽ ȸ ġũ մϴ.
+ */
+void RegisterResourceBenchmarks();
\ No newline at end of file
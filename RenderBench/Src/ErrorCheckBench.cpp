@@ -0,0 +1,118 @@
+#include <cstdio>
+
+#include "GLErrorCheck.h"
+
+#include "RenderBench.h"
+
+/**
+ * @brief    ˻ϴ ¥ OpenGL API ȣ Դϴ.
+ */
+static const uint32_t BENCH_GL_CALL_COUNT = 1000;
+
+/**
+ * @brief ׻ GL_NO_ERROR ȯϴ ¥ glGetErrorԴϴ.
+ */
+static uint32_t GetFakeError()
+{
+	return 0;
+}
+
+/**
+ * @brief ¥ OpenGL API ȣ BENCH_GL_CALL_COUNT ˻ϰ  ϴ.
+ */
+static void CheckFakeFrame()
+{
+	for (uint32_t index = 0; index < BENCH_GL_CALL_COUNT; ++index)
+	{
+		GLErrorCheck::CheckCall(__FILE__, __LINE__, "FakeCall()");
+	}
+
+	GLErrorCheck::CheckFrame();
+}
+
+/**
+ * @brief ¥ Լ ̺ ϰ ־ å ٲ㼭 մϴ.
+ */
+template <typename Function>
+static void RunWithFakeTable(const GLErrorCheck::EMode& mode, Function function)
+{
+	GLErrorCheck::EMode prevMode = GLErrorCheck::GetMode();
+
+	GLErrorCheck::FunctionTable functionTable;
+	functionTable.getError = GetFakeError;
+
+	GLErrorCheck::SetFunctionTable(functionTable);
+	GLErrorCheck::SetMode(mode);
+
+	function();
+
+	GLErrorCheck::SetFunctionTable(GLErrorCheck::FunctionTable());
+	GLErrorCheck::SetMode(prevMode);
+}
+
+void PrintErrorCheckCounters()
+{
+	static const struct { const char* name; GLErrorCheck::EMode mode; } modes[] =
+	{
+		{ "off",            GLErrorCheck::EMode::Off           },
+		{ "per frame",      GLErrorCheck::EMode::PerFrame      },
+		{ "per call",       GLErrorCheck::EMode::PerCall       },
+		{ "debug callback", GLErrorCheck::EMode::DebugCallback },
+	};
+
+	std::printf("glGetError calls per frame (%u checked calls)\n", BENCH_GL_CALL_COUNT);
+	for (const auto& mode : modes)
+	{
+		RunWithFakeTable(mode.mode, []()
+			{
+				GLErrorCheck::ResetCounters();
+				CheckFakeFrame();
+			}
+		);
+
+		std::printf("  %-20s %llu\n", mode.name, static_cast<unsigned long long>(GLErrorCheck::GetCounters().errorQueryCount));
+	}
+	std::printf("\n");
+}
+
+void RegisterErrorCheckBenchmarks()
+{
+	BenchModule::Register("Render/GLErrorCheck/Off", [](uint64_t iterations)
+		{
+			RunWithFakeTable(GLErrorCheck::EMode::Off, [iterations]()
+				{
+					for (uint64_t iteration = 0; iteration < iterations; ++iteration)
+					{
+						CheckFakeFrame();
+					}
+				}
+			);
+		}
+	);
+
+	BenchModule::Register("Render/GLErrorCheck/PerFrame", [](uint64_t iterations)
+		{
+			RunWithFakeTable(GLErrorCheck::EMode::PerFrame, [iterations]()
+				{
+					for (uint64_t iteration = 0; iteration < iterations; ++iteration)
+					{
+						CheckFakeFrame();
+					}
+				}
+			);
+		}
+	);
+
+	BenchModule::Register("Render/GLErrorCheck/PerCall", [](uint64_t iterations)
+		{
+			RunWithFakeTable(GLErrorCheck::EMode::PerCall, [iterations]()
+				{
+					for (uint64_t iteration = 0; iteration < iterations; ++iteration)
+					{
+						CheckFakeFrame();
+					}
+				}
+			);
+		}
+	);
+}
\ No newline at end of file
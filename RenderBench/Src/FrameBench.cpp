@@ -0,0 +1,243 @@
+#include <cstdio>
+
+#include "GeometryGenerator.h"
+#include "MathModule.h"
+#include "NullRenderBackend.h"
+#include "RandomStream.h"
+#include "RenderModule.h"
+
+#include "RenderBench.h"
+
+BenchScene benchScene;
+
+void BenchScene::Initialize()
+{
+	geometryRenderer = RenderModule::CreateResource<GeometryRenderer3D>();
+	meshRenderer = RenderModule::CreateResource<MeshRenderer>();
+	grid = geometryRenderer->CreateRetainedGrid3D(Vec3f(100.0f, 100.0f, 100.0f), 1.0f);
+
+	std::vector<VertexPositionNormalUv3D> vertices;
+	std::vector<uint32_t> indices;
+	GeometryGenerator::CreateSphere(1.0f, 40, vertices, indices);
+
+	mesh = RenderModule::CreateResource<StaticMesh<VertexPositionNormalUv3D>>(vertices, indices);
+	tileMap = RenderModule::CreateResource<TileMap>(TileMap::ESize::Size_512x512, TileMap::ESize::Size_64x64, Vec4f(1.0f, 0.0f, 0.0f, 1.0f), Vec4f(1.0f, 1.0f, 1.0f, 1.0f));
+
+	view = Mat4x4::LookAt(Vec3f(0.0f, 10.0f, 20.0f), Vec3f(0.0f, 0.0f, 0.0f), Vec3f(0.0f, 1.0f, 0.0f));
+	projection = Mat4x4::Perspective(MathModule::ToRadian(45.0f), 1000.0f / 800.0f, 0.01f, 1000.0f);
+
+	RandomStream stream(RandomStream::DEFAULT_SEED);
+
+	meshWorlds.resize(BENCH_MESH_COUNT);
+	for (Mat4x4& world : meshWorlds)
+	{
+		world = Mat4x4::Translation(stream.NextFloat(-20.0f, 20.0f), stream.NextFloat(0.0f, 5.0f), stream.NextFloat(-20.0f, 20.0f));
+	}
+
+	shapeWorlds.resize(BENCH_DEBUG_SHAPE_COUNT);
+	for (Mat4x4& world : shapeWorlds)
+	{
+		world = Mat4x4::Translation(stream.NextFloat(-20.0f, 20.0f), stream.NextFloat(0.0f, 5.0f), stream.NextFloat(-20.0f, 20.0f));
+	}
+}
+
+void BenchScene::RenderFrame()
+{
+	RenderModule::BeginFrame(0.0f, 0.0f, 0.0f, 1.0f);
+	{
+		RenderModule::SetViewProjection(view, projection);
+
+		geometryRenderer->DrawRetained(grid, Mat4x4::Identity());
+
+		for (uint32_t index = 0; index < BENCH_DEBUG_SHAPE_COUNT; ++index)
+		{
+			if (index & 1)
+			{
+				geometryRenderer->DrawCube3D(shapeWorlds[index], Vec3f(1.0f, 1.0f, 1.0f), Vec4f(1.0f, 1.0f, 0.0f, 1.0f));
+			}
+			else
+			{
+				geometryRenderer->DrawSphere3D(shapeWorlds[index], 1.0f, Vec4f(0.0f, 1.0f, 1.0f, 1.0f));
+			}
+		}
+
+		for (const Mat4x4& world : meshWorlds)
+		{
+			meshRenderer->DrawMesh(mesh, world, tileMap);
+		}
+	}
+	RenderModule::EndFrame();
+}
+
+/**
+ * @brief     ϰ 鿣 ȣ ī͸ մϴ.
+ */
+static void PrintFrameCounters(const char* title, const GeometryRenderer3D::EMode& mode)
+{
+	NullRenderBackend* backend = reinterpret_cast<NullRenderBackend*>(RenderModule::GetDeviceBackend());
+	CachedRenderBackend* stateCache = RenderModule::GetStateCache();
+
+	benchScene.geometryRenderer->SetMode(mode);
+
+	backend->ResetCounters();
+	stateCache->ResetCounters();
+	benchScene.RenderFrame();
+
+	const NullRenderBackend::Counters& counters = backend->GetCounters();
+	const CachedRenderBackend::Counters& cacheCounters = stateCache->GetCounters();
+	const GeometryRenderer3D::Stats& stats = benchScene.geometryRenderer->GetFrameStats();
+
+	std::printf("Backend calls per frame (%s)\n", title);
+	std::printf("  %-20s %llu\n", "draw calls", static_cast<unsigned long long>(counters.drawCallCount));
+	std::printf("  %-20s %llu\n", "draw vertices", static_cast<unsigned long long>(counters.drawVertexCount));
+	std::printf("  %-20s %llu\n", "draw indices", static_cast<unsigned long long>(counters.drawIndexCount));
+	std::printf("  %-20s %llu\n", "draw instances", static_cast<unsigned long long>(counters.drawInstanceCount));
+	std::printf("  %-20s %llu\n", "buffer uploads", static_cast<unsigned long long>(counters.bufferUploadCount));
+	std::printf("  %-20s %llu\n", "buffer upload bytes", static_cast<unsigned long long>(counters.bufferUploadBytes));
+	std::printf("  %-20s %llu\n", "state changes", static_cast<unsigned long long>(counters.stateChangeCount));
+	std::printf("  %-20s %llu\n", "program binds", static_cast<unsigned long long>(counters.programBindCount));
+	std::printf("  %-20s %llu\n", "vertex array binds", static_cast<unsigned long long>(counters.vertexArrayBindCount));
+	std::printf("  %-20s %llu\n", "buffer binds", static_cast<unsigned long long>(counters.bufferBindCount));
+	std::printf("  %-20s %llu\n", "texture binds", static_cast<unsigned long long>(counters.textureBindCount));
+	std::printf("  %-20s %llu\n", "uniform updates", static_cast<unsigned long long>(counters.uniformUpdateCount));
+	std::printf("  %-20s %llu\n", "fence waits", static_cast<unsigned long long>(counters.fenceWaitCount));
+	std::printf("  %-20s %llu\n", "state queries", static_cast<unsigned long long>(counters.stateQueryCount));
+	std::printf("  %-20s %llu\n", "cache issued", static_cast<unsigned long long>(cacheCounters.issuedStateCount));
+	std::printf("  %-20s %llu\n", "cache skipped", static_cast<unsigned long long>(cacheCounters.skippedStateCount));
+	std::printf("  %-20s %llu\n", "cache served queries", static_cast<unsigned long long>(cacheCounters.servedQueryCount));
+	std::printf("  %-20s %u\n", "debug primitives", stats.primitiveCount);
+	std::printf("  %-20s %u\n", "debug flushes", stats.flushCount);
+	std::printf("  %-20s %u\n", "debug draw calls", stats.drawCallCount);
+	std::printf("\n");
+
+	benchScene.geometryRenderer->SetMode(GeometryRenderer3D::EMode::Immediate);
+}
+
+void PrintFrameCounters()
+{
+	PrintFrameCounters("immediate", GeometryRenderer3D::EMode::Immediate);
+	PrintFrameCounters("batched", GeometryRenderer3D::EMode::Batched);
+}
+
+void RegisterFrameBenchmarks()
+{
+	BenchModule::Register("Render/Frame/Scene", [](uint64_t iterations)
+		{
+			for (uint64_t iteration = 0; iteration < iterations; ++iteration)
+			{
+				benchScene.RenderFrame();
+			}
+		}
+	);
+
+	BenchModule::Register("Render/Frame/SceneBatched", [](uint64_t iterations)
+		{
+			benchScene.geometryRenderer->SetMode(GeometryRenderer3D::EMode::Batched);
+			for (uint64_t iteration = 0; iteration < iterations; ++iteration)
+			{
+				benchScene.RenderFrame();
+			}
+			benchScene.geometryRenderer->SetMode(GeometryRenderer3D::EMode::Immediate);
+		}
+	);
+
+	BenchModule::Register("Render/GeometryRenderer3D/Cubes1000", [](uint64_t iterations)
+		{
+			for (uint64_t iteration = 0; iteration < iterations; ++iteration)
+			{
+				for (uint32_t index = 0; index < 1000; ++index)
+				{
+					benchScene.geometryRenderer->DrawCube3D(benchScene.shapeWorlds[index % BENCH_DEBUG_SHAPE_COUNT], Vec3f(1.0f, 1.0f, 1.0f), Vec4f(1.0f, 1.0f, 0.0f, 1.0f));
+				}
+			}
+		}
+	);
+
+	BenchModule::Register("Render/GeometryRenderer3D/Cubes1000Batched", [](uint64_t iterations)
+		{
+			benchScene.geometryRenderer->SetMode(GeometryRenderer3D::EMode::Batched);
+			for (uint64_t iteration = 0; iteration < iterations; ++iteration)
+			{
+				for (uint32_t index = 0; index < 1000; ++index)
+				{
+					benchScene.geometryRenderer->DrawCube3D(benchScene.shapeWorlds[index % BENCH_DEBUG_SHAPE_COUNT], Vec3f(1.0f, 1.0f, 1.0f), Vec4f(1.0f, 1.0f, 0.0f, 1.0f));
+				}
+				benchScene.geometryRenderer->Flush();
+			}
+			benchScene.geometryRenderer->SetMode(GeometryRenderer3D::EMode::Immediate);
+		}
+	);
+
+	BenchModule::Register("Render/GeometryRenderer3D/DrawGrid3D", [](uint64_t iterations)
+		{
+			for (uint64_t iteration = 0; iteration < iterations; ++iteration)
+			{
+				benchScene.geometryRenderer->DrawGrid3D(Vec3f(100.0f, 100.0f, 100.0f), 1.0f);
+			}
+		}
+	);
+
+	BenchModule::Register("Render/GeometryRenderer3D/DrawRetainedGrid3D", [](uint64_t iterations)
+		{
+			for (uint64_t iteration = 0; iteration < iterations; ++iteration)
+			{
+				benchScene.geometryRenderer->DrawRetained(benchScene.grid, Mat4x4::Identity());
+			}
+		}
+	);
+
+	BenchModule::Register("Render/GeometryRenderer3D/DrawSphere3D", [](uint64_t iterations)
+		{
+			for (uint64_t iteration = 0; iteration < iterations; ++iteration)
+			{
+				benchScene.geometryRenderer->DrawSphere3D(benchScene.shapeWorlds[0], 1.0f, Vec4f(0.0f, 1.0f, 1.0f, 1.0f));
+			}
+		}
+	);
+
+	BenchModule::Register("Render/GeometryRenderer3D/DrawCube3D", [](uint64_t iterations)
+		{
+			for (uint64_t iteration = 0; iteration < iterations; ++iteration)
+			{
+				benchScene.geometryRenderer->DrawCube3D(benchScene.shapeWorlds[1], Vec3f(1.0f, 1.0f, 1.0f), Vec4f(1.0f, 1.0f, 0.0f, 1.0f));
+			}
+		}
+	);
+
+	BenchModule::Register("Render/MeshRenderer/DrawMesh", [](uint64_t iterations)
+		{
+			for (uint64_t iteration = 0; iteration < iterations; ++iteration)
+			{
+				const Mat4x4& world = benchScene.meshWorlds[iteration % BENCH_MESH_COUNT];
+				benchScene.meshRenderer->DrawMesh(benchScene.mesh, world, benchScene.tileMap);
+
+				if ((iteration + 1) % BENCH_MESH_COUNT == 0)
+				{
+					benchScene.meshRenderer->Flush();
+				}
+			}
+			benchScene.meshRenderer->Flush();
+		}
+	);
+
+	BenchModule::Register("Render/MeshRenderer/DrawMeshInstanced10000", [](uint64_t iterations)
+		{
+			static std::vector<Mat4x4> worlds;
+			if (worlds.empty())
+			{
+				RandomStream stream(RandomStream::DEFAULT_SEED);
+
+				worlds.resize(10000);
+				for (Mat4x4& world : worlds)
+				{
+					world = Mat4x4::Translation(stream.NextFloat(-50.0f, 50.0f), stream.NextFloat(0.0f, 10.0f), stream.NextFloat(-50.0f, 50.0f));
+				}
+			}
+
+			for (uint64_t iteration = 0; iteration < iterations; ++iteration)
+			{
+				benchScene.meshRenderer->DrawMeshInstanced(benchScene.mesh, worlds, benchScene.tileMap);
+			}
+		}
+	);
+}
\ No newline at end of file
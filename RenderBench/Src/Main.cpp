@@ -0,0 +1,31 @@
+#include <cstdint>
+#include <cstdio>
+
+#include "RenderModule.h"
+
+#include "RenderBench.h"
+
+int32_t main(int32_t argc, char* argv[])
+{
+	if (RenderModule::InitHeadless(1000, 800) != RenderModule::Errors::OK)
+	{
+		std::fwprintf(stderr, L"failed to initialize render module : %ls\n", RenderModule::GetLastErrorMessage());
+		return 1;
+	}
+
+	benchScene.Initialize();
+	PrintFrameCounters();
+	PrintErrorCheckCounters();
+	PrintQueueCounters();
+	PrintResourcePoolCounters();
+
+	RegisterFrameBenchmarks();
+	RegisterErrorCheckBenchmarks();
+	RegisterQueueBenchmarks();
+	RegisterResourceBenchmarks();
+
+	int32_t result = BenchModule::Main(argc, argv);
+
+	RenderModule::Uninit();
+	return result;
+}
\ No newline at end of file
@@ -0,0 +1,147 @@
+#include <cstdio>
+
+#include "GeometryGenerator.h"
+#include "RandomStream.h"
+#include "RenderModule.h"
+#include "RenderQueue.h"
+
+#include "RenderBench.h"
+
+/**
+ * @brief   ť ġũ  ӿ ϴ ޽  Դϴ.
+ */
+static const uint32_t BENCH_QUEUE_COMMAND_COUNT = 4096;
+
+/**
+ * @brief   ť ġũ ϴ ޽ÿ ؽó Դϴ.
+ */
+static const uint32_t BENCH_QUEUE_MESH_COUNT = 4;
+static const uint32_t BENCH_QUEUE_TEXTURE_COUNT = 2;
+
+/**
+ * @brief   ť ġũ ϴ ҽԴϴ.
+ */
+static RenderQueue* queue = nullptr;
+static StaticMesh<VertexPositionNormalUv3D>* meshes[BENCH_QUEUE_MESH_COUNT];
+static TileMap* textures[BENCH_QUEUE_TEXTURE_COUNT];
+static std::vector<Mat4x4> worlds;
+static std::vector<uint32_t> resourceIndices;
+
+/**
+ * @brief   ť ġũ ҽ մϴ.
+ */
+static void InitializeQueueScene()
+{
+	if (queue)
+	{
+		return;
+	}
+
+	queue = RenderModule::CreateResource<RenderQueue>();
+
+	for (uint32_t index = 0; index < BENCH_QUEUE_MESH_COUNT; ++index)
+	{
+		std::vector<VertexPositionNormalUv3D> vertices;
+		std::vector<uint32_t> indices;
+		GeometryGenerator::CreateSphere(1.0f, 8 + index * 8, vertices, indices);
+
+		meshes[index] = RenderModule::CreateResource<StaticMesh<VertexPositionNormalUv3D>>(vertices, indices);
+	}
+
+	textures[0] = benchScene.tileMap;
+	textures[1] = RenderModule::CreateResource<TileMap>(TileMap::ESize::Size_512x512, TileMap::ESize::Size_64x64, Vec4f(0.0f, 0.0f, 1.0f, 1.0f), Vec4f(1.0f, 1.0f, 1.0f, 1.0f));
+
+	RandomStream stream(RandomStream::DEFAULT_SEED);
+
+	worlds.resize(BENCH_QUEUE_COMMAND_COUNT);
+	resourceIndices.resize(BENCH_QUEUE_COMMAND_COUNT);
+	for (uint32_t index = 0; index < BENCH_QUEUE_COMMAND_COUNT; ++index)
+	{
+		worlds[index] = Mat4x4::Translation(stream.NextFloat(-50.0f, 50.0f), stream.NextFloat(0.0f, 10.0f), stream.NextFloat(-50.0f, 50.0f));
+		resourceIndices[index] = static_cast<uint32_t>(stream.NextFloat(0.0f, static_cast<float>(BENCH_QUEUE_MESH_COUNT * BENCH_QUEUE_TEXTURE_COUNT) - 0.001f));
+	}
+}
+
+/**
+ * @brief ƼƼ   մϴ.
+ */
+static void RecordQueue()
+{
+	queue->Reset(benchScene.view, 1000.0f);
+	queue->PushRetained(benchScene.geometryRenderer, benchScene.grid, Mat4x4::Identity());
+
+	for (uint32_t index = 0; index < BENCH_QUEUE_COMMAND_COUNT; ++index)
+	{
+		uint32_t resourceIndex = resourceIndices[index];
+		queue->PushMesh(benchScene.meshRenderer, meshes[resourceIndex % BENCH_QUEUE_MESH_COUNT], worlds[index], textures[resourceIndex / BENCH_QUEUE_MESH_COUNT]);
+	}
+}
+
+/**
+ * @brief   ť  踦 մϴ.
+ */
+static void PrintQueueStats(const char* title)
+{
+	RenderModule::BeginFrame(0.0f, 0.0f, 0.0f, 1.0f);
+	queue->Replay();
+	RenderModule::EndFrame();
+
+	const RenderQueue::Stats& stats = queue->GetStats();
+
+	std::printf("Render queue replay (%s)\n", title);
+	std::printf("  %-20s %u\n", "commands", stats.commandCount);
+	std::printf("  %-20s %u\n", "draw calls", stats.drawCallCount);
+	std::printf("  %-20s %u\n", "shader changes", stats.shaderChangeCount);
+	std::printf("  %-20s %u\n", "material changes", stats.materialChangeCount);
+	std::printf("  %-20s %u\n", "mesh changes", stats.meshChangeCount);
+	std::printf("\n");
+}
+
+void PrintQueueCounters()
+{
+	InitializeQueueScene();
+
+	RecordQueue();
+	PrintQueueStats("entity order");
+
+	queue->Sort();
+	PrintQueueStats("sorted");
+}
+
+void RegisterQueueBenchmarks()
+{
+	InitializeQueueScene();
+
+	BenchModule::Register("Render/RenderQueue/Record", [](uint64_t iterations)
+		{
+			for (uint64_t iteration = 0; iteration < iterations; ++iteration)
+			{
+				RecordQueue();
+			}
+		}, BENCH_QUEUE_COMMAND_COUNT
+	);
+
+	BenchModule::Register("Render/RenderQueue/Sort", [](uint64_t iterations)
+		{
+			RecordQueue();
+
+			// LSD   Է     н  , ̹ ĵ  ٽ ص     ֽϴ.
+			for (uint64_t iteration = 0; iteration < iterations; ++iteration)
+			{
+				queue->Sort();
+			}
+		}, BENCH_QUEUE_COMMAND_COUNT
+	);
+
+	BenchModule::Register("Render/RenderQueue/Replay", [](uint64_t iterations)
+		{
+			RecordQueue();
+			queue->Sort();
+
+			for (uint64_t iteration = 0; iteration < iterations; ++iteration)
+			{
+				queue->Replay();
+			}
+		}, BENCH_QUEUE_COMMAND_COUNT
+	);
+}
\ No newline at end of file
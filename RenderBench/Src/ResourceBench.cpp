@@ -0,0 +1,137 @@
+#include <cstdio>
+#include <vector>
+
+#include "RenderModule.h"
+#include "Shader.h"
+
+#include "RenderBench.h"
+
+/**
+ * @brief ҽ Ǯ ġũ δ ҽ Դϴ.
+ */
+static const uint32_t BENCH_RESOURCE_COUNT = 1024;
+
+/**
+ * @brief Ÿϸ  ǻƮ ̴  ҽ ŰԴϴ.
+ */
+static constexpr uint64_t BENCH_TILE_MAP_GENERATOR_KEY = HashResourceKey("TileMapGenerator");
+
+/**
+ * @brief ҽ Ǯ ġũ ϴ, GPU ҽ  ʴ ҽԴϴ.
+ */
+class BenchResource : public IResource
+{
+public:
+	explicit BenchResource(uint32_t value) : value_(value) { bIsInitialized_ = true; }
+	virtual ~BenchResource() {}
+
+	DISALLOW_COPY_AND_ASSIGN(BenchResource);
+
+	virtual void Release() override { bIsInitialized_ = false; }
+
+	uint32_t GetValue() const { return value_; }
+
+private:
+	uint32_t value_ = 0;
+};
+
+/**
+ * @brief ҽ Ǯ ġũ ϴ ҽ ڵԴϴ.
+ */
+static std::vector<ResourceHandle<BenchResource>> handles;
+
+/**
+ * @brief ҽ Ǯ ġũ ҽ մϴ.
+ */
+static void InitializeResourceScene()
+{
+	if (!handles.empty())
+	{
+		return;
+	}
+
+	handles.resize(BENCH_RESOURCE_COUNT);
+	for (uint32_t index = 0; index < BENCH_RESOURCE_COUNT; ++index)
+	{
+		handles[index] = RenderModule::CreateResourceHandle<BenchResource>(index);
+	}
+}
+
+void PrintResourcePoolCounters()
+{
+	InitializeResourceScene();
+
+	ResourceHandle<BenchResource> staleHandle = RenderModule::CreateResourceHandle<BenchResource>(0u);
+	RenderModule::DestroyResource(staleHandle);
+	ResourceHandle<BenchResource> reusedHandle = RenderModule::CreateResourceHandle<BenchResource>(1u);
+
+	std::vector<ResourcePoolStats> stats;
+	RenderModule::GetResourcePoolStats(stats);
+
+	std::printf("Resource pools\n");
+	for (const ResourcePoolStats& pool : stats)
+	{
+		std::printf("  %-40s live %5u / slots %5u, %8llu bytes live, %8llu bytes reserved\n",
+			pool.typeName,
+			pool.liveCount,
+			pool.slotCount,
+			static_cast<unsigned long long>(pool.liveBytes),
+			static_cast<unsigned long long>(pool.reservedBytes)
+		);
+	}
+
+	std::printf("  %-40s %s\n", "stale handle rejected", RenderModule::GetResource(staleHandle) == nullptr ? "yes" : "no");
+	std::printf("  %-40s %s\n", "global TileMapGenerator is Shader", RenderModule::GetGlobalResource<Shader>(BENCH_TILE_MAP_GENERATOR_KEY) != nullptr ? "yes" : "no");
+	std::printf("  %-40s %s\n", "global TileMapGenerator is BenchResource", RenderModule::GetGlobalResource<BenchResource>(BENCH_TILE_MAP_GENERATOR_KEY) != nullptr ? "yes" : "no");
+	std::printf("\n");
+
+	RenderModule::DestroyResource(reusedHandle);
+}
+
+void RegisterResourceBenchmarks()
+{
+	InitializeResourceScene();
+
+	BenchModule::Register("Render/ResourcePool/CreateDestroy", [](uint64_t iterations)
+		{
+			for (uint64_t iteration = 0; iteration < iterations; ++iteration)
+			{
+				ResourceHandle<BenchResource> handle = RenderModule::CreateResourceHandle<BenchResource>(static_cast<uint32_t>(iteration));
+				BenchModule::DoNotOptimize(handle.id);
+				RenderModule::DestroyResource(handle);
+			}
+		}
+	);
+
+	BenchModule::Register("Render/ResourcePool/GetResource", [](uint64_t iterations)
+		{
+			for (uint64_t iteration = 0; iteration < iterations; ++iteration)
+			{
+				uint32_t sum = 0;
+				for (const ResourceHandle<BenchResource>& handle : handles)
+				{
+					sum += RenderModule::GetResource(handle)->GetValue();
+				}
+				BenchModule::DoNotOptimize(sum);
+			}
+		}, BENCH_RESOURCE_COUNT
+	);
+
+	BenchModule::Register("Render/ResourcePool/GetGlobalResource", [](uint64_t iterations)
+		{
+			for (uint64_t iteration = 0; iteration < iterations; ++iteration)
+			{
+				BenchModule::DoNotOptimize(RenderModule::GetGlobalResource<Shader>(BENCH_TILE_MAP_GENERATOR_KEY));
+			}
+		}
+	);
+
+	BenchModule::Register("Render/ResourcePool/GetGlobalResourceString", [](uint64_t iterations)
+		{
+			for (uint64_t iteration = 0; iteration < iterations; ++iteration)
+			{
+				BenchModule::DoNotOptimize(RenderModule::GetGlobalResource<Shader>("TileMapGenerator"));
+			}
+		}
+	);
+}
\ No newline at end of file
@@ -5,14 +5,20 @@ layout(location = 1) in vec4 inColor;
 
 layout(location = 0) out vec4 outColor;
 
+layout(std140, binding = 0) uniform FrameUniform
+{
+    mat4 view;
+    mat4 projection;
+    mat4 viewProjection;
+    float time;
+};
+
 uniform mat4 world;
-uniform mat4 view;
-uniform mat4 projection;
 uniform float pointSize;
 
 void main()
 {
-    gl_Position = projection * view * world * vec4(inPosition, 1.0f);
+    gl_Position = viewProjection * world * vec4(inPosition, 1.0f);
     gl_PointSize = pointSize;
     outColor = inColor;
 }
\ No newline at end of file
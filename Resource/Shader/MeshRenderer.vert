@@ -6,12 +6,18 @@ layout(location = 2) in vec2 inTexCoords;
 
 layout(location = 0) out vec2 outTexCoords;
 
+layout(std140, binding = 0) uniform FrameUniform
+{
+    mat4 view;
+    mat4 projection;
+    mat4 viewProjection;
+    float time;
+};
+
 uniform mat4 world;
-uniform mat4 view;
-uniform mat4 projection;
 
 void main()
 {
-    gl_Position = projection * view * world * vec4(inPosition, 1.0f);
+    gl_Position = viewProjection * world * vec4(inPosition, 1.0f);
     outTexCoords = inTexCoords;
 }
\ No newline at end of file
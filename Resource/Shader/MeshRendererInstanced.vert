@@ -0,0 +1,22 @@
+#version 460 core
+
+layout(location = 0) in vec3 inPosition;
+layout(location = 1) in vec3 inNormal;
+layout(location = 2) in vec2 inTexCoords;
+layout(location = 3) in mat4 inWorld;
+
+layout(location = 0) out vec2 outTexCoords;
+
+layout(std140, binding = 0) uniform FrameUniform
+{
+    mat4 view;
+    mat4 projection;
+    mat4 viewProjection;
+    float time;
+};
+
+void main()
+{
+    gl_Position = viewProjection * inWorld * vec4(inPosition, 1.0f);
+    outTexCoords = inTexCoords;
+}
\ No newline at end of file
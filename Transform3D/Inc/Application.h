@@ -1,15 +1,21 @@
 #pragma once
 
 #include <array>
+#include <vector>
 
 #include "CrashModule.h"
+#include "OcclusionBuffer.h"
 #include "PlatformModule.h"
 #include "RenderModule.h"
+#include "SceneHierarchy.h"
+#include "Vec3.h"
 
 #include "IEntity.h"
+#include "TickScheduler.h"
 
 class GeometryRenderer3D;
 class MeshRenderer;
+class RenderQueue;
 class Camera;
 
 
@@ -62,6 +68,12 @@ private:
 	MeshRenderer* meshRenderer_ = nullptr;
 
 
+	/**
+	 * @brief ƼƼ   ؼ  ϴ ťԴϴ.
+	 */
+	RenderQueue* renderQueue_ = nullptr;
+
+
 	/**
 	 * @brief ī޶ ƼƼԴϴ.
 	 */
@@ -71,5 +83,41 @@ private:
 	/**
 	 * @brief ø̼  ƼƼԴϴ.
 	 */
-	std::array<IEntity*, 3> entities_;
+	std::array<IEntity*, 4> entities_;
+
+
+	/**
+	 * @brief ü ø  ƼƼ   ߽Դϴ. entities_  Դϴ.
+	 */
+	std::vector<Vec3f> boundCenters_;
+
+
+	/**
+	 * @brief ü ø  ƼƼ   Դϴ.    ƼƼ ѴԴϴ.
+	 */
+	std::vector<float> boundRadii_;
+
+
+	/**
+	 * @brief ü ø  ø  ƼƼ εԴϴ.
+	 */
+	std::vector<uint32_t> visibleIndices_;
+
+
+	/**
+	 * @brief  ø  ػ  Դϴ. ü ø  ƼƼ ü   ٽ ׸ϴ.
+	 */
+	OcclusionBuffer occlusionBuffer_;
+
+
+	/**
+	 * @brief ƼƼ Ʈ  Դϴ. ƼƼ Tick     մϴ.
+	 */
+	SceneHierarchy sceneHierarchy_;
+
+
+	/**
+	 * @brief ƼƼ    Tick  迡   忡 ϴ ٷԴϴ.
+	 */
+	TickScheduler tickScheduler_;
 };
\ No newline at end of file
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "Mat4x4.h"
+#include "Vec3.h"
+
+class IResource;
+class MeshRenderer;
+struct VertexPositionNormalUv3D;
+template <typename VertexType> class StaticMesh;
+
+
+/**
+ * @brief Ʈ    ƮԴϴ.
+ */
+struct WorldMatrix
+{
+	Mat4x4 world;
+};
+
+
+/**
+ * @brief ƼƼ ׸    ޽, ؽó ƮԴϴ.
+ */
+struct MeshRef
+{
+	MeshRenderer* renderer = nullptr;
+	StaticMesh<VertexPositionNormalUv3D>* mesh = nullptr;
+	IResource* texture = nullptr;
+};
+
+
+/**
+ * @brief ü ø      ƮԴϴ.
+ *
+ * @note center radius Ʈ ٲ  localRadiusκ ٽ մϴ.
+ */
+struct BoundingSphere
+{
+	Vec3f center;
+	float radius = 0.0f;
+	float localRadius = 0.0f;
+};
+
+
+/**
+ * @brief  ߽  ӵ ȸϴ ƮԴϴ.
+ */
+struct Spin
+{
+	Vec3f axis;
+	float radiansPerSecond = 0.0f;
+	float radian = 0.0f;
+};
+
+
+/**
+ * @brief   ť , ü ø  ޽Դϴ.
+ *
+ * @note ûũ  Ʈ ŰǷ, ŰŸ   ٲ  ȿմϴ.
+ */
+struct RenderItem
+{
+	const MeshRef* mesh = nullptr;
+	const Mat4x4* world = nullptr;
+};
\ No newline at end of file
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <vector>
+
+#include "Frustum.h"
+
+#include "ArchetypeComponents.h"
+#include "ArchetypeWorld.h"
+
+
+/**
+ * @brief ŰŸ  ûũ  ȸϴ ýԴϴ.
+ *
+ * @note
+ * -  Ŭ   ޼  static Դϴ.
+ * - ý۸ ʿ Ʈ ÷ а Ƿ,  ƼƼ ͸     Tick ĳ ȿ ϴ.
+ */
+class ArchetypeSystems
+{
+public:
+	/**
+	 * @brief Spin Transform  ƼƼ ȸ մϴ.
+	 *
+	 * @param world  ŰŸ Դϴ.
+	 * @param deltaSeconds Ÿ ð Դϴ. ʴԴϴ.
+	 */
+	static void UpdateSpin(ArchetypeWorld& world, float deltaSeconds);
+
+
+	/**
+	 * @brief Transform WorldMatrix  ƼƼ   մϴ.
+	 *
+	 * @param world  ŰŸ Դϴ.
+	 */
+	static void UpdateWorldMatrix(ArchetypeWorld& world);
+
+
+	/**
+	 * @brief Transform BoundingSphere  ƼƼ     մϴ.
+	 *
+	 * @param world  ŰŸ Դϴ.
+	 */
+	static void UpdateBoundingSphere(ArchetypeWorld& world);
+
+
+	/**
+	 * @brief   ý   մϴ.
+	 *
+	 * @param world  ŰŸ Դϴ.
+	 * @param deltaSeconds Ÿ ð Դϴ. ʴԴϴ.
+	 */
+	static void Tick(ArchetypeWorld& world, float deltaSeconds);
+
+
+	/**
+	 * @brief MeshRef, WorldMatrix, BoundingSphere  ƼƼ  ü ϴ ƼƼ ϴ.
+	 *
+	 * @param world ȸ ŰŸ Դϴ.
+	 * @param frustum ø  þ üԴϴ.
+	 * @param outItems ̴ ƼƼ ޽ÿ    Դϴ. ȣ  ϴ.
+	 *
+	 * @return ̴ ƼƼ  ȯմϴ.
+	 */
+	static uint32_t CollectVisible(ArchetypeWorld& world, const Frustum& frustum, std::vector<RenderItem>& outItems);
+};
\ No newline at end of file
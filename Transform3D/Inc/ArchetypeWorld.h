@@ -0,0 +1,486 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "IEntity.h"
+
+
+/**
+ * @brief Ʈ Ÿ  ̵Դϴ. Ʈ ũ Ʈ ġ մϴ.
+ */
+using ComponentID = uint32_t;
+
+
+/**
+ * @brief ƼƼ  Ʈ Ÿ Դϴ. ComponentID ° Ʈ   ش Ʈ ϴ.
+ */
+using ComponentMask = uint32_t;
+
+
+/**
+ * @brief  Ʈ (ŰŸ)  ƼƼ ûũ  SoA ÷  ϴ Դϴ.
+ *
+ * @note
+ * - ŰŸԸ CHUNK_BYTES ũ ûũ Ҵϰ, ûũ ȿ Ʈ ŸԺ ӵ ÷ Ӵϴ.
+ * - ý ForEachChunk ûũ ÷ ͸ ޾  ȣ   ȸմϴ.
+ * - ƼƼ ID EntityManager  20Ʈ ε + 12Ʈ  , 帶  ߱ϹǷ EntityManager ID    ˴ϴ.
+ * - ƼƼ ϰų Ʈ ߰/ϸ ŰŸ    ڸ ŰǷ, ForEachChunk ߿  ٲٸ  ˴ϴ.
+ * - Ʈ Ÿ ִ MAX_COMPONENT_TYPE_COUNT   , ̵  ؾ մϴ.
+ * - ƼƼ ϳ Ʈ  ģ ũⰡ CHUNK_BYTES Ѱų,  64Ʈ Ѵ Ʈ  ʽϴ.
+ */
+class ArchetypeWorld
+{
+public:
+	/**
+	 * @brief ûũ ϳ Ʈ Դϴ.
+	 */
+	static const uint32_t CHUNK_BYTES = 16 * 1024;
+
+
+	/**
+	 * @brief   ִ ִ Ʈ Ÿ Դϴ.
+	 */
+	static const uint32_t MAX_COMPONENT_TYPE_COUNT = 32;
+
+
+	/**
+	 * @brief ƼƼ ID  ε ϴ Ʈ Դϴ.
+	 */
+	static const uint32_t INDEX_BITS = 20;
+
+
+	/**
+	 * @brief 忡 ÿ   ִ ִ ƼƼ Դϴ.
+	 */
+	static const uint32_t MAX_ENTITY_COUNT = 1u << INDEX_BITS;
+
+
+	/**
+	 * @brief  ִ Դϴ.
+	 */
+	static const uint32_t MAX_GENERATION = (1u << (32 - INDEX_BITS)) - 1;
+
+
+public:
+	/**
+	 * @brief ŰŸ  Ʈ Դϴ.
+	 */
+	ArchetypeWorld() = default;
+
+
+	/**
+	 * @brief ŰŸ   ҸԴϴ. ִ ƼƼ Ʈ  Ҹŵϴ.
+	 */
+	virtual ~ArchetypeWorld();
+
+
+	/**
+	 * @brief ŰŸ   ڿ  ڸ  մϴ.
+	 */
+	DISALLOW_COPY_AND_ASSIGN(ArchetypeWorld);
+
+
+	/**
+	 * @brief Ʈ Ÿ ID ϴ. ó ȣ  Ʈ Ÿ մϴ.
+	 *
+	 * @return Ʈ Ÿ ID ȯմϴ.
+	 */
+	template <typename TComponent>
+	static ComponentID GetComponentID()
+	{
+		static const ComponentID componentID = RegisterComponent(sizeof(TComponent), alignof(TComponent), &MoveComponent<TComponent>, &DestructComponent<TComponent>);
+		return componentID;
+	}
+
+
+	/**
+	 * @brief Ʈ ŸԵ ũ ϴ.
+	 *
+	 * @return Ʈ ŸԵ Ʈ   ũ ȯմϴ.
+	 */
+	template <typename... TComponents>
+	static ComponentMask GetComponentMask()
+	{
+		return (0u | ... | (1u << GetComponentID<TComponents>()));
+	}
+
+
+	/**
+	 * @brief Ʈ  ƼƼ մϴ.
+	 *
+	 * @param components ƼƼ  ƮԴϴ. Ʈ Ÿ  ޶ մϴ.
+	 *
+	 * @return  ƼƼ ID ȯմϴ. 尡  áٸ INVALID_ENTITY_ID ȯմϴ.
+	 */
+	template <typename... TComponents>
+	EntityID Create(TComponents&&... components)
+	{
+		Archetype& archetype = GetOrCreateArchetype(GetComponentMask<std::decay_t<TComponents>...>());
+
+		EntityID entityID = AllocateEntity(archetype);
+		if (entityID == INVALID_ENTITY_ID)
+		{
+			return INVALID_ENTITY_ID;
+		}
+
+		uint32_t row = archetype.entityCount - 1;
+		(new (GetComponentAddress(archetype, row, GetComponentID<std::decay_t<TComponents>>())) std::decay_t<TComponents>(std::forward<TComponents>(components)), ...);
+
+		return entityID;
+	}
+
+
+	/**
+	 * @brief ƼƼ մϴ. ̹  ƼƼ ƹ͵  ʽϴ.
+	 *
+	 * @param entityID  ƼƼ IDԴϴ.
+	 */
+	void Destroy(const EntityID& entityID);
+
+
+	/**
+	 * @brief ƼƼ ID ִ ƼƼ Ű Ȯմϴ.
+	 *
+	 * @param entityID Ȯ ƼƼ IDԴϴ.
+	 *
+	 * @return ִ ƼƼ true, ׷  false ȯմϴ.
+	 */
+	bool IsValid(const EntityID& entityID) const { return FindRecord(entityID) != nullptr; }
+
+
+	/**
+	 * @brief ƼƼ Ʈ ϴ.
+	 *
+	 * @param entityID Ʈ  ƼƼ IDԴϴ.
+	 *
+	 * @return Ʈ ͸ ȯմϴ.  ƼƼ̰ų Ʈ ٸ nullptr ȯմϴ.
+	 *
+	 * @note ȯ ʹ   ٲ  ȿմϴ.
+	 */
+	template <typename TComponent>
+	TComponent* GetComponent(const EntityID& entityID)
+	{
+		const Record* record = FindRecord(entityID);
+		if (!record)
+		{
+			return nullptr;
+		}
+
+		Archetype& archetype = *archetypes_[record->archetype];
+		ComponentID componentID = GetComponentID<TComponent>();
+		if ((archetype.mask & (1u << componentID)) == 0)
+		{
+			return nullptr;
+		}
+
+		return std::launder(reinterpret_cast<TComponent*>(GetComponentAddress(archetype, record->row, componentID)));
+	}
+
+
+	/**
+	 * @brief ƼƼ Ʈ ߰մϴ. ̹  Ʈ  ٲߴϴ.
+	 *
+	 * @param entityID Ʈ ߰ ƼƼ IDԴϴ.
+	 * @param component ߰ ƮԴϴ.
+	 *
+	 * @note  Ʈ  ŰŸ ƼƼ  Ʈ űϴ.
+	 */
+	template <typename TComponent>
+	void AddComponent(const EntityID& entityID, TComponent&& component)
+	{
+		using ComponentType = std::decay_t<TComponent>;
+
+		if (ComponentType* existing = GetComponent<ComponentType>(entityID))
+		{
+			*existing = std::forward<TComponent>(component);
+			return;
+		}
+
+		Record* record = FindRecord(entityID);
+		if (!record)
+		{
+			return;
+		}
+
+		ComponentID componentID = GetComponentID<ComponentType>();
+		ChangeArchetype(*record, archetypes_[record->archetype]->mask | (1u << componentID));
+
+		new (GetComponentAddress(*archetypes_[record->archetype], record->row, componentID)) ComponentType(std::forward<TComponent>(component));
+	}
+
+
+	/**
+	 * @brief ƼƼ Ʈ մϴ. Ʈ ٸ ƹ͵  ʽϴ.
+	 *
+	 * @param entityID Ʈ  ƼƼ IDԴϴ.
+	 */
+	template <typename TComponent>
+	void RemoveComponent(const EntityID& entityID)
+	{
+		Record* record = FindRecord(entityID);
+		if (!record)
+		{
+			return;
+		}
+
+		ComponentMask componentBit = 1u << GetComponentID<TComponent>();
+		if ((archetypes_[record->archetype]->mask & componentBit) == 0)
+		{
+			return;
+		}
+
+		ChangeArchetype(*record, archetypes_[record->archetype]->mask & ~componentBit);
+	}
+
+
+	/**
+	 * @brief Ʈ ŸԵ   ŰŸ ûũ ȸմϴ.
+	 *
+	 * @param function ûũ ȣ ԼԴϴ. (uint32_t count, TComponents*... columns) ̸,  ÷ count ӵ ƮԴϴ.
+	 */
+	template <typename... TComponents, typename TFunction>
+	void ForEachChunk(TFunction&& function)
+	{
+		ComponentMask mask = GetComponentMask<TComponents...>();
+
+		for (const std::unique_ptr<Archetype>& archetype : archetypes_)
+		{
+			if ((archetype->mask & mask) != mask)
+			{
+				continue;
+			}
+
+			uint32_t remainCount = archetype->entityCount;
+			for (std::size_t chunk = 0; remainCount > 0; ++chunk)
+			{
+				uint32_t count = remainCount < archetype->chunkCapacity ? remainCount : archetype->chunkCapacity;
+				unsigned char* data = archetype->chunks[chunk]->data;
+
+				function(count, std::launder(reinterpret_cast<TComponents*>(data + archetype->columnOffsets[GetComponentID<TComponents>()]))...);
+				remainCount -= count;
+			}
+		}
+	}
+
+
+	/**
+	 * @brief ִ ƼƼ  ϴ.
+	 */
+	uint32_t GetEntityCount() const { return entityCount_; }
+
+
+	/**
+	 * @brief  ŰŸ  ϴ.
+	 */
+	uint32_t GetArchetypeCount() const { return static_cast<uint32_t>(archetypes_.size()); }
+
+
+	/**
+	 * @brief  ŰŸԿ Ҵ ûũ  ϴ.
+	 */
+	uint32_t GetChunkCount() const;
+
+
+	/**
+	 * @brief Ʈ  ŰŸ ûũ ϳ  ƼƼ  ϴ.
+	 *
+	 * @param mask Ʈ  ũԴϴ.
+	 *
+	 * @return ûũ ϳ  ƼƼ  ȯմϴ. ŰŸ  ٸ 0 ȯմϴ.
+	 */
+	uint32_t GetChunkCapacity(const ComponentMask& mask) const;
+
+
+private:
+	/**
+	 * @brief Ʈ Ÿ ũ , ̵/Ҹ ԼԴϴ.
+	 */
+	struct ComponentInfo
+	{
+		uint32_t size = 0;
+		uint32_t alignment = 0;
+		void (*move)(void* dst, void* src) = nullptr; // src dst ̵   src Ҹŵϴ.
+		void (*destruct)(void* component) = nullptr;
+	};
+
+
+	/**
+	 * @brief ûũԴϴ. ƼƼ ID ÷ ڿ Ʈ ŸԺ ÷ ̾ϴ.
+	 */
+	struct Chunk
+	{
+		alignas(64) unsigned char data[CHUNK_BYTES];
+	};
+
+
+	/**
+	 * @brief  Ʈ   ƼƼ Դϴ.
+	 *
+	 * @note  ûũ   ûũ ׻   Ƿ,  row row / chunkCapacity ° ûũ row % chunkCapacity ° ĭԴϴ.
+	 */
+	struct Archetype
+	{
+		uint32_t index = 0;
+		ComponentMask mask = 0;
+		std::vector<ComponentID> componentIDs;
+		uint32_t columnOffsets[MAX_COMPONENT_TYPE_COUNT] = { 0, };
+		uint32_t chunkCapacity = 0;
+		uint32_t entityCount = 0;
+		std::vector<std::unique_ptr<Chunk>> chunks;
+	};
+
+
+	/**
+	 * @brief ƼƼ ID Ű ŰŸ԰ Դϴ.
+	 */
+	struct Record
+	{
+		uint32_t archetype = 0;
+		uint32_t row = 0;
+		uint32_t generation = 1;
+		uint32_t nextFree = INVALID_SLOT;
+		bool bIsAlive = false;
+	};
+
+
+	/**
+	 * @brief Ʈ Ÿ մϴ.
+	 *
+	 * @return ϵ Ʈ Ÿ ID ȯմϴ.
+	 */
+	static ComponentID RegisterComponent(uint32_t size, uint32_t alignment, void (*move)(void*, void*), void (*destruct)(void*));
+
+
+	/**
+	 * @brief src Ʈ dst ̵   src Ҹŵϴ.
+	 */
+	template <typename TComponent>
+	static void MoveComponent(void* dst, void* src)
+	{
+		TComponent* component = std::launder(reinterpret_cast<TComponent*>(src));
+		new (dst) TComponent(std::move(*component));
+		component->~TComponent();
+	}
+
+
+	/**
+	 * @brief Ʈ Ҹŵϴ.
+	 */
+	template <typename TComponent>
+	static void DestructComponent(void* component)
+	{
+		std::launder(reinterpret_cast<TComponent*>(component))->~TComponent();
+	}
+
+
+	/**
+	 * @brief ƼƼ ID  ε, 븦  ȯմϴ.
+	 */
+	static EntityID MakeID(uint32_t index, uint32_t generation) { return (generation << INDEX_BITS) | index; }
+	static uint32_t GetIndex(const EntityID& entityID) { return entityID & (MAX_ENTITY_COUNT - 1); }
+	static uint32_t GetGeneration(const EntityID& entityID) { return entityID >> INDEX_BITS; }
+
+
+	/**
+	 * @brief Ʈ  ŰŸ ϴ. ٸ  ϴ.
+	 */
+	Archetype& GetOrCreateArchetype(const ComponentMask& mask);
+
+
+	/**
+	 * @brief ŰŸ   ϳ ߰ϰ,  ƼƼ ID ߱մϴ. Ʈ  ʽϴ.
+	 *
+	 * @return  ƼƼ ID ȯմϴ. 尡  áٸ INVALID_ENTITY_ID ȯմϴ.
+	 */
+	EntityID AllocateEntity(Archetype& archetype);
+
+
+	/**
+	 * @brief ŰŸ   ϳ ߰մϴ.
+	 *
+	 * @return ߰  ȯմϴ.
+	 */
+	uint32_t PushRow(Archetype& archetype, const EntityID& entityID);
+
+
+	/**
+	 * @brief Ʈ ̹ ҸǾų Ű  ,    ڸ űϴ.
+	 */
+	void EraseRow(Archetype& archetype, uint32_t row);
+
+
+	/**
+	 * @brief ƼƼ ٸ Ʈ  ŰŸ űϴ.  տ  Ʈ ҸŰ,   Ʈ  ʽϴ.
+	 */
+	void ChangeArchetype(Record& record, const ComponentMask& mask);
+
+
+	/**
+	 * @brief ƼƼ ID ڵ带 ϴ.
+	 *
+	 * @return ִ ƼƼ ڵ带 ȯմϴ. Ǿų ȿ  ID nullptr ȯմϴ.
+	 */
+	Record* FindRecord(const EntityID& entityID);
+	const Record* FindRecord(const EntityID& entityID) const;
+
+
+	/**
+	 * @brief  ƼƼ ID  ּҸ ϴ.
+	 */
+	static EntityID* GetEntityAddress(Archetype& archetype, uint32_t row);
+
+
+	/**
+	 * @brief  Ʈ  ּҸ ϴ.
+	 */
+	static void* GetComponentAddress(Archetype& archetype, uint32_t row, const ComponentID& componentID);
+
+
+private:
+	/**
+	 * @brief     Ÿ εԴϴ.
+	 */
+	static const uint32_t INVALID_SLOT = 0xFFFFFFFF;
+
+
+	/**
+	 * @brief ϵ Ʈ Ÿ Դϴ. ComponentID εԴϴ.
+	 */
+	static std::vector<ComponentInfo> componentInfos;
+
+
+	/**
+	 * @brief ŰŸ Դϴ.
+	 */
+	std::vector<std::unique_ptr<Archetype>> archetypes_;
+
+
+	/**
+	 * @brief Ʈ  ũ ŰŸ ε Դϴ.
+	 */
+	std::unordered_map<ComponentMask, uint32_t> archetypeIndices_;
+
+
+	/**
+	 * @brief ƼƼ ID  ε Ű ڵ Դϴ.
+	 */
+	std::vector<Record> records_;
+
+
+	/**
+	 * @brief  ڵ  ù °  εԴϴ.
+	 */
+	uint32_t freeHead_ = INVALID_SLOT;
+
+
+	/**
+	 * @brief ִ ƼƼ Դϴ.
+	 */
+	uint32_t entityCount_ = 0;
+};
\ No newline at end of file
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "BVH.h"
 #include "Mat4x4.h"
 #include "Vec3.h"
 
@@ -52,9 +53,21 @@ public:
 
 
 	/**
-	 * @brief ī޶ ƼƼ ȭ鿡 ׸ϴ.
+	 * @brief ī޶ ƼƼ Tick а   ͸ ϴ.
+	 *
+	 * @param outAccess ī޶ ƼƼ Tick а   Դϴ.
+	 *
+	 * @note þ  ϹǷ, þ  д Tick ī޶󺸴 ߿ ؾ մϴ.
 	 */
-	virtual void Render() override;
+	virtual void GetTickAccess(TickAccess& outAccess) const override;
+
+
+	/**
+	 * @brief ī޶ ƼƼ ȭ鿡 ׸   մϴ.
+	 *
+	 * @param renderQueue    ťԴϴ.
+	 */
+	virtual void Render(RenderQueue* renderQueue) override;
 
 
 	/**
@@ -79,6 +92,25 @@ public:
 	const Mat4x4& GetProjection() const { return projection_; }
 
 
+	/**
+	 * @brief Ÿ  Ÿ ϴ.
+	 *
+	 * @return Ÿ  Ÿ ȯմϴ.
+	 */
+	float GetFarZ() const { return farZ_; }
+
+
+	/**
+	 * @brief ȭ ǥ     ϴ.
+	 *
+	 * @param x ȭ x ǥԴϴ. â Ŭ̾Ʈ  Դϴ.
+	 * @param y ȭ y ǥԴϴ. â Ŭ̾Ʈ  Դϴ.
+	 *
+	 * @return ī޶ ġ ϴ  ȯմϴ.  ȭǾ Ƿ t  ī޶κ ŸԴϴ.
+	 */
+	BVH::Ray GetPickingRay(int32_t x, int32_t y) const;
+
+
 	/**
 	 * @brief ī޶ ƼƼ Ȱȭ θ մϴ.
 	 * 
@@ -1,9 +1,9 @@
 #pragma once
 
-#include <array>
-#include <vector>
 #include <cstdint>
 #include <memory>
+#include <utility>
+#include <vector>
 
 #include "IManager.h"
 #include "IEntity.h"
@@ -12,7 +12,9 @@
 /**
  * @brief ƼƼ  ϴ ŴԴϴ.
  *
- * @note  Ŭ ̱Դϴ.
+ * @note
+ * -  Ŭ ̱Դϴ.
+ * - ƼƼ   þ 뺰  (generational slot map) մϴ. , , ȸ  O(1)Դϴ.
  */
 class EntityManager : public IManager
 {
@@ -59,25 +61,7 @@ public:
 	template <typename TEntity, typename... Args>
 	EntityID CreateID(Args&&... args)
 	{
-		EntityID entityID = -1;
-		for (int32_t index = 0; index < cacheSize_; ++index)
-		{
-			if (!cache_[index])
-			{
-				entityID = static_cast<EntityID>(index);
-				break;
-			}
-		}
-
-		if (entityID == -1)
-		{
-			entityID = cacheSize_++;
-		}
-
-		cache_[entityID] = std::make_unique<TEntity>(args...);
-		cache_[entityID]->SetID(entityID);
-
-		return entityID;
+		return CreateEntity<TEntity>(std::forward<Args>(args)...)->GetID();
 	}
 
 
@@ -86,30 +70,21 @@ public:
 	 *
 	 * @param args ƼƼ ڿ  ڵԴϴ.
 	 *
-	 * @return  ƼƼ ID ȯմϴ.
+	 * @return  ƼƼ ͸ ȯմϴ.
+	 *
+	 * @note   Ͽ  Ƿ ƼƼ   O(1)Դϴ.     ϳ  Ҵմϴ.
 	 */
 	template <typename TEntity, typename... Args>
 	TEntity* CreateEntity(Args&&... args)
 	{
-		EntityID entityID = -1;
-		for (int32_t index = 0; index < cacheSize_; ++index)
-		{
-			if (!cache_[index])
-			{
-				entityID = static_cast<EntityID>(index);
-				break;
-			}
-		}
-
-		if (entityID == -1)
-		{
-			entityID = cacheSize_++;
-		}
-
-		cache_[entityID] = std::make_unique<TEntity>(args...);
-		cache_[entityID]->SetID(entityID);
-
-		return reinterpret_cast<TEntity*>(cache_[entityID].get());
+		uint32_t index = AllocateSlot();
+		Slot& slot = GetSlot(index);
+
+		slot.entity = std::make_unique<TEntity>(std::forward<Args>(args)...);
+		slot.entity->SetID(MakeID(index, slot.generation));
+		++entityCount_;
+
+		return reinterpret_cast<TEntity*>(slot.entity.get());
 	}
 
 
@@ -118,19 +93,31 @@ public:
 	 *
 	 * @param entityID ƼƼ IDԴϴ.
 	 *
-	 * @return ƼƼ ͸ ϴ.
+	 * @return ƼƼ ͸ ϴ.  ƼƼ ID nullptr ȯմϴ.
 	 */
 	template <typename TEntity>
 	TEntity* GetEntity(const EntityID& entityID)
 	{
-		return reinterpret_cast<TEntity*>(cache_[entityID].get());
+		return reinterpret_cast<TEntity*>(FindEntity(entityID));
 	}
 
 
+	/**
+	 * @brief ƼƼ ID ִ ƼƼ Ű Ȯմϴ.
+	 *
+	 * @param entityID Ȯ ƼƼ IDԴϴ.
+	 *
+	 * @return ִ ƼƼ Ųٸ true, Ǿų ߱޵   ID false ȯմϴ.
+	 */
+	bool IsValid(const EntityID& entityID) const { return FindEntity(entityID) != nullptr; }
+
+
 	/**
 	 * @brief ƼƼ Ŵ ϴ ƼƼ մϴ.
 	 *
 	 * @param entityID  ƼƼ IDԴϴ.
+	 *
+	 * @note ̹  ƼƼ ID ƹ͵  ʽϴ.
 	 */
 	void Destroy(const EntityID& entityID);
 
@@ -143,6 +130,53 @@ public:
 	void Destroy(const IEntity* entity);
 
 
+	/**
+	 * @brief ִ ƼƼ  ϴ.
+	 *
+	 * @return ִ ƼƼ  ȯմϴ.
+	 */
+	uint32_t GetEntityCount() const { return entityCount_; }
+
+
+	/**
+	 * @brief Ҵ   ϴ.  ԰ 븦     մϴ.
+	 *
+	 * @return Ҵ   ȯմϴ.
+	 */
+	uint32_t GetSlotCount() const { return slotCount_; }
+
+
+public:
+	/**
+	 * @brief ƼƼ ID  ε ϴ Ʈ Դϴ.
+	 */
+	static const uint32_t INDEX_BITS = 20;
+
+
+	/**
+	 * @brief ƼƼ ID  밡 ϴ Ʈ Դϴ.
+	 */
+	static const uint32_t GENERATION_BITS = 32 - INDEX_BITS;
+
+
+	/**
+	 * @brief ÿ   ִ ִ ƼƼ Դϴ.
+	 */
+	static const uint32_t MAX_ENTITY_COUNT = 1u << INDEX_BITS;
+
+
+	/**
+	 * @brief  ִ Դϴ.   ƼƼ Ǹ  ٽ  ʽϴ.
+	 */
+	static const uint32_t MAX_GENERATION = (1u << GENERATION_BITS) - 1;
+
+
+	/**
+	 * @brief  ϳ   Դϴ.
+	 */
+	static const uint32_t PAGE_SIZE = 1024;
+
+
 private:
 	/**
 	 * @brief ƼƼ  ϴ Ŵ Ʈ ڿ   Ҹڸ մϴ.
@@ -150,21 +184,100 @@ private:
 	DEFAULT_CONSTRUCTOR_AND_VIRTUAL_DESTRUCTOR(EntityManager);
 
 
+	/**
+	 * @brief ƼƼ  Դϴ.
+	 */
+	struct Slot
+	{
+		/**
+		 * @brief  ƼƼԴϴ.  ̶ nullptrԴϴ.
+		 */
+		std::unique_ptr<IEntity> entity;
+
+
+		/**
+		 * @brief   Դϴ.  ó   1̰, ƼƼ   1 մϴ.
+		 */
+		uint32_t generation = 1;
+
+
+		/**
+		 * @brief   Ͽ    εԴϴ.
+		 */
+		uint32_t nextFree = INVALID_SLOT;
+	};
+
+
+	/**
+	 * @brief  ε  ƼƼ ID ϴ.
+	 */
+	static EntityID MakeID(uint32_t index, uint32_t generation) { return (generation << INDEX_BITS) | index; }
+
+
+	/**
+	 * @brief ƼƼ ID  ε ϴ.
+	 */
+	static uint32_t GetIndex(const EntityID& entityID) { return entityID & (MAX_ENTITY_COUNT - 1); }
+
+
+	/**
+	 * @brief ƼƼ ID  븦 ϴ.
+	 */
+	static uint32_t GetGeneration(const EntityID& entityID) { return entityID >> INDEX_BITS; }
+
+
+	/**
+	 * @brief  ε  ϴ.
+	 */
+	Slot& GetSlot(uint32_t index) { return pages_[index / PAGE_SIZE][index % PAGE_SIZE]; }
+	const Slot& GetSlot(uint32_t index) const { return pages_[index / PAGE_SIZE][index % PAGE_SIZE]; }
+
+
+	/**
+	 * @brief   Ͽ  ϴ.   ٸ   Ҵմϴ.
+	 *
+	 * @return   ε ȯմϴ.
+	 */
+	uint32_t AllocateSlot();
+
+
+	/**
+	 * @brief ƼƼ ID Ű ִ ƼƼ ϴ.
+	 *
+	 * @param entityID ƼƼ IDԴϴ.
+	 *
+	 * @return ִ ƼƼ ƼƼ , ׷  nullptr ȯմϴ.
+	 */
+	IEntity* FindEntity(const EntityID& entityID) const;
+
+
 private:
 	/**
-	 * @brief ƼƼ Ŵ ϴ ִ ƼƼ Դϴ.
+	 * @brief     Ÿ εԴϴ.
+	 */
+	static const uint32_t INVALID_SLOT = 0xFFFFFFFF;
+
+
+	/**
+	 * @brief   Դϴ.    ҴǸ Ű Ƿ  ּҰ ٲ ʽϴ.
+	 */
+	std::vector<std::unique_ptr<Slot[]>> pages_;
+
+
+	/**
+	 * @brief Ҵ  Դϴ.
 	 */
-	static const uint32_t MAX_RESOURCE_SIZE = 1000;
+	uint32_t slotCount_ = 0;
 
 
 	/**
-	 * @brief ƼƼ ĳ ũԴϴ.
+	 * @brief ִ ƼƼ Դϴ.
 	 */
-	uint32_t cacheSize_ = 0;
+	uint32_t entityCount_ = 0;
 
 
 	/**
-	 * @brief ƼƼ Ŵ  ƼƼ ĳԴϴ.
+	 * @brief    ù °  εԴϴ.
 	 */
-	std::array<std::unique_ptr<IEntity>, MAX_RESOURCE_SIZE> cache_;
+	uint32_t freeHead_ = INVALID_SLOT;
 };
\ No newline at end of file
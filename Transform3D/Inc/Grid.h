@@ -40,9 +40,21 @@ public:
 
 
 	/**
-	 * @brief (Grid) ƼƼ ȭ鿡 ׸ϴ.
+	 * @brief (Grid) ƼƼ Tick а   ͸ ϴ.
+	 *
+	 * @param outAccess (Grid) ƼƼ Tick а   Դϴ.
+	 *
+	 * @note ڴ Tick  Ϳ  ʽϴ.
+	 */
+	virtual void GetTickAccess(TickAccess& outAccess) const override {}
+
+
+	/**
+	 * @brief (Grid) ƼƼ ȭ鿡 ׸   մϴ.
+	 *
+	 * @param renderQueue    ťԴϴ.
 	 */
-	virtual void Render() override;
+	virtual void Render(RenderQueue* renderQueue) override;
 
 
 	/**
@@ -51,6 +63,33 @@ public:
 	virtual void Release() override;
 
 
+	/**
+	 * @brief  ũ⸦ մϴ.
+	 *
+	 * @param size   ũԴϴ.
+	 *
+	 * @note ũⰡ ٲ  Render   ٽ մϴ.
+	 */
+	void SetSize(const Vec3f& size);
+
+
+	/**
+	 * @brief   մϴ.
+	 *
+	 * @param stride   Դϴ.
+	 *
+	 * @note  ٲ  Render   ٽ մϴ.
+	 */
+	void SetStride(float stride);
+
+
+private:
+	/**
+	 * @brief    մϴ.
+	 */
+	void InvalidateRetained();
+
+
 private:
 	/**
 	 * @brief ڸ ׸   Դϴ.
@@ -68,4 +107,10 @@ private:
 	 * @brief  Դϴ.
 	 */
 	float stride_ = 1.0f;
+
+
+	/**
+	 * @brief      ڵԴϴ.
+	 */
+	uint32_t retained_ = 0;
 };
\ No newline at end of file
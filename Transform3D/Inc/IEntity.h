@@ -2,13 +2,24 @@
 
 #include <cstdint>
 
+#include "Vec3.h"
+
 #include "Macro.h"
+#include "TickAccess.h"
 
 
 /**
  * @brief ƼƼ  ̵(Entity Unique Identity)Դϴ.
+ *
+ * @note  Ʈ ƼƼ Ŵ   ε,  Ʈ  (generation)Դϴ.  Ǹ 밡 ٲǷ  ƼƼ ID  ƼƼ Ű ʽϴ.
+ */
+using EntityID = uint32_t;
+
+
+/**
+ * @brief ȿ  ƼƼ IDԴϴ.   1 ϹǷ  ƼƼ  ID  ʽϴ.
  */
-using EntityID = int32_t;
+const EntityID INVALID_ENTITY_ID = 0;
 
 
 /**
@@ -17,6 +28,18 @@ using EntityID = int32_t;
 class EntityManager;
 
 
+/**
+ * @brief   ť Ŭ  Դϴ.
+ */
+class RenderQueue;
+
+
+/**
+ * @brief  ø   Ŭ  Դϴ.
+ */
+class OcclusionBuffer;
+
+
 /**
  * @brief ƼƼ ̽Դϴ.
  */
@@ -54,9 +77,29 @@ public:
 
 
 	/**
-	 * @brief ƼƼ ȭ鿡 ׸ϴ.
+	 * @brief ƼƼ Tick а   ͸ ϴ.
+	 *
+	 * @param outAccess ƼƼ Tick а   Դϴ.
+	 *
+	 * @note
+	 * - ƽ ٷ   Tick   踦 , 浹 ʴ Tick  忡 ÿ մϴ.
+	 * - ⺻    ͸   忡 ϹǷ,   ƼƼ   ˴ϴ.
 	 */
-	virtual void Render() = 0;
+	virtual void GetTickAccess(TickAccess& outAccess) const
+	{
+		outAccess.Write(ETickResource::ALL);
+		outAccess.bIsMainThread = true;
+	}
+
+
+	/**
+	 * @brief ƼƼ ȭ鿡 ׸   մϴ.
+	 *
+	 * @param renderQueue    ťԴϴ.
+	 *
+	 * @note   ȣ ʰ ť ϸ, ť Ӹ    մϴ.
+	 */
+	virtual void Render(RenderQueue* renderQueue) = 0;
 
 
 	/**
@@ -67,6 +110,29 @@ public:
 	virtual void Release() = 0;
 
 
+	/**
+	 * @brief ƼƼ     ϴ.
+	 *
+	 * @param outCenter   ߽Դϴ.
+	 * @param outRadius   Դϴ.
+	 *
+	 * @return   ִٸ true, ׷  false ȯմϴ.
+	 *
+	 * @note    ƼƼ ü ø 󿡼 ܵǾ ׻ ׷ϴ.
+	 */
+	virtual bool GetBoundingSphere(Vec3f&, float&) const { return false; }
+
+
+	/**
+	 * @brief ƼƼ ü(occluder)  ۿ ߰մϴ.
+	 *
+	 * @param occlusionBuffer ü ߰  Դϴ.
+	 *
+	 * @note ٸ ƼƼ  ŭ ũ   ƼƼ մϴ. ⺻  ƹ͵ ߰ ʽϴ.
+	 */
+	virtual void AddOccluder(OcclusionBuffer*) const {}
+
+
 	/**
 	 * @brief ƼƼ ʱȭ  ִ Ȯմϴ.
 	 *
@@ -103,7 +169,7 @@ private:
 	/**
 	 * @brief ƼƼ ID Դϴ.
 	 */
-	EntityID id_ = -1;
+	EntityID id_ = INVALID_ENTITY_ID;
 
 
 protected:
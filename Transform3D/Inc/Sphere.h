@@ -2,6 +2,7 @@
 
 #include <imgui.h>
 
+#include "BVH.h"
 #include "Transform.h"
 #include "StaticMesh.h"
 #include "TileMap.h"
@@ -11,6 +12,7 @@
 
 class MeshRenderer;
 class Camera;
+class SceneHierarchy;
 
 
 /**
@@ -24,8 +26,9 @@ public:
 	 *
 	 * @param renderer     Դϴ.
 	 * @param camera ī޶Դϴ.
+	 * @param sceneHierarchy  Ʈ   Դϴ.
 	 */
-	Sphere(MeshRenderer* renderer, Camera* camera);
+	Sphere(MeshRenderer* renderer, Camera* camera, SceneHierarchy* sceneHierarchy);
 
 
 	/**
@@ -49,9 +52,21 @@ public:
 
 
 	/**
-	 * @brief (Sphere) ƼƼ ȭ鿡 ׸ϴ.
+	 * @brief (Sphere) ƼƼ Tick а   ͸ ϴ.
+	 *
+	 * @param outAccess (Sphere) ƼƼ Tick а   Դϴ.
+	 *
+	 * @note ī޶ Ȱȭ θ ٲٰ   , ImGui â ׸Ƿ  忡 մϴ.
 	 */
-	virtual void Render() override;
+	virtual void GetTickAccess(TickAccess& outAccess) const override;
+
+
+	/**
+	 * @brief (Sphere) ƼƼ ȭ鿡 ׸   մϴ.
+	 *
+	 * @param renderQueue    ťԴϴ.
+	 */
+	virtual void Render(RenderQueue* renderQueue) override;
 
 
 	/**
@@ -60,6 +75,34 @@ public:
 	virtual void Release() override;
 
 
+	/**
+	 * @brief (Sphere) ƼƼ     ϴ.
+	 *
+	 * @param outCenter   ߽Դϴ.
+	 * @param outRadius   Դϴ.
+	 *
+	 * @return ׻ true ȯմϴ.
+	 */
+	virtual bool GetBoundingSphere(Vec3f& outCenter, float& outRadius) const override;
+
+
+	/**
+	 * @brief (Sphere) ƼƼ ޽ø ü  ۿ ߰մϴ.
+	 *
+	 * @param occlusionBuffer ü ߰  Դϴ.
+	 *
+	 * @note  ޽ô   ϹǷ, ü    ü ϰ  ʽϴ.
+	 */
+	virtual void AddOccluder(OcclusionBuffer* occlusionBuffer) const override;
+
+
+private:
+	/**
+	 * @brief Ŀ ġ   ﰢ մϴ.
+	 */
+	void Pick();
+
+
 private:
 	/**
 	 * @brief ImGui  ӼԴϴ.
@@ -91,6 +134,24 @@ private:
 	TileMap* tileMap_ = nullptr;
 
 
+	/**
+	 * @brief (picking)   ޽   BVHԴϴ.
+	 */
+	BVH bvh_;
+
+
+	/**
+	 * @brief õ ﰢ εԴϴ. õ ﰢ ٸ BVH::INVALID_PRIMITIVEԴϴ.
+	 */
+	uint32_t pickedTriangle_ = BVH::INVALID_PRIMITIVE;
+
+
+	/**
+	 * @brief ī޶󿡼 õ  ŸԴϴ.
+	 */
+	float pickedDistance_ = 0.0f;
+
+
 	/**
 	 * @brief    ġԴϴ.
 	 */
@@ -131,4 +192,16 @@ private:
 	 * @brief ī޶Դϴ.
 	 */
 	Camera* camera_ = nullptr;
+
+
+	/**
+	 * @brief  Ʈ ϵ  Դϴ.
+	 */
+	SceneHierarchy* sceneHierarchy_ = nullptr;
+
+
+	/**
+	 * @brief     IDԴϴ.
+	 */
+	uint32_t sceneNode_ = 0;
 };
\ No newline at end of file
@@ -0,0 +1,123 @@
+#pragma once
+
+#include <vector>
+
+#include "StaticMesh.h"
+#include "TileMap.h"
+#include "Vertex3D.h"
+
+#include "ArchetypeComponents.h"
+#include "ArchetypeWorld.h"
+#include "IEntity.h"
+
+class MeshRenderer;
+class Camera;
+
+
+/**
+ * @brief     ŰŸ 忡    ϰ ׸ ƼƼԴϴ.
+ *
+ * @note
+ * -  ϳϳ IEntity ƴ϶ ŰŸ  ƼƼ̹Ƿ,   Ҵ  ȣ Ͼ ʽϴ.
+ * -  ƼƼ ü IEntity̹Ƿ,  ƼƼ Ͽ ״ ־ ٸ ƼƼ Բ Tick/Render  ֽϴ.
+ * -  ü ø  ϹǷ, ƼƼ     ʽϴ.
+ */
+class SphereField : public IEntity
+{
+public:
+	/**
+	 * @brief  (SphereField) ƼƼ Դϴ.
+	 *
+	 * @param renderer     Դϴ.
+	 * @param camera ü ø  ī޶Դϴ.
+	 * @param count   Դϴ.
+	 */
+	SphereField(MeshRenderer* renderer, Camera* camera, uint32_t count);
+
+
+	/**
+	 * @brief  (SphereField) ƼƼ  ҸԴϴ.
+	 */
+	virtual ~SphereField();
+
+
+	/**
+	 * @brief  (SphereField) ƼƼ  ڿ  ڸ  մϴ.
+	 */
+	DISALLOW_COPY_AND_ASSIGN(SphereField);
+
+
+	/**
+	 * @brief  (SphereField) ƼƼ ý մϴ.
+	 *
+	 * @param deltaSeconds Ÿ ð Դϴ.
+	 */
+	virtual void Tick(float deltaSeconds) override;
+
+
+	/**
+	 * @brief  (SphereField) ƼƼ Tick а   ͸ ϴ.
+	 *
+	 * @param outAccess  (SphereField) ƼƼ Tick а   Դϴ.
+	 *
+	 * @note ڽ ŰŸ 常 ϰ ī޶ Render Ƿ,  Ϳ  ʽϴ.
+	 */
+	virtual void GetTickAccess(TickAccess& outAccess) const override {}
+
+
+	/**
+	 * @brief ī޶ ü     ť մϴ.
+	 *
+	 * @param renderQueue    ťԴϴ.
+	 */
+	virtual void Render(RenderQueue* renderQueue) override;
+
+
+	/**
+	 * @brief  (SphereField) ƼƼ  ҽ Ҵ մϴ.
+	 */
+	virtual void Release() override;
+
+
+	/**
+	 * @brief   ŰŸ 带 ϴ.
+	 */
+	ArchetypeWorld& GetWorld() { return world_; }
+
+
+private:
+	/**
+	 * @brief   ŰŸ Դϴ.
+	 */
+	ArchetypeWorld world_;
+
+
+	/**
+	 * @brief  ޽ ҽԴϴ.   մϴ.
+	 */
+	StaticMesh<VertexPositionNormalUv3D>* mesh_ = nullptr;
+
+
+	/**
+	 * @brief   ŸϸԴϴ.   մϴ.
+	 */
+	TileMap* tileMap_ = nullptr;
+
+
+	/**
+	 * @brief     Դϴ.
+	 */
+	MeshRenderer* renderer_ = nullptr;
+
+
+	/**
+	 * @brief ü ø  ī޶Դϴ.
+	 */
+	Camera* camera_ = nullptr;
+
+
+	/**
+	 * @brief ü ø   Դϴ. Ӹ ٽ äϴ.
+	 */
+	std::vector<RenderItem> visibleItems_;
+};
\ No newline at end of file
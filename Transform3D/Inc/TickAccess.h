@@ -0,0 +1,95 @@
+#pragma once
+
+#include <cstdint>
+
+
+/**
+ * @brief ƼƼ ý Tick ٸ ƼƼ ϴ Դϴ. Ʈ ÷Դϴ.
+ *
+ * @note ƼƼ ڱ   а ٸ  ʿ䰡 ϴ. ٸ ƼƼ  ü   մϴ.
+ */
+enum class ETickResource : uint32_t
+{
+	CAMERA          = 0x00000001, // ī޶ þ/ İ Ȱȭ 
+	SCENE_HIERARCHY = 0x00000002, //    / Ʈ
+	IMGUI           = 0x00000004, // ImGui ؽƮ
+	ALL             = 0xFFFFFFFF, //   
+};
+
+
+/**
+ * @brief ƼƼ ý Tick а   Դϴ.
+ *
+ * @note
+ * -   ͸ ٸ  аų ٸ  Tick 浹ϸ, ƽ ٷ   ˴ϴ.
+ * - 浹 ʴ Tick  ٸ 忡 ÿ   ֽϴ.
+ */
+struct TickAccess
+{
+	/**
+	 * @brief д  ͸ ߰մϴ.
+	 *
+	 * @param resource д  Դϴ.
+	 *
+	 * @return ڱ ڽ  ȯմϴ.
+	 */
+	TickAccess& Read(ETickResource resource)
+	{
+		readMask |= static_cast<uint32_t>(resource);
+		return *this;
+	}
+
+
+	/**
+	 * @brief   ͸ ߰մϴ.  ʹ   ֽϴ.
+	 *
+	 * @param resource   Դϴ.
+	 *
+	 * @return ڱ ڽ  ȯմϴ.
+	 */
+	TickAccess& Write(ETickResource resource)
+	{
+		writeMask |= static_cast<uint32_t>(resource);
+		return *this;
+	}
+
+
+	/**
+	 * @brief ٸ Tick 浹ϴ Ȯմϴ.
+	 *
+	 * @param other Ȯ Tick  Դϴ.
+	 *
+	 * @return 浹Ѵٸ true, ׷  false ȯմϴ.
+	 */
+	bool IsConflict(const TickAccess& other) const
+	{
+		return (writeMask & (other.readMask | other.writeMask)) != 0 || (readMask & other.writeMask) != 0;
+	}
+
+
+	/**
+	 * @brief  Tick  Ͱ  Ȯմϴ.
+	 */
+	bool operator==(const TickAccess& other) const
+	{
+		return readMask == other.readMask && writeMask == other.writeMask && bIsMainThread == other.bIsMainThread;
+	}
+
+
+	/**
+	 * @brief д   Ʈ ũԴϴ.
+	 */
+	uint32_t readMask = 0;
+
+
+	/**
+	 * @brief    Ʈ ũԴϴ.
+	 */
+	uint32_t writeMask = 0;
+
+
+	/**
+	 * @brief  忡 ؾ ϴ Ȯմϴ.
+	 */
+	bool bIsMainThread = false;
+};
\ No newline at end of file
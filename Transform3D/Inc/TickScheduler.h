@@ -0,0 +1,253 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "JobModule.h"
+
+#include "IEntity.h"
+#include "Macro.h"
+#include "TickAccess.h"
+
+
+/**
+ * @brief ƼƼ ý Tick  迡   忡 ϴ ٷԴϴ.
+ *
+ * @note
+ * - ƼƼ ý Tick а   (TickAccess) ϸ, 浹ϴ Tick   ˴ϴ.
+ * -      ٽ Ȯϰ, ٲٸ  ׷ ٽ ϴ.
+ * - 浹ϴ Tick     ǹǷ,       ϴ.
+ * -  忡 ؾ ϴ Tick   Tick ȣ 忡 ϰ,  JobModule ۾ մϴ.
+ */
+class TickScheduler
+{
+public:
+	/**
+	 * @brief ý Tick ԼԴϴ.
+	 */
+	using TickFunction = std::function<void(float deltaSeconds)>;
+
+
+	/**
+	 * @brief ƼƼ ý ϳ Tick ð Դϴ.
+	 */
+	struct TickStats
+	{
+		std::string name; //    ̸Դϴ.
+		uint64_t lastNanoseconds = 0; //  ֱ Tick ɸ ð()Դϴ.
+		uint64_t averageNanoseconds = 0; // Tick ɸ ð  ̵ ()Դϴ.
+		uint64_t maxNanoseconds = 0; // Tick ɸ ð ִ()Դϴ.
+		uint32_t dependencyCount = 0; //   ϴ Tick Դϴ.
+		bool bIsMainThread = false; //  忡 ϴ Ȯմϴ.
+	};
+
+
+public:
+	/**
+	 * @brief ƽ ٷ Ʈ Դϴ.
+	 */
+	TickScheduler() = default;
+
+
+	/**
+	 * @brief ƽ ٷ  ҸԴϴ.
+	 */
+	virtual ~TickScheduler() {}
+
+
+	/**
+	 * @brief ƽ ٷ  ڿ  ڸ  մϴ.
+	 */
+	DISALLOW_COPY_AND_ASSIGN(TickScheduler);
+
+
+	/**
+	 * @brief ƼƼ մϴ. ƼƼ GetTickAccess  ͸ ϴ.
+	 *
+	 * @param name ð 迡 ǥ ̸Դϴ.
+	 * @param entity  ƼƼԴϴ.
+	 *
+	 * @return   ε ȯմϴ.
+	 */
+	uint32_t AddEntity(const std::string& name, IEntity* entity);
+
+
+	/**
+	 * @brief ý մϴ.
+	 *
+	 * @param name ð 迡 ǥ ̸Դϴ.
+	 * @param access ý а   Դϴ.
+	 * @param function ý Tick ԼԴϴ.
+	 *
+	 * @return   ε ȯմϴ.
+	 */
+	uint32_t AddSystem(const std::string& name, const TickAccess& access, const TickFunction& function);
+
+
+	/**
+	 * @brief  ƼƼ ý  迡   忡 ϰ,    ٸϴ.
+	 *
+	 * @param deltaSeconds Ÿ ð Դϴ.
+	 *
+	 * @note  忡 ȣؾ մϴ. JobModule ʱȭ ʾҴٸ  Tick ȣ 忡 մϴ.
+	 */
+	void Tick(float deltaSeconds);
+
+
+	/**
+	 * @brief  ƼƼ ý   ȣ 忡 մϴ.
+	 *
+	 * @param deltaSeconds Ÿ ð Դϴ.
+	 *
+	 * @note Tick  ƾ ϹǷ, Tick  ϰų    մϴ.
+	 */
+	void TickSerial(float deltaSeconds);
+
+
+	/**
+	 * @brief ƼƼ ýۺ Tick ð 踦 ϴ.
+	 *
+	 * @param outStats   ä Tick ð Դϴ.
+	 */
+	void GetTickStats(std::vector<TickStats>& outStats) const;
+
+
+	/**
+	 * @brief Tick ð 踦 ʱȭմϴ.
+	 */
+	void ResetTickStats();
+
+
+	/**
+	 * @brief  ƼƼ ý  ϴ.
+	 *
+	 * @return  ƼƼ ý  ȯմϴ.
+	 */
+	uint32_t GetNodeCount() const { return static_cast<uint32_t>(nodes_.size()); }
+
+
+	/**
+	 * @brief  ׷   ϴ.
+	 *
+	 * @return  ׷   ȯմϴ. ׷  ̶ 0 ȯմϴ.
+	 */
+	uint32_t GetEdgeCount() const { return edgeCount_; }
+
+
+private:
+	/**
+	 * @brief  ׷ Դϴ. ƼƼ ý ϳԴϴ.
+	 */
+	struct Node
+	{
+		std::string name;
+		IEntity* entity = nullptr;
+		TickFunction function;
+		TickAccess access;
+		std::vector<uint32_t> successors;
+		std::vector<uint32_t> predecessors;
+		uint32_t dependencyCount = 0;
+		uint64_t lastNanoseconds = 0;
+		uint64_t averageNanoseconds = 0;
+		uint64_t maxNanoseconds = 0;
+	};
+
+
+	/**
+	 * @brief ƼƼ    ٽ Ȯϰ, ٲٸ  ׷ ٽ ϴ.
+	 */
+	void UpdateGraph();
+
+
+	/**
+	 * @brief    ͷ  ׷ ϴ.
+	 *
+	 * @note  ͸     ڿ  常 ϹǷ,    ð ϴ.
+	 */
+	void BuildGraph();
+
+
+	/**
+	 * @brief  Tick ϰ ð մϴ.
+	 */
+	void RunNode(uint32_t index, float deltaSeconds);
+
+
+	/**
+	 * @brief  ļ     ̰, 0  ļ 带 ۾ մϴ.
+	 */
+	void CompleteNode(uint32_t index, float deltaSeconds);
+
+
+	/**
+	 * @brief 带 ۾ մϴ. ۾  īͿ ɸϴ.
+	 */
+	void ScheduleNode(uint32_t index, float deltaSeconds);
+
+
+	/**
+	 * @brief    尡   ٸϴ. ٸ  ٸ ۾ մϴ.
+	 *
+	 * @note   尡   Ǿ īͰ ϹǷ,  带  ٸ   ī͸ ٸϴ.
+	 */
+	void WaitNode(uint32_t index);
+
+
+private:
+	/**
+	 * @brief  ð    ̵  ġԴϴ. ֱ   1/16ŭ ݿ˴ϴ.
+	 */
+	static const uint32_t AVERAGE_WEIGHT_SHIFT = 4;
+
+
+	/**
+	 * @brief    Դϴ.
+	 */
+	std::vector<Node> nodes_;
+
+
+	/**
+	 * @brief ϴ 尡     ٷ ϴ  Դϴ.     ʽϴ.
+	 */
+	std::vector<uint32_t> sourceNodes_;
+
+
+	/**
+	 * @brief  忡   Դϴ.  Դϴ.
+	 */
+	std::vector<uint32_t> mainThreadNodes_;
+
+
+	/**
+	 * @brief 庰      Դϴ. Ӹ dependencyCount ʱȭմϴ.
+	 */
+	std::unique_ptr<std::atomic<uint32_t>[]> pendingCounts_;
+
+
+	/**
+	 * @brief 庰 ۾ īԴϴ.     带 ٸ ʵ   ī͸ ٸϴ.
+	 */
+	std::unique_ptr<JobModule::Counter[]> nodeCounters_;
+
+
+	/**
+	 * @brief ̹ ӿ   ٸ  Ȯϴ ÷Դϴ.  忡 մϴ.
+	 */
+	std::vector<uint8_t> waitedFlags_;
+
+
+	/**
+	 * @brief  ׷  Դϴ.
+	 */
+	uint32_t edgeCount_ = 0;
+
+
+	/**
+	 * @brief  ׷ ٽ  ϴ Ȯմϴ.
+	 */
+	bool bIsDirty_ = true;
+};
\ No newline at end of file
@@ -1,17 +1,38 @@
+#include <limits>
+
+#include "Frustum.h"
 #include "GeometryRenderer3D.h"
+#include "JobModule.h"
 #include "MeshRenderer.h"
+#include "OcclusionBuffer.h"
+#include "RenderQueue.h"
 
 #include "Application.h"
 #include "Camera.h"
 #include "EntityManager.h"
 #include "Grid.h"
 #include "Sphere.h"
+#include "SphereField.h"
+
+/**
+ * @brief   ƼƼ ŰŸ 忡   Դϴ.
+ */
+static const uint32_t SPHERE_FIELD_COUNT = 2048;
+
+/**
+ * @brief [0, count)  ε ϳ JobModule ۾  óմϴ. MathModule  ó Լ ѱϴ.
+ */
+static void ParallelForJobs(uint32_t count, const ParallelRangeFunction& function)
+{
+	JobModule::ParallelFor(count, function, 1);
+}
 
 Application::Application()
 {
 	PlatformModule::WindowConstructParams windowParam{ L"Transform3D", 100, 100, 1000, 800, false, false };
 
 	CrashModule::Init();
+	JobModule::Init();
 	PlatformModule::Init(windowParam);
 
 	HWND hwnd = PlatformModule::GetWindowHandle();
@@ -28,6 +49,7 @@ Application::~Application()
 	EntityManager::Get().Shutdown();
 
 	PlatformModule::Uninit();
+	JobModule::Uninit();
 	CrashModule::Uninit();
 }
 
@@ -35,6 +57,7 @@ void Application::Init()
 {
 	geometryRenderer_ = RenderModule::CreateResource<GeometryRenderer3D>();
 	meshRenderer_ = RenderModule::CreateResource<MeshRenderer>();
+	renderQueue_ = RenderModule::CreateResource<RenderQueue>();
 
 	EntityManager::Get().Startup();
 
@@ -44,8 +67,20 @@ void Application::Init()
 	{
 		camera_,
 		EntityManager::Get().CreateEntity<Grid>(geometryRenderer_),
-		EntityManager::Get().CreateEntity<Sphere>(meshRenderer_, camera_),
+		EntityManager::Get().CreateEntity<Sphere>(meshRenderer_, camera_, &sceneHierarchy_),
+		EntityManager::Get().CreateEntity<SphereField>(meshRenderer_, camera_, SPHERE_FIELD_COUNT),
 	};
+
+	boundCenters_.resize(entities_.size());
+	boundRadii_.resize(entities_.size());
+	visibleIndices_.resize(entities_.size());
+
+	// ī޶  ؾ, þ  д ƼƼ ŵ þ  нϴ.
+	tickScheduler_.AddEntity("Camera", entities_[0]);
+	tickScheduler_.AddEntity("Grid", entities_[1]);
+	tickScheduler_.AddEntity("Sphere", entities_[2]);
+	tickScheduler_.AddEntity("SphereField", entities_[3]);
+	tickScheduler_.AddSystem("SceneHierarchy", TickAccess().Write(ETickResource::SCENE_HIERARCHY), [&](float) { sceneHierarchy_.Update(); });
 }
 
 void Application::Run()
@@ -53,24 +88,42 @@ void Application::Run()
 	PlatformModule::RunLoop(
 		[&](float deltaSeconds)
 		{
-			for (auto entity : entities_)
+			tickScheduler_.Tick(deltaSeconds);
+
+			RenderModule::SetViewProjection(camera_->GetView(), camera_->GetProjection());
+
+			for (uint32_t index = 0; index < entities_.size(); ++index)
 			{
-				entity->Tick(deltaSeconds);
+				if (!entities_[index]->GetBoundingSphere(boundCenters_[index], boundRadii_[index]))
+				{
+					boundCenters_[index] = Vec3f(0.0f, 0.0f, 0.0f);
+					boundRadii_[index] = std::numeric_limits<float>::infinity();
+				}
 			}
 
-			geometryRenderer_->SetView(camera_->GetView());
-			geometryRenderer_->SetProjection(camera_->GetProjection());
+			Mat4x4 viewProjection = camera_->GetView() * camera_->GetProjection();
+			Frustum frustum(viewProjection);
+			uint32_t visibleCount = frustum.CullSpheres(boundCenters_.data(), boundRadii_.data(), static_cast<uint32_t>(entities_.size()), visibleIndices_.data());
+
+			occlusionBuffer_.Clear(viewProjection);
+			for (uint32_t index = 0; index < visibleCount; ++index)
+			{
+				entities_[visibleIndices_[index]]->AddOccluder(&occlusionBuffer_);
+			}
+			occlusionBuffer_.Rasterize(ParallelForJobs);
+			visibleCount = occlusionBuffer_.CullSpheres(boundCenters_.data(), boundRadii_.data(), visibleIndices_.data(), visibleCount, visibleIndices_.data());
 
-			meshRenderer_->SetView(camera_->GetView());
-			meshRenderer_->SetProjection(camera_->GetProjection());
+			renderQueue_->Reset(camera_->GetView(), camera_->GetFarZ());
+			for (uint32_t index = 0; index < visibleCount; ++index)
+			{
+				entities_[visibleIndices_[index]]->Render(renderQueue_);
+			}
+			renderQueue_->Sort();
 
 			RenderModule::SetWindowViewport();
 			RenderModule::BeginFrame(0.3f, 0.3f, 0.3f, 1.0f);
 
-			for (auto entity : entities_)
-			{
-				entity->Render();
-			}
+			renderQueue_->Replay();
 
 			RenderModule::EndFrame();
 		}
@@ -0,0 +1,75 @@
+#include "Transform.h"
+
+#include "ArchetypeSystems.h"
+
+void ArchetypeSystems::UpdateSpin(ArchetypeWorld& world, float deltaSeconds)
+{
+	world.ForEachChunk<Spin, Transform>(
+		[deltaSeconds](uint32_t count, Spin* spins, Transform* transforms)
+		{
+			for (uint32_t index = 0; index < count; ++index)
+			{
+				Spin& spin = spins[index];
+				spin.radian = MathModule::Fmod(spin.radian + spin.radiansPerSecond * deltaSeconds, TwoPi);
+				transforms[index].rotate = Quat::AxisRadian(spin.axis, spin.radian);
+			}
+		}
+	);
+}
+
+void ArchetypeSystems::UpdateWorldMatrix(ArchetypeWorld& world)
+{
+	world.ForEachChunk<Transform, WorldMatrix>(
+		[](uint32_t count, Transform* transforms, WorldMatrix* worldMatrices)
+		{
+			for (uint32_t index = 0; index < count; ++index)
+			{
+				worldMatrices[index].world = Transform::ToMat(transforms[index]);
+			}
+		}
+	);
+}
+
+void ArchetypeSystems::UpdateBoundingSphere(ArchetypeWorld& world)
+{
+	world.ForEachChunk<Transform, BoundingSphere>(
+		[](uint32_t count, Transform* transforms, BoundingSphere* bounds)
+		{
+			for (uint32_t index = 0; index < count; ++index)
+			{
+				const Vec3f& scale = transforms[index].scale;
+				float maxScale = MathModule::Max<float>(MathModule::Abs(scale.x), MathModule::Max<float>(MathModule::Abs(scale.y), MathModule::Abs(scale.z)));
+
+				bounds[index].center = transforms[index].position;
+				bounds[index].radius = bounds[index].localRadius * maxScale;
+			}
+		}
+	);
+}
+
+void ArchetypeSystems::Tick(ArchetypeWorld& world, float deltaSeconds)
+{
+	UpdateSpin(world, deltaSeconds);
+	UpdateWorldMatrix(world);
+	UpdateBoundingSphere(world);
+}
+
+uint32_t ArchetypeSystems::CollectVisible(ArchetypeWorld& world, const Frustum& frustum, std::vector<RenderItem>& outItems)
+{
+	outItems.clear();
+
+	world.ForEachChunk<MeshRef, WorldMatrix, BoundingSphere>(
+		[&](uint32_t count, MeshRef* meshes, WorldMatrix* worldMatrices, BoundingSphere* bounds)
+		{
+			for (uint32_t index = 0; index < count; ++index)
+			{
+				if (frustum.IsIntersectSphere(bounds[index].center, bounds[index].radius))
+				{
+					outItems.push_back(RenderItem{ &meshes[index], &worldMatrices[index].world });
+				}
+			}
+		}
+	);
+
+	return static_cast<uint32_t>(outItems.size());
+}
\ No newline at end of file
@@ -0,0 +1,247 @@
+#include "ArchetypeWorld.h"
+#include "Assertion.h"
+
+std::vector<ArchetypeWorld::ComponentInfo> ArchetypeWorld::componentInfos;
+
+ArchetypeWorld::~ArchetypeWorld()
+{
+	for (const std::unique_ptr<Archetype>& archetype : archetypes_)
+	{
+		for (uint32_t row = 0; row < archetype->entityCount; ++row)
+		{
+			for (const ComponentID& componentID : archetype->componentIDs)
+			{
+				componentInfos[componentID].destruct(GetComponentAddress(*archetype, row, componentID));
+			}
+		}
+	}
+}
+
+void ArchetypeWorld::Destroy(const EntityID& entityID)
+{
+	Record* record = FindRecord(entityID);
+	if (!record)
+	{
+		return;
+	}
+
+	Archetype& archetype = *archetypes_[record->archetype];
+	for (const ComponentID& componentID : archetype.componentIDs)
+	{
+		componentInfos[componentID].destruct(GetComponentAddress(archetype, record->row, componentID));
+	}
+
+	EraseRow(archetype, record->row);
+
+	uint32_t index = GetIndex(entityID);
+	record->bIsAlive = false;
+	--entityCount_;
+
+	if (record->generation < MAX_GENERATION)
+	{
+		++record->generation;
+		record->nextFree = freeHead_;
+		freeHead_ = index;
+	}
+}
+
+uint32_t ArchetypeWorld::GetChunkCount() const
+{
+	uint32_t chunkCount = 0;
+	for (const std::unique_ptr<Archetype>& archetype : archetypes_)
+	{
+		chunkCount += static_cast<uint32_t>(archetype->chunks.size());
+	}
+
+	return chunkCount;
+}
+
+uint32_t ArchetypeWorld::GetChunkCapacity(const ComponentMask& mask) const
+{
+	auto iter = archetypeIndices_.find(mask);
+	return (iter != archetypeIndices_.end()) ? archetypes_[iter->second]->chunkCapacity : 0;
+}
+
+ComponentID ArchetypeWorld::RegisterComponent(uint32_t size, uint32_t alignment, void (*move)(void*, void*), void (*destruct)(void*))
+{
+	CHECK(componentInfos.size() < MAX_COMPONENT_TYPE_COUNT);
+	CHECK(alignment <= alignof(Chunk));
+
+	componentInfos.push_back(ComponentInfo{ size, alignment, move, destruct });
+	return static_cast<ComponentID>(componentInfos.size() - 1);
+}
+
+ArchetypeWorld::Archetype& ArchetypeWorld::GetOrCreateArchetype(const ComponentMask& mask)
+{
+	auto iter = archetypeIndices_.find(mask);
+	if (iter != archetypeIndices_.end())
+	{
+		return *archetypes_[iter->second];
+	}
+
+	std::unique_ptr<Archetype> archetype = std::make_unique<Archetype>();
+	archetype->index = static_cast<uint32_t>(archetypes_.size());
+	archetype->mask = mask;
+
+	uint32_t rowBytes = sizeof(EntityID);
+	for (ComponentID componentID = 0; componentID < componentInfos.size(); ++componentID)
+	{
+		if (mask & (1u << componentID))
+		{
+			archetype->componentIDs.push_back(componentID);
+			rowBytes += componentInfos[componentID].size;
+		}
+	}
+
+	// ÷     ûũ Ѵ´ٸ,   ûũ ƼƼ  Դϴ.
+	uint32_t capacity = CHUNK_BYTES / rowBytes;
+	CHECK(capacity >= 1);
+
+	while (true)
+	{
+		uint32_t offset = capacity * sizeof(EntityID);
+		for (const ComponentID& componentID : archetype->componentIDs)
+		{
+			const ComponentInfo& info = componentInfos[componentID];
+			offset = (offset + info.alignment - 1) / info.alignment * info.alignment;
+			archetype->columnOffsets[componentID] = offset;
+			offset += capacity * info.size;
+		}
+
+		if (offset <= CHUNK_BYTES || capacity == 1)
+		{
+			break;
+		}
+
+		--capacity;
+	}
+
+	archetype->chunkCapacity = capacity;
+
+	archetypeIndices_.insert({ mask, archetype->index });
+	archetypes_.push_back(std::move(archetype));
+
+	return *archetypes_.back();
+}
+
+EntityID ArchetypeWorld::AllocateEntity(Archetype& archetype)
+{
+	uint32_t index = freeHead_;
+	if (index != INVALID_SLOT)
+	{
+		freeHead_ = records_[index].nextFree;
+	}
+	else
+	{
+		if (records_.size() >= MAX_ENTITY_COUNT)
+		{
+			return INVALID_ENTITY_ID;
+		}
+
+		index = static_cast<uint32_t>(records_.size());
+		records_.emplace_back();
+	}
+
+	Record& record = records_[index];
+	EntityID entityID = MakeID(index, record.generation);
+
+	record.archetype = archetype.index;
+	record.row = PushRow(archetype, entityID);
+	record.bIsAlive = true;
+	++entityCount_;
+
+	return entityID;
+}
+
+uint32_t ArchetypeWorld::PushRow(Archetype& archetype, const EntityID& entityID)
+{
+	if (archetype.entityCount == archetype.chunks.size() * archetype.chunkCapacity)
+	{
+		archetype.chunks.push_back(std::make_unique<Chunk>());
+	}
+
+	uint32_t row = archetype.entityCount++;
+	*GetEntityAddress(archetype, row) = entityID;
+
+	return row;
+}
+
+void ArchetypeWorld::EraseRow(Archetype& archetype, uint32_t row)
+{
+	uint32_t lastRow = archetype.entityCount - 1;
+	if (row != lastRow)
+	{
+		for (const ComponentID& componentID : archetype.componentIDs)
+		{
+			componentInfos[componentID].move(GetComponentAddress(archetype, row, componentID), GetComponentAddress(archetype, lastRow, componentID));
+		}
+
+		EntityID movedID = *GetEntityAddress(archetype, lastRow);
+		*GetEntityAddress(archetype, row) = movedID;
+		records_[GetIndex(movedID)].row = row;
+	}
+
+	--archetype.entityCount;
+
+	//   ûũ 迡 ݺ  ûũ Ź ٽ Ҵ ʵ,  ûũ ϳ ܵӴϴ.
+	std::size_t usedChunkCount = (archetype.entityCount + archetype.chunkCapacity - 1) / archetype.chunkCapacity;
+	if (archetype.chunks.size() > usedChunkCount + 1)
+	{
+		archetype.chunks.pop_back();
+	}
+}
+
+void ArchetypeWorld::ChangeArchetype(Record& record, const ComponentMask& mask)
+{
+	Archetype& src = *archetypes_[record.archetype];
+	Archetype& dst = GetOrCreateArchetype(mask);
+
+	uint32_t srcRow = record.row;
+	uint32_t dstRow = PushRow(dst, *GetEntityAddress(src, srcRow));
+
+	for (const ComponentID& componentID : src.componentIDs)
+	{
+		const ComponentInfo& info = componentInfos[componentID];
+		if (dst.mask & (1u << componentID))
+		{
+			info.move(GetComponentAddress(dst, dstRow, componentID), GetComponentAddress(src, srcRow, componentID));
+		}
+		else
+		{
+			info.destruct(GetComponentAddress(src, srcRow, componentID));
+		}
+	}
+
+	EraseRow(src, srcRow);
+
+	record.archetype = dst.index;
+	record.row = dstRow;
+}
+
+ArchetypeWorld::Record* ArchetypeWorld::FindRecord(const EntityID& entityID)
+{
+	return const_cast<Record*>(static_cast<const ArchetypeWorld*>(this)->FindRecord(entityID));
+}
+
+const ArchetypeWorld::Record* ArchetypeWorld::FindRecord(const EntityID& entityID) const
+{
+	uint32_t index = GetIndex(entityID);
+	if (index >= records_.size())
+	{
+		return nullptr;
+	}
+
+	const Record& record = records_[index];
+	return (record.bIsAlive && record.generation == GetGeneration(entityID)) ? &record : nullptr;
+}
+
+EntityID* ArchetypeWorld::GetEntityAddress(Archetype& archetype, uint32_t row)
+{
+	return reinterpret_cast<EntityID*>(archetype.chunks[row / archetype.chunkCapacity]->data) + row % archetype.chunkCapacity;
+}
+
+void* ArchetypeWorld::GetComponentAddress(Archetype& archetype, uint32_t row, const ComponentID& componentID)
+{
+	unsigned char* column = archetype.chunks[row / archetype.chunkCapacity]->data + archetype.columnOffsets[componentID];
+	return column + static_cast<std::size_t>(row % archetype.chunkCapacity) * componentInfos[componentID].size;
+}
\ No newline at end of file
@@ -0,0 +1,37 @@
+#pragma once
+
+#if !defined(_WIN32) && !defined(_WIN64)
+#include <csignal>
+
+/**
+ * @brief Windows ̿ ÷  극ũ Ʈ մϴ.
+ */
+#ifndef __debugbreak
+#define __debugbreak() std::raise(SIGTRAP)
+#endif
+#endif
+
+/**
+ * @brief 򰡽 ˻մϴ.
+ *
+ * @param Expression ˻ ȣⰪԴϴ.
+ *
+ * @note
+ * - Debug  Release 忡 򰡽 ˻ Shipping 忡 򰡽 ˻ ʽϴ.
+ * - Ű ϸ 극ũ Ʈ ɸϴ.
+ */
+#if defined(DEBUG_MODE) || defined(RELEASE_MODE) || defined(DEVELOPMENT_MODE)
+#ifndef CHECK
+#define CHECK(Expression)\
+{\
+	if (!(bool)(Expression))                                                                                              \
+	{                                                                                                                     \
+		__debugbreak();                                                                                                   \
+	}                                                                                                                     \
+}
+#endif
+#else // defined(SHIPPING_MODE)
+#ifndef CHECK
+#define CHECK(Expression, ...) ((void)(Expression))
+#endif
+#endif
\ No newline at end of file
@@ -87,7 +87,12 @@ void Camera::Tick(float deltaSeconds)
 	}
 }
 
-void Camera::Render()
+void Camera::GetTickAccess(TickAccess& outAccess) const
+{
+	outAccess.Write(ETickResource::CAMERA);
+}
+
+void Camera::Render(RenderQueue* renderQueue)
 {
 }
 
@@ -99,12 +104,37 @@ void Camera::Release()
 	}
 }
 
+BVH::Ray Camera::GetPickingRay(int32_t x, int32_t y) const
+{
+	int32_t screenWidth = 0;
+	int32_t screenHeight = 0;
+	RenderModule::GetScreenSize(screenWidth, screenHeight);
+
+	float ndcX = 2.0f * (static_cast<float>(x) + 0.5f) / static_cast<float>(screenWidth) - 1.0f;
+	float ndcY = 1.0f - 2.0f * (static_cast<float>(y) + 0.5f) / static_cast<float>(screenHeight);
+
+	float sinHalfFov = 0.0f;
+	float cosHalfFov = 0.0f;
+	MathModule::SinCos(fov_ * 0.5f, sinHalfFov, cosHalfFov);
+	float tanHalfFov = sinHalfFov / cosHalfFov;
+
+	Vec3f direction = eyeDirection_ + rightDirection_ * (ndcX * tanHalfFov * aspectRatio_) + upDirection_ * (ndcY * tanHalfFov);
+	return BVH::Ray(eyePosition_, Vec3f::Normalize(direction), farZ_);
+}
+
 void Camera::UpdateState()
 {
+	float sinYaw = 0.0f;
+	float cosYaw = 0.0f;
+	float sinPitch = 0.0f;
+	float cosPitch = 0.0f;
+	MathModule::SinCos(yaw_, sinYaw, cosYaw);
+	MathModule::SinCos(pitch_, sinPitch, cosPitch);
+
 	Vec3f direction;
-	direction.x = MathModule::Cos(yaw_) * MathModule::Cos(pitch_);
-	direction.y = MathModule::Sin(pitch_);
-	direction.z = MathModule::Sin(yaw_) * MathModule::Cos(pitch_);
+	direction.x = cosYaw * cosPitch;
+	direction.y = sinPitch;
+	direction.z = sinYaw * cosPitch;
 
 	eyeDirection_ = Vec3f::Normalize(direction);
 	rightDirection_ = Vec3f::Normalize(Vec3f::Cross(eyeDirection_, worldUpDirection_));
@@ -1,30 +1,6 @@
+#include "Assertion.h"
 #include "EntityManager.h"
 
-/**
- * @brief 򰡽 ˻մϴ.
- *
- * @param Expression ˻ ȣⰪԴϴ.
- *
- * @note
- * - Debug  Release 忡 򰡽 ˻ Shipping 忡 򰡽 ˻ ʽϴ.
- * - Ű ϸ 극ũ Ʈ ɸϴ.
- */
-#if defined(DEBUG_MODE) || defined(RELEASE_MODE) || defined(DEVELOPMENT_MODE)
-#ifndef CHECK
-#define CHECK(Expression)\
-{\
-	if (!(bool)(Expression))                                                                                              \
-	{                                                                                                                     \
-		__debugbreak();                                                                                                   \
-	}                                                                                                                     \
-}
-#endif
-#else // defined(SHIPPING_MODE)
-#ifndef CHECK
-#define CHECK(Expression, ...) ((void)(Expression))
-#endif
-#endif
-
 EntityManager& EntityManager::Get()
 {
 	static EntityManager instance;
@@ -42,57 +18,89 @@ void EntityManager::Shutdown()
 {
 	CHECK(bIsStartup_);
 
-	for (auto& cache : cache_)
+	for (uint32_t index = 0; index < slotCount_; ++index)
 	{
-		if (cache)
+		std::unique_ptr<IEntity>& entity = GetSlot(index).entity;
+		if (entity)
 		{
-			if (cache->IsInitialized())
+			if (entity->IsInitialized())
 			{
-				cache->Release();
+				entity->Release();
 			}
 
-			cache.reset();
+			entity.reset();
 		}
 	}
 
+	pages_.clear();
+	slotCount_ = 0;
+	entityCount_ = 0;
+	freeHead_ = INVALID_SLOT;
+
 	bIsStartup_ = false;
 }
 
 void EntityManager::Destroy(const EntityID& entityID)
 {
-	CHECK(0 <= entityID && entityID < cacheSize_);
+	IEntity* entity = FindEntity(entityID);
+	if (!entity)
+	{
+		return;
+	}
 
-	if (cache_[entityID])
+	if (entity->IsInitialized())
 	{
-		if (cache_[entityID]->IsInitialized())
-		{
-			cache_[entityID]->Release();
-		}
+		entity->Release();
+	}
+
+	uint32_t index = GetIndex(entityID);
+	Slot& slot = GetSlot(index);
+	slot.entity.reset();
+	--entityCount_;
 
-		cache_[entityID].reset();
+	if (slot.generation < MAX_GENERATION)
+	{
+		++slot.generation;
+		slot.nextFree = freeHead_;
+		freeHead_ = index;
 	}
 }
 
 void EntityManager::Destroy(const IEntity* entity)
 {
-	EntityID entityID = -1;
-	for (uint32_t index = 0; index < cacheSize_; ++index)
+	if (entity && FindEntity(entity->GetID()) == entity)
 	{
-		IEntity* cacheEntity = cache_[index].get();
-		if (entity == cacheEntity)
-		{
-			entityID = static_cast<EntityID>(index);
-			break;
-		}
+		Destroy(entity->GetID());
+	}
+}
+
+uint32_t EntityManager::AllocateSlot()
+{
+	if (freeHead_ != INVALID_SLOT)
+	{
+		uint32_t index = freeHead_;
+		freeHead_ = GetSlot(index).nextFree;
+		return index;
 	}
 
-	if (entityID != -1 && cache_[entityID])
+	CHECK(slotCount_ < MAX_ENTITY_COUNT);
+
+	if (slotCount_ % PAGE_SIZE == 0)
 	{
-		if (cache_[entityID]->IsInitialized())
-		{
-			cache_[entityID]->Release();
-		}
+		pages_.push_back(std::make_unique<Slot[]>(PAGE_SIZE));
+	}
+
+	return slotCount_++;
+}
 
-		cache_[entityID].reset();
+IEntity* EntityManager::FindEntity(const EntityID& entityID) const
+{
+	uint32_t index = GetIndex(entityID);
+	if (index >= slotCount_)
+	{
+		return nullptr;
 	}
+
+	const Slot& slot = GetSlot(index);
+	return (slot.generation == GetGeneration(entityID)) ? slot.entity.get() : nullptr;
 }
\ No newline at end of file
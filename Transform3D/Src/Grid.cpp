@@ -1,5 +1,6 @@
 #include "GeometryRenderer3D.h"
 #include "RenderModule.h"
+#include "RenderQueue.h"
 
 #include "Grid.h"
 
@@ -22,15 +23,50 @@ void Grid::Tick(float deltaSeconds)
 {
 }
 
-void Grid::Render()
+void Grid::Render(RenderQueue* renderQueue)
 {
-	renderer_->DrawGrid3D(size_, stride_);
+	if (retained_ == GeometryRenderer3D::INVALID_RETAINED)
+	{
+		retained_ = renderer_->CreateRetainedGrid3D(size_, stride_);
+	}
+
+	renderQueue->PushRetained(renderer_, retained_, Mat4x4::Identity());
 }
 
 void Grid::Release()
 {
 	if (bIsInitialized_)
 	{
+		InvalidateRetained();
+
 		bIsInitialized_ = false;
 	}
+}
+
+void Grid::SetSize(const Vec3f& size)
+{
+	if (size_ != size)
+	{
+		size_ = size;
+		InvalidateRetained();
+	}
+}
+
+void Grid::SetStride(float stride)
+{
+	if (stride_ != stride)
+	{
+		stride_ = stride;
+		InvalidateRetained();
+	}
+}
+
+void Grid::InvalidateRetained()
+{
+	if (retained_ != GeometryRenderer3D::INVALID_RETAINED && renderer_->IsInitialized())
+	{
+		renderer_->DestroyRetained(retained_);
+	}
+
+	retained_ = GeometryRenderer3D::INVALID_RETAINED;
 }
\ No newline at end of file
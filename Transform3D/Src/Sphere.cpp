@@ -1,13 +1,18 @@
 #include "GeometryGenerator.h"
+#include "InputController.h"
 #include "RenderModule.h"
 #include "MeshRenderer.h"
+#include "OcclusionBuffer.h"
+#include "RenderQueue.h"
+#include "SceneHierarchy.h"
 
 #include "Camera.h"
 #include "Sphere.h"
 
-Sphere::Sphere(MeshRenderer* renderer, Camera* camera)
+Sphere::Sphere(MeshRenderer* renderer, Camera* camera, SceneHierarchy* sceneHierarchy)
 	: renderer_(renderer)
 	, camera_(camera)
+	, sceneHierarchy_(sceneHierarchy)
 	, windowFlags_(static_cast<ImGuiWindowFlags_>(ImGuiWindowFlags_NoMove | ImGuiWindowFlags_NoResize | ImGuiWindowFlags_NoCollapse))
 {
 	location_ = ImVec2(10.0f, 10.0f);
@@ -17,6 +22,9 @@ Sphere::Sphere(MeshRenderer* renderer, Camera* camera)
 	std::vector<uint32_t> indices;
 	GeometryGenerator::CreateSphere(1.0f, 40, vertices, indices);
 	mesh_ = RenderModule::CreateResource<StaticMesh<VertexPositionNormalUv3D>>(vertices, indices);
+	bvh_.BuildTriangles(vertices, indices);
+
+	sceneNode_ = sceneHierarchy_->AddNode(transform_);
 
 	tileMap_ = RenderModule::CreateResource<TileMap>(TileMap::ESize::Size_512x512, TileMap::ESize::Size_64x64, Vec4f(1.0f, 0.0f, 0.0f, 1.0f), Vec4f(1.0f, 1.0f, 1.0f, 1.0f));
 }
@@ -37,34 +45,39 @@ void Sphere::Tick(float deltaSeconds)
 	
 	camera_->SetActive(!ImGui::IsWindowFocused());
 
+	bool bIsChanged = false;
+
 	ImGui::Text("Position");
 	ImGui::Text("position");
 	ImGui::SameLine();
-	ImGui::SliderFloat3("##position", position_.data, -10.0f, 10.0f);
+	bIsChanged |= ImGui::SliderFloat3("##position", position_.data, -10.0f, 10.0f);
 	ImGui::SameLine();
 	if (ImGui::Button("Reset##position"))
 	{
 		position_ = Vec3f(0.0f, 0.0f, 0.0f);
+		bIsChanged = true;
 	}
 	ImGui::Separator();
 
 	ImGui::Text("Rotate");
 	ImGui::Text("%-6s", "axis");
 	ImGui::SameLine();
-	ImGui::SliderFloat3("##axis", axis_.data, -1.0f, 1.0f);
+	bIsChanged |= ImGui::SliderFloat3("##axis", axis_.data, -1.0f, 1.0f);
 	ImGui::SameLine();
 	if (ImGui::Button("Reset##axis"))
 	{
 		axis_ = Vec3f(0.0f, 0.0f, 0.0f);
+		bIsChanged = true;
 	}
 
 	ImGui::Text("%-6s", "radian");
 	ImGui::SameLine();
-	ImGui::SliderFloat("##radian", &radian_, -TwoPi, TwoPi);
+	bIsChanged |= ImGui::SliderFloat("##radian", &radian_, -TwoPi, TwoPi);
 	ImGui::SameLine();
 	if (ImGui::Button("Reset##radian"))
 	{
 		radian_ = 0.0f;
+		bIsChanged = true;
 	}
 
 	ImGui::Separator();
@@ -72,23 +85,87 @@ void Sphere::Tick(float deltaSeconds)
 	ImGui::Text("Scale");
 	ImGui::Text("scale");
 	ImGui::SameLine();
-	ImGui::SliderFloat3("##scale", scale_.data, 0.0f, 10.0f);
+	bIsChanged |= ImGui::SliderFloat3("##scale", scale_.data, 0.0f, 10.0f);
 	ImGui::SameLine();
 	if (ImGui::Button("Reset##scale"))
 	{
 		scale_ = Vec3f(1.0f, 1.0f, 1.0f);
+		bIsChanged = true;
+	}
+
+	ImGui::Separator();
+
+	ImGui::Text("Pick (right click)");
+	if (pickedTriangle_ != BVH::INVALID_PRIMITIVE)
+	{
+		ImGui::Text("triangle %u, distance %.3f", pickedTriangle_, pickedDistance_);
+	}
+	else
+	{
+		ImGui::Text("none");
 	}
 
 	ImGui::End();
 
-	transform_.position = position_;
-	transform_.rotate = Quat::AxisRadian(axis_, radian_);
-	transform_.scale = scale_;
+	if (bIsChanged)
+	{
+		transform_.position = position_;
+		transform_.rotate = Quat::AxisRadian(axis_, radian_);
+		transform_.scale = scale_;
+		sceneHierarchy_->SetLocalTransform(sceneNode_, transform_);
+	}
+
+	if (InputController::GetKeyPressState(EKey::KEY_RBUTTON) == EPressState::PRESSED && !ImGui::GetIO().WantCaptureMouse)
+	{
+		Pick();
+	}
 }
 
-void Sphere::Render()
+void Sphere::GetTickAccess(TickAccess& outAccess) const
 {
-	renderer_->DrawMesh(mesh_, Transform::ToMat(transform_), tileMap_);
+	outAccess.Write(ETickResource::CAMERA).Write(ETickResource::SCENE_HIERARCHY).Write(ETickResource::IMGUI);
+	outAccess.bIsMainThread = true;
+}
+
+void Sphere::Render(RenderQueue* renderQueue)
+{
+	renderQueue->PushMesh(renderer_, mesh_, sceneHierarchy_->GetWorldMatrix(sceneNode_), tileMap_);
+}
+
+bool Sphere::GetBoundingSphere(Vec3f& outCenter, float& outRadius) const
+{
+	outCenter = transform_.position;
+	outRadius = MathModule::Max<float>(MathModule::Abs(transform_.scale.x), MathModule::Max<float>(MathModule::Abs(transform_.scale.y), MathModule::Abs(transform_.scale.z)));
+
+	return true;
+}
+
+void Sphere::AddOccluder(OcclusionBuffer* occlusionBuffer) const
+{
+	occlusionBuffer->AddOccluder(mesh_->GetVertices(), mesh_->GetIndices(), sceneHierarchy_->GetWorldMatrix(sceneNode_));
+}
+
+void Sphere::Pick()
+{
+	pickedTriangle_ = BVH::INVALID_PRIMITIVE;
+
+	if (MathModule::Abs(scale_.x) <= Epsilon || MathModule::Abs(scale_.y) <= Epsilon || MathModule::Abs(scale_.z) <= Epsilon)
+	{
+		return;
+	}
+
+	CursorPos cursor = InputController::GetCurrCursorPos();
+	BVH::Ray ray = camera_->GetPickingRay(cursor.x, cursor.y);
+
+	Mat4x3 worldToLocal = Mat4x3::InverseAffine(Transform::ToMat4x3(transform_));
+	BVH::Ray localRay(Mat4x3::TransformPoint(ray.origin, worldToLocal), Mat4x3::TransformVector(ray.direction, worldToLocal), ray.tMax);
+
+	BVH::Hit hit;
+	if (bvh_.IntersectRay(localRay, hit))
+	{
+		pickedTriangle_ = hit.primitive;
+		pickedDistance_ = hit.t;
+	}
 }
 
 void Sphere::Release()
@@ -0,0 +1,78 @@
+#include "Frustum.h"
+#include "GeometryGenerator.h"
+#include "MeshRenderer.h"
+#include "RandomStream.h"
+#include "RenderModule.h"
+#include "RenderQueue.h"
+#include "Transform.h"
+
+#include "ArchetypeSystems.h"
+#include "Camera.h"
+#include "SphereField.h"
+
+SphereField::SphereField(MeshRenderer* renderer, Camera* camera, uint32_t count)
+	: renderer_(renderer)
+	, camera_(camera)
+{
+	std::vector<VertexPositionNormalUv3D> vertices;
+	std::vector<uint32_t> indices;
+	GeometryGenerator::CreateSphere(1.0f, 12, vertices, indices);
+	mesh_ = RenderModule::CreateResource<StaticMesh<VertexPositionNormalUv3D>>(vertices, indices);
+
+	tileMap_ = RenderModule::CreateResource<TileMap>(TileMap::ESize::Size_256x256, TileMap::ESize::Size_32x32, Vec4f(0.2f, 0.4f, 1.0f, 1.0f), Vec4f(1.0f, 1.0f, 1.0f, 1.0f));
+
+	//   ġ ʵ,       Ѹϴ.
+	RandomStream stream(RandomStream::DEFAULT_SEED);
+	for (uint32_t index = 0; index < count; ++index)
+	{
+		float radian = stream.NextFloat(0.0f, TwoPi);
+		float distance = stream.NextFloat(20.0f, 40.0f);
+		float scale = stream.NextFloat(0.2f, 0.6f);
+
+		Transform transform;
+		transform.position = Vec3f(MathModule::Cos(radian) * distance, stream.NextFloat(0.5f, 4.0f), MathModule::Sin(radian) * distance);
+		transform.scale = Vec3f(scale, scale, scale);
+
+		world_.Create(
+			transform,
+			WorldMatrix{ Transform::ToMat(transform) },
+			MeshRef{ renderer_, mesh_, tileMap_ },
+			BoundingSphere{ transform.position, scale, 1.0f },
+			Spin{ stream.NextUnitVec3(), stream.NextFloat(-Pi, Pi), 0.0f }
+		);
+	}
+
+	visibleItems_.reserve(count);
+}
+
+SphereField::~SphereField()
+{
+	if (bIsInitialized_)
+	{
+		Release();
+	}
+}
+
+void SphereField::Tick(float deltaSeconds)
+{
+	ArchetypeSystems::Tick(world_, deltaSeconds);
+}
+
+void SphereField::Render(RenderQueue* renderQueue)
+{
+	Frustum frustum(camera_->GetView() * camera_->GetProjection());
+	ArchetypeSystems::CollectVisible(world_, frustum, visibleItems_);
+
+	for (const RenderItem& item : visibleItems_)
+	{
+		renderQueue->PushMesh(item.mesh->renderer, item.mesh->mesh, *item.world, item.mesh->texture);
+	}
+}
+
+void SphereField::Release()
+{
+	if (bIsInitialized_)
+	{
+		bIsInitialized_ = false;
+	}
+}
\ No newline at end of file
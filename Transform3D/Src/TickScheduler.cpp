@@ -0,0 +1,298 @@
+#include <algorithm>
+#include <chrono>
+
+#include "Assertion.h"
+#include "TickScheduler.h"
+
+/**
+ * @brief   Ʈ ũ Ʈ Դϴ.
+ */
+static const uint32_t TICK_RESOURCE_BITS = 32;
+
+/**
+ * @brief 尡  Ÿ εԴϴ.
+ */
+static const uint32_t INVALID_NODE = 0xFFFFFFFF;
+
+uint32_t TickScheduler::AddEntity(const std::string& name, IEntity* entity)
+{
+	Node node;
+	node.name = name;
+	node.entity = entity;
+	entity->GetTickAccess(node.access);
+
+	nodes_.push_back(node);
+	bIsDirty_ = true;
+
+	return static_cast<uint32_t>(nodes_.size() - 1);
+}
+
+uint32_t TickScheduler::AddSystem(const std::string& name, const TickAccess& access, const TickFunction& function)
+{
+	Node node;
+	node.name = name;
+	node.function = function;
+	node.access = access;
+
+	nodes_.push_back(node);
+	bIsDirty_ = true;
+
+	return static_cast<uint32_t>(nodes_.size() - 1);
+}
+
+void TickScheduler::Tick(float deltaSeconds)
+{
+	UpdateGraph();
+
+	uint32_t nodeCount = static_cast<uint32_t>(nodes_.size());
+	for (uint32_t index = 0; index < nodeCount; ++index)
+	{
+		pendingCounts_[index].store(nodes_[index].dependencyCount, std::memory_order_relaxed);
+	}
+
+	std::fill(waitedFlags_.begin(), waitedFlags_.end(), 0);
+
+	for (uint32_t index : sourceNodes_)
+	{
+		ScheduleNode(index, deltaSeconds);
+	}
+
+	for (uint32_t index : mainThreadNodes_)
+	{
+		//    ڽ  常 ٸǷ,  ۾  ־ ٷ   ֽϴ.
+		for (uint32_t predecessor : nodes_[index].predecessors)
+		{
+			WaitNode(predecessor);
+		}
+		CHECK(pendingCounts_[index].load(std::memory_order_acquire) == 0);
+
+		RunNode(index, deltaSeconds);
+		CompleteNode(index, deltaSeconds);
+	}
+
+	//    ̹Ƿ, ռ 带 ٸ ڿ  尡 ̹ Ǿ ֽϴ.
+	for (uint32_t index = 0; index < nodeCount; ++index)
+	{
+		WaitNode(index);
+	}
+}
+
+void TickScheduler::TickSerial(float deltaSeconds)
+{
+	uint32_t nodeCount = static_cast<uint32_t>(nodes_.size());
+	for (uint32_t index = 0; index < nodeCount; ++index)
+	{
+		RunNode(index, deltaSeconds);
+	}
+}
+
+void TickScheduler::GetTickStats(std::vector<TickStats>& outStats) const
+{
+	outStats.resize(nodes_.size());
+
+	for (std::size_t index = 0; index < nodes_.size(); ++index)
+	{
+		const Node& node = nodes_[index];
+		TickStats& stats = outStats[index];
+
+		stats.name = node.name;
+		stats.lastNanoseconds = node.lastNanoseconds;
+		stats.averageNanoseconds = node.averageNanoseconds;
+		stats.maxNanoseconds = node.maxNanoseconds;
+		stats.dependencyCount = node.dependencyCount;
+		stats.bIsMainThread = node.access.bIsMainThread;
+	}
+}
+
+void TickScheduler::ResetTickStats()
+{
+	for (Node& node : nodes_)
+	{
+		node.lastNanoseconds = 0;
+		node.averageNanoseconds = 0;
+		node.maxNanoseconds = 0;
+	}
+}
+
+void TickScheduler::UpdateGraph()
+{
+	for (Node& node : nodes_)
+	{
+		if (!node.entity)
+		{
+			continue;
+		}
+
+		TickAccess access;
+		node.entity->GetTickAccess(access);
+		if (!(access == node.access))
+		{
+			node.access = access;
+			bIsDirty_ = true;
+		}
+	}
+
+	if (bIsDirty_)
+	{
+		BuildGraph();
+		bIsDirty_ = false;
+	}
+}
+
+void TickScheduler::BuildGraph()
+{
+	uint32_t nodeCount = static_cast<uint32_t>(nodes_.size());
+
+	for (Node& node : nodes_)
+	{
+		node.successors.clear();
+		node.predecessors.clear();
+		node.dependencyCount = 0;
+	}
+	sourceNodes_.clear();
+	mainThreadNodes_.clear();
+	pendingCounts_ = std::make_unique<std::atomic<uint32_t>[]>(nodeCount);
+	nodeCounters_ = std::make_unique<JobModule::Counter[]>(nodeCount);
+	waitedFlags_.assign(nodeCount, 0);
+	edgeCount_ = 0;
+
+	uint32_t lastWriters[TICK_RESOURCE_BITS];
+	std::vector<uint32_t> readers[TICK_RESOURCE_BITS];
+	std::fill(lastWriters, lastWriters + TICK_RESOURCE_BITS, INVALID_NODE);
+
+	//  忡   ̻   ʵ, 帶    ļ 带 մϴ.
+	std::vector<uint32_t> lastSuccessors(nodeCount, INVALID_NODE);
+
+	for (uint32_t index = 0; index < nodeCount; ++index)
+	{
+		Node& node = nodes_[index];
+
+		auto addEdge = [&](uint32_t predecessor)
+			{
+				if (lastSuccessors[predecessor] == index)
+				{
+					return;
+				}
+
+				lastSuccessors[predecessor] = index;
+				nodes_[predecessor].successors.push_back(index);
+				node.predecessors.push_back(predecessor);
+				++node.dependencyCount;
+				++edgeCount_;
+			};
+
+		uint32_t accessMask = node.access.readMask | node.access.writeMask;
+		for (uint32_t bit = 0; bit < TICK_RESOURCE_BITS; ++bit)
+		{
+			uint32_t resource = 1u << bit;
+			if (!(accessMask & resource))
+			{
+				continue;
+			}
+
+			if (lastWriters[bit] != INVALID_NODE)
+			{
+				addEdge(lastWriters[bit]);
+			}
+
+			if (node.access.writeMask & resource)
+			{
+				for (uint32_t reader : readers[bit])
+				{
+					addEdge(reader);
+				}
+
+				lastWriters[bit] = index;
+				readers[bit].clear();
+			}
+			else
+			{
+				readers[bit].push_back(index);
+			}
+		}
+
+		if (node.access.bIsMainThread)
+		{
+			mainThreadNodes_.push_back(index);
+		}
+		else if (node.dependencyCount == 0)
+		{
+			sourceNodes_.push_back(index);
+		}
+	}
+}
+
+void TickScheduler::RunNode(uint32_t index, float deltaSeconds)
+{
+	Node& node = nodes_[index];
+
+	auto start = std::chrono::steady_clock::now();
+	if (node.entity)
+	{
+		node.entity->Tick(deltaSeconds);
+	}
+	else
+	{
+		node.function(deltaSeconds);
+	}
+	auto end = std::chrono::steady_clock::now();
+
+	uint64_t nanoseconds = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+	node.lastNanoseconds = nanoseconds;
+	node.maxNanoseconds = nanoseconds > node.maxNanoseconds ? nanoseconds : node.maxNanoseconds;
+
+	if (node.averageNanoseconds == 0)
+	{
+		node.averageNanoseconds = nanoseconds;
+	}
+	else
+	{
+		node.averageNanoseconds = node.averageNanoseconds - (node.averageNanoseconds >> AVERAGE_WEIGHT_SHIFT) + (nanoseconds >> AVERAGE_WEIGHT_SHIFT);
+	}
+}
+
+void TickScheduler::CompleteNode(uint32_t index, float deltaSeconds)
+{
+	for (uint32_t successor : nodes_[index].successors)
+	{
+		//    Tick ȣ 尡      մϴ.
+		if (pendingCounts_[successor].fetch_sub(1, std::memory_order_acq_rel) == 1 && !nodes_[successor].access.bIsMainThread)
+		{
+			ScheduleNode(successor, deltaSeconds);
+		}
+	}
+}
+
+void TickScheduler::ScheduleNode(uint32_t index, float deltaSeconds)
+{
+	JobModule::Schedule(
+		[this, index, deltaSeconds]()
+		{
+			RunNode(index, deltaSeconds);
+			CompleteNode(index, deltaSeconds);
+		},
+		&nodeCounters_[index]
+	);
+}
+
+void TickScheduler::WaitNode(uint32_t index)
+{
+	if (waitedFlags_[index])
+	{
+		return;
+	}
+
+	//       忡 ϹǷ, ٸ  ̹ ϴ.
+	if (!nodes_[index].access.bIsMainThread)
+	{
+		//   尡    ǹǷ,  带  ٷ  īͰ  ڿ ٸ  ֽϴ.
+		for (uint32_t predecessor : nodes_[index].predecessors)
+		{
+			WaitNode(predecessor);
+		}
+
+		JobModule::Wait(nodeCounters_[index]);
+	}
+
+	waitedFlags_[index] = 1;
+}
\ No newline at end of file